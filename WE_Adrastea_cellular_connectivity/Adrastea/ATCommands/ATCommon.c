@@ -0,0 +1,501 @@
+/**
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ **/
+
+/**
+ * @file
+ * @brief Conversion of common AT command types.
+ */
+
+#include <string.h>
+
+#include "ATCommon.h"
+
+/**
+ * @brief Parses count decimal octets separated by dots, which must span the whole string.
+ */
+static bool AdrasteaI_ATCommon_ParseDecimalOctets(const char* p, const char* end, uint8_t* pOut, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (i > 0)
+        {
+            if ((p == end) || (*p != '.'))
+            {
+                return false;
+            }
+            p++;
+        }
+
+        uint16_t value = 0;
+        uint8_t digits = 0;
+        while ((p < end) && (*p >= '0') && (*p <= '9'))
+        {
+            value = value * 10 + (uint16_t)(*p - '0');
+            p++;
+            if ((++digits > 3) || (value > 255))
+            {
+                return false;
+            }
+        }
+        if (digits == 0)
+        {
+            return false;
+        }
+        pOut[i] = (uint8_t)value;
+    }
+
+    return p == end;
+}
+
+/**
+ * @brief Returns the value of a hexadecimal digit (-1 if the character is no hexadecimal digit).
+ */
+static int8_t AdrasteaI_ATCommon_HexDigitValue(char c)
+{
+    if ((c >= '0') && (c <= '9'))
+    {
+        return (int8_t)(c - '0');
+    }
+    if ((c >= 'a') && (c <= 'f'))
+    {
+        return (int8_t)(c - 'a' + 10);
+    }
+    if ((c >= 'A') && (c <= 'F'))
+    {
+        return (int8_t)(c - 'A' + 10);
+    }
+    return -1;
+}
+
+/**
+ * @brief Parses an IPv6 address in colon notation (RFC 4291, including "::" and a trailing dotted IPv4 address).
+ */
+static bool AdrasteaI_ATCommon_ParseIPv6(const char* p, const char* end, uint8_t* pOut)
+{
+    uint8_t count = 0; /* Number of bytes parsed */
+    int8_t gap = -1;   /* Position of "::" */
+
+    if ((end - p >= 2) && (p[0] == ':') && (p[1] == ':'))
+    {
+        gap = 0;
+        p += 2;
+    }
+
+    while (p < end)
+    {
+        const char* groupEnd = p;
+        while ((groupEnd < end) && (*groupEnd != ':') && (*groupEnd != '.'))
+        {
+            groupEnd++;
+        }
+
+        if ((groupEnd < end) && (*groupEnd == '.'))
+        {
+            /* Embedded IPv4 address, must be last */
+            if ((count > 12) || !AdrasteaI_ATCommon_ParseDecimalOctets(p, end, &pOut[count], 4))
+            {
+                return false;
+            }
+            count += 4;
+            p = end;
+            break;
+        }
+
+        if ((groupEnd == p) || (groupEnd - p > 4) || (count > 14))
+        {
+            return false;
+        }
+
+        uint16_t value = 0;
+        for (; p < groupEnd; p++)
+        {
+            int8_t digit = AdrasteaI_ATCommon_HexDigitValue(*p);
+            if (digit < 0)
+            {
+                return false;
+            }
+            value = (uint16_t)((value << 4) | (uint16_t)digit);
+        }
+        pOut[count++] = (uint8_t)(value >> 8);
+        pOut[count++] = (uint8_t)value;
+
+        if (p == end)
+        {
+            break;
+        }
+
+        /* Skip ':', a second one marks the gap */
+        p++;
+        if ((p < end) && (*p == ':'))
+        {
+            if (gap >= 0)
+            {
+                return false;
+            }
+            gap = (int8_t)count;
+            p++;
+        }
+        else if (p == end)
+        {
+            return false;
+        }
+    }
+
+    if (gap < 0)
+    {
+        return count == 16;
+    }
+
+    if (count > 14)
+    {
+        return false;
+    }
+
+    uint8_t tail = count - (uint8_t)gap;
+    memmove(&pOut[16 - tail], &pOut[gap], tail);
+    memset(&pOut[gap], 0, 16 - (uint8_t)gap - tail);
+    return true;
+}
+
+/**
+ * @brief Parses an IP address string.
+ *
+ * Accepts IPv4 addresses in dotted decimal notation, IPv6 addresses in colon notation and IPv6 addresses in the
+ * dotted decimal notation with 16 octets used by 3GPP. Enclosing quotation marks are ignored.
+ *
+ * @param[in] pInString IP address string (does not need to be terminated)
+ * @param[in] length Length of the string
+ * @param[out] addressP Parsed address
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_ATCommon_ParseIPAddress(const char* pInString, uint16_t length, AdrasteaI_ATCommon_IP_Address_t* addressP)
+{
+    if ((pInString == NULL) || (addressP == NULL))
+    {
+        return false;
+    }
+
+    if ((length >= 2) && (pInString[0] == '"') && (pInString[length - 1] == '"'))
+    {
+        pInString++;
+        length -= 2;
+    }
+
+    const char* end = pInString + length;
+    uint8_t dots = 0;
+    bool colon = false;
+    for (const char* p = pInString; p < end; p++)
+    {
+        if (*p == '.')
+        {
+            dots++;
+        }
+        else if (*p == ':')
+        {
+            colon = true;
+        }
+    }
+
+    memset(addressP->bytes, 0, sizeof(addressP->bytes));
+    addressP->family = AdrasteaI_ATCommon_IP_Family_Invalid;
+
+    if (colon)
+    {
+        if (!AdrasteaI_ATCommon_ParseIPv6(pInString, end, addressP->bytes))
+        {
+            return false;
+        }
+        addressP->family = AdrasteaI_ATCommon_IP_Family_IPv6;
+    }
+    else if (dots == 3)
+    {
+        if (!AdrasteaI_ATCommon_ParseDecimalOctets(pInString, end, addressP->bytes, 4))
+        {
+            return false;
+        }
+        addressP->family = AdrasteaI_ATCommon_IP_Family_IPv4;
+    }
+    else if (dots == 15)
+    {
+        if (!AdrasteaI_ATCommon_ParseDecimalOctets(pInString, end, addressP->bytes, 16))
+        {
+            return false;
+        }
+        addressP->family = AdrasteaI_ATCommon_IP_Family_IPv6;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Appends a number in decimal notation, returns the new end of the string.
+ */
+static char* AdrasteaI_ATCommon_AppendDecimal(char* p, uint16_t value)
+{
+    char digits[5];
+    uint8_t count = 0;
+    do
+    {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+
+    while (count > 0)
+    {
+        *p++ = digits[--count];
+    }
+    return p;
+}
+
+/**
+ * @brief Formats an IP address as string.
+ *
+ * IPv4 addresses are formatted in dotted decimal notation, IPv6 addresses in colon notation as recommended by
+ * RFC 5952 (lower case, longest run of zero groups replaced by "::").
+ *
+ * @param[in] addressP IP address
+ * @param[out] pOutString IP address string
+ * @param[in] maxLength Max. length of string (including termination character), ADRASTEAI_ATCOMMON_IP_ADDRESS_STRING_SIZE is always sufficient
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_ATCommon_FormatIPAddress(const AdrasteaI_ATCommon_IP_Address_t* addressP, char* pOutString, uint16_t maxLength)
+{
+    if ((addressP == NULL) || (pOutString == NULL))
+    {
+        return false;
+    }
+
+    char text[ADRASTEAI_ATCOMMON_IP_ADDRESS_STRING_SIZE];
+    char* p = text;
+
+    switch (addressP->family)
+    {
+        case AdrasteaI_ATCommon_IP_Family_IPv4:
+        {
+            for (uint8_t i = 0; i < 4; i++)
+            {
+                if (i > 0)
+                {
+                    *p++ = '.';
+                }
+                p = AdrasteaI_ATCommon_AppendDecimal(p, addressP->bytes[i]);
+            }
+            break;
+        }
+        case AdrasteaI_ATCommon_IP_Family_IPv6:
+        {
+            static const char hexDigits[] = "0123456789abcdef";
+
+            /* Find the longest run of at least two zero groups */
+            int8_t gapStart = -1;
+            uint8_t gapLength = 1;
+            for (uint8_t i = 0; i < 8;)
+            {
+                uint8_t j = i;
+                while ((j < 8) && (addressP->bytes[2 * j] == 0) && (addressP->bytes[2 * j + 1] == 0))
+                {
+                    j++;
+                }
+                if (j - i > gapLength)
+                {
+                    gapStart = (int8_t)i;
+                    gapLength = j - i;
+                }
+                i = (j > i) ? j : i + 1;
+            }
+
+            for (uint8_t i = 0; i < 8; i++)
+            {
+                if ((int8_t)i == gapStart)
+                {
+                    *p++ = ':';
+                    *p++ = ':';
+                    i += gapLength - 1;
+                    continue;
+                }
+                if ((i > 0) && ((int8_t)i != gapStart + gapLength))
+                {
+                    *p++ = ':';
+                }
+
+                uint16_t group = (uint16_t)((addressP->bytes[2 * i] << 8) | addressP->bytes[2 * i + 1]);
+                bool leading = true;
+                for (int8_t shift = 12; shift >= 0; shift -= 4)
+                {
+                    uint8_t digit = (group >> shift) & 0x0F;
+                    if (leading && (digit == 0) && (shift > 0))
+                    {
+                        continue;
+                    }
+                    leading = false;
+                    *p++ = hexDigits[digit];
+                }
+            }
+            break;
+        }
+        default:
+            return false;
+    }
+
+    uint16_t length = (uint16_t)(p - text);
+    if (length + 1 > maxLength)
+    {
+        return false;
+    }
+
+    memcpy(pOutString, text, length);
+    pOutString[length] = '\0';
+    return true;
+}
+
+/**
+ * @brief Formats an IP address and port as string ("192.0.2.1:80" or "[2001:db8::1]:80").
+ *
+ * @param[in] endpointP Endpoint
+ * @param[out] pOutString Endpoint string
+ * @param[in] maxLength Max. length of string (including termination character), ADRASTEAI_ATCOMMON_IP_ENDPOINT_STRING_SIZE is always sufficient
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_ATCommon_FormatIPEndpoint(const AdrasteaI_ATCommon_IP_Endpoint_t* endpointP, char* pOutString, uint16_t maxLength)
+{
+    if ((endpointP == NULL) || (pOutString == NULL))
+    {
+        return false;
+    }
+
+    char text[ADRASTEAI_ATCOMMON_IP_ENDPOINT_STRING_SIZE];
+    char* p = text;
+    bool ipv6 = (endpointP->address.family == AdrasteaI_ATCommon_IP_Family_IPv6);
+
+    if (ipv6)
+    {
+        *p++ = '[';
+    }
+    if (!AdrasteaI_ATCommon_FormatIPAddress(&endpointP->address, p, ADRASTEAI_ATCOMMON_IP_ADDRESS_STRING_SIZE))
+    {
+        return false;
+    }
+    p += strlen(p);
+    if (ipv6)
+    {
+        *p++ = ']';
+    }
+    *p++ = ':';
+    p = AdrasteaI_ATCommon_AppendDecimal(p, endpointP->port);
+    *p = '\0';
+
+
+    uint16_t length = (uint16_t)(p - text);
+    if (length + 1 > maxLength)
+    {
+        return false;
+    }
+
+    memcpy(pOutString, text, length + 1);
+    return true;
+}
+
+/**
+ * @brief Parses an IP address argument, which may be empty (no address reported).
+ */
+static bool AdrasteaI_ATCommon_ParseIPAddressArgument(const char* pInString, uint16_t length, AdrasteaI_ATCommon_IP_Address_t* addressP)
+{
+    if ((length == 0) || ((length == 2) && (pInString[0] == '"') && (pInString[1] == '"')))
+    {
+        memset(addressP->bytes, 0, sizeof(addressP->bytes));
+        addressP->family = AdrasteaI_ATCommon_IP_Family_Invalid;
+        return true;
+    }
+
+    return AdrasteaI_ATCommon_ParseIPAddress(pInString, length, addressP);
+}
+
+/**
+ * @brief Gets the next argument as IP address, without copying it to an intermediate string.
+ *
+ * An empty argument results in an address of family AdrasteaI_ATCommon_IP_Family_Invalid.
+ *
+ * @param[in,out] pInArguments Argument string, set to the start of the next argument
+ * @param[out] addressP Parsed address
+ * @param[in] delimiter Delimiter after the argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_ATCommon_GetNextArgumentIPAddress(char** pInArguments, AdrasteaI_ATCommon_IP_Address_t* addressP, char delimiter)
+{
+    if ((pInArguments == NULL) || (*pInArguments == NULL) || (addressP == NULL))
+    {
+        return false;
+    }
+
+    char* pArgument = *pInArguments;
+    uint16_t length = 0;
+    bool quoted = false;
+    while ((pArgument[length] != '\0') && (quoted || (pArgument[length] != delimiter)))
+    {
+        if (pArgument[length] == '"')
+        {
+            quoted = !quoted;
+        }
+        length++;
+    }
+
+    if ((pArgument[length] != delimiter) || !AdrasteaI_ATCommon_ParseIPAddressArgument(pArgument, length, addressP))
+    {
+        return false;
+    }
+
+    *pInArguments = (delimiter == '\0') ? &pArgument[length] : &pArgument[length + 1];
+    return true;
+}
+
+/**
+ * @brief Gets an IP address argument from a tokenized argument string, without copying it to an intermediate string.
+ *
+ * An empty argument results in an address of family AdrasteaI_ATCommon_IP_Family_Invalid.
+ *
+ * @param[in] pArguments Argument index created by ATCommand_TokenizeArguments()
+ * @param[in] index Index of the argument to get
+ * @param[out] addressP Parsed address
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_ATCommon_GetArgumentIPAddress(const ATCommand_Arguments_t* pArguments, uint8_t index, AdrasteaI_ATCommon_IP_Address_t* addressP)
+{
+    if ((pArguments == NULL) || (index >= pArguments->count) || (addressP == NULL))
+    {
+        return false;
+    }
+
+    const ATCommand_Argument_t* argumentP = &pArguments->arguments[index];
+    return AdrasteaI_ATCommon_ParseIPAddressArgument(&pArguments->pString[argumentP->offset], argumentP->length, addressP);
+}
@@ -34,6 +34,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "ATCommands.h"
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -82,7 +84,21 @@ extern "C"
         uint16_t Year;
     } AdrasteaI_ATCommon_Date_t;
 
+#ifdef ADRASTEAI_FIXED_POINT
+    /**
+ * @brief Position in fixed point representation (enabled by defining ADRASTEAI_FIXED_POINT for all driver sources).
+ *
+ * Latitude and longitude are stored in micro degrees (1e-6 degree), altitude in millimetres.
+ * Values are rounded to this precision and otherwise match the double representation.
+ */
+    typedef int32_t AdrasteaI_ATCommon_Latitude_t, AdrasteaI_ATCommon_Longitude_t, AdrasteaI_ATCommon_Altitude_t;
+
+#define AdrasteaI_ATCommon_Coordinate_Decimals 6
+
+#define AdrasteaI_ATCommon_Altitude_Decimals 3
+#else
     typedef double AdrasteaI_ATCommon_Latitude_t, AdrasteaI_ATCommon_Longitude_t, AdrasteaI_ATCommon_Altitude_t;
+#endif
 
     typedef uint64_t AdrasteaI_ATCommon_UTC_Timestamp_t;
 
@@ -118,12 +134,62 @@ extern "C"
 
 #define AdrasteaI_ATCommon_Port_Number_Invalid 0
 
+/**
+ * @brief Max. length of an IP address string created by AdrasteaI_ATCommon_FormatIPAddress() (including termination character).
+ */
+#define ADRASTEAI_ATCOMMON_IP_ADDRESS_STRING_SIZE 46
+
+/**
+ * @brief Max. length of an endpoint string created by AdrasteaI_ATCommon_FormatIPEndpoint() (including termination character).
+ */
+#define ADRASTEAI_ATCOMMON_IP_ENDPOINT_STRING_SIZE 54
+
+    /**
+ * @brief IP Address Family
+ */
+    typedef enum AdrasteaI_ATCommon_IP_Family_t
+    {
+        AdrasteaI_ATCommon_IP_Family_Invalid = -1,
+        AdrasteaI_ATCommon_IP_Family_IPv4,
+        AdrasteaI_ATCommon_IP_Family_IPv6,
+        AdrasteaI_ATCommon_IP_Family_NumberOfValues
+    } AdrasteaI_ATCommon_IP_Family_t;
+
+    /**
+ * @brief IP address in binary representation, as reported by the module.
+ * @see AdrasteaI_ATCommon_ParseIPAddress(), AdrasteaI_ATCommon_FormatIPAddress()
+ */
+    typedef struct AdrasteaI_ATCommon_IP_Address_t
+    {
+        int8_t family;     /**< See AdrasteaI_ATCommon_IP_Family_t (AdrasteaI_ATCommon_IP_Family_Invalid if no address has been reported) */
+        uint8_t bytes[16]; /**< Address in network byte order (IPv4 uses the first four bytes) */
+    } AdrasteaI_ATCommon_IP_Address_t;
+
+    /**
+ * @brief IP address and port.
+ */
+    typedef struct AdrasteaI_ATCommon_IP_Endpoint_t
+    {
+        AdrasteaI_ATCommon_IP_Address_t address;
+        AdrasteaI_ATCommon_Port_Number_t port;
+    } AdrasteaI_ATCommon_IP_Endpoint_t;
+
     typedef uint8_t AdrasteaI_ATCommon_Session_ID_t;
 
 #define AdrasteaI_ATCommon_Session_ID_Invalid 0
 
     typedef char AdrasteaI_ATCommon_APN_Name_t[64];
 
+    extern bool AdrasteaI_ATCommon_ParseIPAddress(const char* pInString, uint16_t length, AdrasteaI_ATCommon_IP_Address_t* addressP);
+
+    extern bool AdrasteaI_ATCommon_FormatIPAddress(const AdrasteaI_ATCommon_IP_Address_t* addressP, char* pOutString, uint16_t maxLength);
+
+    extern bool AdrasteaI_ATCommon_FormatIPEndpoint(const AdrasteaI_ATCommon_IP_Endpoint_t* endpointP, char* pOutString, uint16_t maxLength);
+
+    extern bool AdrasteaI_ATCommon_GetNextArgumentIPAddress(char** pInArguments, AdrasteaI_ATCommon_IP_Address_t* addressP, char delimiter);
+
+    extern bool AdrasteaI_ATCommon_GetArgumentIPAddress(const ATCommand_Arguments_t* pArguments, uint8_t index, AdrasteaI_ATCommon_IP_Address_t* addressP);
+
 #ifdef __cplusplus
 }
 #endif
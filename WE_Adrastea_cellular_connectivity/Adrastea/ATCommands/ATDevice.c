@@ -35,10 +35,55 @@
 #include "global.h"
 
 
-static const char* AdrasteaI_ATDevice_Character_Set_Strings[AdrasteaI_ATDevice_Character_Set_NumberOfValues] = {
-    "UCS2", "8859-1", "IRA", "HEX", "PCCP437",
+#define AdrasteaI_ATDevice_Character_Set_Entries(ENTRY)        \
+    ENTRY("HEX", AdrasteaI_ATDevice_Character_Set_HEX)         \
+    ENTRY("IRA", AdrasteaI_ATDevice_Character_Set_IRA)         \
+    ENTRY("UCS2", AdrasteaI_ATDevice_Character_Set_UCS2)       \
+    ENTRY("8859-1", AdrasteaI_ATDevice_Character_Set_8859n)    \
+    ENTRY("PCCP437", AdrasteaI_ATDevice_Character_Set_PCCP437)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATDevice_Character_Set_Strings, AdrasteaI_ATDevice_Character_Set_NumberOfValues, AdrasteaI_ATDevice_Character_Set_Entries);
+
+/**
+ * @brief Request of AdrasteaI_ATDevice_SetTECharacterSet().
+ */
+typedef struct AdrasteaI_ATDevice_Character_Set_Request_t
+{
+    AdrasteaI_ATDevice_Character_Set_t charset;
+} AdrasteaI_ATDevice_Character_Set_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATDevice_Character_Set_Request_Fields[] = {
+    ATCOMMAND_FIELD_ENUMSTRING_QUOTATIONMARKS(AdrasteaI_ATDevice_Character_Set_Request_t, charset, &AdrasteaI_ATDevice_Character_Set_Strings),
+};
+
+/**
+ * @brief Request of AdrasteaI_ATDevice_SetResultCodeFormat().
+ */
+typedef struct AdrasteaI_ATDevice_Result_Code_Format_Request_t
+{
+    AdrasteaI_ATDevice_Result_Code_Format_t format;
+} AdrasteaI_ATDevice_Result_Code_Format_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATDevice_Result_Code_Format_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATDevice_Result_Code_Format_Request_t, format, ATCOMMAND_INTFLAGS_UNSIGNED),
 };
 
+/**
+ * @brief Device commands with fixed argument layout, see AdrasteaI_Command_t.
+ */
+#define ADRASTEAI_ATDEVICE_COMMANDS(COMMAND)                                                                                                                                          \
+    COMMAND(AdrasteaI_ATDevice_Command_Test, "AT", Device, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_NO_FIELDS)                                                                  \
+    COMMAND(AdrasteaI_ATDevice_Command_Reset, "ATZ", Device, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_NO_FIELDS)                                                                \
+    COMMAND(AdrasteaI_ATDevice_Command_FactoryReset, "AT&F0", Device, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_NO_FIELDS)                                                       \
+    COMMAND(AdrasteaI_ATDevice_Command_SetTECharacterSet, "AT+CSCS=", Device, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATDevice_Character_Set_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS) \
+    COMMAND(AdrasteaI_ATDevice_Command_SetResultCodeFormat, "ATV", Device, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATDevice_Result_Code_Format_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)
+
+typedef enum AdrasteaI_ATDevice_Command_t
+{
+    ADRASTEAI_ATDEVICE_COMMANDS(ADRASTEAI_COMMAND_ID) AdrasteaI_ATDevice_Command_NumberOfValues
+} AdrasteaI_ATDevice_Command_t;
+
+static const AdrasteaI_Command_t AdrasteaI_ATDevice_Commands[AdrasteaI_ATDevice_Command_NumberOfValues] = {ADRASTEAI_ATDEVICE_COMMANDS(ADRASTEAI_COMMAND_DESCRIPTOR)};
+
 /**
  * @brief Tests the connection to the wireless module (using the AT command).
  *
@@ -46,17 +91,7 @@ static const char* AdrasteaI_ATDevice_Character_Set_Strings[AdrasteaI_ATDevice_C
  */
 bool AdrasteaI_ATDevice_Test()
 {
-    if (!AdrasteaI_SendRequest("AT\r\n"))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATDevice_Commands[AdrasteaI_ATDevice_Command_Test], NULL, NULL);
 }
 
 /**
@@ -68,29 +103,34 @@ bool AdrasteaI_ATDevice_Test()
  */
 bool AdrasteaI_ATDevice_RequestManufacturerIdentity(AdrasteaI_ATDevice_Manufacturer_Identity_t* manufacturerIdentityP)
 {
-    if (manufacturerIdentityP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (manufacturerIdentityP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CGMI\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Device, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentString(&pResponseCommand, (char*)*manufacturerIdentityP, ATCOMMAND_STRING_TERMINATE, sizeof(*manufacturerIdentityP)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -102,29 +142,34 @@ bool AdrasteaI_ATDevice_RequestManufacturerIdentity(AdrasteaI_ATDevice_Manufactu
  */
 bool AdrasteaI_ATDevice_RequestModelIdentity(AdrasteaI_ATDevice_Model_Identity_t* modelIdentityP)
 {
-    if (modelIdentityP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (modelIdentityP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CGMM\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Device, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentString(&pResponseCommand, (char*)*modelIdentityP, ATCOMMAND_STRING_TERMINATE, sizeof(*modelIdentityP)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -136,39 +181,44 @@ bool AdrasteaI_ATDevice_RequestModelIdentity(AdrasteaI_ATDevice_Model_Identity_t
  */
 bool AdrasteaI_ATDevice_RequestRevisionIdentity(AdrasteaI_ATDevice_Revision_Identity_t* revisionIdentityP)
 {
-    if (revisionIdentityP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (revisionIdentityP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CGMR\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Device, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentString(&pResponseCommand, pResponseCommand, '_', sizeof(AT_commandBuffer)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &revisionIdentityP->major, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, '.'))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &revisionIdentityP->minor, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -180,29 +230,34 @@ bool AdrasteaI_ATDevice_RequestRevisionIdentity(AdrasteaI_ATDevice_Revision_Iden
  */
 bool AdrasteaI_ATDevice_RequestIMEI(AdrasteaI_ATDevice_IMEI_t* imeiP)
 {
-    if (imeiP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (imeiP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CGSN=1\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Device, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, (char*)*imeiP, ATCOMMAND_STRING_TERMINATE, sizeof(*imeiP)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -214,29 +269,34 @@ bool AdrasteaI_ATDevice_RequestIMEI(AdrasteaI_ATDevice_IMEI_t* imeiP)
  */
 bool AdrasteaI_ATDevice_RequestIMEISV(AdrasteaI_ATDevice_IMEISV_t* imeisvP)
 {
-    if (imeisvP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (imeisvP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CGSN=2\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Device, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, (char*)*imeisvP, ATCOMMAND_STRING_TERMINATE, sizeof(*imeisvP)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -248,29 +308,34 @@ bool AdrasteaI_ATDevice_RequestIMEISV(AdrasteaI_ATDevice_IMEISV_t* imeisvP)
  */
 bool AdrasteaI_ATDevice_RequestSVN(AdrasteaI_ATDevice_SVN_t* svnP)
 {
-    if (svnP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (svnP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CGSN=3\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Device, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, (char*)*svnP, ATCOMMAND_STRING_TERMINATE, sizeof(*svnP)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -282,29 +347,34 @@ bool AdrasteaI_ATDevice_RequestSVN(AdrasteaI_ATDevice_SVN_t* svnP)
  */
 bool AdrasteaI_ATDevice_RequestSerialNumber(AdrasteaI_ATDevice_Serial_Number_t* serialNumberP)
 {
-    if (serialNumberP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (serialNumberP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+GSN\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Device, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentString(&pResponseCommand, (char*)*serialNumberP, ATCOMMAND_STRING_TERMINATE, sizeof(*serialNumberP)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -316,31 +386,36 @@ bool AdrasteaI_ATDevice_RequestSerialNumber(AdrasteaI_ATDevice_Serial_Number_t*
  */
 bool AdrasteaI_ATDevice_GetTECharacterSet(AdrasteaI_ATDevice_Character_Set_t* charsetP)
 {
-    if (charsetP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (charsetP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CSCS?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Device, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
-    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)charsetP, AdrasteaI_ATDevice_Character_Set_Strings, AdrasteaI_ATDevice_Character_Set_NumberOfValues, 30, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)charsetP, &AdrasteaI_ATDevice_Character_Set_Strings, 30, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -352,31 +427,9 @@ bool AdrasteaI_ATDevice_GetTECharacterSet(AdrasteaI_ATDevice_Character_Set_t* ch
  */
 bool AdrasteaI_ATDevice_SetTECharacterSet(AdrasteaI_ATDevice_Character_Set_t charset)
 {
-    char* pRequestCommand = AT_commandBuffer;
+    AdrasteaI_ATDevice_Character_Set_Request_t request = {.charset = charset};
 
-    strcpy(pRequestCommand, "AT+CSCS=");
-
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATDevice_Character_Set_Strings[charset], ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATDevice_Commands[AdrasteaI_ATDevice_Command_SetTECharacterSet], &request, NULL);
 }
 
 /**
@@ -390,31 +443,36 @@ bool AdrasteaI_ATDevice_SetTECharacterSet(AdrasteaI_ATDevice_Character_Set_t cha
  */
 bool AdrasteaI_ATDevice_GetCapabilitiesList(char* capListP, uint8_t maxBufferSize)
 {
-    if (capListP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (capListP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+GCAP\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Device, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
     if (!ATCommand_GetNextArgumentString(&pResponseCommand, capListP, ATCOMMAND_STRING_TERMINATE, maxBufferSize))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -426,31 +484,36 @@ bool AdrasteaI_ATDevice_GetCapabilitiesList(char* capListP, uint8_t maxBufferSiz
  */
 bool AdrasteaI_ATDevice_GetPhoneFunctionality(AdrasteaI_ATDevice_Phone_Functionality_t* phoneFunP)
 {
-    if (phoneFunP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (phoneFunP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CFUN?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Device, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand = pResponseCommand + 1;
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, phoneFunP, (ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -464,6 +527,11 @@ bool AdrasteaI_ATDevice_GetPhoneFunctionality(AdrasteaI_ATDevice_Phone_Functiona
  */
 bool AdrasteaI_ATDevice_SetPhoneFunctionality(AdrasteaI_ATDevice_Phone_Functionality_t phoneFun, AdrasteaI_ATDevice_Phone_Functionality_Reset_t resetType)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -472,14 +540,14 @@ bool AdrasteaI_ATDevice_SetPhoneFunctionality(AdrasteaI_ATDevice_Phone_Functiona
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, phoneFun, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (resetType != AdrasteaI_ATDevice_Phone_Functionality_Reset_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, resetType, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -488,20 +556,20 @@ bool AdrasteaI_ATDevice_SetPhoneFunctionality(AdrasteaI_ATDevice_Phone_Functiona
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Device, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -511,17 +579,7 @@ bool AdrasteaI_ATDevice_SetPhoneFunctionality(AdrasteaI_ATDevice_Phone_Functiona
  */
 bool AdrasteaI_ATDevice_Reset()
 {
-    if (!AdrasteaI_SendRequest("ATZ\r\n"))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATDevice_Commands[AdrasteaI_ATDevice_Command_Reset], NULL, NULL);
 }
 
 /**
@@ -531,12 +589,7 @@ bool AdrasteaI_ATDevice_Reset()
  */
 bool AdrasteaI_ATDevice_FactoryReset()
 {
-    if (!AdrasteaI_SendRequest("AT&F0\r\n"))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_ExecuteCommand(&AdrasteaI_ATDevice_Commands[AdrasteaI_ATDevice_Command_FactoryReset], NULL, NULL))
     {
         return false;
     }
@@ -562,29 +615,7 @@ bool AdrasteaI_ATDevice_FactoryReset()
  */
 bool AdrasteaI_ATDevice_SetResultCodeFormat(AdrasteaI_ATDevice_Result_Code_Format_t format)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "ATV");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
+    AdrasteaI_ATDevice_Result_Code_Format_Request_t request = {.format = format};
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Device), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATDevice_Commands[AdrasteaI_ATDevice_Command_SetResultCodeFormat], &request, NULL);
 }
@@ -59,12 +59,14 @@ static const ATCommand_Event_t moduleMainEvents[] = {EVENTENTRY("+COPN", Adraste
 bool AdrasteaI_ATEvent_ParseEventType(char** pAtCommand, AdrasteaI_ATEvent_t* pEvent)
 {
     char delimiters[] = {ATCOMMAND_EVENT_DELIM, ATCOMMAND_STRING_TERMINATE};
+    uint16_t event;
 
-    if (!ATCommand_ParseEventType(pAtCommand, moduleMainEvents, delimiters, sizeof(delimiters), (uint16_t*)pEvent))
+    if (!ATCommand_ParseEventType(pAtCommand, moduleMainEvents, delimiters, sizeof(delimiters), &event))
     {
         *pEvent = AdrasteaI_ATEvent_Invalid;
         return false;
     }
 
+    *pEvent = (AdrasteaI_ATEvent_t)event;
     return true;
 }
@@ -34,30 +34,111 @@
 #include "ATCommands.h"
 
 
-static const char* AdrasteaI_ATGNSS_Satellite_Systems_Strings[AdrasteaI_ATGNSS_Satellite_Systems_Strings_NumberOfValues] = {
-    "GPS",
-    "GLONASS",
-};
+#define AdrasteaI_ATGNSS_Satellite_Systems_Entries(ENTRY) \
+    ENTRY("GPS", 0)                                       \
+    ENTRY("GLONASS", 1)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATGNSS_Satellite_Systems_Strings, AdrasteaI_ATGNSS_Satellite_Systems_Strings_NumberOfValues, AdrasteaI_ATGNSS_Satellite_Systems_Entries);
+
+#define AdrasteaI_ATGNSS_NMEA_Sentences_Entries(ENTRY) \
+    ENTRY("GGA", 0)                                    \
+    ENTRY("GLL", 1)                                    \
+    ENTRY("GNS", 4)                                    \
+    ENTRY("GSA", 2)                                    \
+    ENTRY("GST", 9)                                    \
+    ENTRY("GSV", 3)                                    \
+    ENTRY("RMC", 5)                                    \
+    ENTRY("VTG", 7)                                    \
+    ENTRY("ZDA", 8)                                    \
+    ENTRY("PIDX", 6)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATGNSS_NMEA_Sentences_Strings, AdrasteaI_ATGNSS_NMEA_Sentences_Strings_NumberOfValues, AdrasteaI_ATGNSS_NMEA_Sentences_Entries);
+
+#define AdrasteaI_ATGNSS_Ephemeris_Entries(ENTRY) \
+    ENTRY("B", AdrasteaI_ATGNSS_Ephemeris_BEP)    \
+    ENTRY("C", AdrasteaI_ATGNSS_Ephemeris_CEP)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATGNSS_Ephemeris_Strings, AdrasteaI_ATGNSS_Ephemeris_NumberOfValues, AdrasteaI_ATGNSS_Ephemeris_Entries);
+
+#define AdrasteaI_ATGNSS_Event_Entries(ENTRY)                          \
+    ENTRY("NMEA", AdrasteaI_ATGNSS_Event_NMEA)                         \
+    ENTRY("ALLOWSTAT", AdrasteaI_ATGNSS_Event_Allowed_Status_Change)   \
+    ENTRY("SESSIONSTAT", AdrasteaI_ATGNSS_Event_Session_Status_Change)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATGNSS_Event_Strings, AdrasteaI_ATGNSS_Event_NumberOfValues, AdrasteaI_ATGNSS_Event_Entries);
+
+#define AdrasteaI_ATGNSS_Deletion_Option_Entries(ENTRY)       \
+    ENTRY("0", AdrasteaI_ATGNSS_Deletion_Option_All)          \
+    ENTRY("0001", AdrasteaI_ATGNSS_Deletion_Option_Ephemeris) \
+    ENTRY("0002", AdrasteaI_ATGNSS_Deletion_Option_Almanac)   \
+    ENTRY("0004", AdrasteaI_ATGNSS_Deletion_Option_Position)  \
+    ENTRY("0008", AdrasteaI_ATGNSS_Deletion_Option_Time)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATGNSS_Deletion_Option_Strings, AdrasteaI_ATGNSS_Deletion_Option_NumberOfValues, AdrasteaI_ATGNSS_Deletion_Option_Entries);
+
+/**
+ * @brief Request of AdrasteaI_ATGNSS_StartGNSSWithTolerance().
+ */
+typedef struct AdrasteaI_ATGNSS_Tolerance_Request_t
+{
+    AdrasteaI_ATGNSS_Tolerance_t tolerance;
+} AdrasteaI_ATGNSS_Tolerance_Request_t;
 
-static const char* AdrasteaI_ATGNSS_NMEA_Sentences_Strings[AdrasteaI_ATGNSS_NMEA_Sentences_Strings_NumberOfValues] = {
-    "GGA", "GLL", "GSA", "GSV", "GNS", "RMC", "PIDX", "VTG", "ZDA", "GST",
+static const ATCommand_Field_t AdrasteaI_ATGNSS_Tolerance_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATGNSS_Tolerance_Request_t, tolerance, ATCOMMAND_INTFLAGS_UNSIGNED),
 };
 
-static const char* AdrasteaI_ATGNSS_Ephemeris_Strings[AdrasteaI_ATGNSS_Ephemeris_NumberOfValues] = {
-    "B",
-    "C",
+/**
+ * @brief Request of AdrasteaI_ATGNSS_SetGNSSUnsolicitedNotificationEvents().
+ */
+typedef struct AdrasteaI_ATGNSS_Event_Request_t
+{
+    AdrasteaI_ATGNSS_Event_t event;
+    AdrasteaI_ATCommon_Event_State_t state;
+} AdrasteaI_ATGNSS_Event_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATGNSS_Event_Request_Fields[] = {
+    ATCOMMAND_FIELD_ENUMSTRING_QUOTATIONMARKS(AdrasteaI_ATGNSS_Event_Request_t, event, &AdrasteaI_ATGNSS_Event_Strings),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATGNSS_Event_Request_t, state, ATCOMMAND_INTFLAGS_UNSIGNED),
 };
 
-static const char* AdrasteaI_ATGNSS_Event_Strings[AdrasteaI_ATGNSS_Event_NumberOfValues] = {
-    "NMEA",
-    "SESSIONSTAT",
-    "ALLOWSTAT",
+/**
+ * @brief Request of AdrasteaI_ATGNSS_DeleteData().
+ */
+typedef struct AdrasteaI_ATGNSS_Deletion_Option_Request_t
+{
+    AdrasteaI_ATGNSS_Deletion_Option_t deleteOption;
+} AdrasteaI_ATGNSS_Deletion_Option_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATGNSS_Deletion_Option_Request_Fields[] = {
+    ATCOMMAND_FIELD_ENUMSTRING_QUOTATIONMARKS(AdrasteaI_ATGNSS_Deletion_Option_Request_t, deleteOption, &AdrasteaI_ATGNSS_Deletion_Option_Strings),
 };
 
-static const char* AdrasteaI_ATGNSS_Deletion_Option_Strings[AdrasteaI_ATGNSS_Deletion_Option_NumberOfValues] = {
-    "0", "0001", "0002", "0004", "0008",
+/**
+ * @brief Request of AdrasteaI_ATGNSS_DownloadCEPFile().
+ */
+typedef struct AdrasteaI_ATGNSS_CEP_Download_Request_t
+{
+    AdrasteaI_ATGNSS_CEP_Number_of_Days_t numDays;
+} AdrasteaI_ATGNSS_CEP_Download_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATGNSS_CEP_Download_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATGNSS_CEP_Download_Request_t, numDays, ATCOMMAND_INTFLAGS_UNSIGNED),
 };
 
+/**
+ * @brief GNSS commands with fixed argument layout, see AdrasteaI_Command_t.
+ */
+#define ADRASTEAI_ATGNSS_COMMANDS(COMMAND)                                                                                                                                                    \
+    COMMAND(AdrasteaI_ATGNSS_Command_StopGNSS, "AT%IGNSSACT=0", GNSS, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_NO_FIELDS)                                                               \
+    COMMAND(AdrasteaI_ATGNSS_Command_StartGNSSWithTolerance, "AT%IGNSSACT=2,", GNSS, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATGNSS_Tolerance_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)        \
+    COMMAND(AdrasteaI_ATGNSS_Command_SetGNSSUnsolicitedNotificationEvents, "AT%IGNSSEV=", GNSS, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATGNSS_Event_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS) \
+    COMMAND(AdrasteaI_ATGNSS_Command_DeleteData, "AT%IGNSSMEM=\"ERASE\",", GNSS, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATGNSS_Deletion_Option_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)      \
+    COMMAND(AdrasteaI_ATGNSS_Command_DownloadCEPFile, "AT%IGNSSCEP=\"DLD\",", GNSS, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATGNSS_CEP_Download_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)      \
+    COMMAND(AdrasteaI_ATGNSS_Command_EraseCEPFile, "AT%IGNSSCEP=\"ERASE\"", GNSS, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_NO_FIELDS)
+
+typedef enum AdrasteaI_ATGNSS_Command_t
+{
+    ADRASTEAI_ATGNSS_COMMANDS(ADRASTEAI_COMMAND_ID) AdrasteaI_ATGNSS_Command_NumberOfValues
+} AdrasteaI_ATGNSS_Command_t;
+
+static const AdrasteaI_Command_t AdrasteaI_ATGNSS_Commands[AdrasteaI_ATGNSS_Command_NumberOfValues] = {ADRASTEAI_ATGNSS_COMMANDS(ADRASTEAI_COMMAND_DESCRIPTOR)};
+
 /**
  * @brief Stop GNSS (using the AT%IGNSSACT command).
  *
@@ -65,17 +146,7 @@ static const char* AdrasteaI_ATGNSS_Deletion_Option_Strings[AdrasteaI_ATGNSS_Del
  */
 bool AdrasteaI_ATGNSS_StopGNSS()
 {
-    if (!AdrasteaI_SendRequest("AT%IGNSSACT=0\r\n"))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATGNSS_Commands[AdrasteaI_ATGNSS_Command_StopGNSS], NULL, NULL);
 }
 
 /**
@@ -87,6 +158,11 @@ bool AdrasteaI_ATGNSS_StopGNSS()
  */
 bool AdrasteaI_ATGNSS_StartGNSS(AdrasteaI_ATGNSS_Start_Mode_t startMode)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -97,7 +173,7 @@ bool AdrasteaI_ATGNSS_StartGNSS(AdrasteaI_ATGNSS_Start_Mode_t startMode)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, startMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -106,20 +182,20 @@ bool AdrasteaI_ATGNSS_StartGNSS(AdrasteaI_ATGNSS_Start_Mode_t startMode)
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_GNSS, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -131,31 +207,9 @@ bool AdrasteaI_ATGNSS_StartGNSS(AdrasteaI_ATGNSS_Start_Mode_t startMode)
  */
 bool AdrasteaI_ATGNSS_StartGNSSWithTolerance(AdrasteaI_ATGNSS_Tolerance_t tolerance)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%IGNSSACT=2,");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, tolerance, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
+    AdrasteaI_ATGNSS_Tolerance_Request_t request = {.tolerance = tolerance};
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATGNSS_Commands[AdrasteaI_ATGNSS_Command_StartGNSSWithTolerance], &request, NULL);
 }
 
 /**
@@ -167,29 +221,34 @@ bool AdrasteaI_ATGNSS_StartGNSSWithTolerance(AdrasteaI_ATGNSS_Tolerance_t tolera
  */
 bool AdrasteaI_ATGNSS_ReadGNSSActiveMode(AdrasteaI_ATGNSS_Active_Mode_t* activeModeP)
 {
-    if (activeModeP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (activeModeP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%IGNSSACT?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_GNSS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, activeModeP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -201,6 +260,11 @@ bool AdrasteaI_ATGNSS_ReadGNSSActiveMode(AdrasteaI_ATGNSS_Active_Mode_t* activeM
  */
 bool AdrasteaI_ATGNSS_SetSatelliteSystems(AdrasteaI_ATGNSS_Satellite_Systems_t satSystems)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -211,9 +275,9 @@ bool AdrasteaI_ATGNSS_SetSatelliteSystems(AdrasteaI_ATGNSS_Satellite_Systems_t s
     {
         if ((satSystems.satSystemsStates & (AdrasteaI_ATGNSS_Runtime_Mode_State_Set << i)) >> i)
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_Satellite_Systems_Strings[i], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_Satellite_Systems_Strings.strings[i], ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
         }
     }
@@ -222,20 +286,20 @@ bool AdrasteaI_ATGNSS_SetSatelliteSystems(AdrasteaI_ATGNSS_Satellite_Systems_t s
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_GNSS, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -247,21 +311,26 @@ bool AdrasteaI_ATGNSS_SetSatelliteSystems(AdrasteaI_ATGNSS_Satellite_Systems_t s
  */
 bool AdrasteaI_ATGNSS_GetSatelliteSystems(AdrasteaI_ATGNSS_Satellite_Systems_t* satSystemsP)
 {
-    if (satSystemsP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (satSystemsP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%IGNSSCFG=\"GET\",\"SAT\"\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_GNSS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
@@ -275,23 +344,23 @@ bool AdrasteaI_ATGNSS_GetSatelliteSystems(AdrasteaI_ATGNSS_Satellite_Systems_t*
         uint8_t satSystem;
         if (i == argscount - 1)
         {
-            if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, &satSystem, AdrasteaI_ATGNSS_Satellite_Systems_Strings, AdrasteaI_ATGNSS_Satellite_Systems_Strings_NumberOfValues, 30, ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, &satSystem, &AdrasteaI_ATGNSS_Satellite_Systems_Strings, 30, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
         }
         else
         {
-            if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, &satSystem, AdrasteaI_ATGNSS_Satellite_Systems_Strings, AdrasteaI_ATGNSS_Satellite_Systems_Strings_NumberOfValues, 30, ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, &satSystem, &AdrasteaI_ATGNSS_Satellite_Systems_Strings, 30, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
         }
 
         satSystemsP->satSystemsStates |= AdrasteaI_ATGNSS_Runtime_Mode_State_Set << satSystem;
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -303,6 +372,11 @@ bool AdrasteaI_ATGNSS_GetSatelliteSystems(AdrasteaI_ATGNSS_Satellite_Systems_t*
  */
 bool AdrasteaI_ATGNSS_SetNMEASentences(AdrasteaI_ATGNSS_NMEA_Sentences_t nmeaSentences)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -313,9 +387,9 @@ bool AdrasteaI_ATGNSS_SetNMEASentences(AdrasteaI_ATGNSS_NMEA_Sentences_t nmeaSen
     {
         if ((nmeaSentences.nmeaSentencesStates & (AdrasteaI_ATGNSS_Runtime_Mode_State_Set << i)) >> i)
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_NMEA_Sentences_Strings[i], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_NMEA_Sentences_Strings.strings[i], ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
         }
     }
@@ -324,20 +398,20 @@ bool AdrasteaI_ATGNSS_SetNMEASentences(AdrasteaI_ATGNSS_NMEA_Sentences_t nmeaSen
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_GNSS, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -349,21 +423,26 @@ bool AdrasteaI_ATGNSS_SetNMEASentences(AdrasteaI_ATGNSS_NMEA_Sentences_t nmeaSen
  */
 bool AdrasteaI_ATGNSS_GetNMEASentences(AdrasteaI_ATGNSS_NMEA_Sentences_t* nmeaSentencesP)
 {
-    if (nmeaSentencesP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (nmeaSentencesP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%IGNSSCFG=\"GET\",\"NMEA\"\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_GNSS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
@@ -377,23 +456,23 @@ bool AdrasteaI_ATGNSS_GetNMEASentences(AdrasteaI_ATGNSS_NMEA_Sentences_t* nmeaSe
         uint8_t nmeaSentence;
         if (i == argscount - 1)
         {
-            if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, &nmeaSentence, AdrasteaI_ATGNSS_NMEA_Sentences_Strings, AdrasteaI_ATGNSS_NMEA_Sentences_Strings_NumberOfValues, 30, ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, &nmeaSentence, &AdrasteaI_ATGNSS_NMEA_Sentences_Strings, 30, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
         }
         else
         {
-            if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, &nmeaSentence, AdrasteaI_ATGNSS_NMEA_Sentences_Strings, AdrasteaI_ATGNSS_NMEA_Sentences_Strings_NumberOfValues, 30, ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, &nmeaSentence, &AdrasteaI_ATGNSS_NMEA_Sentences_Strings, 30, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
         }
 
         nmeaSentencesP->nmeaSentencesStates |= AdrasteaI_ATGNSS_Runtime_Mode_State_Set << nmeaSentence;
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -405,31 +484,36 @@ bool AdrasteaI_ATGNSS_GetNMEASentences(AdrasteaI_ATGNSS_NMEA_Sentences_t* nmeaSe
  */
 bool AdrasteaI_ATGNSS_QueryGNSSSatellites(AdrasteaI_ATGNSS_Satellite_Count_t* satCountP)
 {
-    if (satCountP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (satCountP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%IGNSSINFO=\"SAT\"\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_GNSS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, satCountP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -447,37 +531,31 @@ bool AdrasteaI_ATGNSS_ParseSatelliteQueryEvent(char* pEventArguments, AdrasteaI_
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    switch (ATCommand_CountArgs(argumentsP))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 4))
     {
-        case 4:
-        {
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->prn, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_ARGUMENT_DELIM))
-            {
-                return false;
-            }
+        return false;
+    }
 
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->elevation, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_ARGUMENT_DELIM))
-            {
-                return false;
-            }
+    if (!ATCommand_GetArgumentInt(&arguments, 0, &dataP->prn, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
+    {
+        return false;
+    }
 
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->azimuth, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE16), ATCOMMAND_ARGUMENT_DELIM))
-            {
-                return false;
-            }
+    if (!ATCommand_GetArgumentInt(&arguments, 1, &dataP->elevation, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
+    {
+        return false;
+    }
 
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->snr, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
-            {
-                return false;
-            }
+    if (!ATCommand_GetArgumentInt(&arguments, 2, &dataP->azimuth, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED))
+    {
+        return false;
+    }
 
-            break;
-        }
-        default:
-            return false;
-            break;
+    if (!ATCommand_GetArgumentInt(&arguments, 3, &dataP->snr, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
+    {
+        return false;
     }
 
     return true;
@@ -494,11 +572,16 @@ bool AdrasteaI_ATGNSS_ParseSatelliteQueryEvent(char* pEventArguments, AdrasteaI_
  */
 bool AdrasteaI_ATGNSS_QueryGNSSFix(AdrasteaI_ATGNSS_Fix_Relavancy_t relevancy, AdrasteaI_ATGNSS_Fix_t* fixP)
 {
-    if (fixP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (fixP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     switch (relevancy)
@@ -510,20 +593,20 @@ bool AdrasteaI_ATGNSS_QueryGNSSFix(AdrasteaI_ATGNSS_Fix_Relavancy_t relevancy, A
             strcpy(pRequestCommand, "AT%IGNSSINFO=\"LASTFIX\"\r\n");
             break;
         default:
-            return false;
+            return AdrasteaI_EndCommand(false);
             break;
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_GNSS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     memset(fixP, -1, sizeof(AdrasteaI_ATGNSS_Fix_t));
@@ -535,14 +618,14 @@ bool AdrasteaI_ATGNSS_QueryGNSSFix(AdrasteaI_ATGNSS_Fix_Relavancy_t relevancy, A
         case 1:
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &fixP->fixType, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
-            return true;
+            return AdrasteaI_EndCommand(true);
         default:
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &fixP->fixType, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
     }
 
@@ -552,22 +635,22 @@ bool AdrasteaI_ATGNSS_QueryGNSSFix(AdrasteaI_ATGNSS_Fix_Relavancy_t relevancy, A
 
     if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, time, ATCOMMAND_ARGUMENT_DELIM, sizeof(time)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&timeP, &fixP->time.Hours, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ':'))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&timeP, &fixP->time.Minutes, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ':'))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&timeP, &fixP->time.Seconds, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char date[11];
@@ -576,60 +659,89 @@ bool AdrasteaI_ATGNSS_QueryGNSSFix(AdrasteaI_ATGNSS_Fix_Relavancy_t relevancy, A
 
     if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, date, ATCOMMAND_ARGUMENT_DELIM, sizeof(date)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&dateP, &fixP->date.Day, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, '/'))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&dateP, &fixP->date.Month, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, '/'))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&dateP, &fixP->date.Year, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
+#ifdef ADRASTEAI_FIXED_POINT
+    if (!ATCommand_GetNextArgumentFixedPointWithoutQuotationMarks(&pResponseCommand, &fixP->latitude, AdrasteaI_ATCommon_Coordinate_Decimals, ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if (!ATCommand_GetNextArgumentFixedPointWithoutQuotationMarks(&pResponseCommand, &fixP->longitude, AdrasteaI_ATCommon_Coordinate_Decimals, ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if (!ATCommand_GetNextArgumentFixedPointWithoutQuotationMarks(&pResponseCommand, &fixP->altitude, AdrasteaI_ATCommon_Altitude_Decimals, ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+#else
     if (!ATCommand_GetNextArgumentDoubleWithoutQuotationMarks(&pResponseCommand, &fixP->latitude, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentDoubleWithoutQuotationMarks(&pResponseCommand, &fixP->longitude, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentDoubleWithoutQuotationMarks(&pResponseCommand, &fixP->altitude, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
+#endif
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &fixP->utcTimestamp, ATCOMMAND_INTFLAGS_SIZE64 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
+#ifdef ADRASTEAI_FIXED_POINT
+    if (!ATCommand_GetNextArgumentFixedPoint(&pResponseCommand, &fixP->accuracy, AdrasteaI_ATGNSS_Radius_Accuracy_Decimals, ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if (!ATCommand_GetNextArgumentFixedPointWithoutQuotationMarks(&pResponseCommand, &fixP->speed, AdrasteaI_ATGNSS_Speed_Decimals, ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+#else
     if (!ATCommand_GetNextArgumentFloat(&pResponseCommand, &fixP->accuracy, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentFloatWithoutQuotationMarks(&pResponseCommand, &fixP->speed, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
+#endif
 
-    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&fixP->ephType, AdrasteaI_ATGNSS_Ephemeris_Strings, AdrasteaI_ATGNSS_Ephemeris_NumberOfValues, 30, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&fixP->ephType, &AdrasteaI_ATGNSS_Ephemeris_Strings, 30, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -641,31 +753,43 @@ bool AdrasteaI_ATGNSS_QueryGNSSFix(AdrasteaI_ATGNSS_Fix_Relavancy_t relevancy, A
  */
 bool AdrasteaI_ATGNSS_QueryGNSSTTFF(AdrasteaI_ATGNSS_TTFF_t* ttffP)
 {
-    if (ttffP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (ttffP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%IGNSSINFO=\"TTFF\"\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_GNSS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
+#ifdef ADRASTEAI_FIXED_POINT
+    if (!ATCommand_GetNextArgumentFixedPointWithoutQuotationMarks(&pResponseCommand, ttffP, AdrasteaI_ATGNSS_TTFF_Decimals, ATCOMMAND_STRING_TERMINATE))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+#else
     if (!ATCommand_GetNextArgumentFloatWithoutQuotationMarks(&pResponseCommand, ttffP, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
+#endif
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -677,29 +801,34 @@ bool AdrasteaI_ATGNSS_QueryGNSSTTFF(AdrasteaI_ATGNSS_TTFF_t* ttffP)
  */
 bool AdrasteaI_ATGNSS_QueryGNSSEphemerisStatus(AdrasteaI_ATGNSS_Ephemeris_Status_t* statusP)
 {
-    if (statusP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (statusP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%IGNSSINFO=\"EPH\"\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_GNSS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, statusP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -713,36 +842,9 @@ bool AdrasteaI_ATGNSS_QueryGNSSEphemerisStatus(AdrasteaI_ATGNSS_Ephemeris_Status
  */
 bool AdrasteaI_ATGNSS_SetGNSSUnsolicitedNotificationEvents(AdrasteaI_ATGNSS_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%IGNSSEV=");
-
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
+    AdrasteaI_ATGNSS_Event_Request_t request = {.event = event, .state = state};
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATGNSS_Commands[AdrasteaI_ATGNSS_Command_SetGNSSUnsolicitedNotificationEvents], &request, NULL);
 }
 
 /**
@@ -760,9 +862,14 @@ bool AdrasteaI_ATGNSS_ParseSessionStatusChangedEvent(char* pEventArguments, Adra
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
+
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 1))
+    {
+        return false;
+    }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
         return false;
     }
@@ -785,9 +892,14 @@ bool AdrasteaI_ATGNSS_ParseAllowedStatusChangedEvent(char* pEventArguments, Adra
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
+
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 1))
+    {
+        return false;
+    }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
         return false;
     }
@@ -810,7 +922,17 @@ bool AdrasteaI_ATGNSS_ParseNMEAEvent(char* pEventArguments, AdrasteaI_ATGNSS_NME
         return false;
     }
 
-    strcpy(*dataP, pEventArguments + 1);
+    ATCommand_Arguments_t arguments;
+
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments))
+    {
+        return false;
+    }
+
+    if (!ATCommand_GetArgumentRemainder(&arguments, 0, *dataP, sizeof(*dataP)))
+    {
+        return false;
+    }
 
     return true;
 }
@@ -824,31 +946,9 @@ bool AdrasteaI_ATGNSS_ParseNMEAEvent(char* pEventArguments, AdrasteaI_ATGNSS_NME
  */
 bool AdrasteaI_ATGNSS_DeleteData(AdrasteaI_ATGNSS_Deletion_Option_t deleteOption)
 {
-    char* pRequestCommand = AT_commandBuffer;
+    AdrasteaI_ATGNSS_Deletion_Option_Request_t request = {.deleteOption = deleteOption};
 
-    strcpy(pRequestCommand, "AT%IGNSSMEM=\"ERASE\",");
-
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_Deletion_Option_Strings[deleteOption], ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATGNSS_Commands[AdrasteaI_ATGNSS_Command_DeleteData], &request, NULL);
 }
 
 /**
@@ -860,31 +960,9 @@ bool AdrasteaI_ATGNSS_DeleteData(AdrasteaI_ATGNSS_Deletion_Option_t deleteOption
  */
 bool AdrasteaI_ATGNSS_DownloadCEPFile(AdrasteaI_ATGNSS_CEP_Number_of_Days_t numDays)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%IGNSSCEP=\"DLD\",");
+    AdrasteaI_ATGNSS_CEP_Download_Request_t request = {.numDays = numDays};
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, numDays, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATGNSS_Commands[AdrasteaI_ATGNSS_Command_DownloadCEPFile], &request, NULL);
 }
 
 /**
@@ -894,17 +972,7 @@ bool AdrasteaI_ATGNSS_DownloadCEPFile(AdrasteaI_ATGNSS_CEP_Number_of_Days_t numD
  */
 bool AdrasteaI_ATGNSS_EraseCEPFile()
 {
-    if (!AdrasteaI_SendRequest("AT%IGNSSCEP=\"ERASE\"\r\n"))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATGNSS_Commands[AdrasteaI_ATGNSS_Command_EraseCEPFile], NULL, NULL);
 }
 
 /**
@@ -916,21 +984,26 @@ bool AdrasteaI_ATGNSS_EraseCEPFile()
  */
 bool AdrasteaI_ATGNSS_QueryCEPFileStatus(AdrasteaI_ATGNSS_CEP_Status_t* status)
 {
-    if (status == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (status == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%IGNSSCEP=\"STAT\"\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_GNSS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_GNSS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
@@ -941,7 +1014,7 @@ bool AdrasteaI_ATGNSS_QueryCEPFileStatus(AdrasteaI_ATGNSS_CEP_Status_t* status)
         {
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &status->validity, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
@@ -950,29 +1023,29 @@ bool AdrasteaI_ATGNSS_QueryCEPFileStatus(AdrasteaI_ATGNSS_CEP_Status_t* status)
         {
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &status->validity, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &status->remDays, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &status->remHours, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &status->remMinutes, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
         }
         default:
-            return false;
+            return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
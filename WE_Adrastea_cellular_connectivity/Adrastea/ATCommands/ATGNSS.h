@@ -153,7 +153,18 @@ extern "C"
         AdrasteaI_ATGNSS_Fix_Type_NumberOfValues
     } AdrasteaI_ATGNSS_Fix_Type_t;
 
+#ifdef ADRASTEAI_FIXED_POINT
+    /**
+ * @brief Radius accuracy and speed in thousandths of the unit reported by the module (see ADRASTEAI_FIXED_POINT).
+ */
+    typedef int32_t AdrasteaI_ATGNSS_Radius_Accuracy_t, AdrasteaI_ATGNSS_Speed_t;
+
+#define AdrasteaI_ATGNSS_Radius_Accuracy_Decimals 3
+
+#define AdrasteaI_ATGNSS_Speed_Decimals 3
+#else
     typedef float AdrasteaI_ATGNSS_Radius_Accuracy_t, AdrasteaI_ATGNSS_Speed_t;
+#endif
 
     typedef enum AdrasteaI_ATGNSS_Ephemeris_t
     {
@@ -180,7 +191,16 @@ extern "C"
         AdrasteaI_ATGNSS_Ephemeris_t ephType;
     } AdrasteaI_ATGNSS_Fix_t;
 
+#ifdef ADRASTEAI_FIXED_POINT
+    /**
+ * @brief Time to first fix in microseconds (see ADRASTEAI_FIXED_POINT).
+ */
+    typedef int32_t AdrasteaI_ATGNSS_TTFF_t;
+
+#define AdrasteaI_ATGNSS_TTFF_Decimals 3
+#else
     typedef float AdrasteaI_ATGNSS_TTFF_t;
+#endif
 
     typedef enum AdrasteaI_ATGNSS_Ephemeris_Status_t
     {
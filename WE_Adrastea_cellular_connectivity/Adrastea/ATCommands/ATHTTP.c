@@ -34,7 +34,73 @@
 #include "ATCommands.h"
 
 
-static const char* AdrasteaI_ATHTTP_Event_Strings[AdrasteaI_ATHTTP_Event_NumberOfValues] = {"PUTCONF", "POSTCONF", "DELCONF", "GETRCV", "SESTERM", "ALL"};
+#define AdrasteaI_ATHTTP_Event_Entries(ENTRY)                    \
+    ENTRY("ALL", AdrasteaI_ATHTTP_Event_All)                     \
+    ENTRY("GETRCV", AdrasteaI_ATHTTP_Event_GET_Receive)          \
+    ENTRY("DELCONF", AdrasteaI_ATHTTP_Event_DELETE_Confirmation) \
+    ENTRY("PUTCONF", AdrasteaI_ATHTTP_Event_PUT_Confirmation)    \
+    ENTRY("SESTERM", AdrasteaI_ATHTTP_Event_Session_Terminated)  \
+    ENTRY("POSTCONF", AdrasteaI_ATHTTP_Event_POST_Confirmation)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATHTTP_Event_Strings, AdrasteaI_ATHTTP_Event_NumberOfValues, AdrasteaI_ATHTTP_Event_Entries);
+
+/**
+ * @brief Request of AdrasteaI_ATHTTP_ConfigureTLS().
+ */
+typedef struct AdrasteaI_ATHTTP_TLS_Request_t
+{
+    AdrasteaI_ATHTTP_Profile_ID_t profileID;
+    AdrasteaI_ATCommon_TLS_Auth_Mode_t authMode;
+    AdrasteaI_ATCommon_TLS_Profile_ID_t tlsProfileID;
+} AdrasteaI_ATHTTP_TLS_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATHTTP_TLS_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATHTTP_TLS_Request_t, profileID, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATHTTP_TLS_Request_t, authMode, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATHTTP_TLS_Request_t, tlsProfileID, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief Request of AdrasteaI_ATHTTP_ConfigureTimeout().
+ */
+typedef struct AdrasteaI_ATHTTP_Timeout_Request_t
+{
+    AdrasteaI_ATHTTP_Profile_ID_t profileID;
+    AdrasteaI_ATHTTP_Timeout_t timeout;
+} AdrasteaI_ATHTTP_Timeout_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATHTTP_Timeout_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATHTTP_Timeout_Request_t, profileID, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATHTTP_Timeout_Request_t, timeout, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief Request of AdrasteaI_ATHTTP_SetHTTPUnsolicitedNotificationEvents().
+ */
+typedef struct AdrasteaI_ATHTTP_Event_Request_t
+{
+    AdrasteaI_ATHTTP_Event_t event;
+    AdrasteaI_ATCommon_Event_State_t state;
+} AdrasteaI_ATHTTP_Event_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATHTTP_Event_Request_Fields[] = {
+    ATCOMMAND_FIELD_ENUMSTRING_QUOTATIONMARKS(AdrasteaI_ATHTTP_Event_Request_t, event, &AdrasteaI_ATHTTP_Event_Strings),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATHTTP_Event_Request_t, state, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief HTTP commands with fixed argument layout, see AdrasteaI_Command_t.
+ */
+#define ADRASTEAI_ATHTTP_COMMANDS(COMMAND)                                                                                                                                              \
+    COMMAND(AdrasteaI_ATHTTP_Command_ConfigureTLS, "AT%HTTPCFG=\"TLS\",", HTTP, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATHTTP_TLS_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)             \
+    COMMAND(AdrasteaI_ATHTTP_Command_ConfigureTimeout, "AT%HTTPCFG=\"TIMEOUT\",", HTTP, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATHTTP_Timeout_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS) \
+    COMMAND(AdrasteaI_ATHTTP_Command_SetHTTPUnsolicitedNotificationEvents, "AT%HTTPEV=", HTTP, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATHTTP_Event_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)
+
+typedef enum AdrasteaI_ATHTTP_Command_t
+{
+    ADRASTEAI_ATHTTP_COMMANDS(ADRASTEAI_COMMAND_ID) AdrasteaI_ATHTTP_Command_NumberOfValues
+} AdrasteaI_ATHTTP_Command_t;
+
+static const AdrasteaI_Command_t AdrasteaI_ATHTTP_Commands[AdrasteaI_ATHTTP_Command_NumberOfValues] = {ADRASTEAI_ATHTTP_COMMANDS(ADRASTEAI_COMMAND_DESCRIPTOR)};
 
 /**
  * @brief Configure Nodes (using the AT%HTTPCFG command).
@@ -51,6 +117,11 @@ static const char* AdrasteaI_ATHTTP_Event_Strings[AdrasteaI_ATHTTP_Event_NumberO
  */
 bool AdrasteaI_ATHTTP_ConfigureNodes(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATCommon_Auth_Username_t username, AdrasteaI_ATCommon_Auth_Password_t password)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -59,24 +130,24 @@ bool AdrasteaI_ATHTTP_ConfigureNodes(AdrasteaI_ATHTTP_Profile_ID_t profileID, Ad
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if ((strlen(username) != 0) && (strlen(password) != 0))
     {
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, username, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, password, ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         AdrasteaI_optionalParamsDelimCount = 0;
@@ -86,20 +157,20 @@ bool AdrasteaI_ATHTTP_ConfigureNodes(AdrasteaI_ATHTTP_Profile_ID_t profileID, Ad
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_HTTP), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_HTTP, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -115,41 +186,9 @@ bool AdrasteaI_ATHTTP_ConfigureNodes(AdrasteaI_ATHTTP_Profile_ID_t profileID, Ad
  */
 bool AdrasteaI_ATHTTP_ConfigureTLS(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_TLS_Auth_Mode_t authMode, AdrasteaI_ATCommon_TLS_Profile_ID_t tlsProfileID)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%HTTPCFG=\"TLS\",");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
+    AdrasteaI_ATHTTP_TLS_Request_t request = {.profileID = profileID, .authMode = authMode, .tlsProfileID = tlsProfileID};
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, authMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, tlsProfileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_HTTP), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATHTTP_Commands[AdrasteaI_ATHTTP_Command_ConfigureTLS], &request, NULL);
 }
 
 /**
@@ -169,6 +208,11 @@ bool AdrasteaI_ATHTTP_ConfigureTLS(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adra
  */
 bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATHTTP_IP_Session_ID_t sessionID, AdrasteaI_ATHTTP_IP_Addr_Format_t ipFormat, AdrasteaI_ATCommon_Port_Number_t destPort, AdrasteaI_ATCommon_Port_Number_t sourcePort)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -177,14 +221,14 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (sessionID != AdrasteaI_ATHTTP_IP_Session_ID_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -192,7 +236,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
@@ -201,7 +245,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -209,7 +253,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
@@ -218,7 +262,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, destPort, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -226,7 +270,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
@@ -235,7 +279,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, sourcePort, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -244,20 +288,20 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_HTTP), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_HTTP, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -273,46 +317,51 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
  */
 bool AdrasteaI_ATHTTP_ConfigureFormat(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, AdrasteaI_ATHTTP_Header_Presence_t requestHeader)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%HTTPCFG=\"FORMAT\",");
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, responseHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, requestHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_HTTP), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_HTTP, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -326,36 +375,9 @@ bool AdrasteaI_ATHTTP_ConfigureFormat(AdrasteaI_ATHTTP_Profile_ID_t profileID, A
  */
 bool AdrasteaI_ATHTTP_ConfigureTimeout(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATHTTP_Timeout_t timeout)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%HTTPCFG=\"TIMEOUT\",");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, timeout, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
+    AdrasteaI_ATHTTP_Timeout_Request_t request = {.profileID = profileID, .timeout = timeout};
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_HTTP), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATHTTP_Commands[AdrasteaI_ATHTTP_Command_ConfigureTimeout], &request, NULL);
 }
 
 /**
@@ -369,62 +391,40 @@ bool AdrasteaI_ATHTTP_ConfigureTimeout(AdrasteaI_ATHTTP_Profile_ID_t profileID,
  */
 bool AdrasteaI_ATHTTP_SetHTTPUnsolicitedNotificationEvents(AdrasteaI_ATHTTP_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
 {
-    char* pRequestCommand = AT_commandBuffer;
+    AdrasteaI_ATHTTP_Event_Request_t request = {.event = event, .state = state};
 
-    strcpy(pRequestCommand, "AT%HTTPEV=");
-
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATHTTP_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATHTTP_Commands[AdrasteaI_ATHTTP_Command_SetHTTPUnsolicitedNotificationEvents], &request, NULL);
+}
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_HTTP), AdrasteaI_CNFStatus_Success, NULL))
+static bool GETDELETE_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
+{
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
-    return true;
-}
-
-static bool GETDELETE_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
-{
     AdrasteaI_optionalParamsDelimCount = 1;
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (responseHeader != AdrasteaI_ATHTTP_Header_Presence_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, responseHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -432,7 +432,7 @@ static bool GETDELETE_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
@@ -443,13 +443,13 @@ static bool GETDELETE_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_
         {
             if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, headers[i], ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
         }
 
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, headers[headersCount - 1], ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         AdrasteaI_optionalParamsDelimCount = 0;
@@ -459,20 +459,20 @@ static bool GETDELETE_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_HTTP), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_HTTP, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -492,11 +492,16 @@ static bool GETDELETE_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_
  */
 bool AdrasteaI_ATHTTP_GET(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%HTTPCMD=\"GET\",");
 
-    return GETDELETE_Common(pRequestCommand, profileID, addr, responseHeader, headers, headersCount);
+    return AdrasteaI_EndCommand(GETDELETE_Common(pRequestCommand, profileID, addr, responseHeader, headers, headersCount));
 }
 
 /**
@@ -516,39 +521,49 @@ bool AdrasteaI_ATHTTP_GET(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATC
  */
 bool AdrasteaI_ATHTTP_DELETE(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%HTTPCMD=\"DELETE\",");
 
-    return GETDELETE_Common(pRequestCommand, profileID, addr, responseHeader, headers, headersCount);
+    return AdrasteaI_EndCommand(GETDELETE_Common(pRequestCommand, profileID, addr, responseHeader, headers, headersCount));
 }
 
 static bool POSTPUT_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, char* body, AdrasteaI_ATHTTP_Body_Size_t bodySize, char* contentType, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char crchar[] = {'\r', ATCOMMAND_STRING_TERMINATE};
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, bodySize, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (contentType != NULL)
     {
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, contentType, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -556,20 +571,20 @@ static bool POSTPUT_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
     AdrasteaI_optionalParamsDelimCount++;
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
     AdrasteaI_optionalParamsDelimCount++;
 
@@ -579,13 +594,13 @@ static bool POSTPUT_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t
         {
             if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, headers[i], ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
         }
 
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, headers[headersCount - 1], ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         AdrasteaI_optionalParamsDelimCount = 0;
@@ -595,25 +610,25 @@ static bool POSTPUT_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, crchar, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, body, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_HTTP), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_HTTP, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -637,11 +652,16 @@ static bool POSTPUT_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t
  */
 bool AdrasteaI_ATHTTP_POST(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, char* body, AdrasteaI_ATHTTP_Body_Size_t bodySize, char* contentType, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%HTTPSEND=\"POST\",");
 
-    return POSTPUT_Common(pRequestCommand, profileID, addr, body, bodySize, contentType, headers, headersCount);
+    return AdrasteaI_EndCommand(POSTPUT_Common(pRequestCommand, profileID, addr, body, bodySize, contentType, headers, headersCount));
 }
 
 /**
@@ -665,11 +685,16 @@ bool AdrasteaI_ATHTTP_POST(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_AT
  */
 bool AdrasteaI_ATHTTP_PUT(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, char* body, AdrasteaI_ATHTTP_Body_Size_t bodySize, char* contentType, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%HTTPSEND=\"PUT\",");
 
-    return POSTPUT_Common(pRequestCommand, profileID, addr, body, bodySize, contentType, headers, headersCount);
+    return AdrasteaI_EndCommand(POSTPUT_Common(pRequestCommand, profileID, addr, body, bodySize, contentType, headers, headersCount));
 }
 
 /**
@@ -687,29 +712,21 @@ bool AdrasteaI_ATHTTP_ParseGETEvent(char* pEventArguments, AdrasteaI_ATHTTP_Even
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->profileID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count < 2))
     {
         return false;
     }
 
-    switch (ATCommand_CountArgs(argumentsP))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, &dataP->profileID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
-        case 1:
-        {
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->state, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
-            {
-                return false;
-            }
-            break;
-        }
-        default:
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->state, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-            {
-                return false;
-            }
-            break;
+        return false;
+    }
+
+    if (!ATCommand_GetArgumentInt(&arguments, 1, &dataP->state, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
+    {
+        return false;
     }
 
     return true;
@@ -728,54 +745,59 @@ bool AdrasteaI_ATHTTP_ParseGETEvent(char* pEventArguments, AdrasteaI_ATHTTP_Even
  */
 bool AdrasteaI_ATHTTP_ReadResponse(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATHTTP_Data_Length_t maxLength, AdrasteaI_ATHTTP_Response_t* response)
 {
-    if (response == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (response == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%HTTPREAD=");
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, maxLength, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
     memset(pResponseCommand, 0, sizeof(AT_commandBuffer));
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_HTTP), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_HTTP, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &response->dataLength, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &response->receivedLength, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     size_t responseByteCount = 0;
@@ -784,7 +806,7 @@ bool AdrasteaI_ATHTTP_ReadResponse(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adra
     {
         if (!ATCommand_GetNextArgumentString(&pResponseCommand, &response->responseBody[responseByteCount], ATCOMMAND_STRING_TERMINATE, maxLength))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         if ((strlen(response->responseBody) - responseByteCount) == 0)
@@ -800,7 +822,7 @@ bool AdrasteaI_ATHTTP_ReadResponse(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adra
         response->responseBody[responseByteCount] = ATCOMMAND_STRING_TERMINATE;
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
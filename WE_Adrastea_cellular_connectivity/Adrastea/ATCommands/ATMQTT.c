@@ -34,7 +34,92 @@
 #include "ATCommands.h"
 
 
-static const char* AdrasteaI_ATMQTT_Event_Strings[AdrasteaI_ATMQTT_Event_NumberOfValues] = {"CONCONF", "DISCONF", "SUBCONF", "UNSCONF", "PUBCONF", "PUBRCV", "CONFAIL", "ALL"};
+#define AdrasteaI_ATMQTT_Event_Entries(ENTRY)                         \
+    ENTRY("ALL", AdrasteaI_ATMQTT_Event_All)                          \
+    ENTRY("PUBRCV", AdrasteaI_ATMQTT_Event_Publication_Receive)       \
+    ENTRY("CONCONF", AdrasteaI_ATMQTT_Event_Connect_Confirmation)     \
+    ENTRY("CONFAIL", AdrasteaI_ATMQTT_Event_Connect_Failure)          \
+    ENTRY("DISCONF", AdrasteaI_ATMQTT_Event_Disconnect_Confirmation)  \
+    ENTRY("PUBCONF", AdrasteaI_ATMQTT_Event_Publication_Confirmation) \
+    ENTRY("SUBCONF", AdrasteaI_ATMQTT_Event_Subscribe_Confirmation)   \
+    ENTRY("UNSCONF", AdrasteaI_ATMQTT_Event_Unsubscribe_Confirmation)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATMQTT_Event_Strings, AdrasteaI_ATMQTT_Event_NumberOfValues, AdrasteaI_ATMQTT_Event_Entries);
+
+/**
+ * @brief Request of AdrasteaI_ATMQTT_ConfigureTLS().
+ */
+typedef struct AdrasteaI_ATMQTT_TLS_Request_t
+{
+    AdrasteaI_ATMQTT_Conn_ID_t connID;
+    AdrasteaI_ATCommon_TLS_Auth_Mode_t authMode;
+    AdrasteaI_ATCommon_TLS_Profile_ID_t profileID;
+} AdrasteaI_ATMQTT_TLS_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATMQTT_TLS_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATMQTT_TLS_Request_t, connID, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATMQTT_TLS_Request_t, authMode, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATMQTT_TLS_Request_t, profileID, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief Request of the commands enabling or disabling MQTT and AWS IoT events.
+ */
+typedef struct AdrasteaI_ATMQTT_Event_Request_t
+{
+    AdrasteaI_ATMQTT_Event_t event;
+    AdrasteaI_ATCommon_Event_State_t state;
+} AdrasteaI_ATMQTT_Event_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATMQTT_Event_Request_Fields[] = {
+    ATCOMMAND_FIELD_ENUMSTRING_QUOTATIONMARKS(AdrasteaI_ATMQTT_Event_Request_t, event, &AdrasteaI_ATMQTT_Event_Strings),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATMQTT_Event_Request_t, state, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief Request of the commands addressing a single MQTT connection.
+ */
+typedef struct AdrasteaI_ATMQTT_Conn_ID_Request_t
+{
+    AdrasteaI_ATMQTT_Conn_ID_t connID;
+} AdrasteaI_ATMQTT_Conn_ID_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATMQTT_Conn_ID_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATMQTT_Conn_ID_Request_t, connID, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief Request of AdrasteaI_ATMQTT_AWSIOTConfigureProtocol().
+ */
+typedef struct AdrasteaI_ATMQTT_AWSIOT_Protocol_Request_t
+{
+    AdrasteaI_ATMQTT_Keep_Alive_t keepAlive;
+    AdrasteaI_ATMQTT_AWSIOT_QoS_t qos;
+} AdrasteaI_ATMQTT_AWSIOT_Protocol_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATMQTT_AWSIOT_Protocol_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATMQTT_AWSIOT_Protocol_Request_t, keepAlive, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATMQTT_AWSIOT_Protocol_Request_t, qos, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief MQTT commands with fixed argument layout, see AdrasteaI_Command_t.
+ */
+#define ADRASTEAI_ATMQTT_COMMANDS(COMMAND)                                                                                                                                                                \
+    COMMAND(AdrasteaI_ATMQTT_Command_ConfigureTLS, "AT%MQTTCFG=\"TLS\",", MQTT, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATMQTT_TLS_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)                               \
+    COMMAND(AdrasteaI_ATMQTT_Command_SetMQTTUnsolicitedNotificationEvents, "AT%MQTTEV=", MQTT, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATMQTT_Event_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)              \
+    COMMAND(AdrasteaI_ATMQTT_Command_Connect, "AT%MQTTCMD=\"CONNECT\",", MQTT, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATMQTT_Conn_ID_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)                            \
+    COMMAND(AdrasteaI_ATMQTT_Command_Disconnect, "AT%MQTTCMD=\"DISCONNECT\",", MQTT, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATMQTT_Conn_ID_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)                      \
+    COMMAND(AdrasteaI_ATMQTT_Command_AWSIOTConfigureProtocol, "AT%AWSIOTCFG=\"PROTOCOL\",", MQTT, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATMQTT_AWSIOT_Protocol_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS) \
+    COMMAND(AdrasteaI_ATMQTT_Command_SetAWSIOTUnsolicitedNotificationEvents, "AT%AWSIOTEV=", MQTT, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATMQTT_Event_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)          \
+    COMMAND(AdrasteaI_ATMQTT_Command_AWSIOTConnect, "AT%AWSIOTCMD=\"CONNECT\"", MQTT, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_NO_FIELDS)                                                           \
+    COMMAND(AdrasteaI_ATMQTT_Command_AWSIOTDisconnect, "AT%AWSIOTCMD=\"DISCONNECT\"", MQTT, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_NO_FIELDS)
+
+typedef enum AdrasteaI_ATMQTT_Command_t
+{
+    ADRASTEAI_ATMQTT_COMMANDS(ADRASTEAI_COMMAND_ID) AdrasteaI_ATMQTT_Command_NumberOfValues
+} AdrasteaI_ATMQTT_Command_t;
+
+static const AdrasteaI_Command_t AdrasteaI_ATMQTT_Commands[AdrasteaI_ATMQTT_Command_NumberOfValues] = {ADRASTEAI_ATMQTT_COMMANDS(ADRASTEAI_COMMAND_DESCRIPTOR)};
 
 /**
  * @brief Configure Nodes (using the AT%MQTTCFG command).
@@ -53,6 +138,11 @@ static const char* AdrasteaI_ATMQTT_Event_Strings[AdrasteaI_ATMQTT_Event_NumberO
  */
 bool AdrasteaI_ATMQTT_ConfigureNodes(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_Client_ID_t clientID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATCommon_Auth_Username_t username, AdrasteaI_ATCommon_Auth_Password_t password)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -61,29 +151,29 @@ bool AdrasteaI_ATMQTT_ConfigureNodes(AdrasteaI_ATMQTT_Conn_ID_t connID, Adrastea
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, clientID, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if ((strlen(username) != 0) && (strlen(password) != 0))
     {
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, username, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, password, ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         AdrasteaI_optionalParamsDelimCount = 0;
@@ -93,20 +183,20 @@ bool AdrasteaI_ATMQTT_ConfigureNodes(AdrasteaI_ATMQTT_Conn_ID_t connID, Adrastea
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_MQTT, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -122,41 +212,9 @@ bool AdrasteaI_ATMQTT_ConfigureNodes(AdrasteaI_ATMQTT_Conn_ID_t connID, Adrastea
  */
 bool AdrasteaI_ATMQTT_ConfigureTLS(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATCommon_TLS_Auth_Mode_t authMode, AdrasteaI_ATCommon_TLS_Profile_ID_t profileID)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%MQTTCFG=\"TLS\",");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, authMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
+    AdrasteaI_ATMQTT_TLS_Request_t request = {.connID = connID, .authMode = authMode, .profileID = profileID};
 
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATMQTT_Commands[AdrasteaI_ATMQTT_Command_ConfigureTLS], &request, NULL);
 }
 
 /**
@@ -174,6 +232,11 @@ bool AdrasteaI_ATMQTT_ConfigureTLS(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_
  */
 bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_IP_Session_ID_t sessionID, AdrasteaI_ATMQTT_IP_Addr_Format_t ipFormat, AdrasteaI_ATCommon_Port_Number_t port)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -182,14 +245,14 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (sessionID != AdrasteaI_ATMQTT_IP_Session_ID_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -197,7 +260,7 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
@@ -206,7 +269,7 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -214,7 +277,7 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
@@ -223,7 +286,7 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, port, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -232,20 +295,20 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_MQTT, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -267,56 +330,61 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
  */
 bool AdrasteaI_ATMQTT_ConfigureWillMessage(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_WILL_Presence_t presence, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topic, char* message)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%MQTTCFG=\"WILLMSG\",");
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, presence, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, retain, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topic, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, message, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_MQTT, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -332,46 +400,51 @@ bool AdrasteaI_ATMQTT_ConfigureWillMessage(AdrasteaI_ATMQTT_Conn_ID_t connID, Ad
  */
 bool AdrasteaI_ATMQTT_ConfigureProtocol(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_Keep_Alive_t keepAlive, AdrasteaI_ATMQTT_Clean_Session_t cleanSession)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%MQTTCFG=\"PROTOCOL\",");
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, keepAlive, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, cleanSession, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_MQTT, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -385,36 +458,9 @@ bool AdrasteaI_ATMQTT_ConfigureProtocol(AdrasteaI_ATMQTT_Conn_ID_t connID, Adras
  */
 bool AdrasteaI_ATMQTT_SetMQTTUnsolicitedNotificationEvents(AdrasteaI_ATMQTT_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%MQTTEV=");
-
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATMQTT_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
+    AdrasteaI_ATMQTT_Event_Request_t request = {.event = event, .state = state};
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATMQTT_Commands[AdrasteaI_ATMQTT_Command_SetMQTTUnsolicitedNotificationEvents], &request, NULL);
 }
 
 /**
@@ -432,40 +478,26 @@ bool AdrasteaI_ATMQTT_ParseConnectionConfirmationEvent(char* pEventArguments, Ad
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->connID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count < 2) || (arguments.count > 3))
     {
         return false;
     }
 
-    switch (ATCommand_CountArgs(argumentsP))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, &dataP->connID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
-        case 1:
-        {
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->resultCode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
-            {
-                return false;
-            }
-
-            break;
-        }
-        case 2:
-        {
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->resultCode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-            {
-                return false;
-            }
+        return false;
+    }
 
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->errorCode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
-            {
-                return false;
-            }
+    if (!ATCommand_GetArgumentInt(&arguments, 1, &dataP->resultCode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
+    {
+        return false;
+    }
 
-            break;
-        }
-        default:
-            return false;
+    if ((arguments.count == 3) && !ATCommand_GetArgumentInt(&arguments, 2, &dataP->errorCode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
+    {
+        return false;
     }
 
     return true;
@@ -496,45 +528,31 @@ bool AdrasteaI_ATMQTT_ParseSubscriptionConfirmationEvent(char* pEventArguments,
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->connID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count < 3) || (arguments.count > 4))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->msgID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, &dataP->connID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
         return false;
     }
 
-    switch (ATCommand_CountArgs(argumentsP))
+    if (!ATCommand_GetArgumentInt(&arguments, 1, &dataP->msgID, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
-        case 1:
-        {
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->resultCode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
-            {
-                return false;
-            }
-
-            break;
-        }
-        case 2:
-        {
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->resultCode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-            {
-                return false;
-            }
+        return false;
+    }
 
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->errorCode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
-            {
-                return false;
-            }
+    if (!ATCommand_GetArgumentInt(&arguments, 2, &dataP->resultCode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
+    {
+        return false;
+    }
 
-            break;
-        }
-        default:
-            return false;
+    if ((arguments.count == 4) && !ATCommand_GetArgumentInt(&arguments, 3, &dataP->errorCode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
+    {
+        return false;
     }
 
     return true;
@@ -575,29 +593,34 @@ bool AdrasteaI_ATMQTT_ParsePublicationReceivedEvent(char* pEventArguments, Adras
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->connID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count < 5))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->msgID, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, &dataP->connID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, dataP->topicName, ATCOMMAND_ARGUMENT_DELIM, sizeof(AdrasteaI_ATMQTT_Topic_Name_t)))
+    if (!ATCommand_GetArgumentInt(&arguments, 1, &dataP->msgID, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->payloadSize, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetArgumentStringWithoutQuotationMarks(&arguments, 2, dataP->topicName, sizeof(AdrasteaI_ATMQTT_Topic_Name_t)))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentString(&argumentsP, dataP->payload, ATCOMMAND_STRING_TERMINATE, dataP->payloadMaxBufferSize))
+    if (!ATCommand_GetArgumentInt(&arguments, 3, &dataP->payloadSize, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
+    {
+        return false;
+    }
+
+    if (!ATCommand_GetArgumentRemainder(&arguments, 4, dataP->payload, dataP->payloadMaxBufferSize))
     {
         return false;
     }
@@ -614,31 +637,9 @@ bool AdrasteaI_ATMQTT_ParsePublicationReceivedEvent(char* pEventArguments, Adras
  */
 bool AdrasteaI_ATMQTT_Connect(AdrasteaI_ATMQTT_Conn_ID_t connID)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%MQTTCMD=\"CONNECT\",");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
+    AdrasteaI_ATMQTT_Conn_ID_Request_t request = {.connID = connID};
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATMQTT_Commands[AdrasteaI_ATMQTT_Command_Connect], &request, NULL);
 }
 
 /**
@@ -650,31 +651,9 @@ bool AdrasteaI_ATMQTT_Connect(AdrasteaI_ATMQTT_Conn_ID_t connID)
  */
 bool AdrasteaI_ATMQTT_Disconnect(AdrasteaI_ATMQTT_Conn_ID_t connID)
 {
-    char* pRequestCommand = AT_commandBuffer;
+    AdrasteaI_ATMQTT_Conn_ID_Request_t request = {.connID = connID};
 
-    strcpy(pRequestCommand, "AT%MQTTCMD=\"DISCONNECT\",");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATMQTT_Commands[AdrasteaI_ATMQTT_Command_Disconnect], &request, NULL);
 }
 
 /**
@@ -690,41 +669,46 @@ bool AdrasteaI_ATMQTT_Disconnect(AdrasteaI_ATMQTT_Conn_ID_t connID)
  */
 bool AdrasteaI_ATMQTT_Subscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t QoS, AdrasteaI_ATMQTT_Topic_Name_t topicName)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%MQTTCMD=\"SUBSCRIBE\",");
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, QoS, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_MQTT, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -738,16 +722,77 @@ bool AdrasteaI_ATMQTT_Subscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATM
  */
 bool AdrasteaI_ATMQTT_Unsubscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_Topic_Name_t topicName)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%MQTTCMD=\"UNSUBSCRIBE\",");
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if (!AdrasteaI_SendRequest(pRequestCommand))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_MQTT, AdrasteaI_CNFStatus_Success, NULL))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Sends the header of the AT%MQTTCMD="PUBLISH" command (up to and including the line break that precedes
+ * the payload). Has to be called with the command lock held.
+ *
+ * payloadSize is the length declared in the header, payloadEchoLength the number of bytes following the echo of
+ * the header that the driver discards (see AdrasteaI_SendRequestWithPayload()).
+ */
+static bool AdrasteaI_ATMQTT_SendPublishHeader(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, uint32_t payloadSize, uint32_t payloadEchoLength)
+{
+    char* pRequestCommand = AT_commandBuffer;
+
+    strcpy(pRequestCommand, "AT%MQTTCMD=\"PUBLISH\",");
+
+    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return false;
+    }
+
+    if (!ATCommand_AppendArgumentInt(pRequestCommand, retain, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return false;
+    }
+
+    if (!ATCommand_AppendArgumentInt(pRequestCommand, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return false;
+    }
+
+    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return false;
+    }
+
+    if (!ATCommand_AppendArgumentInt(pRequestCommand, payloadSize, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -757,12 +802,26 @@ bool AdrasteaI_ATMQTT_Unsubscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
         return false;
     }
 
-    if (!AdrasteaI_SendRequest(pRequestCommand))
+    return AdrasteaI_SendRequestWithPayload(pRequestCommand, payloadEchoLength);
+}
+
+/**
+ * @brief Waits for the confirmation of the AT%MQTTCMD="PUBLISH" command and reads the message ID (if reported).
+ * Has to be called with the command lock held.
+ */
+static bool AdrasteaI_ATMQTT_WaitForPublishConfirm(AdrasteaI_ATMQTT_Message_ID_t* msgIDP)
+{
+    char* pResponseCommand = AT_commandBuffer;
+
+    /* The response is empty if the module does not report a message ID */
+    pResponseCommand[0] = ATCOMMAND_STRING_TERMINATE;
+
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_MQTT, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
         return false;
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
+    if ((msgIDP != NULL) && (pResponseCommand[0] != ATCOMMAND_STRING_TERMINATE) && !ATCommand_GetNextArgumentInt(&pResponseCommand, msgIDP, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -773,6 +832,8 @@ bool AdrasteaI_ATMQTT_Unsubscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
 /**
  * @brief Publish to Topic (using the AT%MQTTCMD command).
  *
+ * The payload is sent as zero terminated string. Use AdrasteaI_ATMQTT_PublishBinary() for arbitrary data.
+ *
  * @param[in] connID MQTT Connection. See AdrasteaI_ATMQTT_Conn_ID_t.
  *
  * @param[in] qos Quality of Service.
@@ -789,56 +850,129 @@ bool AdrasteaI_ATMQTT_Unsubscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
  */
 bool AdrasteaI_ATMQTT_Publish(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, char* payload, AdrasteaI_ATMQTT_Payload_Size_t payloadSize)
 {
-    char* pRequestCommand = AT_commandBuffer;
+    return AdrasteaI_ATMQTT_PublishWithMessageID(connID, qos, retain, topicName, payload, payloadSize, NULL);
+}
 
-    strcpy(pRequestCommand, "AT%MQTTCMD=\"PUBLISH\",");
+/**
+ * @brief Publish to Topic (using the AT%MQTTCMD command) and return the message ID assigned by the module.
+ *
+ * The message ID is reported again by the Publication Confirmation event (PUBCONF) when the broker has
+ * acknowledged a publication with QoS 1 or 2.
+ *
+ * @param[in] connID MQTT Connection. See AdrasteaI_ATMQTT_Conn_ID_t.
+ *
+ * @param[in] qos Quality of Service.
+ *
+ * @param[in] retain Whether or not the Will Message will be retained across disconnects.
+ *
+ * @param[in] topicName MQTT Topic Name.
+ *
+ * @param[in] payload Payload to be published to topic.
+ *
+ * @param[in] payloadSize Size of the payload in bytes.
+ *
+ * @param[out] msgIDP Message ID (AdrasteaI_ATMQTT_Message_ID_Invalid if not reported by the module). Can be NULL.
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_ATMQTT_PublishWithMessageID(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, char* payload, AdrasteaI_ATMQTT_Payload_Size_t payloadSize, AdrasteaI_ATMQTT_Message_ID_t* msgIDP)
+{
+    if (msgIDP != NULL)
+    {
+        *msgIDP = AdrasteaI_ATMQTT_Message_ID_Invalid;
+    }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (payload == NULL)
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, retain, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    size_t payloadLength = strlen(payload);
+
+    if (!AdrasteaI_ATMQTT_SendPublishHeader(connID, qos, retain, topicName, (uint32_t)payloadSize + 1, 0))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_ARGUMENT_DELIM))
+    if ((payloadLength > 0) && !AdrasteaI_Transparent_Transmit(payload, (uint16_t)payloadLength))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, payloadSize + 1, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    return AdrasteaI_EndCommand(AdrasteaI_ATMQTT_WaitForPublishConfirm(msgIDP));
+}
+
+/**
+ * @brief Publish binary data to Topic (using the AT%MQTTCMD command).
+ *
+ * Only the command header is built in AT_commandBuffer. The payload is transmitted from the supplied buffer right
+ * after the header, so it may contain arbitrary bytes (including zero bytes) and is not limited by the size of
+ * the command buffer.
+ *
+ * The header declares exactly payloadSize bytes and exactly payloadSize bytes are transmitted; unlike
+ * AdrasteaI_ATMQTT_PublishWithMessageID(), no byte is added for a string terminator. The module echoes the
+ * payload, the driver discards these payloadSize bytes instead of passing them to the line framer, so line
+ * breaks or result codes (OK, ERROR) in the payload do not end the command and the payload may be longer than
+ * ADRASTEAI_LINE_MAX_SIZE.
+ *
+ * @param[in] connID MQTT Connection. See AdrasteaI_ATMQTT_Conn_ID_t.
+ *
+ * @param[in] qos Quality of Service.
+ *
+ * @param[in] retain Whether or not the Will Message will be retained across disconnects.
+ *
+ * @param[in] topicName MQTT Topic Name.
+ *
+ * @param[in] payload Payload to be published to topic. Must stay valid until the function returns.
+ *
+ * @param[in] payloadSize Size of the payload in bytes.
+ *
+ * @param[out] msgIDP Message ID (AdrasteaI_ATMQTT_Message_ID_Invalid if not reported by the module). Can be NULL.
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_ATMQTT_PublishBinary(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, const uint8_t* payload, AdrasteaI_ATMQTT_Binary_Payload_Size_t payloadSize, AdrasteaI_ATMQTT_Message_ID_t* msgIDP)
+{
+    if (msgIDP != NULL)
     {
-        return false;
+        *msgIDP = AdrasteaI_ATMQTT_Message_ID_Invalid;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if ((payload == NULL) && (payloadSize > 0))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, payload, ATCOMMAND_STRING_TERMINATE))
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
-    if (!AdrasteaI_SendRequest(pRequestCommand))
+    if (!AdrasteaI_ATMQTT_SendPublishHeader(connID, qos, retain, topicName, payloadSize, payloadSize))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
+    /* AdrasteaI_Transparent_Transmit() takes at most 0xFFFF bytes per call */
+    while (payloadSize > 0)
     {
-        return false;
+        uint16_t length = (payloadSize > 0xFFFF) ? 0xFFFF : (uint16_t)payloadSize;
+
+        if (!AdrasteaI_Transparent_Transmit((const char*)payload, length))
+        {
+            return AdrasteaI_EndCommand(false);
+        }
+
+        payload += length;
+        payloadSize -= length;
     }
 
-    return true;
+    return AdrasteaI_EndCommand(AdrasteaI_ATMQTT_WaitForPublishConfirm(msgIDP));
 }
 
 /**
@@ -854,41 +988,46 @@ bool AdrasteaI_ATMQTT_Publish(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQT
  */
 bool AdrasteaI_ATMQTT_AWSIOTConfigureConnection(AdrasteaI_ATCommon_IP_Addr_t url, AdrasteaI_ATCommon_TLS_Profile_ID_t profileID, AdrasteaI_ATMQTT_Client_ID_t clientID)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%AWSIOTCFG=\"CONN\",");
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, url, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, clientID, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_MQTT, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -902,6 +1041,11 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureConnection(AdrasteaI_ATCommon_IP_Addr_t url
  */
 bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t sessionID, AdrasteaI_ATMQTT_IP_Addr_Format_t ipFormat)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -912,7 +1056,7 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t session
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -920,7 +1064,7 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t session
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
@@ -929,7 +1073,7 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t session
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -938,20 +1082,20 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t session
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_MQTT, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -965,36 +1109,9 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t session
  */
 bool AdrasteaI_ATMQTT_AWSIOTConfigureProtocol(AdrasteaI_ATMQTT_Keep_Alive_t keepAlive, AdrasteaI_ATMQTT_AWSIOT_QoS_t qos)
 {
-    char* pRequestCommand = AT_commandBuffer;
+    AdrasteaI_ATMQTT_AWSIOT_Protocol_Request_t request = {.keepAlive = keepAlive, .qos = qos};
 
-    strcpy(pRequestCommand, "AT%AWSIOTCFG=\"PROTOCOL\",");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, keepAlive, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATMQTT_Commands[AdrasteaI_ATMQTT_Command_AWSIOTConfigureProtocol], &request, NULL);
 }
 
 /**
@@ -1008,36 +1125,9 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureProtocol(AdrasteaI_ATMQTT_Keep_Alive_t keep
  */
 bool AdrasteaI_ATMQTT_SetAWSIOTUnsolicitedNotificationEvents(AdrasteaI_ATMQTT_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%AWSIOTEV=");
-
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATMQTT_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
+    AdrasteaI_ATMQTT_Event_Request_t request = {.event = event, .state = state};
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATMQTT_Commands[AdrasteaI_ATMQTT_Command_SetAWSIOTUnsolicitedNotificationEvents], &request, NULL);
 }
 
 /**
@@ -1055,9 +1145,14 @@ bool AdrasteaI_ATMQTT_ParseAWSIOTConnectionConfirmationEvent(char* pEventArgumen
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
+
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 1))
+    {
+        return false;
+    }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
         return false;
     }
@@ -1090,14 +1185,19 @@ bool AdrasteaI_ATMQTT_ParseAWSIOTSubscriptionConfirmationEvent(char* pEventArgum
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
+
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 2))
+    {
+        return false;
+    }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->msgID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, &dataP->msgID, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->resultCode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_GetArgumentInt(&arguments, 1, &dataP->resultCode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
         return false;
     }
@@ -1140,14 +1240,19 @@ bool AdrasteaI_ATMQTT_ParseAWSIOTPublicationReceivedEvent(char* pEventArguments,
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, dataP->topicName, ATCOMMAND_ARGUMENT_DELIM, sizeof(AdrasteaI_ATMQTT_Topic_Name_t)))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count < 2))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, dataP->payload, ATCOMMAND_STRING_TERMINATE, dataP->payloadMaxBufferSize))
+    if (!ATCommand_GetArgumentStringWithoutQuotationMarks(&arguments, 0, dataP->topicName, sizeof(AdrasteaI_ATMQTT_Topic_Name_t)))
+    {
+        return false;
+    }
+
+    if (!ATCommand_GetArgumentRemainderWithoutQuotationMarks(&arguments, 1, dataP->payload, dataP->payloadMaxBufferSize))
     {
         return false;
     }
@@ -1162,17 +1267,7 @@ bool AdrasteaI_ATMQTT_ParseAWSIOTPublicationReceivedEvent(char* pEventArguments,
  */
 bool AdrasteaI_ATMQTT_AWSIOTConnect()
 {
-    if (!AdrasteaI_SendRequest("AT%AWSIOTCMD=\"CONNECT\"\r\n"))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATMQTT_Commands[AdrasteaI_ATMQTT_Command_AWSIOTConnect], NULL, NULL);
 }
 
 /**
@@ -1182,17 +1277,7 @@ bool AdrasteaI_ATMQTT_AWSIOTConnect()
  */
 bool AdrasteaI_ATMQTT_AWSIOTDisconnect()
 {
-    if (!AdrasteaI_SendRequest("AT%AWSIOTCMD=\"DISCONNECT\"\r\n"))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATMQTT_Commands[AdrasteaI_ATMQTT_Command_AWSIOTDisconnect], NULL, NULL);
 }
 
 /**
@@ -1204,31 +1289,36 @@ bool AdrasteaI_ATMQTT_AWSIOTDisconnect()
  */
 bool AdrasteaI_ATMQTT_AWSIOTSubscribe(AdrasteaI_ATMQTT_Topic_Name_t topicName)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%AWSIOTCMD=\"SUBSCRIBE\",");
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_MQTT, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -1240,31 +1330,36 @@ bool AdrasteaI_ATMQTT_AWSIOTSubscribe(AdrasteaI_ATMQTT_Topic_Name_t topicName)
  */
 bool AdrasteaI_ATMQTT_AWSIOTUnsubscribe(AdrasteaI_ATMQTT_Topic_Name_t topicName)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%AWSIOTCMD=\"UNSUBSCRIBE\",");
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_MQTT, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -1278,34 +1373,39 @@ bool AdrasteaI_ATMQTT_AWSIOTUnsubscribe(AdrasteaI_ATMQTT_Topic_Name_t topicName)
  */
 bool AdrasteaI_ATMQTT_AWSIOTPublish(AdrasteaI_ATMQTT_Topic_Name_t topicName, char* payload)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%AWSIOTCMD=\"PUBLISH\",");
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, payload, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_MQTT), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_MQTT, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
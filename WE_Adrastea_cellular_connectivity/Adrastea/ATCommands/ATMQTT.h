@@ -168,6 +168,8 @@ extern "C"
 
     typedef uint16_t AdrasteaI_ATMQTT_Message_ID_t;
 
+#define AdrasteaI_ATMQTT_Message_ID_Invalid 0
+
     /**
  * @brief MQTT Subscription/Publication Confirmation Result
  */
@@ -183,6 +185,8 @@ extern "C"
 
     typedef uint8_t AdrasteaI_ATMQTT_Payload_Size_t;
 
+    typedef uint32_t AdrasteaI_ATMQTT_Binary_Payload_Size_t;
+
     /**
  * @brief MQTT Publication Received Result
  */
@@ -272,6 +276,10 @@ extern "C"
 
     extern bool AdrasteaI_ATMQTT_Publish(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, char* payload, AdrasteaI_ATMQTT_Payload_Size_t payloadSize);
 
+    extern bool AdrasteaI_ATMQTT_PublishWithMessageID(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, char* payload, AdrasteaI_ATMQTT_Payload_Size_t payloadSize, AdrasteaI_ATMQTT_Message_ID_t* msgIDP);
+
+    extern bool AdrasteaI_ATMQTT_PublishBinary(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, const uint8_t* payload, AdrasteaI_ATMQTT_Binary_Payload_Size_t payloadSize, AdrasteaI_ATMQTT_Message_ID_t* msgIDP);
+
     extern bool AdrasteaI_ATMQTT_AWSIOTConfigureConnection(AdrasteaI_ATCommon_IP_Addr_t url, AdrasteaI_ATCommon_TLS_Profile_ID_t profileID, AdrasteaI_ATMQTT_Client_ID_t clientID);
 
     extern bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t sessionID, AdrasteaI_ATMQTT_IP_Addr_Format_t ipFormat);
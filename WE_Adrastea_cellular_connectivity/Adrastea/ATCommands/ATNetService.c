@@ -28,12 +28,52 @@
  * @brief AT commands for Net Service functionality.
  */
 #include <stdio.h>
-#include <Math.h>
 
 #include "ATNetService.h"
 #include "Adrastea/AdrasteaI.h"
 #include "ATCommands.h"
 
+static const ATCommand_Field_t AdrasteaI_ATNetService_Signal_Quality_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATNetService_Signal_Quality_t, rssi, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATNetService_Signal_Quality_t, ber, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+static const ATCommand_Field_t AdrasteaI_ATNetService_Extended_Signal_Quality_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATNetService_Extended_Signal_Quality_t, rxlev, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATNetService_Extended_Signal_Quality_t, ber, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATNetService_Extended_Signal_Quality_t, rscp, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATNetService_Extended_Signal_Quality_t, ecno, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATNetService_Extended_Signal_Quality_t, rsrq, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATNetService_Extended_Signal_Quality_t, rsrp, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief Request of AdrasteaI_ATNetService_SetPLMNReadFormat().
+ */
+typedef struct AdrasteaI_ATNetService_PLMN_Format_Request_t
+{
+    AdrasteaI_ATNetService_PLMN_Format_t format;
+} AdrasteaI_ATNetService_PLMN_Format_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATNetService_PLMN_Format_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATNetService_PLMN_Format_Request_t, format, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief Net service commands with fixed argument layout, see AdrasteaI_Command_t.
+ */
+#define ADRASTEAI_ATNETSERVICE_COMMANDS(COMMAND)                                                                                                                                                           \
+    COMMAND(AdrasteaI_ATNetService_Command_ReadOperators, "AT+COPN", NetService, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_NO_FIELDS)                                                                 \
+    COMMAND(AdrasteaI_ATNetService_Command_ReadSignalQuality, "AT+CSQ", NetService, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATNetService_Signal_Quality_Fields))                   \
+    COMMAND(AdrasteaI_ATNetService_Command_ReadExtendedSignalQuality, "AT+CESQ", NetService, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATNetService_Extended_Signal_Quality_Fields)) \
+    COMMAND(AdrasteaI_ATNetService_Command_SetPLMNReadFormat, "AT+COPS=3,", NetService, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATNetService_PLMN_Format_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)
+
+typedef enum AdrasteaI_ATNetService_Command_t
+{
+    ADRASTEAI_ATNETSERVICE_COMMANDS(ADRASTEAI_COMMAND_ID) AdrasteaI_ATNetService_Command_NumberOfValues
+} AdrasteaI_ATNetService_Command_t;
+
+static const AdrasteaI_Command_t AdrasteaI_ATNetService_Commands[AdrasteaI_ATNetService_Command_NumberOfValues] = {ADRASTEAI_ATNETSERVICE_COMMANDS(ADRASTEAI_COMMAND_DESCRIPTOR)};
 
 /**
  * @brief Read Operators from memory (using the AT+COPN command).
@@ -42,17 +82,7 @@
  */
 bool AdrasteaI_ATNetService_ReadOperators()
 {
-    if (!AdrasteaI_SendRequest("AT+COPN\r\n"))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATNetService_Commands[AdrasteaI_ATNetService_Command_ReadOperators], NULL, NULL);
 }
 
 /**
@@ -70,18 +100,19 @@ bool AdrasteaI_ATNetService_ParseOperatorReadEvent(char* pEventArguments, Adrast
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    argumentsP += 1;
-
-    if (!ATCommand_GetNextArgumentIntWithoutQuotationMarks(&argumentsP, &dataP->operatorNumeric, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE32), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 2))
     {
         return false;
     }
 
-    argumentsP += 1;
+    if (!ATCommand_GetArgumentIntWithoutQuotationMarks(&arguments, 0, &dataP->operatorNumeric, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE32)))
+    {
+        return false;
+    }
 
-    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, dataP->operatorString, ATCOMMAND_STRING_TERMINATE, sizeof(dataP->operatorString)))
+    if (!ATCommand_GetArgumentStringWithoutQuotationMarks(&arguments, 1, dataP->operatorString, sizeof(dataP->operatorString)))
     {
         return false;
     }
@@ -98,31 +129,9 @@ bool AdrasteaI_ATNetService_ParseOperatorReadEvent(char* pEventArguments, Adrast
  */
 bool AdrasteaI_ATNetService_SetPLMNReadFormat(AdrasteaI_ATNetService_PLMN_Format_t format)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT+COPS=3,");
+    AdrasteaI_ATNetService_PLMN_Format_Request_t request = {.format = format};
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATNetService_Commands[AdrasteaI_ATNetService_Command_SetPLMNReadFormat], &request, NULL);
 }
 
 /**
@@ -134,13 +143,18 @@ bool AdrasteaI_ATNetService_SetPLMNReadFormat(AdrasteaI_ATNetService_PLMN_Format
  */
 bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     switch (plmn.selectionMode)
     {
         case AdrasteaI_ATNetService_PLMN_Selection_Mode_Automatic:
         {
             if (!AdrasteaI_SendRequest("AT+COPS=0\r\n"))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
@@ -155,7 +169,7 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
 
             if (!ATCommand_AppendArgumentInt(pRequestCommand, plmn.format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             switch (plmn.format)
@@ -165,7 +179,7 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
                 {
                     if (!ATCommand_AppendArgumentString(pRequestCommand, plmn.operator.operatorString, ATCOMMAND_STRING_TERMINATE))
                     {
-                        return false;
+                        return AdrasteaI_EndCommand(false);
                     }
 
                     break;
@@ -174,13 +188,13 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
                 {
                     if (!ATCommand_AppendArgumentIntQuotationMarks(pRequestCommand, plmn.operator.operatorNumeric, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                     {
-                        return false;
+                        return AdrasteaI_EndCommand(false);
                     }
 
                     break;
                 }
                 default:
-                    return false;
+                    return AdrasteaI_EndCommand(false);
                     break;
             }
 
@@ -188,7 +202,7 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
             {
                 if (!ATCommand_AppendArgumentInt(pRequestCommand, plmn.accessTechnology, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                 {
-                    return false;
+                    return AdrasteaI_EndCommand(false);
                 }
                 AdrasteaI_optionalParamsDelimCount = 0;
             }
@@ -197,12 +211,12 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
 
             if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!AdrasteaI_SendRequest(pRequestCommand))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
@@ -211,22 +225,22 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
         {
             if (!AdrasteaI_SendRequest("AT+COPS=2\r\n"))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
         }
         default:
-            return false;
+            return AdrasteaI_EndCommand(false);
             break;
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_NetService, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -238,21 +252,26 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
  */
 bool AdrasteaI_ATNetService_ReadPLMN(AdrasteaI_ATNetService_PLMN_t* plmnP)
 {
-    if (plmnP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (plmnP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+COPS?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_NetService, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
@@ -268,7 +287,7 @@ bool AdrasteaI_ATNetService_ReadPLMN(AdrasteaI_ATNetService_PLMN_t* plmnP)
         {
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &plmnP->selectionMode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
             break;
         }
@@ -276,12 +295,12 @@ bool AdrasteaI_ATNetService_ReadPLMN(AdrasteaI_ATNetService_PLMN_t* plmnP)
         {
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &plmnP->selectionMode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &plmnP->format, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             switch (plmnP->format)
@@ -291,7 +310,7 @@ bool AdrasteaI_ATNetService_ReadPLMN(AdrasteaI_ATNetService_PLMN_t* plmnP)
                 {
                     if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, plmnP->operator.operatorString, ATCOMMAND_ARGUMENT_DELIM, sizeof(plmnP->operator.operatorString)))
                     {
-                        return false;
+                        return AdrasteaI_EndCommand(false);
                     }
 
                     break;
@@ -300,29 +319,29 @@ bool AdrasteaI_ATNetService_ReadPLMN(AdrasteaI_ATNetService_PLMN_t* plmnP)
                 {
                     if (!ATCommand_GetNextArgumentIntWithoutQuotationMarks(&pResponseCommand, &plmnP->operator.operatorNumeric, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE32), ATCOMMAND_ARGUMENT_DELIM))
                     {
-                        return false;
+                        return AdrasteaI_EndCommand(false);
                     }
 
                     break;
                 }
                 default:
-                    return false;
+                    return AdrasteaI_EndCommand(false);
                     break;
             }
 
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &plmnP->accessTechnology, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
         }
         default:
-            return false;
+            return AdrasteaI_EndCommand(false);
             break;
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -338,32 +357,7 @@ bool AdrasteaI_ATNetService_ReadSignalQuality(AdrasteaI_ATNetService_Signal_Qual
     {
         return false;
     }
-
-    if (!AdrasteaI_SendRequest("AT+CSQ\r\n"))
-    {
-        return false;
-    }
-
-    char* pResponseCommand = AT_commandBuffer;
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, pResponseCommand))
-    {
-        return false;
-    }
-
-    pResponseCommand += 1;
-
-    if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &sq->rssi, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &sq->ber, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATNetService_Commands[AdrasteaI_ATNetService_Command_ReadSignalQuality], NULL, sq);
 }
 
 /**
@@ -379,52 +373,7 @@ bool AdrasteaI_ATNetService_ReadExtendedSignalQuality(AdrasteaI_ATNetService_Ext
     {
         return false;
     }
-
-    if (!AdrasteaI_SendRequest("AT+CESQ\r\n"))
-    {
-        return false;
-    }
-
-    char* pResponseCommand = AT_commandBuffer;
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, pResponseCommand))
-    {
-        return false;
-    }
-
-    pResponseCommand += 1;
-
-    if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &esq->rxlev, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &esq->ber, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &esq->rscp, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &esq->ecno, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &esq->rsrq, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &esq->rsrp, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATNetService_Commands[AdrasteaI_ATNetService_Command_ReadExtendedSignalQuality], NULL, esq);
 }
 
 /**
@@ -436,21 +385,26 @@ bool AdrasteaI_ATNetService_ReadExtendedSignalQuality(AdrasteaI_ATNetService_Ext
  */
 bool AdrasteaI_ATNetService_ReadPowerSavingMode(AdrasteaI_ATNetService_Power_Saving_Mode_t* psmP)
 {
-    if (psmP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (psmP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CPSMS?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_NetService, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
@@ -459,30 +413,30 @@ bool AdrasteaI_ATNetService_ReadPowerSavingMode(AdrasteaI_ATNetService_Power_Sav
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &psmP->state, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentString(&pResponseCommand, temp, ATCOMMAND_ARGUMENT_DELIM, sizeof(temp)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentString(&pResponseCommand, temp, ATCOMMAND_ARGUMENT_DELIM, sizeof(temp)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentBitsWithoutQuotationMarks(&pResponseCommand, &psmP->periodicTAU.periodicTAU, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentBitsWithoutQuotationMarks(&pResponseCommand, &psmP->activeTime.activeTime, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -494,6 +448,11 @@ bool AdrasteaI_ATNetService_ReadPowerSavingMode(AdrasteaI_ATNetService_Power_Sav
  */
 bool AdrasteaI_ATNetService_SetPowerSavingMode(AdrasteaI_ATNetService_Power_Saving_Mode_t psm)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT+CPSMS=");
@@ -504,7 +463,7 @@ bool AdrasteaI_ATNetService_SetPowerSavingMode(AdrasteaI_ATNetService_Power_Savi
         {
             if (!ATCommand_AppendArgumentInt(pRequestCommand, AdrasteaI_ATNetService_Power_Saving_Mode_State_Disable, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
@@ -513,52 +472,52 @@ bool AdrasteaI_ATNetService_SetPowerSavingMode(AdrasteaI_ATNetService_Power_Savi
         {
             if (!ATCommand_AppendArgumentInt(pRequestCommand, AdrasteaI_ATNetService_Power_Saving_Mode_State_Enable, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_AppendArgumentBitsQuotationMarks(pRequestCommand, psm.periodicTAU.periodicTAU, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_AppendArgumentBitsQuotationMarks(pRequestCommand, psm.activeTime.activeTime, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
         }
         default:
-            return false;
+            return AdrasteaI_EndCommand(false);
             break;
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_NetService, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -572,6 +531,11 @@ bool AdrasteaI_ATNetService_SetPowerSavingMode(AdrasteaI_ATNetService_Power_Savi
  */
 bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX_Mode_t mode, AdrasteaI_ATNetService_eDRX_t edrx)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT+CEDRXS=");
@@ -583,7 +547,7 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
         {
             if (!ATCommand_AppendArgumentInt(pRequestCommand, mode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
@@ -595,14 +559,14 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
 
             if (!ATCommand_AppendArgumentInt(pRequestCommand, mode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (edrx.AcT > AdrasteaI_ATNetService_eDRX_AcT_NotUsingeDRX)
             {
                 if (!ATCommand_AppendArgumentInt(pRequestCommand, edrx.AcT, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
                 {
-                    return false;
+                    return AdrasteaI_EndCommand(false);
                 }
                 AdrasteaI_optionalParamsDelimCount = 1;
             }
@@ -610,7 +574,7 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
             {
                 if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
                 {
-                    return false;
+                    return AdrasteaI_EndCommand(false);
                 }
                 AdrasteaI_optionalParamsDelimCount++;
             }
@@ -619,7 +583,7 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
             {
                 if (!ATCommand_AppendArgumentBitsQuotationMarks(pRequestCommand, edrx.requestedValue, (ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
                 {
-                    return false;
+                    return AdrasteaI_EndCommand(false);
                 }
                 AdrasteaI_optionalParamsDelimCount = 0;
             }
@@ -630,26 +594,26 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
         }
 
         default:
-            return false;
+            return AdrasteaI_EndCommand(false);
             break;
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_NetService, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -661,21 +625,26 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
  */
 bool AdrasteaI_ATNetService_ReadeDRXDynamicParameters(AdrasteaI_ATNetService_eDRX_t* edrxP)
 {
-    if (edrxP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (edrxP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CEDRXRDP\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_NetService, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
@@ -690,7 +659,7 @@ bool AdrasteaI_ATNetService_ReadeDRXDynamicParameters(AdrasteaI_ATNetService_eDR
         {
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &edrxP->AcT, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
@@ -699,31 +668,31 @@ bool AdrasteaI_ATNetService_ReadeDRXDynamicParameters(AdrasteaI_ATNetService_eDR
         {
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &edrxP->AcT, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_GetNextArgumentBitsWithoutQuotationMarks(&pResponseCommand, &edrxP->requestedValue, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_GetNextArgumentBitsWithoutQuotationMarks(&pResponseCommand, &edrxP->networkProvidedValue, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_GetNextArgumentBitsWithoutQuotationMarks(&pResponseCommand, &edrxP->pagingTime, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
         }
         default:
-            return false;
+            return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -735,21 +704,26 @@ bool AdrasteaI_ATNetService_ReadeDRXDynamicParameters(AdrasteaI_ATNetService_eDR
  */
 bool AdrasteaI_ATNetService_ReadCoverageEnhancementStatus(AdrasteaI_ATNetService_CES_t* cesP)
 {
-    if (cesP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (cesP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CRCES\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_NetService), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_NetService, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
@@ -760,7 +734,7 @@ bool AdrasteaI_ATNetService_ReadCoverageEnhancementStatus(AdrasteaI_ATNetService
         {
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &cesP->AcT, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
             break;
         }
@@ -768,28 +742,28 @@ bool AdrasteaI_ATNetService_ReadCoverageEnhancementStatus(AdrasteaI_ATNetService
         {
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &cesP->AcT, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             pResponseCommand += 1;
 
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &cesP->coverageEnhacementLevel, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             pResponseCommand += 1;
 
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &cesP->coverageClass, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
         }
         default:
-            return false;
+            return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
@@ -33,13 +33,51 @@
 #include "Adrastea/AdrasteaI.h"
 #include "ATCommands.h"
 
-static const char* AdrasteaI_ATPacketDomain_PDP_Type_Strings[AdrasteaI_ATPacketDomain_PDP_Type_NumberOfValues] = {
-    "IP",
-    "IPV6",
-    "IPV4V6",
-    "Non−IP",
+#define AdrasteaI_ATPacketDomain_PDP_Type_Entries(ENTRY)      \
+    ENTRY("IP", AdrasteaI_ATPacketDomain_PDP_Type_IPv4)       \
+    ENTRY("IPV6", AdrasteaI_ATPacketDomain_PDP_Type_IPv6)     \
+    ENTRY("IPV4V6", AdrasteaI_ATPacketDomain_PDP_Type_IPv4v6) \
+    ENTRY("Non−IP", AdrasteaI_ATPacketDomain_PDP_Type_Non_IP)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATPacketDomain_PDP_Type_Strings, AdrasteaI_ATPacketDomain_PDP_Type_NumberOfValues, AdrasteaI_ATPacketDomain_PDP_Type_Entries);
+
+static const ATCommand_Field_t AdrasteaI_ATPacketDomain_PDP_Context_State_CID_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATPacketDomain_PDP_Context_CID_State_t, state, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATPacketDomain_PDP_Context_CID_State_t, cid, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+static const ATCommand_Field_t AdrasteaI_ATPacketDomain_PDP_Context_CID_State_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATPacketDomain_PDP_Context_CID_State_t, cid, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATPacketDomain_PDP_Context_CID_State_t, state, ATCOMMAND_INTFLAGS_UNSIGNED),
 };
 
+/**
+ * @brief Request of AdrasteaI_ATPacketDomain_SetNetworkRegistrationResultCode().
+ */
+typedef struct AdrasteaI_ATPacketDomain_Network_Registration_Result_Code_Request_t
+{
+    AdrasteaI_ATPacketDomain_Network_Registration_Result_Code_t resultcode;
+} AdrasteaI_ATPacketDomain_Network_Registration_Result_Code_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATPacketDomain_Network_Registration_Result_Code_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATPacketDomain_Network_Registration_Result_Code_Request_t, resultcode, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief Packet domain commands with fixed argument layout, see AdrasteaI_Command_t.
+ */
+#define ADRASTEAI_ATPACKETDOMAIN_COMMANDS(COMMAND)                                                                                                                                                        \
+    COMMAND(AdrasteaI_ATPacketDomain_Command_ReadPDPContexts, "AT+CGDCONT?", PacketDomain, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_NO_FIELDS)                                                      \
+    COMMAND(AdrasteaI_ATPacketDomain_Command_SetPDPContextState, "AT+CGACT=", PacketDomain, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATPacketDomain_PDP_Context_State_CID_Fields), ADRASTEAI_COMMAND_NO_FIELDS) \
+    COMMAND(AdrasteaI_ATPacketDomain_Command_ReadPDPContextsState, "AT+CGACT?", PacketDomain, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_NO_FIELDS)                                                   \
+    COMMAND(AdrasteaI_ATPacketDomain_Command_SetNetworkRegistrationResultCode, "AT+CEREG=", PacketDomain, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATPacketDomain_Network_Registration_Result_Code_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)
+
+typedef enum AdrasteaI_ATPacketDomain_Command_t
+{
+    ADRASTEAI_ATPACKETDOMAIN_COMMANDS(ADRASTEAI_COMMAND_ID) AdrasteaI_ATPacketDomain_Command_NumberOfValues
+} AdrasteaI_ATPacketDomain_Command_t;
+
+static const AdrasteaI_Command_t AdrasteaI_ATPacketDomain_Commands[AdrasteaI_ATPacketDomain_Command_NumberOfValues] = {ADRASTEAI_ATPACKETDOMAIN_COMMANDS(ADRASTEAI_COMMAND_DESCRIPTOR)};
+
 /**
  * @brief Set Network Registration Result Code (using the AT+CEREG command).
  *
@@ -49,31 +87,9 @@ static const char* AdrasteaI_ATPacketDomain_PDP_Type_Strings[AdrasteaI_ATPacketD
  */
 bool AdrasteaI_ATPacketDomain_SetNetworkRegistrationResultCode(AdrasteaI_ATPacketDomain_Network_Registration_Result_Code_t resultcode)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT+CEREG=");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, resultcode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_PacketDomain), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
+    AdrasteaI_ATPacketDomain_Network_Registration_Result_Code_Request_t request = {.resultcode = resultcode};
 
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATPacketDomain_Commands[AdrasteaI_ATPacketDomain_Command_SetNetworkRegistrationResultCode], &request, NULL);
 }
 
 /**
@@ -85,21 +101,26 @@ bool AdrasteaI_ATPacketDomain_SetNetworkRegistrationResultCode(AdrasteaI_ATPacke
  */
 bool AdrasteaI_ATPacketDomain_ReadNetworkRegistrationStatus(AdrasteaI_ATPacketDomain_Network_Registration_Status_t* statusP)
 {
-    if (statusP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (statusP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CEREG?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_PacketDomain), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_PacketDomain, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
@@ -112,7 +133,7 @@ bool AdrasteaI_ATPacketDomain_ReadNetworkRegistrationStatus(AdrasteaI_ATPacketDo
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &statusP->resultCode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     switch (statusP->resultCode)
@@ -122,7 +143,7 @@ bool AdrasteaI_ATPacketDomain_ReadNetworkRegistrationStatus(AdrasteaI_ATPacketDo
         {
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &statusP->state, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
@@ -131,32 +152,32 @@ bool AdrasteaI_ATPacketDomain_ReadNetworkRegistrationStatus(AdrasteaI_ATPacketDo
         {
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &statusP->state, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, statusP->TAC, ATCOMMAND_ARGUMENT_DELIM, sizeof(statusP->TAC)))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, statusP->ECI, ATCOMMAND_ARGUMENT_DELIM, sizeof(statusP->ECI)))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &statusP->AcT, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
         }
         default:
-            return false;
+            return AdrasteaI_EndCommand(false);
             break;
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -174,9 +195,7 @@ bool AdrasteaI_ATPacketDomain_ParseNetworkRegistrationStatusEvent(char* pEventAr
         return false;
     }
 
-    char* argumentsP = pEventArguments;
-
-    argumentsP += 1;
+    ATCommand_Arguments_t arguments;
 
     dataP->resultCode = AdrasteaI_ATPacketDomain_Network_Registration_Result_Code_Invalid;
 
@@ -186,11 +205,16 @@ bool AdrasteaI_ATPacketDomain_ParseNetworkRegistrationStatusEvent(char* pEventAr
 
     dataP->AcT = AdrasteaI_ATCommon_AcT_Invalid;
 
-    switch (ATCommand_CountArgs(argumentsP))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments))
+    {
+        return false;
+    }
+
+    switch (arguments.count)
     {
         case 1:
         {
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_GetArgumentInt(&arguments, 0, &dataP->state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8)))
             {
                 return false;
             }
@@ -199,22 +223,22 @@ bool AdrasteaI_ATPacketDomain_ParseNetworkRegistrationStatusEvent(char* pEventAr
         }
         case 4:
         {
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_GetArgumentInt(&arguments, 0, &dataP->state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8)))
             {
                 return false;
             }
 
-            if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, dataP->TAC, ATCOMMAND_ARGUMENT_DELIM, sizeof(dataP->TAC)))
+            if (!ATCommand_GetArgumentStringWithoutQuotationMarks(&arguments, 1, dataP->TAC, sizeof(dataP->TAC)))
             {
                 return false;
             }
 
-            if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, dataP->ECI, ATCOMMAND_ARGUMENT_DELIM, sizeof(dataP->ECI)))
+            if (!ATCommand_GetArgumentStringWithoutQuotationMarks(&arguments, 2, dataP->ECI, sizeof(dataP->ECI)))
             {
                 return false;
             }
 
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->AcT, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_GetArgumentInt(&arguments, 3, &dataP->AcT, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
             {
                 return false;
             }
@@ -237,6 +261,11 @@ bool AdrasteaI_ATPacketDomain_ParseNetworkRegistrationStatusEvent(char* pEventAr
  */
 bool AdrasteaI_ATPacketDomain_SetPacketDomainEventReporting(AdrasteaI_ATPacketDomain_Event_Reporting_t reporting)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -245,14 +274,14 @@ bool AdrasteaI_ATPacketDomain_SetPacketDomainEventReporting(AdrasteaI_ATPacketDo
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, reporting.mode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (reporting.mode != AdrasteaI_ATPacketDomain_Event_Reporting_Mode_Buffer_Unsolicited_Result_Codes_if_Full_Discard && reporting.buffer != AdrasteaI_ATPacketDomain_Event_Reporting_Buffer_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, reporting.buffer, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -261,20 +290,20 @@ bool AdrasteaI_ATPacketDomain_SetPacketDomainEventReporting(AdrasteaI_ATPacketDo
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_PacketDomain), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_PacketDomain, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -286,34 +315,39 @@ bool AdrasteaI_ATPacketDomain_SetPacketDomainEventReporting(AdrasteaI_ATPacketDo
  */
 bool AdrasteaI_ATPacketDomain_ReadPacketDomainEventReporting(AdrasteaI_ATPacketDomain_Event_Reporting_t* reportingP)
 {
-    if (reportingP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (reportingP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CGEREP?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_PacketDomain), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_PacketDomain, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &reportingP->mode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &reportingP->buffer, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -325,6 +359,11 @@ bool AdrasteaI_ATPacketDomain_ReadPacketDomainEventReporting(AdrasteaI_ATPacketD
  */
 bool AdrasteaI_ATPacketDomain_DefinePDPContext(AdrasteaI_ATPacketDomain_PDP_Context_t context)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -333,19 +372,19 @@ bool AdrasteaI_ATPacketDomain_DefinePDPContext(AdrasteaI_ATPacketDomain_PDP_Cont
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, context.cid, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATPacketDomain_PDP_Type_Strings[context.pdpType], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATPacketDomain_PDP_Type_Strings.strings[context.pdpType], ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (strlen(context.apnName) != 0)
     {
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, context.apnName, ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -354,20 +393,20 @@ bool AdrasteaI_ATPacketDomain_DefinePDPContext(AdrasteaI_ATPacketDomain_PDP_Cont
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_PacketDomain), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_PacketDomain, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -377,17 +416,7 @@ bool AdrasteaI_ATPacketDomain_DefinePDPContext(AdrasteaI_ATPacketDomain_PDP_Cont
  */
 bool AdrasteaI_ATPacketDomain_ReadPDPContexts()
 {
-    if (!AdrasteaI_SendRequest("AT+CGDCONT?\r\n"))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_PacketDomain), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATPacketDomain_Commands[AdrasteaI_ATPacketDomain_Command_ReadPDPContexts], NULL, NULL);
 }
 
 /**
@@ -405,19 +434,24 @@ bool AdrasteaI_ATPacketDomain_ParsePDPContextEvent(char* pEventArguments, Adrast
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->cid, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count < 3))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&argumentsP, (uint8_t*)&dataP->pdpType, AdrasteaI_ATPacketDomain_PDP_Type_Strings, AdrasteaI_ATPacketDomain_PDP_Type_NumberOfValues, 30, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, &dataP->cid, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8)))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, dataP->apnName, ATCOMMAND_ARGUMENT_DELIM, sizeof(AdrasteaI_ATCommon_APN_Name_t)))
+    if (!ATCommand_GetArgumentEnumWithoutQuotationMarks(&arguments, 1, (uint8_t*)&dataP->pdpType, &AdrasteaI_ATPacketDomain_PDP_Type_Strings, 30))
+    {
+        return false;
+    }
+
+    if (!ATCommand_GetArgumentStringWithoutQuotationMarks(&arguments, 2, dataP->apnName, sizeof(AdrasteaI_ATCommon_APN_Name_t)))
     {
         return false;
     }
@@ -434,36 +468,7 @@ bool AdrasteaI_ATPacketDomain_ParsePDPContextEvent(char* pEventArguments, Adrast
  */
 bool AdrasteaI_ATPacketDomain_SetPDPContextState(AdrasteaI_ATPacketDomain_PDP_Context_CID_State_t cidstate)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT+CGACT=");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, cidstate.state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, cidstate.cid, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_PacketDomain), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATPacketDomain_Commands[AdrasteaI_ATPacketDomain_Command_SetPDPContextState], &cidstate, NULL);
 }
 
 /**
@@ -473,17 +478,7 @@ bool AdrasteaI_ATPacketDomain_SetPDPContextState(AdrasteaI_ATPacketDomain_PDP_Co
  */
 bool AdrasteaI_ATPacketDomain_ReadPDPContextsState()
 {
-    if (!AdrasteaI_SendRequest("AT+CGACT?\r\n"))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_PacketDomain), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATPacketDomain_Commands[AdrasteaI_ATPacketDomain_Command_ReadPDPContextsState], NULL, NULL);
 }
 
 /**
@@ -501,17 +496,12 @@ bool AdrasteaI_ATPacketDomain_ParsePDPContextStateEvent(char* pEventArguments, A
         return false;
     }
 
-    char* argumentsP = pEventArguments;
-
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->cid, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
+    ATCommand_Arguments_t arguments;
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 2))
     {
         return false;
     }
 
-    return true;
+    return ATCommand_GetFields(&arguments, 0, AdrasteaI_ATPacketDomain_PDP_Context_CID_State_Fields, (uint8_t)(sizeof(AdrasteaI_ATPacketDomain_PDP_Context_CID_State_Fields) / sizeof(AdrasteaI_ATPacketDomain_PDP_Context_CID_State_Fields[0])), dataP);
 }
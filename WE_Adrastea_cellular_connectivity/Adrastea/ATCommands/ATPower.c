@@ -36,11 +36,11 @@
 
 
 
-static const char* AdrasteaI_ATPower_Mode_Strings[AdrasteaI_ATPower_Mode_NumberOfValues] = {
-    "stop",
-    "standby",
-    "shutdown",
-};
+#define AdrasteaI_ATPower_Mode_Entries(ENTRY)          \
+    ENTRY("stop", AdrasteaI_ATPower_Mode_Stop)         \
+    ENTRY("standby", AdrasteaI_ATPower_Mode_Standby)   \
+    ENTRY("shutdown", AdrasteaI_ATPower_Mode_Shutdown)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATPower_Mode_Strings, AdrasteaI_ATPower_Mode_NumberOfValues, AdrasteaI_ATPower_Mode_Entries);
 
 /**
  * @brief Set MCU Power Mode (using the pwrMode command).
@@ -53,6 +53,11 @@ static const char* AdrasteaI_ATPower_Mode_Strings[AdrasteaI_ATPower_Mode_NumberO
  */
 bool AdrasteaI_ATPower_SetPowerMode(AdrasteaI_ATPower_Mode_t mode, AdrasteaI_ATPower_Mode_Duration_t duration)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_Transparent_Transmit("\x04", 1);
 
     while (AdrasteaI_CheckATMode() != AdrasteaI_ATMode_Off)
@@ -66,16 +71,16 @@ bool AdrasteaI_ATPower_SetPowerMode(AdrasteaI_ATPower_Mode_t mode, AdrasteaI_ATP
     strcpy(pRequestCommand, "pwrMode ");
     
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, AdrasteaI_ATPower_Mode_Strings[mode], ' '))
+    if (!ATCommand_AppendArgumentString(pRequestCommand, AdrasteaI_ATPower_Mode_Strings.strings[mode], ' '))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (duration != AdrasteaI_ATPower_Mode_Duration_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, duration, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         AdrasteaI_optionalParamsDelimCount = 0;
@@ -85,17 +90,17 @@ bool AdrasteaI_ATPower_SetPowerMode(AdrasteaI_ATPower_Mode_t mode, AdrasteaI_ATP
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Power), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Power, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     AdrasteaI_Transparent_Transmit("map\r\n", 5);
@@ -104,7 +109,7 @@ bool AdrasteaI_ATPower_SetPowerMode(AdrasteaI_ATPower_Mode_t mode, AdrasteaI_ATP
     {
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -116,6 +121,11 @@ bool AdrasteaI_ATPower_SetPowerMode(AdrasteaI_ATPower_Mode_t mode, AdrasteaI_ATP
  */
 bool AdrasteaI_ATPower_EnableSleep()
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_Transparent_Transmit("\x04", 1);
 
     while (AdrasteaI_CheckATMode() != AdrasteaI_ATMode_Off)
@@ -124,13 +134,13 @@ bool AdrasteaI_ATPower_EnableSleep()
 
     if (!AdrasteaI_SendRequest("sleepSet enable\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Power), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Power, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
@@ -34,18 +34,69 @@
 #include "ATCommands.h"
 
 
-static const char* AdrasteaI_ATProprietary_RAT_Strings[AdrasteaI_ATProprietary_RAT_NumberOfValues] = {
-    "DEFAULT",
-    "CATM",
-    "NBIOT",
+#define AdrasteaI_ATProprietary_RAT_Entries(ENTRY)        \
+    ENTRY("CATM", AdrasteaI_ATProprietary_RAT_CATM)       \
+    ENTRY("NBIOT", AdrasteaI_ATProprietary_RAT_NB_IOT)    \
+    ENTRY("DEFAULT", AdrasteaI_ATProprietary_RAT_DEFAULT)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATProprietary_RAT_Strings, AdrasteaI_ATProprietary_RAT_NumberOfValues, AdrasteaI_ATProprietary_RAT_Entries);
+
+#define AdrasteaI_ATProprietary_IP_Addr_Format_Entries(ENTRY)      \
+    ENTRY("IP", AdrasteaI_ATProprietary_IP_Addr_Format_IPv4)       \
+    ENTRY("IPV6", AdrasteaI_ATProprietary_IP_Addr_Format_IPv6)     \
+    ENTRY("IPV4V6", AdrasteaI_ATProprietary_IP_Addr_Format_IPv4v6)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATProprietary_IP_Addr_Format_Strings, AdrasteaI_ATProprietary_IP_Addr_Format_NumberOfValues, AdrasteaI_ATProprietary_IP_Addr_Format_Entries);
+
+/**
+ * @brief Request of AdrasteaI_ATProprietary_SetNetworkAttachmentState().
+ */
+typedef struct AdrasteaI_ATProprietary_Network_Attachment_State_Request_t
+{
+    AdrasteaI_ATProprietary_Network_Attachment_State_t state;
+} AdrasteaI_ATProprietary_Network_Attachment_State_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATProprietary_Network_Attachment_State_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATProprietary_Network_Attachment_State_Request_t, state, ATCOMMAND_INTFLAGS_UNSIGNED),
 };
 
-static const char* AdrasteaI_ATProprietary_IP_Addr_Format_Strings[AdrasteaI_ATProprietary_IP_Addr_Format_NumberOfValues] = {
-    "IP",
-    "IPV6",
-    "IPV4V6",
+/**
+ * @brief Request of AdrasteaI_ATProprietary_SetBootDelay().
+ */
+typedef struct AdrasteaI_ATProprietary_Boot_Delay_Request_t
+{
+    AdrasteaI_ATProprietary_Boot_Delay_t delay;
+} AdrasteaI_ATProprietary_Boot_Delay_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATProprietary_Boot_Delay_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATProprietary_Boot_Delay_Request_t, delay, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief Request of AdrasteaI_ATProprietary_DeleteTLSProfile().
+ */
+typedef struct AdrasteaI_ATProprietary_TLS_Profile_ID_Request_t
+{
+    AdrasteaI_ATCommon_TLS_Profile_ID_t profileID;
+} AdrasteaI_ATProprietary_TLS_Profile_ID_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATProprietary_TLS_Profile_ID_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATProprietary_TLS_Profile_ID_Request_t, profileID, ATCOMMAND_INTFLAGS_UNSIGNED),
 };
 
+/**
+ * @brief Proprietary commands with fixed argument layout, see AdrasteaI_Command_t.
+ */
+#define ADRASTEAI_ATPROPRIETARY_COMMANDS(COMMAND)                                                                                                                                                                        \
+    COMMAND(AdrasteaI_ATProprietary_Command_SetNetworkAttachmentState, "AT%CMATT=", Proprietary, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATProprietary_Network_Attachment_State_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS) \
+    COMMAND(AdrasteaI_ATProprietary_Command_SetBootDelay, "AT%SETBDELAY=", Proprietary, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATProprietary_Boot_Delay_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)                        \
+    COMMAND(AdrasteaI_ATProprietary_Command_DeleteTLSProfile, "AT%CERTCFG=\"DELETE\",", Proprietary, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATProprietary_TLS_Profile_ID_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)
+
+typedef enum AdrasteaI_ATProprietary_Command_t
+{
+    ADRASTEAI_ATPROPRIETARY_COMMANDS(ADRASTEAI_COMMAND_ID) AdrasteaI_ATProprietary_Command_NumberOfValues
+} AdrasteaI_ATProprietary_Command_t;
+
+static const AdrasteaI_Command_t AdrasteaI_ATProprietary_Commands[AdrasteaI_ATProprietary_Command_NumberOfValues] = {ADRASTEAI_ATPROPRIETARY_COMMANDS(ADRASTEAI_COMMAND_DESCRIPTOR)};
+
 /**
  * @brief Read Network Attachment State (using the AT%CMATT command).
  *
@@ -55,31 +106,36 @@ static const char* AdrasteaI_ATProprietary_IP_Addr_Format_Strings[AdrasteaI_ATPr
  */
 bool AdrasteaI_ATProprietary_ReadNetworkAttachmentState(AdrasteaI_ATProprietary_Network_Attachment_State_t* stateP)
 {
-    if (stateP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (stateP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%CMATT?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, stateP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -91,31 +147,9 @@ bool AdrasteaI_ATProprietary_ReadNetworkAttachmentState(AdrasteaI_ATProprietary_
  */
 bool AdrasteaI_ATProprietary_SetNetworkAttachmentState(AdrasteaI_ATProprietary_Network_Attachment_State_t state)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%CMATT=");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
+    AdrasteaI_ATProprietary_Network_Attachment_State_Request_t request = {.state = state};
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATProprietary_Commands[AdrasteaI_ATProprietary_Command_SetNetworkAttachmentState], &request, NULL);
 }
 
 /**
@@ -127,46 +161,51 @@ bool AdrasteaI_ATProprietary_SetNetworkAttachmentState(AdrasteaI_ATProprietary_N
  */
 bool AdrasteaI_ATProprietary_ReadRemainingPINPUKAttempts(AdrasteaI_ATProprietary_PIN_PUK_Attempts_t* attemptsP)
 {
-    if (attemptsP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (attemptsP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%CPININFO\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &attemptsP->pinAttempts, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &attemptsP->pukAttempts, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &attemptsP->pin2Attempts, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &attemptsP->puk2Attempts, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -182,22 +221,27 @@ bool AdrasteaI_ATProprietary_ReadRemainingPINPUKAttempts(AdrasteaI_ATProprietary
  */
 bool AdrasteaI_ATProprietary_SwitchToRATWithoutFullReboot(AdrasteaI_ATProprietary_RAT_t rat, AdrasteaI_ATProprietary_RAT_Storage_t storage, AdrasteaI_ATProprietary_RAT_Source_t source)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%RATACT=");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATProprietary_RAT_Strings[rat], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATProprietary_RAT_Strings.strings[rat], ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (storage != AdrasteaI_ATProprietary_RAT_Storage_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, storage, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -205,7 +249,7 @@ bool AdrasteaI_ATProprietary_SwitchToRATWithoutFullReboot(AdrasteaI_ATProprietar
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
@@ -214,7 +258,7 @@ bool AdrasteaI_ATProprietary_SwitchToRATWithoutFullReboot(AdrasteaI_ATProprietar
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, source, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -223,20 +267,20 @@ bool AdrasteaI_ATProprietary_SwitchToRATWithoutFullReboot(AdrasteaI_ATProprietar
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -248,41 +292,46 @@ bool AdrasteaI_ATProprietary_SwitchToRATWithoutFullReboot(AdrasteaI_ATProprietar
  */
 bool AdrasteaI_ATProprietary_ReadRATStatus(AdrasteaI_ATProprietary_RAT_Status_t* ratstatusP)
 {
-    if (ratstatusP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (ratstatusP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%RATACT?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
-    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&ratstatusP->rat, AdrasteaI_ATProprietary_RAT_Strings, AdrasteaI_ATProprietary_RAT_NumberOfValues, 30, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&ratstatusP->rat, &AdrasteaI_ATProprietary_RAT_Strings, 30, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &ratstatusP->mode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &ratstatusP->source, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -294,31 +343,9 @@ bool AdrasteaI_ATProprietary_ReadRATStatus(AdrasteaI_ATProprietary_RAT_Status_t*
  */
 bool AdrasteaI_ATProprietary_SetBootDelay(AdrasteaI_ATProprietary_Boot_Delay_t delay)
 {
-    char* pRequestCommand = AT_commandBuffer;
+    AdrasteaI_ATProprietary_Boot_Delay_Request_t request = {.delay = delay};
 
-    strcpy(pRequestCommand, "AT%SETBDELAY=");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, delay, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATProprietary_Commands[AdrasteaI_ATProprietary_Command_SetBootDelay], &request, NULL);
 }
 
 /**
@@ -334,6 +361,11 @@ bool AdrasteaI_ATProprietary_SetBootDelay(AdrasteaI_ATProprietary_Boot_Delay_t d
  */
 bool AdrasteaI_ATProprietary_ResolveDomainName(AdrasteaI_ATCommon_Session_ID_t sessionid, AdrasteaI_ATProprietary_Domain_Name_t domain, AdrasteaI_ATProprietary_IP_Addr_Format_t format)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -342,19 +374,19 @@ bool AdrasteaI_ATProprietary_ResolveDomainName(AdrasteaI_ATCommon_Session_ID_t s
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, sessionid, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, domain, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (format != AdrasteaI_ATProprietary_IP_Addr_Format_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -363,20 +395,20 @@ bool AdrasteaI_ATProprietary_ResolveDomainName(AdrasteaI_ATCommon_Session_ID_t s
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -394,14 +426,19 @@ bool AdrasteaI_ATProprietary_ParseResolveDomainNameEvent(char* pEventArguments,
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 2))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, dataP->addr, ATCOMMAND_STRING_TERMINATE, sizeof(dataP->addr)))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, &dataP->format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8)))
+    {
+        return false;
+    }
+
+    if (!AdrasteaI_ATCommon_GetArgumentIPAddress(&arguments, 1, &dataP->addr))
     {
         return false;
     }
@@ -426,6 +463,11 @@ bool AdrasteaI_ATProprietary_ParseResolveDomainNameEvent(char* pEventArguments,
  */
 bool AdrasteaI_ATProprietary_Ping(AdrasteaI_ATProprietary_IP_Addr_Format_t format, AdrasteaI_ATCommon_IP_Addr_t destaddr, AdrasteaI_ATProprietary_Ping_Packet_Count_t packetcount, AdrasteaI_ATProprietary_Ping_Packet_Size_t packetsize, AdrasteaI_ATProprietary_Ping_Timeout_t timeout)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -434,19 +476,19 @@ bool AdrasteaI_ATProprietary_Ping(AdrasteaI_ATProprietary_IP_Addr_Format_t forma
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, destaddr, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (packetcount != AdrasteaI_ATProprietary_Ping_Packet_Count_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, packetcount, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -454,7 +496,7 @@ bool AdrasteaI_ATProprietary_Ping(AdrasteaI_ATProprietary_IP_Addr_Format_t forma
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
@@ -463,7 +505,7 @@ bool AdrasteaI_ATProprietary_Ping(AdrasteaI_ATProprietary_IP_Addr_Format_t forma
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, packetsize, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -471,7 +513,7 @@ bool AdrasteaI_ATProprietary_Ping(AdrasteaI_ATProprietary_IP_Addr_Format_t forma
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
@@ -480,7 +522,7 @@ bool AdrasteaI_ATProprietary_Ping(AdrasteaI_ATProprietary_IP_Addr_Format_t forma
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, timeout, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -489,20 +531,20 @@ bool AdrasteaI_ATProprietary_Ping(AdrasteaI_ATProprietary_IP_Addr_Format_t forma
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -520,24 +562,29 @@ bool AdrasteaI_ATProprietary_ParsePingResultEvent(char* pEventArguments, Adraste
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->id, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 4))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, dataP->addr, ATCOMMAND_ARGUMENT_DELIM, sizeof(dataP->addr)))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, &dataP->id, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8)))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->rtt, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE16), ATCOMMAND_ARGUMENT_DELIM))
+    if (!AdrasteaI_ATCommon_GetArgumentIPAddress(&arguments, 1, &dataP->addr))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->ttl, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE16), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_GetArgumentInt(&arguments, 2, &dataP->rtt, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE16)))
+    {
+        return false;
+    }
+
+    if (!ATCommand_GetArgumentInt(&arguments, 3, &dataP->ttl, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE16)))
     {
         return false;
     }
@@ -558,43 +605,48 @@ bool AdrasteaI_ATProprietary_ParsePingResultEvent(char* pEventArguments, Adraste
  */
 bool AdrasteaI_ATProprietary_ReadCredential(AdrasteaI_ATProprietary_File_Name_t filename, char* dataP, uint16_t dataMaxBufferSize)
 {
-    if (dataP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (dataP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%CERTCMD=\"READ\",");
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, filename, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, dataP, ATCOMMAND_STRING_TERMINATE, dataMaxBufferSize))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -610,43 +662,48 @@ bool AdrasteaI_ATProprietary_ReadCredential(AdrasteaI_ATProprietary_File_Name_t
  */
 bool AdrasteaI_ATProprietary_WriteCredential(AdrasteaI_ATProprietary_File_Name_t filename, AdrasteaI_ATProprietary_Credential_Format_t format, char* data)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%CERTCMD=\"WRITE\",");
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, filename, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, data, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -658,21 +715,26 @@ bool AdrasteaI_ATProprietary_WriteCredential(AdrasteaI_ATProprietary_File_Name_t
  */
 bool AdrasteaI_ATProprietary_ListCredentials(AdrasteaI_ATProprietary_File_Names_List_t* filenamesList)
 {
-    if (filenamesList == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (filenamesList == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%CERTCMD=\"DIR\"\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     filenamesList->filenames = NULL;
@@ -685,24 +747,24 @@ bool AdrasteaI_ATProprietary_ListCredentials(AdrasteaI_ATProprietary_File_Names_
 
         if (filenamesList->filenames == NULL)
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         for (uint8_t i = 0; i < filenamesList->count - 1; i++)
         {
             if (!ATCommand_GetNextArgumentString(&pResponseCommand, filenamesList->filenames[i], ATCOMMAND_ARGUMENT_DELIM, sizeof(AdrasteaI_ATProprietary_File_Name_t)))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
         }
 
         if (!ATCommand_GetNextArgumentString(&pResponseCommand, filenamesList->filenames[filenamesList->count - 1], ATCOMMAND_STRING_TERMINATE, sizeof(AdrasteaI_ATProprietary_File_Name_t)))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -714,31 +776,36 @@ bool AdrasteaI_ATProprietary_ListCredentials(AdrasteaI_ATProprietary_File_Names_
  */
 bool AdrasteaI_ATProprietary_DeleteCredential(AdrasteaI_ATProprietary_File_Name_t filename)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%CERTCMD=\"DELETE\",");
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, filename, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -750,23 +817,28 @@ bool AdrasteaI_ATProprietary_DeleteCredential(AdrasteaI_ATProprietary_File_Name_
  */
 bool AdrasteaI_ATProprietary_ListTLSProfiles(AdrasteaI_ATProprietary_TLS_Profile_ID_List_t* profileIDsList)
 {
-    if (profileIDsList == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (profileIDsList == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%CERTCFG?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
     pResponseCommand[0] = '\0';
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     profileIDsList->profileIDs = NULL;
@@ -781,20 +853,20 @@ bool AdrasteaI_ATProprietary_ListTLSProfiles(AdrasteaI_ATProprietary_TLS_Profile
 
         if (profileIDsList->profileIDs == NULL)
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         for (uint8_t i = 0; i < profileIDsList->count - 1; i++)
         {
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &profileIDsList->profileIDs[i], (ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
         }
 
         if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &profileIDsList->profileIDs[profileIDsList->count - 1], (ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
     }
     else
@@ -802,7 +874,7 @@ bool AdrasteaI_ATProprietary_ListTLSProfiles(AdrasteaI_ATProprietary_TLS_Profile
         profileIDsList->count = 0;
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -826,6 +898,11 @@ bool AdrasteaI_ATProprietary_ListTLSProfiles(AdrasteaI_ATProprietary_TLS_Profile
  */
 bool AdrasteaI_ATProprietary_AddTLSProfile(AdrasteaI_ATCommon_TLS_Profile_ID_t profileID, AdrasteaI_ATProprietary_File_Name_t CA, AdrasteaI_ATProprietary_File_Path_t CAPath, AdrasteaI_ATProprietary_File_Name_t deviceCert, AdrasteaI_ATProprietary_File_Name_t deviceKey, AdrasteaI_ATProprietary_File_Name_t pskID, AdrasteaI_ATProprietary_File_Name_t pskKey)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -834,14 +911,14 @@ bool AdrasteaI_ATProprietary_AddTLSProfile(AdrasteaI_ATCommon_TLS_Profile_ID_t p
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (strlen(CA) != 0)
     {
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, CA, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         AdrasteaI_optionalParamsDelimCount = 1;
@@ -850,7 +927,7 @@ bool AdrasteaI_ATProprietary_AddTLSProfile(AdrasteaI_ATCommon_TLS_Profile_ID_t p
         {
             if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, CAPath, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
             AdrasteaI_optionalParamsDelimCount = 1;
         }
@@ -858,7 +935,7 @@ bool AdrasteaI_ATProprietary_AddTLSProfile(AdrasteaI_ATCommon_TLS_Profile_ID_t p
         {
             if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
             AdrasteaI_optionalParamsDelimCount++;
         }
@@ -867,14 +944,14 @@ bool AdrasteaI_ATProprietary_AddTLSProfile(AdrasteaI_ATCommon_TLS_Profile_ID_t p
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         AdrasteaI_optionalParamsDelimCount++;
 
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         AdrasteaI_optionalParamsDelimCount++;
@@ -884,12 +961,12 @@ bool AdrasteaI_ATProprietary_AddTLSProfile(AdrasteaI_ATCommon_TLS_Profile_ID_t p
     {
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, deviceCert, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, deviceKey, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         AdrasteaI_optionalParamsDelimCount = 1;
@@ -898,14 +975,14 @@ bool AdrasteaI_ATProprietary_AddTLSProfile(AdrasteaI_ATCommon_TLS_Profile_ID_t p
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         AdrasteaI_optionalParamsDelimCount++;
 
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         AdrasteaI_optionalParamsDelimCount++;
@@ -915,12 +992,12 @@ bool AdrasteaI_ATProprietary_AddTLSProfile(AdrasteaI_ATCommon_TLS_Profile_ID_t p
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
 
         AdrasteaI_optionalParamsDelimCount = 0;
@@ -930,20 +1007,20 @@ bool AdrasteaI_ATProprietary_AddTLSProfile(AdrasteaI_ATCommon_TLS_Profile_ID_t p
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -955,31 +1032,9 @@ bool AdrasteaI_ATProprietary_AddTLSProfile(AdrasteaI_ATCommon_TLS_Profile_ID_t p
  */
 bool AdrasteaI_ATProprietary_DeleteTLSProfile(AdrasteaI_ATCommon_TLS_Profile_ID_t profileID)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%CERTCFG=\"DELETE\",");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
+    AdrasteaI_ATProprietary_TLS_Profile_ID_Request_t request = {.profileID = profileID};
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATProprietary_Commands[AdrasteaI_ATProprietary_Command_DeleteTLSProfile], &request, NULL);
 }
 
 /**
@@ -991,6 +1046,11 @@ bool AdrasteaI_ATProprietary_DeleteTLSProfile(AdrasteaI_ATCommon_TLS_Profile_ID_
  */
 bool AdrasteaI_ATProprietary_SetPDNParameters(AdrasteaI_ATProprietary_PDN_Parameters_t parameters)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -999,14 +1059,14 @@ bool AdrasteaI_ATProprietary_SetPDNParameters(AdrasteaI_ATProprietary_PDN_Parame
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, parameters.sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (strlen(parameters.apnName) != 0)
     {
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, parameters.apnName, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -1014,16 +1074,16 @@ bool AdrasteaI_ATProprietary_SetPDNParameters(AdrasteaI_ATProprietary_PDN_Parame
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
 
     if (parameters.ipFormat != AdrasteaI_ATProprietary_IP_Addr_Format_Invalid)
     {
-        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATProprietary_IP_Addr_Format_Strings[parameters.ipFormat], ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATProprietary_IP_Addr_Format_Strings.strings[parameters.ipFormat], ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -1032,20 +1092,20 @@ bool AdrasteaI_ATProprietary_SetPDNParameters(AdrasteaI_ATProprietary_PDN_Parame
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -1057,39 +1117,44 @@ bool AdrasteaI_ATProprietary_SetPDNParameters(AdrasteaI_ATProprietary_PDN_Parame
  */
 bool AdrasteaI_ATProprietary_ReadPDNParameters(AdrasteaI_ATProprietary_PDN_Parameters_t* parameters)
 {
-    if (parameters == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (parameters == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%PDNSET?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Proprietary), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Proprietary, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &parameters->sessionID, (ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentString(&pResponseCommand, parameters->apnName, ATCOMMAND_ARGUMENT_DELIM, sizeof(AdrasteaI_ATCommon_APN_Name_t)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_GetNextArgumentEnum(&pResponseCommand, (uint8_t*)&parameters->ipFormat, AdrasteaI_ATProprietary_IP_Addr_Format_Strings, AdrasteaI_ATProprietary_IP_Addr_Format_NumberOfValues, 30, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetNextArgumentEnum(&pResponseCommand, (uint8_t*)&parameters->ipFormat, &AdrasteaI_ATProprietary_IP_Addr_Format_Strings, 30, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
@@ -140,7 +140,7 @@ extern "C"
     typedef struct AdrasteaI_ATProprietary_Ping_Result_t
     {
         AdrasteaI_ATProprietary_Ping_ID_t id;
-        AdrasteaI_ATCommon_IP_Addr_t addr;
+        AdrasteaI_ATCommon_IP_Address_t addr; /**< See AdrasteaI_ATCommon_FormatIPAddress() */
         AdrasteaI_ATProprietary_Ping_TTL_t ttl;
         AdrasteaI_ATProprietary_Ping_RTT_t rtt;
     } AdrasteaI_ATProprietary_Ping_Result_t;
@@ -165,7 +165,7 @@ extern "C"
     typedef struct AdrasteaI_ATProprietary_Domain_Name_Resolve_Result_t
     {
         AdrasteaI_ATProprietary_IP_Addr_Format_t format;
-        AdrasteaI_ATCommon_IP_Addr_t addr;
+        AdrasteaI_ATCommon_IP_Address_t addr; /**< See AdrasteaI_ATCommon_FormatIPAddress() */
     } AdrasteaI_ATProprietary_Domain_Name_Resolve_Result_t;
 
     typedef char AdrasteaI_ATProprietary_File_Name_t[64];
@@ -34,13 +34,45 @@
 #include "ATCommands.h"
 
 
-static const char* AdrasteaI_ATSIM_Facility_Strings[AdrasteaI_ATSIM_Facility_NumberOfValues] = {
-    "SC", "P2", "PN", "PU", "PS",
-};
+#define AdrasteaI_ATSIM_Facility_Entries(ENTRY) \
+    ENTRY("P2", AdrasteaI_ATSIM_Facility_P2)    \
+    ENTRY("PN", AdrasteaI_ATSIM_Facility_PN)    \
+    ENTRY("PS", AdrasteaI_ATSIM_Facility_PS)    \
+    ENTRY("PU", AdrasteaI_ATSIM_Facility_PU)    \
+    ENTRY("SC", AdrasteaI_ATSIM_Facility_SC)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATSIM_Facility_Strings, AdrasteaI_ATSIM_Facility_NumberOfValues, AdrasteaI_ATSIM_Facility_Entries);
+
+#define AdrasteaI_ATSIM_PIN_Status_Entries(ENTRY)                    \
+    ENTRY("READY", AdrasteaI_ATSIM_PIN_Status_Ready)                 \
+    ENTRY("SIM PIN", AdrasteaI_ATSIM_PIN_Status_SIM_PIN)             \
+    ENTRY("SIM PUK", AdrasteaI_ATSIM_PIN_Status_SIM_PUK)             \
+    ENTRY("SIM PIN2", AdrasteaI_ATSIM_PIN_Status_SIM_PIN2)           \
+    ENTRY("SIM PUK2", AdrasteaI_ATSIM_PIN_Status_SIM_PUK2)           \
+    ENTRY("PH-SP PIN", AdrasteaI_ATSIM_PIN_Status_PH_SP_PIN)         \
+    ENTRY("PH-SP PUK", AdrasteaI_ATSIM_PIN_Status_PH_SP_PUK)         \
+    ENTRY("PH-NET PIN", AdrasteaI_ATSIM_PIN_Status_PH_NET_PIN)       \
+    ENTRY("PH-NET PUK", AdrasteaI_ATSIM_PIN_Status_PH_NET_PUK)       \
+    ENTRY("PH-SIM PIN", AdrasteaI_ATSIM_PIN_Status_PH_SIM_PIN)       \
+    ENTRY("PH-CORP PIN", AdrasteaI_ATSIM_PIN_Status_PH_CORP_PIN)     \
+    ENTRY("PH-CORP PUK", AdrasteaI_ATSIM_PIN_Status_PH_CORP_PUK)     \
+    ENTRY("PH-FSIM PIN", AdrasteaI_ATSIM_PIN_Status_PH_FSIM_PIN)     \
+    ENTRY("PH-FSIM PUK", AdrasteaI_ATSIM_PIN_Status_PH_FSIM_PUK)     \
+    ENTRY("PH-NETSUB PIN", AdrasteaI_ATSIM_PIN_Status_PH_NETSUB_PIN) \
+    ENTRY("PH-NETSUB PUK", AdrasteaI_ATSIM_PIN_Status_PH_NETSUB_PUK)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATSIM_PIN_Status_Strings, AdrasteaI_ATSIM_PIN_Status_NumberOfValues, AdrasteaI_ATSIM_PIN_Status_Entries);
 
-static const char* AdrasteaI_ATSIM_PIN_Status_Strings[AdrasteaI_ATSIM_PIN_Status_NumberOfValues] = {
-    "READY", "SIM PIN", "SIM PUK", "PH-SIM PIN", "PH-FSIM PIN", "PH-FSIM PUK", "SIM PIN2", "SIM PUK2", "PH-NET PIN", "PH-NET PUK", "PH-NETSUB PIN", "PH-NETSUB PUK", "PH-SP PIN", "PH-SP PUK", "PH-CORP PIN", "PH-CORP PUK",
-};
+/**
+ * @brief SIM commands with fixed argument layout, see AdrasteaI_Command_t.
+ */
+#define ADRASTEAI_ATSIM_COMMANDS(COMMAND) \
+    COMMAND(AdrasteaI_ATSIM_Command_ReadSubscriberNumber, "AT+CNUM", SIM, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_NO_FIELDS)
+
+typedef enum AdrasteaI_ATSIM_Command_t
+{
+    ADRASTEAI_ATSIM_COMMANDS(ADRASTEAI_COMMAND_ID) AdrasteaI_ATSIM_Command_NumberOfValues
+} AdrasteaI_ATSIM_Command_t;
+
+static const AdrasteaI_Command_t AdrasteaI_ATSIM_Commands[AdrasteaI_ATSIM_Command_NumberOfValues] = {ADRASTEAI_ATSIM_COMMANDS(ADRASTEAI_COMMAND_DESCRIPTOR)};
 
 /**
  * @brief Read International Mobile Subscriber Identity (using the AT+CIMI command).
@@ -51,29 +83,34 @@ static const char* AdrasteaI_ATSIM_PIN_Status_Strings[AdrasteaI_ATSIM_PIN_Status
  */
 bool AdrasteaI_ATSIM_RequestInternationalMobileSubscriberIdentity(AdrasteaI_ATSIM_IMSI_t* imsiP)
 {
-    if (imsiP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (imsiP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CIMI\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SIM), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SIM, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentString(&pResponseCommand, (char*)*imsiP, ATCOMMAND_STRING_TERMINATE, sizeof(*imsiP)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -89,6 +126,11 @@ bool AdrasteaI_ATSIM_RequestInternationalMobileSubscriberIdentity(AdrasteaI_ATSI
  */
 bool AdrasteaI_ATSIM_SetFacilityLock(AdrasteaI_ATSIM_Facility_t facility, AdrasteaI_ATSIM_Lock_Mode_t mode, AdrasteaI_ATSIM_PIN_t pin)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -97,24 +139,24 @@ bool AdrasteaI_ATSIM_SetFacilityLock(AdrasteaI_ATSIM_Facility_t facility, Adrast
 
     if (facility == AdrasteaI_ATSIM_Facility_P2)
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSIM_Facility_Strings[facility], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSIM_Facility_Strings.strings[facility], ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, mode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (strlen(pin) != 0)
     {
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, pin, ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -123,20 +165,20 @@ bool AdrasteaI_ATSIM_SetFacilityLock(AdrasteaI_ATSIM_Facility_t facility, Adrast
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SIM), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SIM, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -150,55 +192,60 @@ bool AdrasteaI_ATSIM_SetFacilityLock(AdrasteaI_ATSIM_Facility_t facility, Adrast
  */
 bool AdrasteaI_ATSIM_ReadFacilityLock(AdrasteaI_ATSIM_Facility_t facility, AdrasteaI_ATSIM_Lock_Status_t* statusP)
 {
-    if (statusP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (statusP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT+CLCK=");
 
     if (facility == AdrasteaI_ATSIM_Facility_P2)
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSIM_Facility_Strings[facility], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSIM_Facility_Strings.strings[facility], ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, 2, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SIM), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SIM, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, statusP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 //TODO check this command
@@ -209,17 +256,7 @@ bool AdrasteaI_ATSIM_ReadFacilityLock(AdrasteaI_ATSIM_Facility_t facility, Adras
  */
 bool AdrasteaI_ATSIM_ReadSubscriberNumber()
 {
-    if (!AdrasteaI_SendRequest("AT+CNUM\r\n"))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SIM), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATSIM_Commands[AdrasteaI_ATSIM_Command_ReadSubscriberNumber], NULL, NULL);
 }
 
 /**
@@ -231,31 +268,36 @@ bool AdrasteaI_ATSIM_ReadSubscriberNumber()
  */
 bool AdrasteaI_ATSIM_ReadPinStatus(AdrasteaI_ATSIM_PIN_Status_t* statusP)
 {
-    if (statusP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (statusP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CPIN?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SIM), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SIM, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
-    if (!ATCommand_GetNextArgumentEnum(&pResponseCommand, (uint8_t*)statusP, AdrasteaI_ATSIM_PIN_Status_Strings, AdrasteaI_ATSIM_PIN_Status_NumberOfValues, 30, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_GetNextArgumentEnum(&pResponseCommand, (uint8_t*)statusP, &AdrasteaI_ATSIM_PIN_Status_Strings, 30, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -269,6 +311,11 @@ bool AdrasteaI_ATSIM_ReadPinStatus(AdrasteaI_ATSIM_PIN_Status_t* statusP)
  */
 bool AdrasteaI_ATSIM_EnterPin(AdrasteaI_ATSIM_PIN_t pin1, AdrasteaI_ATSIM_PIN_t pin2)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -277,14 +324,14 @@ bool AdrasteaI_ATSIM_EnterPin(AdrasteaI_ATSIM_PIN_t pin1, AdrasteaI_ATSIM_PIN_t
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, pin1, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (strlen(pin2) != 0)
     {
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, pin2, ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -293,20 +340,20 @@ bool AdrasteaI_ATSIM_EnterPin(AdrasteaI_ATSIM_PIN_t pin1, AdrasteaI_ATSIM_PIN_t
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SIM), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SIM, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -322,41 +369,46 @@ bool AdrasteaI_ATSIM_EnterPin(AdrasteaI_ATSIM_PIN_t pin1, AdrasteaI_ATSIM_PIN_t
  */
 bool AdrasteaI_ATSIM_ChangePassword(AdrasteaI_ATSIM_Facility_t facility, AdrasteaI_ATSIM_PIN_t oldpassword, AdrasteaI_ATSIM_PIN_t newpassword)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT+CPWD=");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSIM_Facility_Strings[facility], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSIM_Facility_Strings.strings[facility], ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, oldpassword, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, newpassword, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SIM), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SIM, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -380,6 +432,11 @@ bool AdrasteaI_ATSIM_ChangePassword(AdrasteaI_ATSIM_Facility_t facility, Adraste
  */
 bool AdrasteaI_ATSIM_RestrictedSIMAccess(AdrasteaI_ATSIM_Restricted_Access_Command_t cmd, AdrasteaI_ATSIM_Restricted_Access_File_ID fileID, AdrasteaI_ATSIM_Restricted_Access_P1 p1, AdrasteaI_ATSIM_Restricted_Access_P2 p2, AdrasteaI_ATSIM_Restricted_Access_P3 p3, char* dataWritten, AdrasteaI_ATSIM_Restricted_Access_Response_t* cmdResponse)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -388,34 +445,34 @@ bool AdrasteaI_ATSIM_RestrictedSIMAccess(AdrasteaI_ATSIM_Restricted_Access_Comma
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, cmd, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, fileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, p1, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, p2, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, p3, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (dataWritten != NULL)
     {
         if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, dataWritten, ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -424,26 +481,26 @@ bool AdrasteaI_ATSIM_RestrictedSIMAccess(AdrasteaI_ATSIM_Restricted_Access_Comma
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SIM), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SIM, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &cmdResponse->sw1, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     switch (ATCommand_CountArgs(pResponseCommand))
@@ -452,7 +509,7 @@ bool AdrasteaI_ATSIM_RestrictedSIMAccess(AdrasteaI_ATSIM_Restricted_Access_Comma
         {
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &cmdResponse->sw2, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
             break;
         }
@@ -460,19 +517,19 @@ bool AdrasteaI_ATSIM_RestrictedSIMAccess(AdrasteaI_ATSIM_Restricted_Access_Comma
         {
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &cmdResponse->sw2, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
             if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, cmdResponse->responseRead, ATCOMMAND_STRING_TERMINATE, cmdResponse->responseReadMaxBufferSize))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
             break;
         }
         default:
-            return false;
+            return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -484,31 +541,36 @@ bool AdrasteaI_ATSIM_RestrictedSIMAccess(AdrasteaI_ATSIM_Restricted_Access_Comma
  */
 bool AdrasteaI_ATSIM_RequestIntegratedCircuitCardIdentifier(AdrasteaI_ATSIM_ICCID_t* iccidP)
 {
-    if (iccidP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (iccidP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT%CCID\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SIM), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SIM, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
     if (!ATCommand_GetNextArgumentString(&pResponseCommand, (char*)*iccidP, ATCOMMAND_STRING_TERMINATE, sizeof(*iccidP)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -526,40 +588,21 @@ bool AdrasteaI_ATSMS_ParseSubscriberNumberEvent(char* pEventArguments, AdrasteaI
         return false;
     }
 
-    char* argumentsP = pEventArguments;
-
-    argumentsP += 1;
+    ATCommand_Arguments_t arguments;
 
-    char alphaN[30];
-
-    if (!ATCommand_GetNextArgumentString(&argumentsP, alphaN, ATCOMMAND_ARGUMENT_DELIM, sizeof(alphaN)))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count < 3))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, dataP->number, ATCOMMAND_ARGUMENT_DELIM, sizeof(dataP->number)))
+    if (!ATCommand_GetArgumentStringWithoutQuotationMarks(&arguments, 1, dataP->number, sizeof(dataP->number)))
     {
         return false;
     }
 
-    switch (ATCommand_CountArgs(argumentsP))
+    if (!ATCommand_GetArgumentInt(&arguments, 2, &dataP->numberType, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8)))
     {
-        case 1:
-        {
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->numberType, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
-            {
-                return false;
-            }
-            break;
-        }
-        default:
-        {
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->numberType, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_ARGUMENT_DELIM))
-            {
-                return false;
-            }
-            break;
-        }
+        return false;
     }
 
     return true;
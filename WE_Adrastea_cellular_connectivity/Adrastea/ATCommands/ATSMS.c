@@ -34,12 +34,63 @@
 #include "ATCommands.h"
 
 
-static const char* AdrasteaI_ATSMS_Message_State_Strings[AdrasteaI_ATSMS_Message_State_NumberOfValues] = {"REC UNREAD", "REC READ", "STO UNSENT", "STO SENT", "ALL"};
+#define AdrasteaI_ATSMS_Message_State_Entries(ENTRY)                   \
+    ENTRY("ALL", AdrasteaI_ATSMS_Message_State_All)                    \
+    ENTRY("REC READ", AdrasteaI_ATSMS_Message_State_Received_Read)     \
+    ENTRY("STO SENT", AdrasteaI_ATSMS_Message_State_Stored_Sent)       \
+    ENTRY("REC UNREAD", AdrasteaI_ATSMS_Message_State_Received_Unread) \
+    ENTRY("STO UNSENT", AdrasteaI_ATSMS_Message_State_Stored_Unsent)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATSMS_Message_State_Strings, AdrasteaI_ATSMS_Message_State_NumberOfValues, AdrasteaI_ATSMS_Message_State_Entries);
+
+#define AdrasteaI_ATSMS_Storage_Location_Entries(ENTRY)         \
+    ENTRY("BM", AdrasteaI_ATSMS_Storage_Location_Broadcast)     \
+    ENTRY("ME", AdrasteaI_ATSMS_Storage_Location_ME)            \
+    ENTRY("MT", AdrasteaI_ATSMS_Storage_Location_MT)            \
+    ENTRY("SM", AdrasteaI_ATSMS_Storage_Location_SIM)           \
+    ENTRY("SR", AdrasteaI_ATSMS_Storage_Location_Status_Report) \
+    ENTRY("TA", AdrasteaI_ATSMS_Storage_Location_TA)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATSMS_Storage_Location_Strings, AdrasteaI_ATSMS_Storage_Location_NumberOfValues, AdrasteaI_ATSMS_Storage_Location_Entries);
 
-static const char* AdrasteaI_ATSMS_Storage_Location_Strings[AdrasteaI_ATSMS_Storage_Location_NumberOfValues] = {
-    "BM", "ME", "MT", "SM", "TA", "SR",
+/**
+ * @brief Request of the commands addressing a single message.
+ */
+typedef struct AdrasteaI_ATSMS_Message_Index_Request_t
+{
+    AdrasteaI_ATSMS_Message_Index_t index;
+} AdrasteaI_ATSMS_Message_Index_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATSMS_Message_Index_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATSMS_Message_Index_Request_t, index, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief Request of AdrasteaI_ATSMS_ListMessages().
+ */
+typedef struct AdrasteaI_ATSMS_Message_State_Request_t
+{
+    AdrasteaI_ATSMS_Message_State_t listType;
+} AdrasteaI_ATSMS_Message_State_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATSMS_Message_State_Request_Fields[] = {
+    ATCOMMAND_FIELD_ENUMSTRING_QUOTATIONMARKS(AdrasteaI_ATSMS_Message_State_Request_t, listType, &AdrasteaI_ATSMS_Message_State_Strings),
 };
 
+/**
+ * @brief SMS commands with fixed argument layout, see AdrasteaI_Command_t.
+ */
+#define ADRASTEAI_ATSMS_COMMANDS(COMMAND)                                                                                                                                \
+    COMMAND(AdrasteaI_ATSMS_Command_DeleteMessage, "AT+CMGD=", SMS, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATSMS_Message_Index_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS) \
+    COMMAND(AdrasteaI_ATSMS_Command_DeleteAllMessages, "AT+CMGD=0,4", SMS, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_NO_FIELDS)                                     \
+    COMMAND(AdrasteaI_ATSMS_Command_ListMessages, "AT+CMGL=", SMS, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATSMS_Message_State_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)  \
+    COMMAND(AdrasteaI_ATSMS_Command_ReadMessage, "AT+CMGR=", SMS, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATSMS_Message_Index_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)
+
+typedef enum AdrasteaI_ATSMS_Command_t
+{
+    ADRASTEAI_ATSMS_COMMANDS(ADRASTEAI_COMMAND_ID) AdrasteaI_ATSMS_Command_NumberOfValues
+} AdrasteaI_ATSMS_Command_t;
+
+static const AdrasteaI_Command_t AdrasteaI_ATSMS_Commands[AdrasteaI_ATSMS_Command_NumberOfValues] = {ADRASTEAI_ATSMS_COMMANDS(ADRASTEAI_COMMAND_DESCRIPTOR)};
+
 /**
  * @brief Delete Message (using the AT+CMGD command).
  *
@@ -49,31 +100,9 @@ static const char* AdrasteaI_ATSMS_Storage_Location_Strings[AdrasteaI_ATSMS_Stor
  */
 bool AdrasteaI_ATSMS_DeleteMessage(AdrasteaI_ATSMS_Message_Index_t index)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT+CMGD=");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SMS), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
+    AdrasteaI_ATSMS_Message_Index_Request_t request = {.index = index};
 
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATSMS_Commands[AdrasteaI_ATSMS_Command_DeleteMessage], &request, NULL);
 }
 
 /**
@@ -83,17 +112,7 @@ bool AdrasteaI_ATSMS_DeleteMessage(AdrasteaI_ATSMS_Message_Index_t index)
  */
 bool AdrasteaI_ATSMS_DeleteAllMessages()
 {
-    if (!AdrasteaI_SendRequest("AT+CMGD=0,4\r\n"))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SMS), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATSMS_Commands[AdrasteaI_ATSMS_Command_DeleteAllMessages], NULL, NULL);
 }
 
 /**
@@ -105,31 +124,9 @@ bool AdrasteaI_ATSMS_DeleteAllMessages()
  */
 bool AdrasteaI_ATSMS_ListMessages(AdrasteaI_ATSMS_Message_State_t listType)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT+CMGL=");
-
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSMS_Message_State_Strings[listType], ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
+    AdrasteaI_ATSMS_Message_State_Request_t request = {.listType = listType};
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SMS), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATSMS_Commands[AdrasteaI_ATSMS_Command_ListMessages], &request, NULL);
 }
 
 /**
@@ -141,31 +138,9 @@ bool AdrasteaI_ATSMS_ListMessages(AdrasteaI_ATSMS_Message_State_t listType)
  */
 bool AdrasteaI_ATSMS_ReadMessage(AdrasteaI_ATSMS_Message_Index_t index)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT+CMGR=");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SMS), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
+    AdrasteaI_ATSMS_Message_Index_Request_t request = {.index = index};
 
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATSMS_Commands[AdrasteaI_ATSMS_Command_ReadMessage], &request, NULL);
 }
 
 /**
@@ -181,22 +156,27 @@ bool AdrasteaI_ATSMS_ReadMessage(AdrasteaI_ATSMS_Message_Index_t index)
  */
 bool AdrasteaI_ATSMS_SetMessageStorageLocations(AdrasteaI_ATSMS_Storage_Location_t readDeleteStorage, AdrasteaI_ATSMS_Storage_Location_t writeSendStorage, AdrasteaI_ATSMS_Storage_Location_t receiveStorage)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT+CPMS=");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSMS_Storage_Location_Strings[readDeleteStorage], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSMS_Storage_Location_Strings.strings[readDeleteStorage], ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (writeSendStorage != AdrasteaI_ATSMS_Storage_Location_Invalid)
     {
-        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSMS_Storage_Location_Strings[writeSendStorage], ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSMS_Storage_Location_Strings.strings[writeSendStorage], ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -204,16 +184,16 @@ bool AdrasteaI_ATSMS_SetMessageStorageLocations(AdrasteaI_ATSMS_Storage_Location
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
 
     if (receiveStorage != AdrasteaI_ATSMS_Storage_Location_Invalid)
     {
-        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSMS_Storage_Location_Strings[receiveStorage], ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSMS_Storage_Location_Strings.strings[receiveStorage], ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -222,20 +202,20 @@ bool AdrasteaI_ATSMS_SetMessageStorageLocations(AdrasteaI_ATSMS_Storage_Location
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SMS), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SMS, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -247,71 +227,76 @@ bool AdrasteaI_ATSMS_SetMessageStorageLocations(AdrasteaI_ATSMS_Storage_Location
  */
 bool AdrasteaI_ATSMS_ReadMessageStorageUsage(AdrasteaI_ATSMS_Message_Storage_Usage_t* storageUsageP)
 {
-    if (storageUsageP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (storageUsageP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CPMS?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SMS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SMS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
-    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&storageUsageP->readDeleteStorageUsage.storageLocation, AdrasteaI_ATSMS_Storage_Location_Strings, AdrasteaI_ATSMS_Storage_Location_NumberOfValues, 30, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&storageUsageP->readDeleteStorageUsage.storageLocation, &AdrasteaI_ATSMS_Storage_Location_Strings, 30, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &storageUsageP->readDeleteStorageUsage.usedMessages, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &storageUsageP->readDeleteStorageUsage.maxMessages, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&storageUsageP->writeSendStorageUsage.storageLocation, AdrasteaI_ATSMS_Storage_Location_Strings, AdrasteaI_ATSMS_Storage_Location_NumberOfValues, 30, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&storageUsageP->writeSendStorageUsage.storageLocation, &AdrasteaI_ATSMS_Storage_Location_Strings, 30, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &storageUsageP->writeSendStorageUsage.usedMessages, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &storageUsageP->writeSendStorageUsage.maxMessages, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&storageUsageP->receiveStorageUsage.storageLocation, AdrasteaI_ATSMS_Storage_Location_Strings, AdrasteaI_ATSMS_Storage_Location_NumberOfValues, 30, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&storageUsageP->receiveStorageUsage.storageLocation, &AdrasteaI_ATSMS_Storage_Location_Strings, 30, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &storageUsageP->receiveStorageUsage.usedMessages, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &storageUsageP->receiveStorageUsage.maxMessages, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -323,6 +308,11 @@ bool AdrasteaI_ATSMS_ReadMessageStorageUsage(AdrasteaI_ATSMS_Message_Storage_Usa
  */
 bool AdrasteaI_ATSMS_SetServiceCenterAddress(AdrasteaI_ATSMS_Service_Center_Address_t serviceCenterAddress)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -331,14 +321,14 @@ bool AdrasteaI_ATSMS_SetServiceCenterAddress(AdrasteaI_ATSMS_Service_Center_Addr
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, serviceCenterAddress.address, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (serviceCenterAddress.addressType != AdrasteaI_ATSMS_Address_Type_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, serviceCenterAddress.addressType, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -347,20 +337,20 @@ bool AdrasteaI_ATSMS_SetServiceCenterAddress(AdrasteaI_ATSMS_Service_Center_Addr
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SMS), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SMS, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -372,36 +362,41 @@ bool AdrasteaI_ATSMS_SetServiceCenterAddress(AdrasteaI_ATSMS_Service_Center_Addr
  */
 bool AdrasteaI_ATSMS_ReadServiceCenterAddress(AdrasteaI_ATSMS_Service_Center_Address_t* serviceCenterAddressP)
 {
-    if (serviceCenterAddressP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (serviceCenterAddressP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     if (!AdrasteaI_SendRequest("AT+CSCA?\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SMS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SMS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
     if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, serviceCenterAddressP->address, ATCOMMAND_ARGUMENT_DELIM, sizeof(serviceCenterAddressP->address)))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &serviceCenterAddressP->addressType, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -419,11 +414,16 @@ bool AdrasteaI_ATSMS_ReadServiceCenterAddress(AdrasteaI_ATSMS_Service_Center_Add
  */
 bool AdrasteaI_ATSMS_SendMessage(AdrasteaI_ATSMS_Address_t address, AdrasteaI_ATSMS_Address_Type_t addressType, AdrasteaI_ATSMS_Message_Payload_t message, AdrasteaI_ATSMS_Message_Reference_t* messageReferenceP)
 {
-    if (messageReferenceP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (messageReferenceP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -432,14 +432,14 @@ bool AdrasteaI_ATSMS_SendMessage(AdrasteaI_ATSMS_Address_t address, AdrasteaI_AT
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, address, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (addressType != AdrasteaI_ATSMS_Address_Type_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, addressType, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -448,29 +448,29 @@ bool AdrasteaI_ATSMS_SendMessage(AdrasteaI_ATSMS_Address_t address, AdrasteaI_AT
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, "\r", ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, message, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, "\x1A", ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SMS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SMS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     while (*pResponseCommand != '\0' && *(pResponseCommand + 1) != '+')
@@ -482,10 +482,10 @@ bool AdrasteaI_ATSMS_SendMessage(AdrasteaI_ATSMS_Address_t address, AdrasteaI_AT
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, messageReferenceP, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -503,11 +503,16 @@ bool AdrasteaI_ATSMS_SendMessage(AdrasteaI_ATSMS_Address_t address, AdrasteaI_AT
  */
 bool AdrasteaI_ATSMS_SendLargeMessage(AdrasteaI_ATSMS_Address_t address, AdrasteaI_ATSMS_Address_Type_t addressType, AdrasteaI_ATSMS_Message_Payload_t message, AdrasteaI_ATSMS_Message_Reference_t* messageReferenceP)
 {
-    if (messageReferenceP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (messageReferenceP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -516,14 +521,14 @@ bool AdrasteaI_ATSMS_SendLargeMessage(AdrasteaI_ATSMS_Address_t address, Adraste
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, address, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (addressType != AdrasteaI_ATSMS_Address_Type_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, addressType, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -532,29 +537,29 @@ bool AdrasteaI_ATSMS_SendLargeMessage(AdrasteaI_ATSMS_Address_t address, Adraste
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, "\r", ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, message, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, "\x1A", ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SMS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SMS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     while (*pResponseCommand != '\0' && *(pResponseCommand + 1) != '+')
@@ -566,10 +571,10 @@ bool AdrasteaI_ATSMS_SendLargeMessage(AdrasteaI_ATSMS_Address_t address, Adraste
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, messageReferenceP, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -587,11 +592,16 @@ bool AdrasteaI_ATSMS_SendLargeMessage(AdrasteaI_ATSMS_Address_t address, Adraste
  */
 bool AdrasteaI_ATSMS_WriteMessageToStorage(AdrasteaI_ATSMS_Address_t address, AdrasteaI_ATSMS_Address_Type_t addressType, AdrasteaI_ATSMS_Message_Payload_t message, AdrasteaI_ATSMS_Message_Index_t* messageIndexP)
 {
-    if (messageIndexP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (messageIndexP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -600,14 +610,14 @@ bool AdrasteaI_ATSMS_WriteMessageToStorage(AdrasteaI_ATSMS_Address_t address, Ad
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, address, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (addressType != AdrasteaI_ATSMS_Address_Type_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, addressType, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -616,29 +626,29 @@ bool AdrasteaI_ATSMS_WriteMessageToStorage(AdrasteaI_ATSMS_Address_t address, Ad
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, "\r", ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, message, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, "\x1A", ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SMS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SMS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     while (*pResponseCommand != '\0' && *(pResponseCommand + 1) != '+')
@@ -650,10 +660,10 @@ bool AdrasteaI_ATSMS_WriteMessageToStorage(AdrasteaI_ATSMS_Address_t address, Ad
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, messageIndexP, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -667,45 +677,50 @@ bool AdrasteaI_ATSMS_WriteMessageToStorage(AdrasteaI_ATSMS_Address_t address, Ad
  */
 bool AdrasteaI_ATSMS_SendMessageFromStorage(AdrasteaI_ATSMS_Message_Index_t index, AdrasteaI_ATSMS_Message_Reference_t* messageReferenceP)
 {
-    if (messageReferenceP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (messageReferenceP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT+CMSS=");
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SMS), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SMS, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     pResponseCommand += 1;
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, messageReferenceP, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -717,13 +732,18 @@ bool AdrasteaI_ATSMS_SendMessageFromStorage(AdrasteaI_ATSMS_Message_Index_t inde
  */
 bool AdrasteaI_ATSMS_SetSMSUnsolicitedNotificationEvents(AdrasteaI_ATCommon_Event_State_t eventState)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     switch (eventState)
     {
         case AdrasteaI_ATCommon_Event_State_Enable:
         {
             if (!AdrasteaI_SendRequest("AT+CNMI=2,1\r\n"))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
             break;
         }
@@ -731,20 +751,20 @@ bool AdrasteaI_ATSMS_SetSMSUnsolicitedNotificationEvents(AdrasteaI_ATCommon_Even
         {
             if (!AdrasteaI_SendRequest("AT+CNMI=1,0\r\n"))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
             break;
         }
         default:
-            return false;
+            return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_SMS), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_SMS, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -762,38 +782,29 @@ bool AdrasteaI_ATSMS_ParseReadMessageEvent(char* pEventArguments, AdrasteaI_ATSM
         return false;
     }
 
-    char* argumentsP = pEventArguments;
-
-    argumentsP += 1;
+    ATCommand_Arguments_t arguments;
 
     dataP->messageIndex = 0;
 
-    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&argumentsP, (uint8_t*)&dataP->messageState, AdrasteaI_ATSMS_Message_State_Strings, AdrasteaI_ATSMS_Message_State_NumberOfValues, 30, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count < 3))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, dataP->address, ATCOMMAND_ARGUMENT_DELIM, sizeof(dataP->address)))
+    if (!ATCommand_GetArgumentEnumWithoutQuotationMarks(&arguments, 0, (uint8_t*)&dataP->messageState, &AdrasteaI_ATSMS_Message_State_Strings, 30))
     {
         return false;
     }
 
-    if (ATCommand_CountArgs(argumentsP) == 3)
+    if (!ATCommand_GetArgumentStringWithoutQuotationMarks(&arguments, 1, dataP->address, sizeof(dataP->address)))
     {
-        char extraData[40];
-
-        if (!ATCommand_GetNextArgumentString(&argumentsP, extraData, ATCOMMAND_ARGUMENT_DELIM, sizeof(extraData)))
-        {
-            return false;
-        }
-
-        if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, extraData, ATCOMMAND_ARGUMENT_DELIM, sizeof(extraData)))
-        {
-            return false;
-        }
+        return false;
     }
 
-    if (!ATCommand_GetNextArgumentString(&argumentsP, dataP->payload, ATCOMMAND_STRING_TERMINATE, sizeof(dataP->payload)))
+    /* Skip optional alpha and service centre time stamp */
+    uint8_t payloadIndex = (arguments.count == 5) ? 4 : 2;
+
+    if (!ATCommand_GetArgumentRemainder(&arguments, payloadIndex, dataP->payload, sizeof(dataP->payload)))
     {
         return false;
     }
@@ -816,41 +827,32 @@ bool AdrasteaI_ATSMS_ParseListMessagesEvent(char* pEventArguments, AdrasteaI_ATS
         return false;
     }
 
-    char* argumentsP = pEventArguments;
-
-    argumentsP += 1;
+    ATCommand_Arguments_t arguments;
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->messageIndex, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count < 4))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&argumentsP, (uint8_t*)&dataP->messageState, AdrasteaI_ATSMS_Message_State_Strings, AdrasteaI_ATSMS_Message_State_NumberOfValues, 30, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, &dataP->messageIndex, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8)))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, dataP->address, ATCOMMAND_ARGUMENT_DELIM, sizeof(dataP->address)))
+    if (!ATCommand_GetArgumentEnumWithoutQuotationMarks(&arguments, 1, (uint8_t*)&dataP->messageState, &AdrasteaI_ATSMS_Message_State_Strings, 30))
     {
         return false;
     }
 
-    if (ATCommand_CountArgs(argumentsP) == 3)
+    if (!ATCommand_GetArgumentStringWithoutQuotationMarks(&arguments, 2, dataP->address, sizeof(dataP->address)))
     {
-        char extraData[40];
-
-        if (!ATCommand_GetNextArgumentString(&argumentsP, extraData, ATCOMMAND_ARGUMENT_DELIM, sizeof(extraData)))
-        {
-            return false;
-        }
-
-        if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&argumentsP, extraData, ATCOMMAND_ARGUMENT_DELIM, sizeof(extraData)))
-        {
-            return false;
-        }
+        return false;
     }
 
-    if (!ATCommand_GetNextArgumentString(&argumentsP, dataP->payload, ATCOMMAND_STRING_TERMINATE, sizeof(dataP->payload)))
+    /* Skip optional alpha and service centre time stamp */
+    uint8_t payloadIndex = (arguments.count == 6) ? 5 : 3;
+
+    if (!ATCommand_GetArgumentRemainder(&arguments, payloadIndex, dataP->payload, sizeof(dataP->payload)))
     {
         return false;
     }
@@ -873,16 +875,19 @@ bool AdrasteaI_ATSMS_ParseMessageReceivedEvent(char* pEventArguments, AdrasteaI_
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    argumentsP += 1;
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 2))
+    {
+        return false;
+    }
 
-    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&argumentsP, (uint8_t*)&dataP->storageLocation, AdrasteaI_ATSMS_Storage_Location_Strings, AdrasteaI_ATSMS_Storage_Location_NumberOfValues, 30, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetArgumentEnumWithoutQuotationMarks(&arguments, 0, (uint8_t*)&dataP->storageLocation, &AdrasteaI_ATSMS_Storage_Location_Strings, 30))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->messageIndex, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_GetArgumentInt(&arguments, 1, &dataP->messageIndex, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8)))
     {
         return false;
     }
@@ -905,11 +910,14 @@ bool AdrasteaI_ATSMS_ParseSMSErrorEvent(char* pEventArguments, AdrasteaI_ATSMS_E
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    argumentsP += 1;
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 1))
+    {
+        return false;
+    }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, dataP, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE16), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, dataP, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE16)))
     {
         return false;
     }
@@ -32,12 +32,109 @@
 #include "ATSocket.h"
 #include "Adrastea/AdrasteaI.h"
 #include "ATCommands.h"
+#include "log.h"
+
+#define AdrasteaI_ATSocket_State_Entries(ENTRY)                \
+    ENTRY("ACTIVATED", AdrasteaI_ATSocket_State_Activated)     \
+    ENTRY("LISTENING", AdrasteaI_ATSocket_State_Listening)     \
+    ENTRY("DEACTIVATED", AdrasteaI_ATSocket_State_Deactivated)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATSocket_State_Strings, AdrasteaI_ATSocket_State_NumberOfValues, AdrasteaI_ATSocket_State_Entries);
+
+#define AdrasteaI_ATSocket_Type_Entries(ENTRY) \
+    ENTRY("TCP", AdrasteaI_ATSocket_Type_TCP)  \
+    ENTRY("UDP", AdrasteaI_ATSocket_Type_UDP)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATSocket_Type_Strings, AdrasteaI_ATSocket_Type_NumberOfValues, AdrasteaI_ATSocket_Type_Entries);
+
+#define AdrasteaI_ATSocket_Behaviour_Entries(ENTRY)               \
+    ENTRY("OPEN", AdrasteaI_ATSocket_Behaviour_Open_Connection)   \
+    ENTRY("LISTEN", AdrasteaI_ATSocket_Behaviour_Listen)          \
+    ENTRY("LISTENP", AdrasteaI_ATSocket_Behaviour_ListenMultiple)
+ATCOMMAND_STRINGTABLE(AdrasteaI_ATSocket_Behaviour_Strings, AdrasteaI_ATSocket_Behaviour_NumberOfValues, AdrasteaI_ATSocket_Behaviour_Entries);
+
+static const ATCommand_Field_t AdrasteaI_ATSocket_Read_Result_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATSocket_Read_Result_t, socketID, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_ENUMSTRING_QUOTATIONMARKS(AdrasteaI_ATSocket_Read_Result_t, socketState, &AdrasteaI_ATSocket_State_Strings),
+};
 
-static const char* AdrasteaI_ATSocket_State_Strings[AdrasteaI_ATSocket_State_NumberOfValues] = {"DEACTIVATED", "ACTIVATED", "LISTENING"};
+/**
+ * @brief Request of the commands addressing a single socket.
+ */
+typedef struct AdrasteaI_ATSocket_ID_Request_t
+{
+    AdrasteaI_ATSocket_ID_t socketID;
+} AdrasteaI_ATSocket_ID_Request_t;
 
-static const char* AdrasteaI_ATSocket_Type_Strings[AdrasteaI_ATSocket_Type_NumberOfValues] = {"TCP", "UDP"};
+static const ATCommand_Field_t AdrasteaI_ATSocket_ID_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATSocket_ID_Request_t, socketID, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
 
-static const char* AdrasteaI_ATSocket_Behaviour_Strings[AdrasteaI_ATSocket_Behaviour_NumberOfValues] = {"OPEN", "LISTEN", "LISTENP"};
+/**
+ * @brief Request of AdrasteaI_ATSocket_SetSocketOptions().
+ */
+typedef struct AdrasteaI_ATSocket_Options_Request_t
+{
+    AdrasteaI_ATSocket_ID_t socketID;
+    AdrasteaI_ATSocket_Aggregation_Time_t aggregationTime;
+    AdrasteaI_ATSocket_Aggregation_Buffer_Size_t aggregationBufferSize;
+    AdrasteaI_ATSocket_TCP_Idle_Time_t idleTime;
+} AdrasteaI_ATSocket_Options_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATSocket_Options_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATSocket_Options_Request_t, socketID, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATSocket_Options_Request_t, aggregationTime, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATSocket_Options_Request_t, aggregationBufferSize, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATSocket_Options_Request_t, idleTime, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief Request of AdrasteaI_ATSocket_AddSSLtoSocket().
+ */
+typedef struct AdrasteaI_ATSocket_SSL_Request_t
+{
+    AdrasteaI_ATSocket_ID_t socketID;
+    AdrasteaI_ATCommon_SSL_Auth_Mode_t authMode;
+    AdrasteaI_ATCommon_SSL_Profile_ID_t profileID;
+} AdrasteaI_ATSocket_SSL_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATSocket_SSL_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATSocket_SSL_Request_t, socketID, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATSocket_SSL_Request_t, authMode, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATSocket_SSL_Request_t, profileID, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief Request of AdrasteaI_ATSocket_SetSocketUnsolicitedNotificationEvents().
+ */
+typedef struct AdrasteaI_ATSocket_Event_Request_t
+{
+    AdrasteaI_ATSocket_Event_t event;
+    AdrasteaI_ATCommon_Event_State_t state;
+} AdrasteaI_ATSocket_Event_Request_t;
+
+static const ATCommand_Field_t AdrasteaI_ATSocket_Event_Request_Fields[] = {
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATSocket_Event_Request_t, event, ATCOMMAND_INTFLAGS_UNSIGNED),
+    ATCOMMAND_FIELD_INT(AdrasteaI_ATSocket_Event_Request_t, state, ATCOMMAND_INTFLAGS_UNSIGNED),
+};
+
+/**
+ * @brief Socket commands with fixed argument layout, see AdrasteaI_Command_t.
+ */
+#define ADRASTEAI_ATSOCKET_COMMANDS(COMMAND)                                                                                                                                                    \
+    COMMAND(AdrasteaI_ATSocket_Command_ReadCreatedSocketsStates, "AT%SOCKETCMD?", Socket, ADRASTEAI_COMMAND_NO_FIELDS, ADRASTEAI_COMMAND_NO_FIELDS)                                             \
+    COMMAND(AdrasteaI_ATSocket_Command_DeactivateSocket, "AT%SOCKETCMD=\"DEACTIVATE\",", Socket, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATSocket_ID_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)   \
+    COMMAND(AdrasteaI_ATSocket_Command_SetSocketOptions, "AT%SOCKETCMD=\"SETOPT\",", Socket, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATSocket_Options_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)  \
+    COMMAND(AdrasteaI_ATSocket_Command_DeleteSocket, "AT%SOCKETCMD=\"DELETE\",", Socket, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATSocket_ID_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)           \
+    COMMAND(AdrasteaI_ATSocket_Command_AddSSLtoSocket, "AT%SOCKETCMD=\"SSLALLOC\",", Socket, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATSocket_SSL_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)      \
+    COMMAND(AdrasteaI_ATSocket_Command_KeepSocketSSLSession, "AT%SOCKETCMD=\"SSLKEEP\",", Socket, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATSocket_ID_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)  \
+    COMMAND(AdrasteaI_ATSocket_Command_DeleteSocketSSLSession, "AT%SOCKETCMD=\"SSLDEL\",", Socket, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATSocket_ID_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS) \
+    COMMAND(AdrasteaI_ATSocket_Command_SetSocketUnsolicitedNotificationEvents, "AT%SOCKETEV=", Socket, ADRASTEAI_COMMAND_FIELDS(AdrasteaI_ATSocket_Event_Request_Fields), ADRASTEAI_COMMAND_NO_FIELDS)
+
+typedef enum AdrasteaI_ATSocket_Command_t
+{
+    ADRASTEAI_ATSOCKET_COMMANDS(ADRASTEAI_COMMAND_ID) AdrasteaI_ATSocket_Command_NumberOfValues
+} AdrasteaI_ATSocket_Command_t;
+
+static const AdrasteaI_Command_t AdrasteaI_ATSocket_Commands[AdrasteaI_ATSocket_Command_NumberOfValues] = {ADRASTEAI_ATSOCKET_COMMANDS(ADRASTEAI_COMMAND_DESCRIPTOR)};
 
 /**
  * @brief Read Created Sockets States (using the AT%SOCKETCMD command).
@@ -46,11 +143,7 @@ static const char* AdrasteaI_ATSocket_Behaviour_Strings[AdrasteaI_ATSocket_Behav
  */
 bool AdrasteaI_ATSocket_ReadCreatedSocketsStates()
 {
-    if (!AdrasteaI_SendRequest("AT%SOCKETCMD?\r\n"))
-    {
-        return false;
-    }
-    return AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, NULL);
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATSocket_Commands[AdrasteaI_ATSocket_Command_ReadCreatedSocketsStates], NULL, NULL);
 }
 
 /**
@@ -81,11 +174,16 @@ bool AdrasteaI_ATSocket_ReadCreatedSocketsStates()
 bool AdrasteaI_ATSocket_AllocateSocket(AdrasteaI_ATCommon_Session_ID_t sessionID, AdrasteaI_ATSocket_Type_t socketType, AdrasteaI_ATSocket_Behaviour_t socketBehaviour, AdrasteaI_ATCommon_IP_Addr_t destinationIPAddress, AdrasteaI_ATCommon_Port_Number_t destinationPortNumber, AdrasteaI_ATCommon_Port_Number_t sourcePortNumber, AdrasteaI_ATSocket_Data_Length_t packetSize,
                                        AdrasteaI_ATSocket_Timeout_t socketTimeout, AdrasteaI_ATSocket_IP_Addr_Format_t addressFormat, AdrasteaI_ATSocket_ID_t* socketIDP)
 {
-    if (socketIDP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (socketIDP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -94,34 +192,34 @@ bool AdrasteaI_ATSocket_AllocateSocket(AdrasteaI_ATCommon_Session_ID_t sessionID
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSocket_Type_Strings[socketType], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSocket_Type_Strings.strings[socketType], ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSocket_Behaviour_Strings[socketBehaviour], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATSocket_Behaviour_Strings.strings[socketBehaviour], ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, destinationIPAddress, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, destinationPortNumber, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (sourcePortNumber != AdrasteaI_ATCommon_Port_Number_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, sourcePortNumber, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -129,7 +227,7 @@ bool AdrasteaI_ATSocket_AllocateSocket(AdrasteaI_ATCommon_Session_ID_t sessionID
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
@@ -138,7 +236,7 @@ bool AdrasteaI_ATSocket_AllocateSocket(AdrasteaI_ATCommon_Session_ID_t sessionID
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, packetSize, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -146,7 +244,7 @@ bool AdrasteaI_ATSocket_AllocateSocket(AdrasteaI_ATCommon_Session_ID_t sessionID
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
@@ -155,7 +253,7 @@ bool AdrasteaI_ATSocket_AllocateSocket(AdrasteaI_ATCommon_Session_ID_t sessionID
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, socketTimeout, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 1;
     }
@@ -163,7 +261,7 @@ bool AdrasteaI_ATSocket_AllocateSocket(AdrasteaI_ATCommon_Session_ID_t sessionID
     {
         if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
@@ -172,7 +270,7 @@ bool AdrasteaI_ATSocket_AllocateSocket(AdrasteaI_ATCommon_Session_ID_t sessionID
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, addressFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -181,27 +279,27 @@ bool AdrasteaI_ATSocket_AllocateSocket(AdrasteaI_ATCommon_Session_ID_t sessionID
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Socket, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, socketIDP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -215,6 +313,11 @@ bool AdrasteaI_ATSocket_AllocateSocket(AdrasteaI_ATCommon_Session_ID_t sessionID
  */
 bool AdrasteaI_ATSocket_ActivateSocket(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_ATCommon_Session_ID_t SSLSessionID)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
@@ -223,14 +326,14 @@ bool AdrasteaI_ATSocket_ActivateSocket(AdrasteaI_ATSocket_ID_t socketID, Adraste
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (SSLSessionID != AdrasteaI_ATCommon_Session_ID_Invalid)
     {
         if (!ATCommand_AppendArgumentInt(pRequestCommand, SSLSessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
-            return false;
+            return AdrasteaI_EndCommand(false);
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
@@ -239,20 +342,20 @@ bool AdrasteaI_ATSocket_ActivateSocket(AdrasteaI_ATSocket_ID_t socketID, Adraste
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Socket, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -266,69 +369,74 @@ bool AdrasteaI_ATSocket_ActivateSocket(AdrasteaI_ATSocket_ID_t socketID, Adraste
  */
 bool AdrasteaI_ATSocket_ReadSocketInfo(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_ATSocket_Info_t* infoP)
 {
-    if (infoP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (infoP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%SOCKETCMD=\"INFO\",");
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Socket, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&infoP->socketState, AdrasteaI_ATSocket_State_Strings, AdrasteaI_ATSocket_State_NumberOfValues, 30, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&infoP->socketState, &AdrasteaI_ATSocket_State_Strings, 30, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&infoP->socketType, AdrasteaI_ATSocket_Type_Strings, AdrasteaI_ATSocket_Type_NumberOfValues, 30, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&pResponseCommand, (uint8_t*)&infoP->socketType, &AdrasteaI_ATSocket_Type_Strings, 30, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, infoP->sourceIPAddress, ATCOMMAND_ARGUMENT_DELIM, sizeof(infoP->sourceIPAddress)))
+    if (!AdrasteaI_ATCommon_GetNextArgumentIPAddress(&pResponseCommand, &infoP->source.address, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, infoP->destinationIPAddress, ATCOMMAND_ARGUMENT_DELIM, sizeof(infoP->sourceIPAddress)))
+    if (!AdrasteaI_ATCommon_GetNextArgumentIPAddress(&pResponseCommand, &infoP->destination.address, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &infoP->sourcePortNumber, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &infoP->source.port, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     switch (ATCommand_CountArgs(pResponseCommand))
     {
         case 1:
         {
-            if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &infoP->destinationPortNumber, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &infoP->destination.port, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             infoP->tcpSocketDirection = AdrasteaI_ATSocket_Direction_Invalid;
@@ -339,28 +447,28 @@ bool AdrasteaI_ATSocket_ReadSocketInfo(AdrasteaI_ATSocket_ID_t socketID, Adraste
         }
         case 3:
         {
-            if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &infoP->destinationPortNumber, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &infoP->destination.port, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &infoP->tcpSocketDirection, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &infoP->socketTimeout, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
         }
         default:
-            return false;
+            return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -372,31 +480,9 @@ bool AdrasteaI_ATSocket_ReadSocketInfo(AdrasteaI_ATSocket_ID_t socketID, Adraste
  */
 bool AdrasteaI_ATSocket_DeactivateSocket(AdrasteaI_ATSocket_ID_t socketID)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%SOCKETCMD=\"DEACTIVATE\",");
+    AdrasteaI_ATSocket_ID_Request_t request = {.socketID = socketID};
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATSocket_Commands[AdrasteaI_ATSocket_Command_DeactivateSocket], &request, NULL);
 }
 
 /**
@@ -414,46 +500,9 @@ bool AdrasteaI_ATSocket_DeactivateSocket(AdrasteaI_ATSocket_ID_t socketID)
  */
 bool AdrasteaI_ATSocket_SetSocketOptions(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_ATSocket_Aggregation_Time_t aggregationTime, AdrasteaI_ATSocket_Aggregation_Buffer_Size_t aggregationBufferSize, AdrasteaI_ATSocket_TCP_Idle_Time_t idleTime)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%SOCKETCMD=\"SETOPT\",");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, aggregationTime, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, aggregationBufferSize, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, idleTime, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
+    AdrasteaI_ATSocket_Options_Request_t request = {.socketID = socketID, .aggregationTime = aggregationTime, .aggregationBufferSize = aggregationBufferSize, .idleTime = idleTime};
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATSocket_Commands[AdrasteaI_ATSocket_Command_SetSocketOptions], &request, NULL);
 }
 
 /**
@@ -465,31 +514,9 @@ bool AdrasteaI_ATSocket_SetSocketOptions(AdrasteaI_ATSocket_ID_t socketID, Adras
  */
 bool AdrasteaI_ATSocket_DeleteSocket(AdrasteaI_ATSocket_ID_t socketID)
 {
-    char* pRequestCommand = AT_commandBuffer;
+    AdrasteaI_ATSocket_ID_Request_t request = {.socketID = socketID};
 
-    strcpy(pRequestCommand, "AT%SOCKETCMD=\"DELETE\",");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATSocket_Commands[AdrasteaI_ATSocket_Command_DeleteSocket], &request, NULL);
 }
 
 /**
@@ -505,41 +532,9 @@ bool AdrasteaI_ATSocket_DeleteSocket(AdrasteaI_ATSocket_ID_t socketID)
  */
 bool AdrasteaI_ATSocket_AddSSLtoSocket(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_ATCommon_SSL_Auth_Mode_t authMode, AdrasteaI_ATCommon_SSL_Profile_ID_t profileID)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%SOCKETCMD=\"SSLALLOC\",");
+    AdrasteaI_ATSocket_SSL_Request_t request = {.socketID = socketID, .authMode = authMode, .profileID = profileID};
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, authMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
-
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATSocket_Commands[AdrasteaI_ATSocket_Command_AddSSLtoSocket], &request, NULL);
 }
 
 /**
@@ -553,43 +548,48 @@ bool AdrasteaI_ATSocket_AddSSLtoSocket(AdrasteaI_ATSocket_ID_t socketID, Adraste
  */
 bool AdrasteaI_ATSocket_ReadSocketLastError(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_ATSocket_Error_Code_t* errorCodeP)
 {
-    if (errorCodeP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (errorCodeP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%SOCKETCMD=\"LASTERROR\",");
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Socket, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, errorCodeP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -603,48 +603,53 @@ bool AdrasteaI_ATSocket_ReadSocketLastError(AdrasteaI_ATSocket_ID_t socketID, Ad
  */
 bool AdrasteaI_ATSocket_ReadSocketSSLInfo(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_ATSocket_SSL_Info_t* infoP)
 {
-    if (infoP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if (infoP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%SOCKETCMD=\"SSLINFO\",");
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Socket, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &infoP->SSLMode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &infoP->profileID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -656,31 +661,9 @@ bool AdrasteaI_ATSocket_ReadSocketSSLInfo(AdrasteaI_ATSocket_ID_t socketID, Adra
  */
 bool AdrasteaI_ATSocket_KeepSocketSSLSession(AdrasteaI_ATSocket_ID_t socketID)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%SOCKETCMD=\"SSLKEEP\",");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, NULL))
-    {
-        return false;
-    }
+    AdrasteaI_ATSocket_ID_Request_t request = {.socketID = socketID};
 
-    return true;
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATSocket_Commands[AdrasteaI_ATSocket_Command_KeepSocketSSLSession], &request, NULL);
 }
 
 /**
@@ -692,141 +675,203 @@ bool AdrasteaI_ATSocket_KeepSocketSSLSession(AdrasteaI_ATSocket_ID_t socketID)
  */
 bool AdrasteaI_ATSocket_DeleteSocketSSLSession(AdrasteaI_ATSocket_ID_t socketID)
 {
-    char* pRequestCommand = AT_commandBuffer;
-
-    strcpy(pRequestCommand, "AT%SOCKETCMD=\"SSLDEL\",");
-
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
+    AdrasteaI_ATSocket_ID_Request_t request = {.socketID = socketID};
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
-    {
-        return false;
-    }
-
-    if (!AdrasteaI_SendRequest(pRequestCommand))
-    {
-        return false;
-    }
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATSocket_Commands[AdrasteaI_ATSocket_Command_DeleteSocketSSLSession], &request, NULL);
+}
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, NULL))
+/**
+ * @brief Gets the data argument of a AT%SOCKETDATA="RECEIVE" response.
+ *
+ * @param[in] argumentsP Tokenized response
+ * @param[in,out] dataReadP Receives the data, dataReadP->dataLength has to be parsed already
+ * @param[in] bufferSize Size of dataReadP->data
+ * @param[in] decodeHex Decode the hex encoded data instead of copying it as string
+ *
+ * @return true if successful, false otherwise
+ */
+static bool AdrasteaI_ATSocket_GetReceivedData(const ATCommand_Arguments_t* argumentsP, AdrasteaI_ATSocket_Data_Read_t* dataReadP, uint16_t bufferSize, bool decodeHex)
+{
+    if (!decodeHex)
     {
-        return false;
+        return ATCommand_GetArgumentStringWithoutQuotationMarks(argumentsP, 3, dataReadP->data, bufferSize);
     }
 
-    return true;
+    uint16_t decodedLength;
+    return ATCommand_GetArgumentHex(argumentsP, 3, (uint8_t*)dataReadP->data, bufferSize, &decodedLength) && (decodedLength == dataReadP->dataLength);
 }
 
 /**
- * @brief Receive from Socket (using the AT%SOCKETDATA command).
+ * @brief Reads data from a socket (using the AT%SOCKETDATA command).
  *
- * @param[in] socketID Socket ID.
- *
- * @param[in] maxBufferLength Maximum data length to read.
- *
- * @param[out] dataReadP Data read is returned in this argument.
+ * @param[in] socketID Socket ID
+ * @param[out] dataReadP Data read is returned in this argument
+ * @param[in] requestLength Max. number of bytes to read
+ * @param[in] bufferSize Size of the buffer dataReadP->data
+ * @param[in] decodeHex Decode the hex encoded data instead of copying it as string
  *
  * @return true if successful, false otherwise
  */
-bool AdrasteaI_ATSocket_ReceiveFromSocket(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_ATSocket_Data_Read_t* dataReadP, uint16_t maxBufferLength)
+static bool AdrasteaI_ATSocket_Receive(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_ATSocket_Data_Read_t* dataReadP, uint16_t requestLength, uint16_t bufferSize, bool decodeHex)
 {
-    if (dataReadP == NULL)
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
+    if ((dataReadP == NULL) || (requestLength == 0))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%SOCKETDATA=\"RECEIVE\",");
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, maxBufferLength, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_AppendArgumentInt(pRequestCommand, requestLength, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     char* pResponseCommand = AT_commandBuffer;
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, pResponseCommand))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Socket, AdrasteaI_CNFStatus_Success, pResponseCommand))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &dataReadP->socketID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    ATCommand_Arguments_t arguments;
+
+    if (!ATCommand_TokenizeArguments(pResponseCommand, &arguments))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &dataReadP->dataLength, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, &dataReadP->socketID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &dataReadP->dataLeftLength, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetArgumentInt(&arguments, 1, &dataReadP->dataLength, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    switch (ATCommand_CountArgs(pResponseCommand))
+    if (!ATCommand_GetArgumentInt(&arguments, 2, &dataReadP->dataLeftLength, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
-        case 1:
+        return AdrasteaI_EndCommand(false);
+    }
+
+    switch (arguments.count)
+    {
+        case 4:
         {
-            if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, dataReadP->data, ATCOMMAND_STRING_TERMINATE, maxBufferLength))
+            if (!AdrasteaI_ATSocket_GetReceivedData(&arguments, dataReadP, bufferSize, decodeHex))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
-            strcpy(dataReadP->sourceIPAddress, "");
+            memset(&dataReadP->source, 0, sizeof(dataReadP->source));
+
+            dataReadP->source.address.family = AdrasteaI_ATCommon_IP_Family_Invalid;
 
-            dataReadP->sourcePortNumber = AdrasteaI_ATCommon_Port_Number_Invalid;
+            dataReadP->source.port = AdrasteaI_ATCommon_Port_Number_Invalid;
 
             break;
         }
-        case 3:
+        case 6:
         {
-            if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, dataReadP->data, ATCOMMAND_ARGUMENT_DELIM, maxBufferLength))
+            if (!AdrasteaI_ATSocket_GetReceivedData(&arguments, dataReadP, bufferSize, decodeHex))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
-            if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(&pResponseCommand, dataReadP->sourceIPAddress, ATCOMMAND_ARGUMENT_DELIM, sizeof(dataReadP->sourceIPAddress)))
+            if (!AdrasteaI_ATCommon_GetArgumentIPAddress(&arguments, 4, &dataReadP->source.address))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
-            if (!ATCommand_GetNextArgumentInt(&pResponseCommand, &dataReadP->sourcePortNumber, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_GetArgumentInt(&arguments, 5, &dataReadP->source.port, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED))
             {
-                return false;
+                return AdrasteaI_EndCommand(false);
             }
 
             break;
         }
         default:
-            return false;
+            return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    WE_LOG_DEBUG(ATSocket, "Socket %u: received %u bytes, %u bytes left", dataReadP->socketID, dataReadP->dataLength, dataReadP->dataLeftLength);
+
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Receive from Socket (using the AT%SOCKETDATA command).
+ *
+ * The data is copied as string as reported by the module. Use AdrasteaI_ATSocket_ReceiveBinaryFromSocket()
+ * for data that may contain zero bytes.
+ *
+ * @param[in] socketID Socket ID.
+ *
+ * @param[in] maxBufferLength Size of the buffer dataReadP->data (including the terminating zero), at most maxBufferLength - 1 bytes are read.
+ *
+ * @param[out] dataReadP Data read is returned in this argument.
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_ATSocket_ReceiveFromSocket(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_ATSocket_Data_Read_t* dataReadP, uint16_t maxBufferLength)
+{
+    if (maxBufferLength < 2)
+    {
+        return false;
+    }
+    return AdrasteaI_ATSocket_Receive(socketID, dataReadP, maxBufferLength - 1, maxBufferLength, false);
+}
+
+/**
+ * @brief Receive binary data from Socket (using the AT%SOCKETDATA command).
+ *
+ * The module reports the received data hex encoded (two hex digits per byte). The data is decoded into
+ * dataReadP->data, so it may contain any byte value. dataReadP->dataLength is the number of bytes decoded,
+ * the data is not null terminated.
+ *
+ * @param[in] socketID Socket ID.
+ *
+ * @param[out] dataReadP Data read is returned in this argument.
+ *
+ * @param[in] maxLength Size of the buffer dataReadP->data, at most maxLength bytes are read
+ * (the hex encoded response has to fit into ADRASTEAI_LINE_MAX_SIZE).
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_ATSocket_ReceiveBinaryFromSocket(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_ATSocket_Data_Read_t* dataReadP, uint16_t maxLength)
+{
+    return AdrasteaI_ATSocket_Receive(socketID, dataReadP, maxLength, maxLength, true);
 }
 
 /**
  * @brief Send to Socket (using the AT%SOCKETDATA command).
  *
+ * The data is sent as quoted string, so it must not contain zero bytes, quotation marks or line breaks.
+ * Use AdrasteaI_ATSocket_SendBinaryToSocket() for arbitrary data.
+ *
  * @param[in] socketID Socket ID.
  *
  * @param[in] data Data to send.
@@ -837,84 +882,292 @@ bool AdrasteaI_ATSocket_ReceiveFromSocket(AdrasteaI_ATSocket_ID_t socketID, Adra
  */
 bool AdrasteaI_ATSocket_SendToSocket(AdrasteaI_ATSocket_ID_t socketID, char* data, AdrasteaI_ATSocket_Data_Length_t dataLength)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     char* pRequestCommand = AT_commandBuffer;
 
     strcpy(pRequestCommand, "AT%SOCKETDATA=\"SEND\",");
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentInt(pRequestCommand, dataLength, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, data, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest(pRequestCommand))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Socket, AdrasteaI_CNFStatus_Success, NULL))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief End of an AT%SOCKETDATA command following the hex encoded data of a segment.
+ */
+#define ADRASTEAI_ATSOCKET_SEGMENT_END "\"" ATCOMMAND_CRLF
+
+/**
+ * @brief Writes the AT%SOCKETDATA command for one segment of binary data up to the opening quotation mark of the data.
+ *
+ * The hex encoded data and ADRASTEAI_ATSOCKET_SEGMENT_END follow, either in the same buffer (see
+ * AdrasteaI_ATSocket_EncodeSegment()) or transmitted separately (see AdrasteaI_ATSocket_SendStream()). The buffers are
+ * sized with ADRASTEAI_ATSOCKET_SEGMENT_OVERHEAD, which has to be updated if the command changes.
+ *
+ * @param[out] pRequestCommand Buffer for the command
+ * @param[in] socketID Socket ID
+ * @param[in] length Length of the segment
+ *
+ * @return true if successful, false otherwise
+ */
+static bool AdrasteaI_ATSocket_EncodeSegmentHeader(char* pRequestCommand, AdrasteaI_ATSocket_ID_t socketID, uint16_t length)
+{
+    strcpy(pRequestCommand, "AT%SOCKETDATA=\"SEND\",");
+
+    if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return false;
+    }
+
+    if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, NULL))
+    return ATCommand_AppendArgumentString(pRequestCommand, "\"", ATCOMMAND_STRING_TERMINATE);
+}
+
+/**
+ * @brief Writes the complete AT%SOCKETDATA command for one segment of binary data (hex encoded) to a buffer.
+ *
+ * @param[out] pRequestCommand Buffer for the command (2 * length + ADRASTEAI_ATSOCKET_SEGMENT_OVERHEAD characters)
+ * @param[in] socketID Socket ID
+ * @param[in] data Data of the segment
+ * @param[in] length Length of the segment
+ *
+ * @return true if successful, false otherwise
+ */
+static bool AdrasteaI_ATSocket_EncodeSegment(char* pRequestCommand, AdrasteaI_ATSocket_ID_t socketID, const uint8_t* data, uint16_t length)
+{
+    if (!AdrasteaI_ATSocket_EncodeSegmentHeader(pRequestCommand, socketID, length))
     {
         return false;
     }
 
+    char* pData = pRequestCommand + strlen(pRequestCommand);
+    ATCommand_EncodeHex(data, length, pData);
+    strcpy(pData + 2 * (size_t)length, ADRASTEAI_ATSOCKET_SEGMENT_END);
+
     return true;
 }
 
 /**
- * @brief Set Socket Notification Events (using the AT%SOCKETEV command).
+ * @brief Send binary data to Socket (using the AT%SOCKETDATA command with hex encoded data).
  *
- * @param[in] event Socket event type. See AdrasteaI_ATSocket_Event_t.
+ * Data of any length is sent in segments of up to ADRASTEAI_ATSOCKET_HEX_SEGMENT_SIZE bytes, one command per segment.
+ * The data is hex encoded while it is transmitted, it is not copied to the command buffer.
+ * Same as AdrasteaI_ATSocket_SendStream() without segment buffer.
  *
- * @param[in] state Event State
+ * @param[in] socketID Socket ID.
+ *
+ * @param[in] data Data to send.
+ *
+ * @param[in] dataLength Length of data to send.
  *
  * @return true if successful, false otherwise
  */
-bool AdrasteaI_ATSocket_SetSocketUnsolicitedNotificationEvents(AdrasteaI_ATSocket_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
+bool AdrasteaI_ATSocket_SendBinaryToSocket(AdrasteaI_ATSocket_ID_t socketID, const uint8_t* data, uint32_t dataLength)
 {
-    char* pRequestCommand = AT_commandBuffer;
+    AdrasteaI_ATSocket_Send_Stream_t stream = {0};
+    stream.socketID = socketID;
+    stream.data = data;
+    stream.dataLength = dataLength;
 
-    strcpy(pRequestCommand, "AT%SOCKETEV=");
+    return AdrasteaI_ATSocket_SendStream(&stream);
+}
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, event, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+/**
+ * @brief Send binary data to Socket as a sequence of AT%SOCKETDATA commands with hex encoded data.
+ *
+ * The data is sent in segments of up to ADRASTEAI_ATSOCKET_HEX_SEGMENT_SIZE bytes, one command per segment. The module
+ * accepts only one command at a time, so the next segment is sent when the previous one has been confirmed.
+ *
+ * Without streamP->segmentBuffer, the data of each segment is hex encoded while it is transmitted after the command
+ * header. With streamP->segmentBuffer, the complete command for the next segment is prepared alternately in
+ * AT_commandBuffer and streamP->segmentBuffer while the module processes the current one. This hides the time needed
+ * for encoding a segment, but one segment in flight plus one prepared is all that can be gained: The number of
+ * round trips is the same in both cases (see tools/host/bench_socket_send.c).
+ *
+ * Sending stops after the pending segment if streamP->cancel is set. On return, streamP->bytesAcknowledged holds the
+ * number of bytes accepted by the module, i.e. sending can be resumed from there. The remaining output fields
+ * report the achieved goodput and the goodput the UART could achieve at most with the same command overhead.
+ *
+ * @param[in,out] streamP Stream to send. See AdrasteaI_ATSocket_Send_Stream_t.
+ *
+ * @return true if all data has been acknowledged by the module, false otherwise (error or canceled)
+ */
+bool AdrasteaI_ATSocket_SendStream(AdrasteaI_ATSocket_Send_Stream_t* streamP)
+{
+    if (streamP == NULL)
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    streamP->bytesAcknowledged = 0;
+    streamP->uartBytes = 0;
+    streamP->segments = 0;
+    streamP->durationUsec = 0;
+    streamP->goodput = 0;
+    streamP->goodputLimit = 0;
+
+    bool prepare = (streamP->segmentBuffer != NULL);
+
+    if (((streamP->data == NULL) && (streamP->dataLength > 0)) || (prepare && (streamP->segmentBufferSize < ADRASTEAI_ATSOCKET_SEGMENT_OVERHEAD + 2)))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!AdrasteaI_BeginCommand())
     {
         return false;
     }
 
-    if (!AdrasteaI_SendRequest(pRequestCommand))
+    /* With a segment buffer, both buffers must be able to hold a complete command */
+    uint16_t segmentSize = ADRASTEAI_ATSOCKET_HEX_SEGMENT_SIZE;
+    if (prepare && ((streamP->segmentBufferSize - ADRASTEAI_ATSOCKET_SEGMENT_OVERHEAD) / 2 < segmentSize))
     {
-        return false;
+        segmentSize = (streamP->segmentBufferSize - ADRASTEAI_ATSOCKET_SEGMENT_OVERHEAD) / 2;
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Socket), AdrasteaI_CNFStatus_Success, NULL))
+    char* buffers[2] = {AT_commandBuffer, streamP->segmentBuffer};
+    uint8_t current = 0;
+    uint32_t offset = 0;
+    uint16_t currentLength = (streamP->dataLength - offset > segmentSize) ? segmentSize : (uint16_t)(streamP->dataLength - offset);
+    bool ret = true;
+
+    uint32_t startTime = WE_GetTickMicroseconds();
+
+    if (prepare && !AdrasteaI_ATSocket_EncodeSegment(buffers[current], streamP->socketID, streamP->data, currentLength))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    return true;
+    while (offset < streamP->dataLength)
+    {
+        if (streamP->cancel)
+        {
+            ret = false;
+            break;
+        }
+
+        if (prepare)
+        {
+            size_t commandLength = strlen(buffers[current]);
+            if (!AdrasteaI_SendRequest(buffers[current]))
+            {
+                ret = false;
+                break;
+            }
+            streamP->uartBytes += commandLength;
+        }
+        else
+        {
+            /* The payload is encoded while it is transmitted after the command header */
+            if (!AdrasteaI_ATSocket_EncodeSegmentHeader(AT_commandBuffer, streamP->socketID, currentLength))
+            {
+                ret = false;
+                break;
+            }
+            size_t headerLength = strlen(AT_commandBuffer);
+            if (!AdrasteaI_SendRequest(AT_commandBuffer) || !AdrasteaI_Transparent_TransmitHex(streamP->data + offset, currentLength) || !AdrasteaI_Transparent_Transmit(ADRASTEAI_ATSOCKET_SEGMENT_END, strlen(ADRASTEAI_ATSOCKET_SEGMENT_END)))
+            {
+                ret = false;
+                break;
+            }
+            streamP->uartBytes += headerLength + 2 * (uint32_t)currentLength + strlen(ADRASTEAI_ATSOCKET_SEGMENT_END);
+        }
+
+        /* Prepare the next command while the module processes the current one. The buffer holding the current
+         * command is not touched until it has been confirmed, as the UART transmits asynchronously. */
+        uint32_t nextOffset = offset + currentLength;
+        uint16_t nextLength = (streamP->dataLength - nextOffset > segmentSize) ? segmentSize : (uint16_t)(streamP->dataLength - nextOffset);
+        if (prepare && (nextLength > 0) && !AdrasteaI_ATSocket_EncodeSegment(buffers[current ^ 1], streamP->socketID, streamP->data + nextOffset, nextLength))
+        {
+            /* Cannot happen with a valid segment size, but the pending command must be waited for nonetheless */
+            nextLength = 0;
+            ret = false;
+        }
+
+        if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Socket, AdrasteaI_CNFStatus_Success, NULL))
+        {
+            ret = false;
+            break;
+        }
+
+        streamP->bytesAcknowledged += currentLength;
+        streamP->segments++;
+
+        if (!ret)
+        {
+            break;
+        }
+
+        offset = nextOffset;
+        currentLength = nextLength;
+        current ^= 1;
+    }
+
+    streamP->durationUsec = WE_GetTickMicroseconds() - startTime;
+    if (streamP->durationUsec > 0)
+    {
+        streamP->goodput = (uint32_t)(((uint64_t)streamP->bytesAcknowledged * 1000000) / streamP->durationUsec);
+    }
+    if (streamP->uartBytes > 0)
+    {
+        streamP->goodputLimit = (uint32_t)(((uint64_t)streamP->bytesAcknowledged * AdrasteaI_GetUartCharactersPerSecond()) / streamP->uartBytes);
+    }
+
+    WE_LOG_DEBUG(ATSocket, "Socket %u: %u bytes acknowledged in %u us", streamP->socketID, streamP->bytesAcknowledged, streamP->durationUsec);
+
+    return AdrasteaI_EndCommand(ret);
+}
+
+/**
+ * @brief Set Socket Notification Events (using the AT%SOCKETEV command).
+ *
+ * @param[in] event Socket event type. See AdrasteaI_ATSocket_Event_t.
+ *
+ * @param[in] state Event State
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_ATSocket_SetSocketUnsolicitedNotificationEvents(AdrasteaI_ATSocket_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
+{
+    AdrasteaI_ATSocket_Event_Request_t request = {.event = event, .state = state};
+
+    return AdrasteaI_ExecuteCommand(&AdrasteaI_ATSocket_Commands[AdrasteaI_ATSocket_Command_SetSocketUnsolicitedNotificationEvents], &request, NULL);
 }
 
 /**
@@ -932,9 +1185,14 @@ bool AdrasteaI_ATSocket_ParseDataReceivedEvent(char* pEventArguments, AdrasteaI_
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 1))
+    {
+        return false;
+    }
+
+    if (!ATCommand_GetArgumentInt(&arguments, 0, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
         return false;
     }
@@ -957,9 +1215,14 @@ bool AdrasteaI_ATSocket_ParseSocketTerminatedEvent(char* pEventArguments, Adrast
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
+
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 1))
+    {
+        return false;
+    }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
         return false;
     }
@@ -968,36 +1231,62 @@ bool AdrasteaI_ATSocket_ParseSocketTerminatedEvent(char* pEventArguments, Adrast
 }
 
 /**
- * @brief Parses the value of Socket Read event arguments.
+ * @brief Parses the value of New Socket Accepted event arguments.
  *
  * @param[in]  pEventArguments String containing arguments of the AT command
- * @param[out] dataP Socket Read Result si returned in this argument. See AdrasteaI_ATSocket_Read_Result_t.
+ * @param[out] dataP ID of the listening socket and of the accepted socket are returned in this argument.
  *
  * @return true if successful, false otherwise
  */
-bool AdrasteaI_ATSocket_ParseSocketsReadEvent(char* pEventArguments, AdrasteaI_ATSocket_Read_Result_t* dataP)
+bool AdrasteaI_ATSocket_ParseNewSocketAcceptedEvent(char* pEventArguments, AdrasteaI_ATSocket_Accepted_t* dataP)
 {
     if (dataP == NULL || pEventArguments == NULL)
     {
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Arguments_t arguments;
 
-    if (ATCommand_CountArgs(argumentsP) != 2)
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count < 1) || (arguments.count > 2))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->socketID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_GetArgumentInt(&arguments, 0, &dataP->listenSocketID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentEnumWithoutQuotationMarks(&argumentsP, (uint8_t*)&dataP->socketState, AdrasteaI_ATSocket_State_Strings, AdrasteaI_ATSocket_State_NumberOfValues, 30, ATCOMMAND_STRING_TERMINATE))
+    dataP->acceptedSocketID = AdrasteaI_ATSocket_ID_Invalid;
+    if ((arguments.count == 2) && !ATCommand_GetArgumentInt(&arguments, 1, &dataP->acceptedSocketID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
     {
         return false;
     }
 
     return true;
 }
+
+/**
+ * @brief Parses the value of Socket Read event arguments.
+ *
+ * @param[in]  pEventArguments String containing arguments of the AT command
+ * @param[out] dataP Socket Read Result si returned in this argument. See AdrasteaI_ATSocket_Read_Result_t.
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_ATSocket_ParseSocketsReadEvent(char* pEventArguments, AdrasteaI_ATSocket_Read_Result_t* dataP)
+{
+    if (dataP == NULL || pEventArguments == NULL)
+    {
+        return false;
+    }
+
+    ATCommand_Arguments_t arguments;
+
+    if (!ATCommand_TokenizeArguments(pEventArguments, &arguments) || (arguments.count != 2))
+    {
+        return false;
+    }
+
+    return ATCommand_GetFields(&arguments, 0, AdrasteaI_ATSocket_Read_Result_Fields, (uint8_t)(sizeof(AdrasteaI_ATSocket_Read_Result_Fields) / sizeof(AdrasteaI_ATSocket_Read_Result_Fields[0])), dataP);
+}
@@ -37,6 +37,23 @@
 
 #include "ATCommon.h"
 
+/**
+ * @brief Max. number of characters of an AT%SOCKETDATA command for a segment of binary data besides the hex encoded
+ * data: AT%SOCKETDATA="SEND", (21), socket ID (3), delimiter (1), length (5), delimiter and opening quotation mark (2),
+ * closing quotation mark and line end (3) and the terminating null (1). Has to match the command written by
+ * AdrasteaI_ATSocket_EncodeSegmentHeader() and ADRASTEAI_ATSOCKET_SEGMENT_END (ATSocket.c).
+ */
+#define ADRASTEAI_ATSOCKET_SEGMENT_OVERHEAD (21 + 3 + 1 + 5 + 2 + 3 + 1)
+
+/**
+ * @brief Max. payload of a hex encoded AT%SOCKETDATA command. Besides ADRASTEAI_MAX_PAYLOAD_SIZE, the payload is
+ * limited by the echo of the command (header and two characters per byte) having to fit into ADRASTEAI_LINE_MAX_SIZE.
+ * Larger data is sent in several commands, i.e. as several UDP datagrams.
+ *
+ * Requires AdrasteaI.h to be included where used.
+ */
+#define ADRASTEAI_ATSOCKET_HEX_SEGMENT_SIZE ((((ADRASTEAI_LINE_MAX_SIZE - ADRASTEAI_ATSOCKET_SEGMENT_OVERHEAD) / 2) < ADRASTEAI_MAX_PAYLOAD_SIZE) ? ((ADRASTEAI_LINE_MAX_SIZE - ADRASTEAI_ATSOCKET_SEGMENT_OVERHEAD) / 2) : ADRASTEAI_MAX_PAYLOAD_SIZE)
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -117,10 +134,8 @@ extern "C"
     {
         AdrasteaI_ATSocket_State_t socketState;
         AdrasteaI_ATSocket_Type_t socketType;
-        AdrasteaI_ATCommon_IP_Addr_t sourceIPAddress;
-        AdrasteaI_ATCommon_IP_Addr_t destinationIPAddress;
-        AdrasteaI_ATCommon_Port_Number_t sourcePortNumber;
-        AdrasteaI_ATCommon_Port_Number_t destinationPortNumber;
+        AdrasteaI_ATCommon_IP_Endpoint_t source;      /**< Local address and port, see AdrasteaI_ATCommon_FormatIPEndpoint() */
+        AdrasteaI_ATCommon_IP_Endpoint_t destination; /**< Remote address and port */
         AdrasteaI_ATSocket_Direction_t tcpSocketDirection;
         AdrasteaI_ATSocket_Timeout_t socketTimeout;
     } AdrasteaI_ATSocket_Info_t;
@@ -150,8 +165,7 @@ extern "C"
         AdrasteaI_ATSocket_Data_Length_t dataLength;
         char* data;
         AdrasteaI_ATSocket_Data_Length_t dataLeftLength;
-        AdrasteaI_ATCommon_IP_Addr_t sourceIPAddress;
-        AdrasteaI_ATCommon_Port_Number_t sourcePortNumber;
+        AdrasteaI_ATCommon_IP_Endpoint_t source; /**< Sender (address family AdrasteaI_ATCommon_IP_Family_Invalid if not reported) */
     } AdrasteaI_ATSocket_Data_Read_t;
 
     /**
@@ -172,6 +186,34 @@ extern "C"
         AdrasteaI_ATCommon_SSL_Profile_ID_t profileID;
     } AdrasteaI_ATSocket_SSL_Info_t;
 
+    /**
+ * @brief Streaming send (see AdrasteaI_ATSocket_SendStream())
+ */
+    typedef struct AdrasteaI_ATSocket_Send_Stream_t
+    {
+        AdrasteaI_ATSocket_ID_t socketID; /**< Socket to send to */
+        const uint8_t* data;              /**< Data to send */
+        uint32_t dataLength;              /**< Number of bytes to send */
+        char* segmentBuffer;              /**< Buffer for preparing the next command while the current one is pending (at least AT_MAX_COMMAND_BUFFER_SIZE characters recommended), NULL to encode each segment while it is transmitted */
+        uint16_t segmentBufferSize;       /**< Size of segmentBuffer */
+        volatile bool cancel;             /**< Set to true (e.g. from another task) to stop sending after the pending segment */
+        uint32_t bytesAcknowledged;       /**< Output: Number of bytes acknowledged by the module */
+        uint32_t uartBytes;               /**< Output: Number of characters sent to the module via UART */
+        uint16_t segments;                /**< Output: Number of acknowledged segments */
+        uint32_t durationUsec;            /**< Output: Time taken for sending in microseconds */
+        uint32_t goodput;                 /**< Output: Achieved rate in payload bytes per second */
+        uint32_t goodputLimit;            /**< Output: Payload bytes per second the UART could transfer at most using the same encoding */
+    } AdrasteaI_ATSocket_Send_Stream_t;
+
+    /**
+ * @brief New Socket Accepted event
+ */
+    typedef struct AdrasteaI_ATSocket_Accepted_t
+    {
+        AdrasteaI_ATSocket_ID_t listenSocketID;   /**< Listening socket */
+        AdrasteaI_ATSocket_ID_t acceptedSocketID; /**< Socket of the accepted connection (AdrasteaI_ATSocket_ID_Invalid if not reported) */
+    } AdrasteaI_ATSocket_Accepted_t;
+
     typedef uint16_t AdrasteaI_ATSocket_Aggregation_Time_t;
 
     typedef uint16_t AdrasteaI_ATSocket_Aggregation_Buffer_Size_t;
@@ -205,8 +247,14 @@ extern "C"
 
     extern bool AdrasteaI_ATSocket_ReceiveFromSocket(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_ATSocket_Data_Read_t* dataReadP, uint16_t maxBufferLength);
 
+    extern bool AdrasteaI_ATSocket_ReceiveBinaryFromSocket(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_ATSocket_Data_Read_t* dataReadP, uint16_t maxLength);
+
     extern bool AdrasteaI_ATSocket_SendToSocket(AdrasteaI_ATSocket_ID_t socketID, char* data, AdrasteaI_ATSocket_Data_Length_t dataLength);
 
+    extern bool AdrasteaI_ATSocket_SendBinaryToSocket(AdrasteaI_ATSocket_ID_t socketID, const uint8_t* data, uint32_t dataLength);
+
+    extern bool AdrasteaI_ATSocket_SendStream(AdrasteaI_ATSocket_Send_Stream_t* streamP);
+
     extern bool AdrasteaI_ATSocket_SetSocketUnsolicitedNotificationEvents(AdrasteaI_ATSocket_Event_t event, AdrasteaI_ATCommon_Event_State_t state);
 
     extern bool AdrasteaI_ATSocket_ParseDataReceivedEvent(char* pEventArguments, AdrasteaI_ATSocket_ID_t* dataP);
@@ -215,6 +263,8 @@ extern "C"
 
     extern bool AdrasteaI_ATSocket_ParseSocketsReadEvent(char* pEventArguments, AdrasteaI_ATSocket_Read_Result_t* dataP);
 
+    extern bool AdrasteaI_ATSocket_ParseNewSocketAcceptedEvent(char* pEventArguments, AdrasteaI_ATSocket_Accepted_t* dataP);
+
 #ifdef __cplusplus
 }
 #endif
@@ -103,7 +103,11 @@ void ATGNSSExample()
 
         if (ret && fix.fixType != AdrasteaI_ATGNSS_Fix_Type_No_Fix)
         {
+#ifdef ADRASTEAI_FIXED_POINT
+            WE_DEBUG_PRINT("Fix Latitude: %ld udeg, Longitude: %ld udeg, Altitude: %ld mm\r\n", (long)fix.latitude, (long)fix.longitude, (long)fix.altitude);
+#else
             WE_DEBUG_PRINT("Fix Latitude: %f, Longitude: %f, Altitude: %f\r\n", fix.latitude, fix.longitude, fix.altitude);
+#endif
         }
     }
 }
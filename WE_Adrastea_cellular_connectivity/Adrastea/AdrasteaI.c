@@ -34,13 +34,24 @@
 #include "ATDevice.h"
 #include "ATEvent.h"
 #include "AdrasteaI.h"
+#include "AdrasteaI_MQTTPublisher.h"
+#include "AdrasteaI_MQTTQueue.h"
+#include "AdrasteaI_MQTTStream.h"
+#include "AdrasteaI_MQTTSupervisor.h"
+#include "AdrasteaI_Metrics.h"
+#include "AdrasteaI_Poll.h"
+#include "AdrasteaI_Socket.h"
 #include "ATCommands.h"
 #include "cyhal_gpio.h"
 #include "global.h"
+#include "log.h"
+#include "trace.h"
 
 
 static void AdrasteaI_HandleRxByte(uint8_t* dataP, size_t size);
 static void AdrasteaI_HandleRxLine(char* rxPacket, uint16_t rxLength);
+static void AdrasteaI_HandleURC(char* rxPacket);
+static bool AdrasteaI_WaitForConfirmInternal(uint32_t maxTimeMs, AdrasteaI_Timeout_t timeoutType, AdrasteaI_CNFStatus_t expectedStatus, char* pOutResponse);
 static WE_UART_HandleRxByte_t byteRxCallback = AdrasteaI_HandleRxByte;
 
 /**
@@ -132,6 +143,17 @@ static bool AdrasteaI_twoEolCharacters = true;
  */
 static bool AdrasteaI_responseincoming = false;
 
+/**
+ * @brief Length of the raw payload transmitted after the pending request (see AdrasteaI_SendRequestWithPayload()).
+ * The echo of the payload starts after the echo of the request line.
+ */
+static uint32_t AdrasteaI_payloadEchoLength = 0;
+
+/**
+ * @brief Number of echoed payload bytes still to be discarded by the RX line framer.
+ */
+static uint32_t AdrasteaI_payloadEchoRemaining = 0;
+
 static bool AdrasteaI_MCUEventBegan = false;
 
 /**
@@ -208,6 +230,48 @@ static AdrasteaI_Pins_t* AdrasteaI_pinsP = NULL;
  */
 static WE_UART_t* AdrasteaI_uartP = NULL;
 
+#ifdef ADRASTEAI_METRICS
+/**
+ * @brief Time (milliseconds) at which the pending request has been sent.
+ */
+static uint32_t AdrasteaI_requestSentTime = 0;
+#endif
+
+/**
+ * @brief Lock serializing commands issued by different tasks.
+ *
+ * The lock is recursive, so a task owning it may issue further commands (or group several
+ * commands using AdrasteaI_Lock()/AdrasteaI_Unlock()) without blocking itself.
+ */
+static WE_OS_Mutex_t AdrasteaI_lock;
+
+/**
+ * @brief Is set to true once AdrasteaI_lock has been created.
+ */
+static bool AdrasteaI_lockInitialized = false;
+
+/**
+ * @brief Nesting depth of the lock owned by the current owner (only modified by the owner).
+ */
+static uint32_t AdrasteaI_lockDepth = 0;
+
+/**
+ * @brief Time (milliseconds) at which the current owner took the lock.
+ */
+static uint32_t AdrasteaI_lockTakenTime = 0;
+
+/**
+ * @brief Maximum time (milliseconds) a command waits for the lock.
+ * @see AdrasteaI_SetLockTimeout
+ */
+static uint32_t AdrasteaI_lockTimeoutMs = WE_OS_WAIT_FOREVER;
+
+/**
+ * @brief Lock statistics.
+ * @see AdrasteaI_GetLockStatistics
+ */
+static AdrasteaI_Lock_Statistics_t AdrasteaI_lockStatistics = {0};
+
 /**
  * @brief Initializes the serial communication with the module
  *
@@ -220,6 +284,21 @@ static WE_UART_t* AdrasteaI_uartP = NULL;
 bool AdrasteaI_Init(WE_UART_t* uartP, AdrasteaI_Pins_t* pinoutP, AdrasteaI_EventCallback_t eventCallback)
 {
     AdrasteaI_requestPending = false;
+    AdrasteaI_payloadEchoLength = 0;
+    AdrasteaI_payloadEchoRemaining = 0;
+
+#ifdef WE_TRACE
+    WE_Trace_Init();
+#endif
+
+    if (!AdrasteaI_lockInitialized)
+    {
+        if (!WE_OS_MutexInit(&AdrasteaI_lock))
+        {
+            return false;
+        }
+        AdrasteaI_lockInitialized = true;
+    }
 
     /* Callbacks */
     AdrasteaI_eventCallback = eventCallback;
@@ -314,6 +393,7 @@ bool AdrasteaI_Deinit(void)
     AdrasteaI_rxByteCounter = 0;
     AdrasteaI_eolChar1Found = 0;
     AdrasteaI_requestPending = false;
+    AdrasteaI_payloadEchoRemaining = 0;
     AdrasteaI_currentResponseLength = 0;
 
     if (!WE_DeinitPin(AdrasteaI_pinsP->AdrasteaI_Pin_WakeUp) || !WE_DeinitPin(AdrasteaI_pinsP->AdrasteaI_Pin_Reset))
@@ -346,32 +426,37 @@ bool AdrasteaI_PinReset(void)
  */
 bool AdrasteaI_PinWakeUp(void)
 {
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
     AdrasteaI_wakingUp = true;
     if (!WE_SetPin(AdrasteaI_pinsP->AdrasteaI_Pin_WakeUp, WE_Pin_Level_High))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     WE_Delay(100);
 
     if (!WE_SetPin(AdrasteaI_pinsP->AdrasteaI_Pin_WakeUp, WE_Pin_Level_Low))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     if (!AdrasteaI_SendRequest("sleepSet disable\r\n"))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
-    if (!AdrasteaI_WaitForConfirm(AdrasteaI_GetTimeout(AdrasteaI_Timeout_Power), AdrasteaI_CNFStatus_Success, NULL))
+    if (!AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_Power, AdrasteaI_CNFStatus_Success, NULL))
     {
-        return false;
+        return AdrasteaI_EndCommand(false);
     }
 
     AdrasteaI_Transparent_Transmit("map\r\n", 5);
     AdrasteaI_wakingUp = false;
-    return true;
+    return AdrasteaI_EndCommand(true);
 }
 
 /**
@@ -381,7 +466,21 @@ bool AdrasteaI_PinWakeUp(void)
  *
  * @return true if successful, false otherwise
  */
-bool AdrasteaI_SendRequest(char* data)
+bool AdrasteaI_SendRequest(char* data) { return AdrasteaI_SendRequestWithPayload(data, 0); }
+
+/**
+ * @brief Sends the supplied AT command to the module, announcing a raw payload that is transmitted after it
+ *
+ * The module echoes the payload after the request line. As the payload may contain line breaks or result
+ * codes and may exceed ADRASTEAI_LINE_MAX_SIZE, the RX line framer discards payloadLength bytes following
+ * the echo of the request instead of interpreting them as lines.
+ *
+ * @param[in] data AT command to send. Note that the command has to end with "\r\n\0".
+ * @param[in] payloadLength Number of payload bytes the caller transmits after the command (0 for none)
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_SendRequestWithPayload(char* data, uint32_t payloadLength)
 {
     if (AdrasteaI_executingEventCallback)
     {
@@ -390,8 +489,12 @@ bool AdrasteaI_SendRequest(char* data)
         return false;
     }
 
+    /* Set before transmitting, the echo of the request may be received before AdrasteaI_Transparent_Transmit() returns */
+    AdrasteaI_payloadEchoLength = payloadLength;
+    AdrasteaI_payloadEchoRemaining = 0;
     AdrasteaI_requestPending = true;
     AdrasteaI_currentResponseLength = 0;
+    AdrasteaI_cmdConfirmStatus = AdrasteaI_CNFStatus_Invalid;
 
     /* Make sure that the time between the last confirmation received from the module
 	 * and the next command sent to the module is not shorter than AdrasteaI_minCommandIntervalUsec */
@@ -425,10 +528,16 @@ bool AdrasteaI_SendRequest(char* data)
         }
     }
 
-#ifdef WE_DEBUG
+#if defined(WE_DEBUG) && !defined(WE_TRACE)
+    /* With WE_TRACE, the request is recorded by AdrasteaI_Transparent_Transmit() without formatting */
     WE_DEBUG_PRINT("> %s", data);
 #endif
 
+#ifdef ADRASTEAI_METRICS
+    AdrasteaI_Metrics_RequestSent(AdrasteaI_pendingCommandName, dataLength);
+    AdrasteaI_requestSentTime = WE_GetTick();
+#endif
+
     AdrasteaI_Transparent_Transmit(data, dataLength);
 
     return true;
@@ -449,9 +558,54 @@ bool AdrasteaI_Transparent_Transmit(const char* data, uint16_t dataLength)
     {
         return false;
     }
+#ifdef WE_TRACE
+    WE_Trace_Record(WE_Trace_Record_Type_TX, (const uint8_t*)data, dataLength);
+#endif
     return AdrasteaI_uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
+/**
+ * @brief Sends binary data hex encoded (two upper case hex digits per byte) to Adrastea via UART.
+ *
+ * The data is encoded block-wise while it is transmitted, so no buffer for the encoded data is needed.
+ * Used for sending the payload of AT commands after the command header has been sent using AdrasteaI_SendRequest().
+ *
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] dataLength Number of bytes to be sent
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Transparent_TransmitHex(const uint8_t* data, uint16_t dataLength)
+{
+    /* The UART transmits asynchronously and waits for the previous transfer before starting the next one,
+     * so a block may be refilled as soon as the transfer of the other block has been started. */
+    static char blocks[2][128];
+    static uint8_t nextBlock = 0;
+
+    if (data == NULL)
+    {
+        return false;
+    }
+
+    while (dataLength > 0)
+    {
+        char* block = blocks[nextBlock];
+        uint16_t length = (dataLength > sizeof(blocks[0]) / 2) ? sizeof(blocks[0]) / 2 : dataLength;
+        ATCommand_EncodeHex(data, length, block);
+
+        if (!AdrasteaI_Transparent_Transmit(block, 2 * length))
+        {
+            return false;
+        }
+
+        nextBlock ^= 1;
+        data += length;
+        dataLength -= length;
+    }
+
+    return true;
+}
+
 /**
  * @brief Waits for the response from the module after a request.
  *
@@ -461,9 +615,42 @@ bool AdrasteaI_Transparent_Transmit(const char* data, uint16_t dataLength)
  *
  * @return true if successful, false otherwise
  */
-bool AdrasteaI_WaitForConfirm(uint32_t maxTimeMs, AdrasteaI_CNFStatus_t expectedStatus, char* pOutResponse)
+bool AdrasteaI_WaitForConfirm(uint32_t maxTimeMs, AdrasteaI_CNFStatus_t expectedStatus, char* pOutResponse) { return AdrasteaI_WaitForConfirmInternal(maxTimeMs, AdrasteaI_Timeout_NumberOfValues, expectedStatus, pOutResponse); }
+
+/**
+ * @brief Waits for the response from the module after a request, using the timeout of a command type.
+ *
+ * Same as AdrasteaI_WaitForConfirm(), but the request is also recorded under its type by the metrics.
+ *
+ * @param[in] timeoutType Timeout (i.e. command) type, selects the maximum wait time set using AdrasteaI_SetTimeout()
+ * @param[in] expectedStatus Status to wait for
+ * @param[out] pOutResponse Received response text (if any) will be written to this buffer (optional)
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_t timeoutType, AdrasteaI_CNFStatus_t expectedStatus, char* pOutResponse)
 {
-    AdrasteaI_cmdConfirmStatus = AdrasteaI_CNFStatus_Invalid;
+    return AdrasteaI_WaitForConfirmInternal(AdrasteaI_GetTimeout(timeoutType), timeoutType, expectedStatus, pOutResponse);
+}
+
+/**
+ * @brief Waits for the response from the module after a request.
+ *
+ * @param[in] maxTimeMs Maximum wait time in milliseconds
+ * @param[in] timeoutType Timeout (i.e. command) type recorded by the metrics (AdrasteaI_Timeout_NumberOfValues if unknown)
+ * @param[in] expectedStatus Status to wait for
+ * @param[out] pOutResponse Received response text (if any) will be written to this buffer (optional)
+ *
+ * @return true if successful, false otherwise
+ */
+static bool AdrasteaI_WaitForConfirmInternal(uint32_t maxTimeMs, AdrasteaI_Timeout_t timeoutType, AdrasteaI_CNFStatus_t expectedStatus, char* pOutResponse)
+{
+    if (!AdrasteaI_requestPending)
+    {
+        /* With a pending request, the status has been reset by AdrasteaI_SendRequest(). Resetting it
+         * here would discard a confirmation received before this function has been called. */
+        AdrasteaI_cmdConfirmStatus = AdrasteaI_CNFStatus_Invalid;
+    }
 
     uint32_t t0 = WE_GetTick();
 
@@ -475,6 +662,11 @@ bool AdrasteaI_WaitForConfirm(uint32_t maxTimeMs, AdrasteaI_CNFStatus_t expected
             AdrasteaI_lastConfirmTimeUsec = WE_GetTickMicroseconds();
             AdrasteaI_requestPending = false;
             AdrasteaI_responseincoming = false;
+            AdrasteaI_payloadEchoLength = 0;
+            AdrasteaI_payloadEchoRemaining = 0;
+#ifdef ADRASTEAI_METRICS
+            AdrasteaI_Metrics_RequestCompleted(timeoutType, (AdrasteaI_cmdConfirmStatus == AdrasteaI_CNFStatus_Failed) ? AdrasteaI_Metrics_Result_Error : AdrasteaI_Metrics_Result_Success, WE_GetTick() - AdrasteaI_requestSentTime);
+#endif
             if (AdrasteaI_cmdConfirmStatus == expectedStatus)
             {
                 if (NULL != pOutResponse)
@@ -503,11 +695,82 @@ bool AdrasteaI_WaitForConfirm(uint32_t maxTimeMs, AdrasteaI_CNFStatus_t expected
         }
     }
 
+#ifdef ADRASTEAI_METRICS
+    AdrasteaI_Metrics_RequestCompleted(timeoutType, AdrasteaI_Metrics_Result_Timeout, WE_GetTick() - AdrasteaI_requestSentTime);
+#endif
+
     AdrasteaI_responseincoming = false;
     AdrasteaI_requestPending = false;
+    AdrasteaI_payloadEchoLength = 0;
+    AdrasteaI_payloadEchoRemaining = 0;
     return false;
 }
 
+/**
+ * @brief Executes an AT command described by a command descriptor.
+ *
+ * Builds the request from the descriptor and the request struct, sends it, waits for the confirmation
+ * and decodes the response into the response struct.
+ *
+ * @param[in] commandP Command descriptor
+ * @param[in] pRequest Struct holding the request arguments (may be NULL if the command has no request fields)
+ * @param[out] pResponse Struct receiving the response arguments (may be NULL if the command has no response fields)
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_ExecuteCommand(const AdrasteaI_Command_t* commandP, const void* pRequest, void* pResponse)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    if ((commandP == NULL) || ((commandP->numRequestFields != 0) && (pRequest == NULL)) || ((commandP->numResponseFields != 0) && (pResponse == NULL)))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    char* pRequestCommand = AT_commandBuffer;
+
+    strcpy(pRequestCommand, commandP->request);
+
+    if ((commandP->numRequestFields != 0) && !ATCommand_AppendFields(pRequestCommand, commandP->requestFields, commandP->numRequestFields, pRequest, ATCOMMAND_STRING_TERMINATE))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if (!AdrasteaI_SendRequest(pRequestCommand))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if (commandP->numResponseFields == 0)
+    {
+        return AdrasteaI_EndCommand(AdrasteaI_WaitForConfirmByType(commandP->timeout, AdrasteaI_CNFStatus_Success, NULL));
+    }
+
+    char* pResponseCommand = AT_commandBuffer;
+
+    if (!AdrasteaI_WaitForConfirmByType(commandP->timeout, AdrasteaI_CNFStatus_Success, pResponseCommand))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    ATCommand_Arguments_t arguments;
+
+    if (!ATCommand_TokenizeArguments(pResponseCommand, &arguments) || (arguments.count != commandP->numResponseFields))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    return AdrasteaI_EndCommand(ATCommand_GetFields(&arguments, 0, commandP->responseFields, commandP->numResponseFields, pResponse));
+}
+
 /**
  * @brief Check if the response of the command is expected to be more the one line and fill AdrasteaI_responseSkip accordingly.
  */
@@ -537,6 +800,13 @@ void AdrasteaI_CheckResponseComplete()
         break;
         case AdrasteaI_ATEvent_MQTT_Publication_Received:
         {
+#ifdef ADRASTEAI_MQTT_STREAM
+            if (AdrasteaI_MQTTStream_IsEnabled())
+            {
+                /* Only the header is received as a line, the payload is streamed */
+                break;
+            }
+#endif
             AdrasteaI_responseSkip.lineskip = 1;
             AdrasteaI_responseSkip.delim = ',';
         }
@@ -592,6 +862,160 @@ void AdrasteaI_SetTimeout(AdrasteaI_Timeout_t type, uint32_t timeout) { Adrastea
  */
 uint32_t AdrasteaI_GetTimeout(AdrasteaI_Timeout_t type) { return AdrasteaI_timeouts[type]; }
 
+/**
+ * @brief Takes the command lock for the calling task.
+ *
+ * Other tasks issuing commands are blocked until the lock is released using AdrasteaI_Unlock(). The lock may be
+ * taken several times by the same task (e.g. to execute a sequence of commands without interruption),
+ * each call has to be matched by a call of AdrasteaI_Unlock().
+ *
+ * @param[in] timeoutMs Maximum time to wait for the lock in milliseconds (WE_OS_NO_WAIT, WE_OS_WAIT_FOREVER)
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Lock(uint32_t timeoutMs)
+{
+    if (!AdrasteaI_lockInitialized)
+    {
+        return false;
+    }
+
+    uint32_t t0 = WE_GetTick();
+    bool contended = false;
+
+    if (!WE_OS_MutexLock(&AdrasteaI_lock, WE_OS_NO_WAIT))
+    {
+        contended = true;
+        if ((timeoutMs == WE_OS_NO_WAIT) || !WE_OS_MutexLock(&AdrasteaI_lock, timeoutMs))
+        {
+            /* Not protected by the lock, the counter is informational only */
+            AdrasteaI_lockStatistics.timeouts++;
+            return false;
+        }
+    }
+
+    if (AdrasteaI_lockDepth++ == 0)
+    {
+        AdrasteaI_lockTakenTime = WE_GetTick();
+        AdrasteaI_lockStatistics.acquisitions++;
+        if (contended)
+        {
+            uint32_t waitTime = AdrasteaI_lockTakenTime - t0;
+            AdrasteaI_lockStatistics.contentions++;
+            if (waitTime > AdrasteaI_lockStatistics.maxWaitTimeMs)
+            {
+                AdrasteaI_lockStatistics.maxWaitTimeMs = waitTime;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Releases the command lock taken using AdrasteaI_Lock().
+ */
+void AdrasteaI_Unlock(void)
+{
+    if (!AdrasteaI_lockInitialized || (AdrasteaI_lockDepth == 0))
+    {
+        return;
+    }
+
+    if (--AdrasteaI_lockDepth == 0)
+    {
+        uint32_t holdTime = WE_GetTick() - AdrasteaI_lockTakenTime;
+        AdrasteaI_lockStatistics.totalHoldTimeMs += holdTime;
+        if (holdTime > AdrasteaI_lockStatistics.maxHoldTimeMs)
+        {
+            AdrasteaI_lockStatistics.maxHoldTimeMs = holdTime;
+        }
+    }
+
+    WE_OS_MutexUnlock(&AdrasteaI_lock);
+}
+
+/**
+ * @brief Takes the command lock for sending commands, unless called from the event callback.
+ *
+ * @param[in] timeoutMs Maximum time to wait for the lock in milliseconds (WE_OS_NO_WAIT, WE_OS_WAIT_FOREVER)
+ *
+ * @return true if successful, false otherwise
+ */
+static bool AdrasteaI_BeginCommandWithTimeout(uint32_t timeoutMs)
+{
+    if (AdrasteaI_executingEventCallback)
+    {
+        /* Commands may not be sent from event handlers. Waiting for the lock here would block
+		 * reception of the response the lock owner is waiting for. */
+        return false;
+    }
+
+    return AdrasteaI_Lock(timeoutMs);
+}
+
+/**
+ * @brief Is called by the AT command functions before accessing the command buffer or sending a request.
+ *
+ * Takes the command lock using the timeout set by AdrasteaI_SetLockTimeout(). Must be matched by
+ * a call of AdrasteaI_EndCommand() on every return path.
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_BeginCommand(void) { return AdrasteaI_BeginCommandWithTimeout(AdrasteaI_lockTimeoutMs); }
+
+/**
+ * @brief Same as AdrasteaI_BeginCommand(), but fails instead of waiting if another task holds the command lock.
+ *
+ * Must be matched by a call of AdrasteaI_EndCommand() if successful.
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_TryBeginCommand(void) { return AdrasteaI_BeginCommandWithTimeout(WE_OS_NO_WAIT); }
+
+/**
+ * @brief Is called by the AT command functions on return, releases the lock taken by AdrasteaI_BeginCommand().
+ *
+ * @param[in] result Result of the command
+ *
+ * @return result
+ */
+bool AdrasteaI_EndCommand(bool result)
+{
+    AdrasteaI_Unlock();
+    return result;
+}
+
+/**
+ * @brief Sets the maximum time a command waits for the command lock held by another task.
+ *
+ * @param[in] timeoutMs Timeout in milliseconds (default: WE_OS_WAIT_FOREVER)
+ */
+void AdrasteaI_SetLockTimeout(uint32_t timeoutMs) { AdrasteaI_lockTimeoutMs = timeoutMs; }
+
+/**
+ * @brief Returns the statistics of the command lock (contention and hold times).
+ *
+ * The statistics are updated by the lock owner and copied without locking, so a snapshot taken
+ * while another task is issuing commands may be slightly inconsistent.
+ *
+ * @param[out] statisticsP Statistics are returned in this argument
+ */
+void AdrasteaI_GetLockStatistics(AdrasteaI_Lock_Statistics_t* statisticsP)
+{
+    if (statisticsP == NULL)
+    {
+        return;
+    }
+
+    *statisticsP = AdrasteaI_lockStatistics;
+}
+
+/**
+ * @brief Resets the statistics of the command lock.
+ */
+void AdrasteaI_ResetLockStatistics(void) { memset(&AdrasteaI_lockStatistics, 0, sizeof(AdrasteaI_lockStatistics)); }
+
 /**
  * @brief Default byte received callback.
  *
@@ -602,9 +1026,30 @@ uint32_t AdrasteaI_GetTimeout(AdrasteaI_Timeout_t type) { return AdrasteaI_timeo
 static void AdrasteaI_HandleRxByte(uint8_t* dataP, size_t size)
 {
     uint8_t receivedByte;
+
+#ifdef ADRASTEAI_METRICS
+    AdrasteaI_Metrics_BytesReceived(size);
+#endif
+
+#ifdef WE_TRACE
+    WE_Trace_RecordRx(dataP, (uint16_t)size);
+#endif
+
     for (; size > 0; size--, dataP++)
     {
         receivedByte = *dataP;
+        if (AdrasteaI_payloadEchoRemaining > 0)
+        {
+            /* Echo of a raw payload (see AdrasteaI_SendRequestWithPayload()) */
+            AdrasteaI_payloadEchoRemaining--;
+            continue;
+        }
+#ifdef ADRASTEAI_MQTT_STREAM
+        if (AdrasteaI_MQTTStream_HandleRxByte(receivedByte))
+        {
+            continue;
+        }
+#endif
         if((receivedByte == AdrasteaI_EndChar) && ((*dataP) == AdrasteaI_EndChar))
         {
 			AdrasteaI_rxBuffer[AdrasteaI_rxByteCounter++] =AdrasteaI_EndChar;
@@ -624,6 +1069,10 @@ static void AdrasteaI_HandleRxByte(uint8_t* dataP, size_t size)
 
         if (AdrasteaI_rxByteCounter >= ADRASTEAI_LINE_MAX_SIZE)
         {
+#ifdef ADRASTEAI_METRICS
+            AdrasteaI_Metrics_RxOverrun();
+#endif
+            WE_LOG_WARNING(AdrasteaI, "RX line exceeds %u bytes, discarded", ADRASTEAI_LINE_MAX_SIZE);
             AdrasteaI_rxByteCounter = 0;
             AdrasteaI_eolChar1Found = false;
             return;
@@ -697,10 +1146,12 @@ static void AdrasteaI_HandleRxByte(uint8_t* dataP, size_t size)
  */
 static void AdrasteaI_HandleRxLine(char* rxPacket, uint16_t rxLength)
 {
-#ifdef WE_DEBUG
+#if defined(WE_DEBUG) && !defined(WE_TRACE)
     WE_DEBUG_PRINT("< %s\r\n", rxPacket);
 #endif
 
+    WE_LOG_DEBUG(AdrasteaI, "RX line, %u bytes, request pending %u", rxLength, AdrasteaI_requestPending);
+
     if (AdrasteaI_requestPending)
     {
         if (0 == strncmp(&rxPacket[0], ADRASTEAI_RESPONSE_OK, strlen(ADRASTEAI_RESPONSE_OK)))
@@ -744,6 +1195,10 @@ static void AdrasteaI_HandleRxLine(char* rxPacket, uint16_t rxLength)
 
                 if (AdrasteaI_currentResponseLength + chunkLength >= ADRASTEAI_MAX_RESPONSE_TEXT_LENGTH)
                 {
+#ifdef ADRASTEAI_METRICS
+                    AdrasteaI_Metrics_ResponseTruncated();
+#endif
+                    WE_LOG_WARNING(AdrasteaI, "Response truncated to %u bytes", ADRASTEAI_MAX_RESPONSE_TEXT_LENGTH);
                     chunkLength = ADRASTEAI_MAX_RESPONSE_TEXT_LENGTH - AdrasteaI_currentResponseLength;
                 }
 
@@ -769,6 +1224,8 @@ static void AdrasteaI_HandleRxLine(char* rxPacket, uint16_t rxLength)
             {
                 //if true command echo detected store response for lines after
                 AdrasteaI_responseincoming = true;
+                AdrasteaI_payloadEchoRemaining = AdrasteaI_payloadEchoLength;
+                AdrasteaI_payloadEchoLength = 0;
             }
         }
     }
@@ -801,6 +1258,8 @@ static void AdrasteaI_HandleRxLine(char* rxPacket, uint16_t rxLength)
     }
     else if (('+' == rxPacket[0]) || ('%' == rxPacket[0]))
     {
+        AdrasteaI_HandleURC(rxPacket);
+
         if (NULL != AdrasteaI_eventCallback)
         {
             /* Execute callback (if specified). */
@@ -811,6 +1270,72 @@ static void AdrasteaI_HandleRxLine(char* rxPacket, uint16_t rxLength)
     }
 }
 
+/**
+ * @brief Passes a URC to the URC handlers of the optional modules.
+ *
+ * The event type is parsed once here. The handlers parse the arguments of the events they are
+ * interested in without modifying the line, which is passed on to the event callback afterwards.
+ *
+ * @param[in] rxPacket Received line starting with '+' or '%'
+ */
+static void AdrasteaI_HandleURC(char* rxPacket)
+{
+#if defined(ADRASTEAI_METRICS) || defined(ADRASTEAI_SOCKET) || defined(ADRASTEAI_POLL) || defined(ADRASTEAI_MQTT_PUBLISHER) || defined(ADRASTEAI_MQTT_QUEUE) || defined(ADRASTEAI_MQTT_STREAM) || defined(ADRASTEAI_MQTT_SUPERVISOR)
+    char* pArguments = rxPacket;
+    AdrasteaI_ATEvent_t event;
+    if (!AdrasteaI_ATEvent_ParseEventType(&pArguments, &event))
+    {
+        event = AdrasteaI_ATEvent_Invalid;
+    }
+
+#ifdef ADRASTEAI_METRICS
+    AdrasteaI_Metrics_URCReceived(event);
+#endif
+
+    if (event == AdrasteaI_ATEvent_Invalid)
+    {
+        return;
+    }
+
+#ifdef ADRASTEAI_SOCKET
+    AdrasteaI_Socket_HandleURC(event, pArguments);
+#endif
+#ifdef ADRASTEAI_POLL
+    AdrasteaI_Poll_HandleURC(event, pArguments);
+#endif
+#ifdef ADRASTEAI_MQTT_PUBLISHER
+    AdrasteaI_MQTTPublisher_HandleURC(event, pArguments);
+#endif
+#ifdef ADRASTEAI_MQTT_QUEUE
+    AdrasteaI_MQTTQueue_HandleURC(event, pArguments);
+#endif
+#ifdef ADRASTEAI_MQTT_STREAM
+    AdrasteaI_MQTTStream_HandleURC(event, pArguments);
+#endif
+#ifdef ADRASTEAI_MQTT_SUPERVISOR
+    AdrasteaI_MQTTSupervisor_HandleURC(event, pArguments);
+#endif
+#else
+    UNUSED(rxPacket);
+#endif
+}
+
+/**
+ * @brief Returns the number of characters the UART to Adrastea can transfer per second.
+ *
+ * @return Characters per second (0 if the driver has not been initialized)
+ */
+uint32_t AdrasteaI_GetUartCharactersPerSecond(void)
+{
+    if (AdrasteaI_uartP == NULL)
+    {
+        return 0;
+    }
+
+    /* Start bit, 8 data bits, optional parity bit, stop bit */
+    return AdrasteaI_uartP->baudrate / ((AdrasteaI_uartP->parity == WE_Parity_None) ? 10 : 11);
+}
+
 /**
  * @brief Sets EOL character(s) used for interpreting responses from Adrastea.
  *
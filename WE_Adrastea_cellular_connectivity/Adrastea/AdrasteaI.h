@@ -35,7 +35,9 @@
 #include <stdint.h>
 
 
+#include "ATCommands.h"
 #include "global.h"
+#include "os.h"
 
 
 /**
@@ -130,6 +132,50 @@ extern "C"
         char delim;
     } AdrasteaI_Response_Complete_t;
 
+    /**
+ * @brief Descriptor of an AT command with fixed argument layout.
+ *
+ * Executed by AdrasteaI_ExecuteCommand(). The request is built from the request string followed by
+ * the request fields, the response (if any) is decoded into the response fields.
+ */
+    typedef struct AdrasteaI_Command_t
+    {
+        const char* request;                     /**< Request string without arguments and line ending (e.g. "AT+CGACT=") */
+        AdrasteaI_Timeout_t timeout;             /**< Timeout category of the command */
+        const ATCommand_Field_t* requestFields;  /**< Arguments appended to the request (NULL if none) */
+        uint8_t numRequestFields;                /**< Number of entries in requestFields */
+        const ATCommand_Field_t* responseFields; /**< Arguments decoded from the response (NULL if the response is not evaluated) */
+        uint8_t numResponseFields;               /**< Number of entries in responseFields */
+    } AdrasteaI_Command_t;
+
+/**
+ * @brief X-macro helpers for command tables.
+ *
+ * A module lists its commands as COMMAND(id, request, timeout, requestFields, responseFields) entries, with
+ * the timeout category given without its AdrasteaI_Timeout_ prefix and the fields given as
+ * ADRASTEAI_COMMAND_FIELDS(fieldTable) or ADRASTEAI_COMMAND_NO_FIELDS. Expanding the list with
+ * ADRASTEAI_COMMAND_ID yields the command IDs, expanding it with ADRASTEAI_COMMAND_DESCRIPTOR yields
+ * the matching AdrasteaI_Command_t table.
+ */
+#define ADRASTEAI_COMMAND_FIELDS(fieldTable) fieldTable, (uint8_t)(sizeof(fieldTable) / sizeof((fieldTable)[0]))
+#define ADRASTEAI_COMMAND_NO_FIELDS NULL, 0
+#define ADRASTEAI_COMMAND_ID(id, request, timeout, requestFields, responseFields) id,
+#define ADRASTEAI_COMMAND_DESCRIPTOR(id, request, timeout, requestFields, responseFields) [id] = {request, AdrasteaI_Timeout_##timeout, requestFields, responseFields},
+
+    /**
+ * @brief Statistics of the command lock serializing access to the module.
+ * @see AdrasteaI_GetLockStatistics()
+ */
+    typedef struct AdrasteaI_Lock_Statistics_t
+    {
+        uint32_t acquisitions;    /**< Number of times the lock has been taken (nested locking by the owner is not counted) */
+        uint32_t contentions;     /**< Number of acquisitions that had to wait for another task */
+        uint32_t timeouts;        /**< Number of lock attempts that timed out */
+        uint32_t maxWaitTimeMs;   /**< Longest time a task waited for the lock (milliseconds) */
+        uint32_t maxHoldTimeMs;   /**< Longest time the lock has been held (milliseconds) */
+        uint32_t totalHoldTimeMs; /**< Accumulated time the lock has been held (milliseconds) */
+    } AdrasteaI_Lock_Statistics_t;
+
     /**
  * @brief Adrastea event callback.
  *
@@ -146,13 +192,27 @@ extern "C"
     extern bool AdrasteaI_PinWakeUp(void);
 
     extern bool AdrasteaI_SendRequest(char* data);
+    extern bool AdrasteaI_SendRequestWithPayload(char* data, uint32_t payloadLength);
     extern bool AdrasteaI_WaitForConfirm(uint32_t maxTimeMs, AdrasteaI_CNFStatus_t expectedStatus, char* pOutResponse);
+    extern bool AdrasteaI_WaitForConfirmByType(AdrasteaI_Timeout_t timeoutType, AdrasteaI_CNFStatus_t expectedStatus, char* pOutResponse);
+    extern bool AdrasteaI_ExecuteCommand(const AdrasteaI_Command_t* commandP, const void* pRequest, void* pResponse);
+
+    extern bool AdrasteaI_Lock(uint32_t timeoutMs);
+    extern void AdrasteaI_Unlock(void);
+    extern bool AdrasteaI_BeginCommand(void);
+    extern bool AdrasteaI_TryBeginCommand(void);
+    extern bool AdrasteaI_EndCommand(bool result);
+    extern void AdrasteaI_SetLockTimeout(uint32_t timeoutMs);
+    extern void AdrasteaI_GetLockStatistics(AdrasteaI_Lock_Statistics_t* statisticsP);
+    extern void AdrasteaI_ResetLockStatistics(void);
 
     extern bool AdrasteaI_SetTimingParameters(uint32_t waitTimeStepMicroseconds, uint32_t minCommandIntervalMicroseconds);
     extern void AdrasteaI_SetTimeout(AdrasteaI_Timeout_t type, uint32_t timeout);
     extern uint32_t AdrasteaI_GetTimeout(AdrasteaI_Timeout_t type);
 
     extern bool AdrasteaI_Transparent_Transmit(const char* data, uint16_t dataLength);
+    extern bool AdrasteaI_Transparent_TransmitHex(const uint8_t* data, uint16_t dataLength);
+    extern uint32_t AdrasteaI_GetUartCharactersPerSecond(void);
     extern void AdrasteaI_SetEolCharacters(uint8_t eol1, uint8_t eol2, bool twoEolCharacters);
     extern AdrasteaI_ATMode_t AdrasteaI_CheckATMode();
 
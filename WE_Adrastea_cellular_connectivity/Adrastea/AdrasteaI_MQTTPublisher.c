@@ -0,0 +1,514 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Pipelined MQTT publishing with a window of unacknowledged messages (enabled by defining ADRASTEAI_MQTT_PUBLISHER).
+ */
+
+#include <string.h>
+
+#include "ATEvent.h"
+#include "AdrasteaI.h"
+#include "AdrasteaI_MQTTPublisher.h"
+#include "global.h"
+#include "log.h"
+
+#ifdef ADRASTEAI_MQTT_PUBLISHER
+
+/**
+ * @brief State of a window slot.
+ */
+typedef enum AdrasteaI_MQTTPublisher_Slot_State_t
+{
+    AdrasteaI_MQTTPublisher_Slot_State_Free,
+    AdrasteaI_MQTTPublisher_Slot_State_Sending,   /**< Publish command in progress, message ID not known yet */
+    AdrasteaI_MQTTPublisher_Slot_State_InFlight,  /**< Waiting for PUBCONF (matched by the notification handler) */
+    AdrasteaI_MQTTPublisher_Slot_State_Completed, /**< Result available, callback not called yet */
+} AdrasteaI_MQTTPublisher_Slot_State_t;
+
+/**
+ * @brief Message in the window.
+ */
+typedef struct AdrasteaI_MQTTPublisher_Slot_t
+{
+    volatile uint8_t state; /**< See AdrasteaI_MQTTPublisher_Slot_State_t */
+    volatile int8_t result; /**< See AdrasteaI_MQTTPublisher_Result_t */
+    AdrasteaI_ATMQTT_Conn_ID_t connID;
+    AdrasteaI_ATMQTT_Message_ID_t msgID;
+    uint32_t sendTime;
+    uint32_t earlyAckStart; /**< Value of AdrasteaI_MQTTPublisher_earlyAckWrite when sending started */
+    AdrasteaI_MQTTPublisher_Callback_t callback;
+    void* contextP;
+} AdrasteaI_MQTTPublisher_Slot_t;
+
+/**
+ * @brief Acknowledgement received while the message ID of its message was not known yet.
+ */
+typedef struct AdrasteaI_MQTTPublisher_Early_Ack_t
+{
+    int8_t connID;
+    int8_t result;
+    AdrasteaI_ATMQTT_Message_ID_t msgID; /**< AdrasteaI_ATMQTT_Message_ID_Invalid if unused */
+} AdrasteaI_MQTTPublisher_Early_Ack_t;
+
+static AdrasteaI_MQTTPublisher_Slot_t AdrasteaI_MQTTPublisher_slots[ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE];
+
+static volatile AdrasteaI_MQTTPublisher_Early_Ack_t AdrasteaI_MQTTPublisher_earlyAcks[ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE];
+static volatile uint32_t AdrasteaI_MQTTPublisher_earlyAckWrite = 0;
+
+static AdrasteaI_MQTTPublisher_Statistics_t AdrasteaI_MQTTPublisher_statistics;
+static uint32_t AdrasteaI_MQTTPublisher_totalCommandMs = 0;
+static uint32_t AdrasteaI_MQTTPublisher_totalAckMs = 0;
+static uint32_t AdrasteaI_MQTTPublisher_firstPublishTime = 0;
+static uint32_t AdrasteaI_MQTTPublisher_lastAckTime = 0;
+
+/**
+ * @brief Returns the number of slots in use.
+ */
+static uint8_t AdrasteaI_MQTTPublisher_CountInFlight(void)
+{
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE; i++)
+    {
+        if (AdrasteaI_MQTTPublisher_slots[i].state != AdrasteaI_MQTTPublisher_Slot_State_Free)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Completes a slot with the supplied result (callback is called by AdrasteaI_MQTTPublisher_Process()).
+ */
+static void AdrasteaI_MQTTPublisher_Complete(AdrasteaI_MQTTPublisher_Slot_t* slotP, AdrasteaI_MQTTPublisher_Result_t result)
+{
+    slotP->result = (int8_t)result;
+    slotP->state = AdrasteaI_MQTTPublisher_Slot_State_Completed;
+}
+
+/**
+ * @brief Discards the early acknowledgements of a connection, the module reuses message IDs after reconnecting.
+ */
+static void AdrasteaI_MQTTPublisher_ClearEarlyAcks(AdrasteaI_ATMQTT_Conn_ID_t connID)
+{
+    for (uint8_t i = 0; i < ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE; i++)
+    {
+        volatile AdrasteaI_MQTTPublisher_Early_Ack_t* ackP = &AdrasteaI_MQTTPublisher_earlyAcks[i];
+        if (ackP->connID == (int8_t)connID)
+        {
+            ackP->msgID = AdrasteaI_ATMQTT_Message_ID_Invalid;
+        }
+    }
+}
+
+/**
+ * @brief Publishes a text or binary message, waiting for a free slot in the window if necessary.
+ */
+static bool AdrasteaI_MQTTPublisher_PublishMessage(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, const uint8_t* payload, uint32_t payloadSize, bool binary, uint32_t waitMs,
+                                                   AdrasteaI_MQTTPublisher_Callback_t callback, void* contextP, AdrasteaI_ATMQTT_Message_ID_t* msgIDP)
+{
+    uint32_t t0 = WE_GetTick();
+    bool waited = false;
+    AdrasteaI_MQTTPublisher_Slot_t* slotP = NULL;
+
+    while (1)
+    {
+        if (!AdrasteaI_BeginCommand())
+        {
+            return false;
+        }
+
+        AdrasteaI_MQTTPublisher_Process();
+
+        for (uint8_t i = 0; i < ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE; i++)
+        {
+            if (AdrasteaI_MQTTPublisher_slots[i].state == AdrasteaI_MQTTPublisher_Slot_State_Free)
+            {
+                slotP = &AdrasteaI_MQTTPublisher_slots[i];
+                break;
+            }
+        }
+
+        if (slotP != NULL)
+        {
+            break;
+        }
+
+        if (!waited)
+        {
+            AdrasteaI_MQTTPublisher_statistics.windowFull++;
+            waited = true;
+        }
+
+        if (WE_GetTick() - t0 >= waitMs)
+        {
+            WE_LOG_DEBUG(ATMQTT, "Publisher window full");
+            return AdrasteaI_EndCommand(false);
+        }
+
+        /* Release the lock while waiting, so other tasks can send commands */
+        AdrasteaI_EndCommand(true);
+        WE_Delay(ADRASTEAI_MQTT_PUBLISHER_POLL_INTERVAL_MS);
+    }
+
+    slotP->connID = connID;
+    slotP->msgID = AdrasteaI_ATMQTT_Message_ID_Invalid;
+    slotP->callback = callback;
+    slotP->contextP = contextP;
+    slotP->sendTime = WE_GetTick();
+    slotP->earlyAckStart = AdrasteaI_MQTTPublisher_earlyAckWrite;
+    slotP->state = AdrasteaI_MQTTPublisher_Slot_State_Sending;
+
+    AdrasteaI_ATMQTT_Message_ID_t msgID;
+    bool sent = binary ? AdrasteaI_ATMQTT_PublishBinary(connID, qos, retain, topicName, payload, payloadSize, &msgID) : AdrasteaI_ATMQTT_PublishWithMessageID(connID, qos, retain, topicName, (char*)payload, (AdrasteaI_ATMQTT_Payload_Size_t)payloadSize, &msgID);
+    if (!sent)
+    {
+        slotP->state = AdrasteaI_MQTTPublisher_Slot_State_Free;
+        return AdrasteaI_EndCommand(false);
+    }
+
+    uint32_t now = WE_GetTick();
+    AdrasteaI_MQTTPublisher_Statistics_t* statisticsP = &AdrasteaI_MQTTPublisher_statistics;
+    if (statisticsP->published == 0)
+    {
+        AdrasteaI_MQTTPublisher_firstPublishTime = slotP->sendTime;
+    }
+    statisticsP->published++;
+    AdrasteaI_MQTTPublisher_totalCommandMs += now - slotP->sendTime;
+
+    if (msgIDP != NULL)
+    {
+        *msgIDP = msgID;
+    }
+
+    slotP->msgID = msgID;
+    if ((qos == AdrasteaI_ATMQTT_QoS_At_Most_Once) || (msgID == AdrasteaI_ATMQTT_Message_ID_Invalid))
+    {
+        /* No acknowledgement to wait for */
+        AdrasteaI_MQTTPublisher_Complete(slotP, AdrasteaI_MQTTPublisher_Result_Success);
+    }
+    else
+    {
+        slotP->state = AdrasteaI_MQTTPublisher_Slot_State_InFlight;
+
+        /* The acknowledgement may have been received before the message ID was known. Only acknowledgements
+         * recorded since sending started are considered, older ones with the same ID belong to earlier messages. */
+        uint32_t end = AdrasteaI_MQTTPublisher_earlyAckWrite;
+        uint32_t recorded = end - slotP->earlyAckStart;
+        if (recorded > ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE)
+        {
+            recorded = ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE;
+        }
+        for (uint32_t k = end - recorded; k != end; k++)
+        {
+            volatile AdrasteaI_MQTTPublisher_Early_Ack_t* ackP = &AdrasteaI_MQTTPublisher_earlyAcks[k % ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE];
+            if ((ackP->msgID == msgID) && (ackP->connID == (int8_t)connID))
+            {
+                ackP->msgID = AdrasteaI_ATMQTT_Message_ID_Invalid;
+                AdrasteaI_MQTTPublisher_Complete(slotP, (AdrasteaI_MQTTPublisher_Result_t)ackP->result);
+                break;
+            }
+        }
+    }
+
+    uint8_t inFlight = AdrasteaI_MQTTPublisher_CountInFlight();
+    if (inFlight > statisticsP->maxInFlight)
+    {
+        statisticsP->maxInFlight = inFlight;
+    }
+
+    AdrasteaI_MQTTPublisher_Process();
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Publishes a message, waiting for a free slot in the window if necessary.
+ *
+ * Returns when the module has accepted the message. QoS 0 messages are completed right away, QoS 1 and 2 messages
+ * when their PUBCONF notification has been received.
+ *
+ * @param[in] connID MQTT Connection. See AdrasteaI_ATMQTT_Conn_ID_t.
+ * @param[in] qos Quality of Service.
+ * @param[in] retain Whether or not the message will be retained by the broker.
+ * @param[in] topicName MQTT Topic Name.
+ * @param[in] payload Payload to be published to topic.
+ * @param[in] payloadSize Size of the payload in bytes.
+ * @param[in] waitMs Max. time to wait for a free slot (milliseconds), 0 to fail right away if the window is full
+ * @param[in] callback Called when the message has been completed (can be NULL)
+ * @param[in] contextP Passed to the callback
+ * @param[out] msgIDP Message ID assigned by the module (can be NULL)
+ *
+ * @return true if successful, false otherwise (the callback is not called in this case)
+ */
+bool AdrasteaI_MQTTPublisher_Publish(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, char* payload, AdrasteaI_ATMQTT_Payload_Size_t payloadSize, uint32_t waitMs,
+                                     AdrasteaI_MQTTPublisher_Callback_t callback, void* contextP, AdrasteaI_ATMQTT_Message_ID_t* msgIDP)
+{
+    return AdrasteaI_MQTTPublisher_PublishMessage(connID, qos, retain, topicName, (const uint8_t*)payload, payloadSize, false, waitMs, callback, contextP, msgIDP);
+}
+
+/**
+ * @brief Publishes a binary message (see AdrasteaI_ATMQTT_PublishBinary()), waiting for a free slot in the window if necessary.
+ *
+ * Returns when the module has accepted the message. QoS 0 messages are completed right away, QoS 1 and 2 messages
+ * when their PUBCONF notification has been received.
+ *
+ * @param[in] connID MQTT Connection. See AdrasteaI_ATMQTT_Conn_ID_t.
+ * @param[in] qos Quality of Service.
+ * @param[in] retain Whether or not the message will be retained by the broker.
+ * @param[in] topicName MQTT Topic Name.
+ * @param[in] payload Payload to be published to topic.
+ * @param[in] payloadSize Size of the payload in bytes.
+ * @param[in] waitMs Max. time to wait for a free slot (milliseconds), 0 to fail right away if the window is full
+ * @param[in] callback Called when the message has been completed (can be NULL)
+ * @param[in] contextP Passed to the callback
+ * @param[out] msgIDP Message ID assigned by the module (can be NULL)
+ *
+ * @return true if successful, false otherwise (the callback is not called in this case)
+ */
+bool AdrasteaI_MQTTPublisher_PublishBinary(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, const uint8_t* payload, AdrasteaI_ATMQTT_Binary_Payload_Size_t payloadSize, uint32_t waitMs,
+                                           AdrasteaI_MQTTPublisher_Callback_t callback, void* contextP, AdrasteaI_ATMQTT_Message_ID_t* msgIDP)
+{
+    return AdrasteaI_MQTTPublisher_PublishMessage(connID, qos, retain, topicName, payload, payloadSize, true, waitMs, callback, contextP, msgIDP);
+}
+
+/**
+ * @brief Calls the callbacks of completed messages and times out messages without acknowledgement.
+ *
+ * Is called by AdrasteaI_MQTTPublisher_Publish(), should be called regularly by the application otherwise.
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTPublisher_Process(void)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    uint32_t now = WE_GetTick();
+    AdrasteaI_MQTTPublisher_Statistics_t* statisticsP = &AdrasteaI_MQTTPublisher_statistics;
+
+    for (uint8_t i = 0; i < ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE; i++)
+    {
+        AdrasteaI_MQTTPublisher_Slot_t* slotP = &AdrasteaI_MQTTPublisher_slots[i];
+
+        if ((slotP->state == AdrasteaI_MQTTPublisher_Slot_State_InFlight) && (now - slotP->sendTime >= ADRASTEAI_MQTT_PUBLISHER_ACK_TIMEOUT_MS))
+        {
+            WE_LOG_WARNING(ATMQTT, "Publication %u timed out", slotP->msgID);
+            AdrasteaI_MQTTPublisher_Complete(slotP, AdrasteaI_MQTTPublisher_Result_TimedOut);
+        }
+
+        if (slotP->state != AdrasteaI_MQTTPublisher_Slot_State_Completed)
+        {
+            continue;
+        }
+
+        AdrasteaI_MQTTPublisher_Result_t result = (AdrasteaI_MQTTPublisher_Result_t)slotP->result;
+        switch (result)
+        {
+            case AdrasteaI_MQTTPublisher_Result_Success:
+                statisticsP->acknowledged++;
+                AdrasteaI_MQTTPublisher_totalAckMs += now - slotP->sendTime;
+                AdrasteaI_MQTTPublisher_lastAckTime = now;
+                break;
+            case AdrasteaI_MQTTPublisher_Result_TimedOut:
+                statisticsP->timedOut++;
+                break;
+            default:
+                statisticsP->failed++;
+                break;
+        }
+
+        /* Free the slot before calling the callback, which may publish the next message */
+        AdrasteaI_MQTTPublisher_Callback_t callback = slotP->callback;
+        void* contextP = slotP->contextP;
+        AdrasteaI_ATMQTT_Conn_ID_t connID = slotP->connID;
+        AdrasteaI_ATMQTT_Message_ID_t msgID = slotP->msgID;
+        slotP->state = AdrasteaI_MQTTPublisher_Slot_State_Free;
+
+        if (callback != NULL)
+        {
+            callback(connID, msgID, result, contextP);
+        }
+    }
+
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Waits until all messages have been completed.
+ *
+ * @param[in] timeoutMs Max. time to wait (milliseconds)
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTPublisher_Flush(uint32_t timeoutMs)
+{
+    uint32_t t0 = WE_GetTick();
+
+    while (1)
+    {
+        if (!AdrasteaI_MQTTPublisher_Process())
+        {
+            return false;
+        }
+
+        if (AdrasteaI_MQTTPublisher_CountInFlight() == 0)
+        {
+            return true;
+        }
+
+        if (WE_GetTick() - t0 >= timeoutMs)
+        {
+            return false;
+        }
+
+        WE_Delay(ADRASTEAI_MQTT_PUBLISHER_POLL_INTERVAL_MS);
+    }
+}
+
+/**
+ * @brief Completes all messages of a connection waiting for their acknowledgement with AdrasteaI_MQTTPublisher_Result_Aborted.
+ *
+ * Should be called when a connection has been lost, the callbacks are called by the next AdrasteaI_MQTTPublisher_Process().
+ *
+ * @param[in] connID MQTT Connection
+ */
+void AdrasteaI_MQTTPublisher_Abort(AdrasteaI_ATMQTT_Conn_ID_t connID)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; i < ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE; i++)
+    {
+        AdrasteaI_MQTTPublisher_Slot_t* slotP = &AdrasteaI_MQTTPublisher_slots[i];
+        if ((slotP->state == AdrasteaI_MQTTPublisher_Slot_State_InFlight) && (slotP->connID == connID))
+        {
+            AdrasteaI_MQTTPublisher_Complete(slotP, AdrasteaI_MQTTPublisher_Result_Aborted);
+        }
+    }
+
+    AdrasteaI_MQTTPublisher_ClearEarlyAcks(connID);
+
+    AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Returns the publisher statistics.
+ *
+ * The stop-and-wait rate is the rate that would have been achieved by waiting for the acknowledgement of each
+ * message before publishing the next one, based on the average command duration and acknowledgement time.
+ *
+ * @param[out] statisticsP Statistics
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTPublisher_GetStatistics(AdrasteaI_MQTTPublisher_Statistics_t* statisticsP)
+{
+    if (statisticsP == NULL)
+    {
+        return false;
+    }
+
+    *statisticsP = AdrasteaI_MQTTPublisher_statistics;
+    statisticsP->inFlight = AdrasteaI_MQTTPublisher_CountInFlight();
+
+    if (statisticsP->published > 0)
+    {
+        statisticsP->averageCommandMs = AdrasteaI_MQTTPublisher_totalCommandMs / statisticsP->published;
+    }
+
+    if (statisticsP->acknowledged > 0)
+    {
+        statisticsP->averageAckMs = AdrasteaI_MQTTPublisher_totalAckMs / statisticsP->acknowledged;
+
+        uint32_t elapsedMs = AdrasteaI_MQTTPublisher_lastAckTime - AdrasteaI_MQTTPublisher_firstPublishTime;
+        statisticsP->ratePerSecondX100 = (elapsedMs > 0) ? (uint32_t)(((uint64_t)statisticsP->acknowledged * 100000) / elapsedMs) : 0;
+
+        /* The acknowledgement time includes the command duration */
+        statisticsP->stopAndWaitRatePerSecondX100 = (statisticsP->averageAckMs > 0) ? 100000 / statisticsP->averageAckMs : 0;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Records PUBCONF notifications and discards the early acknowledgements of a connection on CONCONF. Is called
+ * for each notification received from the module.
+ *
+ * @param[in] event Event type, parsed once by the driver for all URC handlers
+ * @param[in] pArguments Arguments following the event name (not modified, the line is passed on to the event callback afterwards)
+ */
+void AdrasteaI_MQTTPublisher_HandleURC(AdrasteaI_ATEvent_t event, char* pArguments)
+{
+    if (event == AdrasteaI_ATEvent_MQTT_Connection_Confirmation)
+    {
+        /* The parser sets the low byte of the enumeration fields only */
+        AdrasteaI_ATMQTT_Connection_Result_t connection;
+        memset(&connection, 0, sizeof(connection));
+        if (AdrasteaI_ATMQTT_ParseConnectionConfirmationEvent(pArguments, &connection))
+        {
+            AdrasteaI_MQTTPublisher_ClearEarlyAcks(connection.connID);
+        }
+        return;
+    }
+
+    if (event != AdrasteaI_ATEvent_MQTT_Publication_Confirmation)
+    {
+        return;
+    }
+
+    /* The parser sets the low byte of the enumeration fields only */
+    AdrasteaI_ATMQTT_Publication_Confirmation_Result_t confirmation;
+    memset(&confirmation, 0, sizeof(confirmation));
+    if (!AdrasteaI_ATMQTT_ParsePublicationConfirmationEvent(pArguments, &confirmation))
+    {
+        return;
+    }
+
+    AdrasteaI_MQTTPublisher_Result_t result = (confirmation.resultCode == AdrasteaI_ATMQTT_Event_Result_Code_Success) ? AdrasteaI_MQTTPublisher_Result_Success : AdrasteaI_MQTTPublisher_Result_Failed;
+
+    for (uint8_t i = 0; i < ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE; i++)
+    {
+        AdrasteaI_MQTTPublisher_Slot_t* slotP = &AdrasteaI_MQTTPublisher_slots[i];
+        if ((slotP->state == AdrasteaI_MQTTPublisher_Slot_State_InFlight) && (slotP->msgID == confirmation.msgID) && (slotP->connID == confirmation.connID))
+        {
+            AdrasteaI_MQTTPublisher_Complete(slotP, result);
+            return;
+        }
+    }
+
+    volatile AdrasteaI_MQTTPublisher_Early_Ack_t* ackP = &AdrasteaI_MQTTPublisher_earlyAcks[AdrasteaI_MQTTPublisher_earlyAckWrite % ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE];
+    ackP->connID = (int8_t)confirmation.connID;
+    ackP->result = (int8_t)result;
+    ackP->msgID = confirmation.msgID;
+    AdrasteaI_MQTTPublisher_earlyAckWrite++;
+}
+
+#endif /* ADRASTEAI_MQTT_PUBLISHER */
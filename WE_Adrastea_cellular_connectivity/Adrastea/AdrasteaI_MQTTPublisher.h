@@ -0,0 +1,131 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Pipelined MQTT publishing with a window of unacknowledged messages (enabled by defining ADRASTEAI_MQTT_PUBLISHER).
+ *
+ * AdrasteaI_ATMQTT_Publish() returns when the module has accepted a message, the broker acknowledgement of QoS 1
+ * and 2 messages is reported later by the PUBCONF notification. Instead of waiting for this notification after
+ * each message, AdrasteaI_MQTTPublisher_Publish() keeps up to ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE messages in
+ * flight and correlates the notifications with the messages by connection and message ID. When the window is
+ * full, publishing waits for a free slot (backpressure).
+ *
+ * Each message can have a callback, which is called from AdrasteaI_MQTTPublisher_Process() in the context of the
+ * calling task once the message has been acknowledged, rejected or timed out. The PUBCONF notification must be
+ * enabled using AdrasteaI_ATMQTT_SetMQTTUnsolicitedNotificationEvents().
+ */
+
+#ifndef ADRASTEAI_MQTTPUBLISHER_H_INCLUDED
+#define ADRASTEAI_MQTTPUBLISHER_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ATEvent.h"
+#include "ATMQTT.h"
+
+#ifndef ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE
+/**
+ * @brief Max. number of messages waiting for their acknowledgement.
+ */
+#define ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE 4
+#endif
+
+#ifndef ADRASTEAI_MQTT_PUBLISHER_ACK_TIMEOUT_MS
+/**
+ * @brief Time after which a message without acknowledgement is completed with AdrasteaI_MQTTPublisher_Result_TimedOut (milliseconds).
+ */
+#define ADRASTEAI_MQTT_PUBLISHER_ACK_TIMEOUT_MS 30000
+#endif
+
+/**
+ * @brief Interval for checking for acknowledgements while waiting for a free slot (milliseconds).
+ */
+#define ADRASTEAI_MQTT_PUBLISHER_POLL_INTERVAL_MS 5
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief Outcome of a publication.
+ */
+    typedef enum AdrasteaI_MQTTPublisher_Result_t
+    {
+        AdrasteaI_MQTTPublisher_Result_Invalid = -1,
+        AdrasteaI_MQTTPublisher_Result_Success,  /**< Acknowledged by the broker (QoS 0: accepted by the module) */
+        AdrasteaI_MQTTPublisher_Result_Failed,   /**< Reported as failed by the module */
+        AdrasteaI_MQTTPublisher_Result_TimedOut, /**< No acknowledgement within ADRASTEAI_MQTT_PUBLISHER_ACK_TIMEOUT_MS */
+        AdrasteaI_MQTTPublisher_Result_Aborted,  /**< Aborted by AdrasteaI_MQTTPublisher_Abort() */
+        AdrasteaI_MQTTPublisher_Result_NumberOfValues
+    } AdrasteaI_MQTTPublisher_Result_t;
+
+    /**
+ * @brief Called when a publication has been completed.
+ */
+    typedef void (*AdrasteaI_MQTTPublisher_Callback_t)(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_Message_ID_t msgID, AdrasteaI_MQTTPublisher_Result_t result, void* contextP);
+
+    /**
+ * @brief Publisher statistics.
+ * @see AdrasteaI_MQTTPublisher_GetStatistics()
+ */
+    typedef struct AdrasteaI_MQTTPublisher_Statistics_t
+    {
+        uint32_t published;                    /**< Messages accepted by the module */
+        uint32_t acknowledged;                 /**< Messages completed successfully */
+        uint32_t failed;                       /**< Messages reported as failed */
+        uint32_t timedOut;                     /**< Messages completed without acknowledgement */
+        uint32_t windowFull;                   /**< Publications that had to wait for a free slot */
+        uint8_t inFlight;                      /**< Messages currently waiting for their acknowledgement */
+        uint8_t maxInFlight;                   /**< Max. number of messages waiting for their acknowledgement at the same time */
+        uint32_t averageCommandMs;             /**< Average duration of the publish command (milliseconds) */
+        uint32_t averageAckMs;                 /**< Average time from publish command to acknowledgement (milliseconds) */
+        uint32_t ratePerSecondX100;            /**< Acknowledged messages per second since the first publication (multiplied by 100) */
+        uint32_t stopAndWaitRatePerSecondX100; /**< Rate if each acknowledgement had been awaited before the next publication (multiplied by 100) */
+    } AdrasteaI_MQTTPublisher_Statistics_t;
+
+    extern bool AdrasteaI_MQTTPublisher_Publish(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, char* payload, AdrasteaI_ATMQTT_Payload_Size_t payloadSize, uint32_t waitMs,
+                                                AdrasteaI_MQTTPublisher_Callback_t callback, void* contextP, AdrasteaI_ATMQTT_Message_ID_t* msgIDP);
+
+    extern bool AdrasteaI_MQTTPublisher_PublishBinary(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, const uint8_t* payload, AdrasteaI_ATMQTT_Binary_Payload_Size_t payloadSize, uint32_t waitMs,
+                                                      AdrasteaI_MQTTPublisher_Callback_t callback, void* contextP, AdrasteaI_ATMQTT_Message_ID_t* msgIDP);
+
+    extern bool AdrasteaI_MQTTPublisher_Process(void);
+
+    extern bool AdrasteaI_MQTTPublisher_Flush(uint32_t timeoutMs);
+
+    extern void AdrasteaI_MQTTPublisher_Abort(AdrasteaI_ATMQTT_Conn_ID_t connID);
+
+    extern bool AdrasteaI_MQTTPublisher_GetStatistics(AdrasteaI_MQTTPublisher_Statistics_t* statisticsP);
+
+    extern void AdrasteaI_MQTTPublisher_HandleURC(AdrasteaI_ATEvent_t event, char* pArguments);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADRASTEAI_MQTTPUBLISHER_H_INCLUDED */
@@ -0,0 +1,1029 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Store-and-forward queue for MQTT publications in external flash (enabled by defining ADRASTEAI_MQTT_QUEUE).
+ */
+
+#include <string.h>
+
+#include "ATEvent.h"
+#include "AdrasteaI.h"
+#include "AdrasteaI_MQTTPublisher.h"
+#include "AdrasteaI_MQTTQueue.h"
+#include "global.h"
+#include "log.h"
+
+#ifdef ADRASTEAI_MQTT_QUEUE
+
+#ifndef ADRASTEAI_MQTT_PUBLISHER
+#error "ADRASTEAI_MQTT_QUEUE requires ADRASTEAI_MQTT_PUBLISHER"
+#endif
+
+/**
+ * @brief Time to wait before draining again after a queued message could not be delivered (milliseconds).
+ */
+#define ADRASTEAI_MQTT_QUEUE_RETRY_INTERVAL_MS 5000
+
+#define ADRASTEAI_MQTT_QUEUE_SECTOR_MAGIC 0x5154514Dlu /* "MQTQ" */
+#define ADRASTEAI_MQTT_QUEUE_SECTOR_HEADER_LENGTH 20
+#define ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH 16
+#define ADRASTEAI_MQTT_QUEUE_MAX_TOPIC_LENGTH (sizeof(AdrasteaI_ATMQTT_Topic_Name_t) - 1)
+#define ADRASTEAI_MQTT_QUEUE_RECORD_BUFFER_SIZE (ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH + ADRASTEAI_MQTT_QUEUE_MAX_TOPIC_LENGTH + ADRASTEAI_MQTT_QUEUE_MAX_PAYLOAD_SIZE)
+#define ADRASTEAI_MQTT_QUEUE_MAX_WRITE_ALIGNMENT 64
+
+/**
+ * @brief Record types. Erased flash (0xFF) marks the end of the records of a sector.
+ */
+#define ADRASTEAI_MQTT_QUEUE_RECORD_MESSAGE 0x4D     /* 'M' */
+#define ADRASTEAI_MQTT_QUEUE_RECORD_ACK 0x41         /* 'A' */
+#define ADRASTEAI_MQTT_QUEUE_RECORD_ERASED 0xFF
+
+/*
+ * Sector header (little endian):  magic (4), sector sequence (4), erase count (4), acknowledged sequence (4), reserved (2), CRC (2)
+ * Record header (little endian):  type (1), flags (1), topic length (1), reserved (1), sequence (4), payload length (2),
+ *                                 payload CRC (2), reserved (2), header CRC (2)
+ *
+ * Message records are followed by the topic and the payload. Sector headers and records start at multiples of the
+ * write alignment of the flash, the remainder of a record is padded with 0xFF.
+ */
+
+/**
+ * @brief Sector of the log (RAM copy of the sector header).
+ */
+typedef struct AdrasteaI_MQTTQueue_Sector_t
+{
+    bool valid;
+    uint32_t sequence;           /**< Position of the sector in the log */
+    uint32_t eraseCount;
+    uint32_t maxMessageSequence; /**< Sequence number of the last message in the sector (0 if none) */
+} AdrasteaI_MQTTQueue_Sector_t;
+
+/**
+ * @brief Position in the log.
+ */
+typedef struct AdrasteaI_MQTTQueue_Position_t
+{
+    uint8_t sector;
+    uint32_t offset;
+} AdrasteaI_MQTTQueue_Position_t;
+
+/**
+ * @brief Decoded record header.
+ */
+typedef struct AdrasteaI_MQTTQueue_Record_t
+{
+    uint8_t type;
+    uint8_t flags;
+    uint8_t topicLength;
+    uint32_t sequence;
+    uint16_t payloadLength;
+    uint16_t payloadCRC;
+    uint32_t size; /**< Size in flash including padding */
+} AdrasteaI_MQTTQueue_Record_t;
+
+/**
+ * @brief State of a queued message handed to the publisher.
+ */
+typedef enum AdrasteaI_MQTTQueue_InFlight_State_t
+{
+    AdrasteaI_MQTTQueue_InFlight_State_Sent,
+    AdrasteaI_MQTTQueue_InFlight_State_Delivered,
+    AdrasteaI_MQTTQueue_InFlight_State_Failed,
+} AdrasteaI_MQTTQueue_InFlight_State_t;
+
+/**
+ * @brief Queued message handed to the publisher (in the order the messages were sent).
+ */
+typedef struct AdrasteaI_MQTTQueue_InFlight_t
+{
+    uint32_t sequence;
+    uint32_t sectorSequence; /**< To detect that the sector has been erased in the meantime */
+    AdrasteaI_MQTTQueue_Position_t position;
+    uint8_t state; /**< See AdrasteaI_MQTTQueue_InFlight_State_t */
+} AdrasteaI_MQTTQueue_InFlight_t;
+
+static const WE_Flash_t* AdrasteaI_MQTTQueue_flashP = NULL;
+static uint32_t AdrasteaI_MQTTQueue_baseAddress = 0;
+static uint8_t AdrasteaI_MQTTQueue_sectorCount = 0;
+static uint32_t AdrasteaI_MQTTQueue_alignment = 1;
+static uint32_t AdrasteaI_MQTTQueue_firstRecordOffset = 0;
+
+static AdrasteaI_MQTTQueue_Sector_t AdrasteaI_MQTTQueue_sectors[ADRASTEAI_MQTT_QUEUE_MAX_SECTORS];
+static uint8_t AdrasteaI_MQTTQueue_headSector = 0;
+static uint32_t AdrasteaI_MQTTQueue_headOffset = 0;
+static AdrasteaI_MQTTQueue_Position_t AdrasteaI_MQTTQueue_readPosition;
+
+static uint32_t AdrasteaI_MQTTQueue_nextSequence = 1;
+static uint32_t AdrasteaI_MQTTQueue_ackedSequence = 0;
+static uint32_t AdrasteaI_MQTTQueue_persistedAckedSequence = 0;
+
+static AdrasteaI_MQTTQueue_InFlight_t AdrasteaI_MQTTQueue_inFlight[ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE];
+static uint8_t AdrasteaI_MQTTQueue_inFlightStart = 0;
+static uint8_t AdrasteaI_MQTTQueue_inFlightCount = 0;
+
+/* Messages delivered after a failed one, not published again when draining is restarted (see AdrasteaI_MQTTQueue_CompleteInFlight()) */
+static uint32_t AdrasteaI_MQTTQueue_deliveredSequences[ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE];
+static uint8_t AdrasteaI_MQTTQueue_deliveredCount = 0;
+
+static volatile bool AdrasteaI_MQTTQueue_connected[AdrasteaI_ATMQTT_Conn_ID_NumberOfValues];
+static volatile bool AdrasteaI_MQTTQueue_drainRequested = false;
+static bool AdrasteaI_MQTTQueue_retryPending = false;
+static uint32_t AdrasteaI_MQTTQueue_retryTime = 0;
+
+static AdrasteaI_MQTTQueue_Statistics_t AdrasteaI_MQTTQueue_statistics;
+
+/* Record buffer, used for appending and for draining (protected by the command lock) */
+static uint8_t AdrasteaI_MQTTQueue_buffer[ADRASTEAI_MQTT_QUEUE_RECORD_BUFFER_SIZE + ADRASTEAI_MQTT_QUEUE_MAX_WRITE_ALIGNMENT];
+
+static uint16_t AdrasteaI_MQTTQueue_CRC(const uint8_t* data, uint32_t length, uint16_t crc)
+{
+    /* CRC-16/CCITT */
+    while (length-- > 0)
+    {
+        crc ^= (uint16_t)(*data++) << 8;
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static void AdrasteaI_MQTTQueue_PutUint16(uint8_t* p, uint16_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+}
+
+static void AdrasteaI_MQTTQueue_PutUint32(uint8_t* p, uint32_t value)
+{
+    AdrasteaI_MQTTQueue_PutUint16(p, (uint16_t)value);
+    AdrasteaI_MQTTQueue_PutUint16(p + 2, (uint16_t)(value >> 16));
+}
+
+static uint16_t AdrasteaI_MQTTQueue_GetUint16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+
+static uint32_t AdrasteaI_MQTTQueue_GetUint32(const uint8_t* p) { return AdrasteaI_MQTTQueue_GetUint16(p) | ((uint32_t)AdrasteaI_MQTTQueue_GetUint16(p + 2) << 16); }
+
+static uint32_t AdrasteaI_MQTTQueue_Align(uint32_t length) { return (length + AdrasteaI_MQTTQueue_alignment - 1) / AdrasteaI_MQTTQueue_alignment * AdrasteaI_MQTTQueue_alignment; }
+
+static uint32_t AdrasteaI_MQTTQueue_SectorAddress(uint8_t sector) { return AdrasteaI_MQTTQueue_baseAddress + (uint32_t)sector * AdrasteaI_MQTTQueue_flashP->sectorSize; }
+
+static uint8_t AdrasteaI_MQTTQueue_NextSector(uint8_t sector) { return (uint8_t)((sector + 1) % AdrasteaI_MQTTQueue_sectorCount); }
+
+/**
+ * @brief Reads the header of a sector.
+ *
+ * @return true if the sector holds a valid header, false otherwise
+ */
+static bool AdrasteaI_MQTTQueue_ReadSectorHeader(uint8_t sector, AdrasteaI_MQTTQueue_Sector_t* sectorP, uint32_t* ackedSequenceP)
+{
+    uint8_t header[ADRASTEAI_MQTT_QUEUE_SECTOR_HEADER_LENGTH];
+
+    if (!AdrasteaI_MQTTQueue_flashP->flashRead(AdrasteaI_MQTTQueue_SectorAddress(sector), header, sizeof(header)))
+    {
+        return false;
+    }
+
+    if ((AdrasteaI_MQTTQueue_GetUint32(header) != ADRASTEAI_MQTT_QUEUE_SECTOR_MAGIC) || (AdrasteaI_MQTTQueue_GetUint16(header + 18) != AdrasteaI_MQTTQueue_CRC(header, 18, 0xFFFF)))
+    {
+        return false;
+    }
+
+    sectorP->valid = true;
+    sectorP->sequence = AdrasteaI_MQTTQueue_GetUint32(header + 4);
+    sectorP->eraseCount = AdrasteaI_MQTTQueue_GetUint32(header + 8);
+    sectorP->maxMessageSequence = 0;
+    *ackedSequenceP = AdrasteaI_MQTTQueue_GetUint32(header + 12);
+    return true;
+}
+
+/**
+ * @brief Reads the record header at the supplied position.
+ *
+ * @return true if a valid record has been read, false if the end of the records of the sector has been reached
+ */
+static bool AdrasteaI_MQTTQueue_ReadRecordHeader(const AdrasteaI_MQTTQueue_Position_t* positionP, AdrasteaI_MQTTQueue_Record_t* recordP)
+{
+    uint8_t header[ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH];
+
+    if ((positionP->sector == AdrasteaI_MQTTQueue_headSector) && (positionP->offset >= AdrasteaI_MQTTQueue_headOffset))
+    {
+        return false;
+    }
+
+    if ((positionP->offset + ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH > AdrasteaI_MQTTQueue_flashP->sectorSize) || !AdrasteaI_MQTTQueue_flashP->flashRead(AdrasteaI_MQTTQueue_SectorAddress(positionP->sector) + positionP->offset, header, sizeof(header)))
+    {
+        return false;
+    }
+
+    /* An interrupted write leaves an erased or corrupted header, the sector is not continued in both cases */
+    if ((header[0] == ADRASTEAI_MQTT_QUEUE_RECORD_ERASED) || (AdrasteaI_MQTTQueue_GetUint16(header + 14) != AdrasteaI_MQTTQueue_CRC(header, 14, 0xFFFF)))
+    {
+        return false;
+    }
+
+    recordP->type = header[0];
+    recordP->flags = header[1];
+    recordP->topicLength = header[2];
+    recordP->sequence = AdrasteaI_MQTTQueue_GetUint32(header + 4);
+    recordP->payloadLength = AdrasteaI_MQTTQueue_GetUint16(header + 8);
+    recordP->payloadCRC = AdrasteaI_MQTTQueue_GetUint16(header + 10);
+    recordP->size = AdrasteaI_MQTTQueue_Align(ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH + ((recordP->type == ADRASTEAI_MQTT_QUEUE_RECORD_MESSAGE) ? recordP->topicLength + recordP->payloadLength : 0));
+
+    return (positionP->offset + recordP->size <= AdrasteaI_MQTTQueue_flashP->sectorSize);
+}
+
+/**
+ * @brief Reads the record at the supplied position, moving on to the following sectors if the end of a sector
+ * has been reached. On return, the position is the position of the record.
+ *
+ * @return true if a record has been read, false if the end of the log has been reached
+ */
+static bool AdrasteaI_MQTTQueue_ReadRecord(AdrasteaI_MQTTQueue_Position_t* positionP, AdrasteaI_MQTTQueue_Record_t* recordP)
+{
+    while (!AdrasteaI_MQTTQueue_ReadRecordHeader(positionP, recordP))
+    {
+        if (positionP->sector == AdrasteaI_MQTTQueue_headSector)
+        {
+            return false;
+        }
+
+        positionP->sector = AdrasteaI_MQTTQueue_NextSector(positionP->sector);
+        positionP->offset = AdrasteaI_MQTTQueue_firstRecordOffset;
+    }
+    return true;
+}
+
+/**
+ * @brief Appends a prepared record (header and data in AdrasteaI_MQTTQueue_buffer) to the head sector.
+ */
+static bool AdrasteaI_MQTTQueue_ProgramRecord(uint32_t length)
+{
+    uint32_t size = AdrasteaI_MQTTQueue_Align(length);
+    memset(AdrasteaI_MQTTQueue_buffer + length, 0xFF, size - length);
+
+    if (!AdrasteaI_MQTTQueue_flashP->flashProgram(AdrasteaI_MQTTQueue_SectorAddress(AdrasteaI_MQTTQueue_headSector) + AdrasteaI_MQTTQueue_headOffset, AdrasteaI_MQTTQueue_buffer, size))
+    {
+        /* The record may have been written partially, don't use the rest of the sector */
+        AdrasteaI_MQTTQueue_headOffset = AdrasteaI_MQTTQueue_flashP->sectorSize;
+        return false;
+    }
+
+    AdrasteaI_MQTTQueue_headOffset += size;
+    return true;
+}
+
+/**
+ * @brief Counts the undelivered messages in a sector.
+ */
+static uint32_t AdrasteaI_MQTTQueue_CountPending(uint8_t sector)
+{
+    uint32_t count = 0;
+    AdrasteaI_MQTTQueue_Position_t position = {.sector = sector, .offset = AdrasteaI_MQTTQueue_firstRecordOffset};
+    AdrasteaI_MQTTQueue_Record_t record;
+
+    while (AdrasteaI_MQTTQueue_ReadRecordHeader(&position, &record))
+    {
+        if ((record.type == ADRASTEAI_MQTT_QUEUE_RECORD_MESSAGE) && (record.sequence > AdrasteaI_MQTTQueue_ackedSequence))
+        {
+            count++;
+        }
+        position.offset += record.size;
+    }
+    return count;
+}
+
+/**
+ * @brief Erases the sector following the head sector and makes it the new head sector.
+ *
+ * If the sector still holds undelivered messages (i.e. the log is full), these messages are dropped.
+ */
+static bool AdrasteaI_MQTTQueue_OpenNextSector(void)
+{
+    uint8_t sector = AdrasteaI_MQTTQueue_NextSector(AdrasteaI_MQTTQueue_headSector);
+    AdrasteaI_MQTTQueue_Sector_t* sectorP = &AdrasteaI_MQTTQueue_sectors[sector];
+    AdrasteaI_MQTTQueue_Sector_t* headP = &AdrasteaI_MQTTQueue_sectors[AdrasteaI_MQTTQueue_headSector];
+
+    if (sectorP->valid && (sectorP->maxMessageSequence > AdrasteaI_MQTTQueue_ackedSequence))
+    {
+        uint32_t dropped = AdrasteaI_MQTTQueue_CountPending(sector);
+        WE_LOG_WARNING(ATMQTT, "Queue full, dropping %lu messages", (unsigned long)dropped);
+        AdrasteaI_MQTTQueue_statistics.dropped += dropped;
+        AdrasteaI_MQTTQueue_statistics.pending -= dropped;
+
+        /* The oldest remaining messages are in the sector after the erased one */
+        if (AdrasteaI_MQTTQueue_readPosition.sector == sector)
+        {
+            AdrasteaI_MQTTQueue_readPosition.sector = AdrasteaI_MQTTQueue_NextSector(sector);
+            AdrasteaI_MQTTQueue_readPosition.offset = AdrasteaI_MQTTQueue_firstRecordOffset;
+        }
+    }
+
+    /* Sectors without valid header continue with the highest known erase count */
+    uint32_t eraseCount = sectorP->valid ? sectorP->eraseCount : AdrasteaI_MQTTQueue_statistics.maxSectorEraseCount;
+    eraseCount++;
+
+    sectorP->valid = false;
+    AdrasteaI_MQTTQueue_statistics.sectorErases++;
+    if (!AdrasteaI_MQTTQueue_flashP->flashEraseSector(AdrasteaI_MQTTQueue_SectorAddress(sector)))
+    {
+        return false;
+    }
+
+    uint8_t* header = AdrasteaI_MQTTQueue_buffer;
+    uint32_t sequence = headP->valid ? headP->sequence + 1 : 1;
+    AdrasteaI_MQTTQueue_PutUint32(header, ADRASTEAI_MQTT_QUEUE_SECTOR_MAGIC);
+    AdrasteaI_MQTTQueue_PutUint32(header + 4, sequence);
+    AdrasteaI_MQTTQueue_PutUint32(header + 8, eraseCount);
+    AdrasteaI_MQTTQueue_PutUint32(header + 12, AdrasteaI_MQTTQueue_ackedSequence);
+    AdrasteaI_MQTTQueue_PutUint16(header + 16, 0xFFFF);
+    AdrasteaI_MQTTQueue_PutUint16(header + 18, AdrasteaI_MQTTQueue_CRC(header, 18, 0xFFFF));
+
+    AdrasteaI_MQTTQueue_headSector = sector;
+    AdrasteaI_MQTTQueue_headOffset = 0;
+    if (!AdrasteaI_MQTTQueue_ProgramRecord(ADRASTEAI_MQTT_QUEUE_SECTOR_HEADER_LENGTH))
+    {
+        return false;
+    }
+
+    sectorP->valid = true;
+    sectorP->sequence = sequence;
+    sectorP->eraseCount = eraseCount;
+    sectorP->maxMessageSequence = 0;
+
+    /* The sector header holds the acknowledged sequence number as well */
+    AdrasteaI_MQTTQueue_persistedAckedSequence = AdrasteaI_MQTTQueue_ackedSequence;
+
+    if (eraseCount > AdrasteaI_MQTTQueue_statistics.maxSectorEraseCount)
+    {
+        AdrasteaI_MQTTQueue_statistics.maxSectorEraseCount = eraseCount;
+    }
+    return true;
+}
+
+/**
+ * @brief Makes sure that a record of the supplied size fits into the head sector.
+ */
+static bool AdrasteaI_MQTTQueue_Reserve(uint32_t length)
+{
+    if (AdrasteaI_MQTTQueue_headOffset + AdrasteaI_MQTTQueue_Align(length) <= AdrasteaI_MQTTQueue_flashP->sectorSize)
+    {
+        return true;
+    }
+    return AdrasteaI_MQTTQueue_OpenNextSector();
+}
+
+/**
+ * @brief Appends an acknowledgement record if messages have been delivered since the last one.
+ */
+static bool AdrasteaI_MQTTQueue_PersistAck(void)
+{
+    if (AdrasteaI_MQTTQueue_persistedAckedSequence == AdrasteaI_MQTTQueue_ackedSequence)
+    {
+        return true;
+    }
+
+    if (!AdrasteaI_MQTTQueue_Reserve(ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH))
+    {
+        return false;
+    }
+
+    if (AdrasteaI_MQTTQueue_persistedAckedSequence == AdrasteaI_MQTTQueue_ackedSequence)
+    {
+        /* Already persisted in the header of a newly opened sector */
+        return true;
+    }
+
+    uint8_t* header = AdrasteaI_MQTTQueue_buffer;
+    memset(header, 0xFF, ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH);
+    header[0] = ADRASTEAI_MQTT_QUEUE_RECORD_ACK;
+    AdrasteaI_MQTTQueue_PutUint32(header + 4, AdrasteaI_MQTTQueue_ackedSequence);
+    AdrasteaI_MQTTQueue_PutUint16(header + 14, AdrasteaI_MQTTQueue_CRC(header, 14, 0xFFFF));
+
+    if (!AdrasteaI_MQTTQueue_ProgramRecord(ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH))
+    {
+        return false;
+    }
+
+    AdrasteaI_MQTTQueue_persistedAckedSequence = AdrasteaI_MQTTQueue_ackedSequence;
+    return true;
+}
+
+/**
+ * @brief Scans the log after a reset: Determines the head of the log, the acknowledged sequence number
+ * and the oldest undelivered message.
+ */
+static void AdrasteaI_MQTTQueue_Mount(void)
+{
+    uint8_t order[ADRASTEAI_MQTT_QUEUE_MAX_SECTORS];
+    uint8_t validCount = 0;
+    AdrasteaI_MQTTQueue_Statistics_t* statisticsP = &AdrasteaI_MQTTQueue_statistics;
+
+    statisticsP->minSectorEraseCount = UINT32_MAX;
+    for (uint8_t sector = 0; sector < AdrasteaI_MQTTQueue_sectorCount; sector++)
+    {
+        AdrasteaI_MQTTQueue_Sector_t* sectorP = &AdrasteaI_MQTTQueue_sectors[sector];
+        uint32_t ackedSequence;
+
+        memset(sectorP, 0, sizeof(*sectorP));
+        if (!AdrasteaI_MQTTQueue_ReadSectorHeader(sector, sectorP, &ackedSequence))
+        {
+            statisticsP->minSectorEraseCount = 0;
+            continue;
+        }
+
+        if (ackedSequence > AdrasteaI_MQTTQueue_ackedSequence)
+        {
+            AdrasteaI_MQTTQueue_ackedSequence = ackedSequence;
+        }
+        if (sectorP->eraseCount > statisticsP->maxSectorEraseCount)
+        {
+            statisticsP->maxSectorEraseCount = sectorP->eraseCount;
+        }
+        if (sectorP->eraseCount < statisticsP->minSectorEraseCount)
+        {
+            statisticsP->minSectorEraseCount = sectorP->eraseCount;
+        }
+
+        /* Insert into the list of valid sectors, ordered by sequence */
+        uint8_t i = validCount++;
+        while ((i > 0) && (AdrasteaI_MQTTQueue_sectors[order[i - 1]].sequence > sectorP->sequence))
+        {
+            order[i] = order[i - 1];
+            i--;
+        }
+        order[i] = sector;
+    }
+
+    if (validCount == 0)
+    {
+        return;
+    }
+
+    AdrasteaI_MQTTQueue_headSector = order[validCount - 1];
+    AdrasteaI_MQTTQueue_headOffset = AdrasteaI_MQTTQueue_flashP->sectorSize;
+
+    /* First pass: Sequence numbers and end of the log */
+    for (uint8_t i = 0; i < validCount; i++)
+    {
+        AdrasteaI_MQTTQueue_Position_t position = {.sector = order[i], .offset = AdrasteaI_MQTTQueue_firstRecordOffset};
+        AdrasteaI_MQTTQueue_Record_t record;
+
+        while (AdrasteaI_MQTTQueue_ReadRecordHeader(&position, &record))
+        {
+            if (record.type == ADRASTEAI_MQTT_QUEUE_RECORD_MESSAGE)
+            {
+                AdrasteaI_MQTTQueue_sectors[position.sector].maxMessageSequence = record.sequence;
+                if (record.sequence >= AdrasteaI_MQTTQueue_nextSequence)
+                {
+                    AdrasteaI_MQTTQueue_nextSequence = record.sequence + 1;
+                }
+            }
+            else if ((record.type == ADRASTEAI_MQTT_QUEUE_RECORD_ACK) && (record.sequence > AdrasteaI_MQTTQueue_ackedSequence))
+            {
+                AdrasteaI_MQTTQueue_ackedSequence = record.sequence;
+            }
+            position.offset += record.size;
+        }
+
+        if (position.sector == AdrasteaI_MQTTQueue_headSector)
+        {
+            /* Continue after the last record, unless the sector ends with an interrupted write */
+            uint8_t type = ADRASTEAI_MQTT_QUEUE_RECORD_ERASED;
+            if ((position.offset + ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH <= AdrasteaI_MQTTQueue_flashP->sectorSize) && AdrasteaI_MQTTQueue_flashP->flashRead(AdrasteaI_MQTTQueue_SectorAddress(position.sector) + position.offset, &type, 1) && (type == ADRASTEAI_MQTT_QUEUE_RECORD_ERASED))
+            {
+                AdrasteaI_MQTTQueue_headOffset = position.offset;
+            }
+        }
+    }
+
+    /* Second pass: Oldest undelivered message */
+    AdrasteaI_MQTTQueue_readPosition.sector = AdrasteaI_MQTTQueue_headSector;
+    AdrasteaI_MQTTQueue_readPosition.offset = AdrasteaI_MQTTQueue_headOffset;
+    for (uint8_t i = 0; i < validCount; i++)
+    {
+        AdrasteaI_MQTTQueue_Sector_t* sectorP = &AdrasteaI_MQTTQueue_sectors[order[i]];
+        if (sectorP->maxMessageSequence <= AdrasteaI_MQTTQueue_ackedSequence)
+        {
+            continue;
+        }
+
+        uint32_t pending = AdrasteaI_MQTTQueue_CountPending(order[i]);
+        if (statisticsP->pending == 0)
+        {
+            AdrasteaI_MQTTQueue_readPosition.sector = order[i];
+            AdrasteaI_MQTTQueue_readPosition.offset = AdrasteaI_MQTTQueue_firstRecordOffset;
+        }
+        statisticsP->pending += pending;
+    }
+
+    AdrasteaI_MQTTQueue_persistedAckedSequence = AdrasteaI_MQTTQueue_ackedSequence;
+}
+
+/**
+ * @brief Initializes the queue and restores queued messages from flash.
+ *
+ * @param[in] flashP Flash to be used (must stay valid). The flash must have been initialized.
+ * @param[in] baseAddress Address of the first flash sector used by the queue
+ * @param[in] sectorCount Number of flash sectors used by the queue (2 to ADRASTEAI_MQTT_QUEUE_MAX_SECTORS)
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTQueue_Init(const WE_Flash_t* flashP, uint32_t baseAddress, uint8_t sectorCount)
+{
+    if ((flashP == NULL) || (flashP->flashRead == NULL) || (flashP->flashProgram == NULL) || (flashP->flashEraseSector == NULL) || (sectorCount < 2) || (sectorCount > ADRASTEAI_MQTT_QUEUE_MAX_SECTORS) || (flashP->writeAlignment > ADRASTEAI_MQTT_QUEUE_MAX_WRITE_ALIGNMENT) ||
+        (flashP->sectorSize == 0) || (baseAddress % flashP->sectorSize != 0))
+    {
+        return false;
+    }
+
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_MQTTQueue_flashP = flashP;
+    AdrasteaI_MQTTQueue_baseAddress = baseAddress;
+    AdrasteaI_MQTTQueue_sectorCount = sectorCount;
+    AdrasteaI_MQTTQueue_alignment = (flashP->writeAlignment > 0) ? flashP->writeAlignment : 1;
+    AdrasteaI_MQTTQueue_firstRecordOffset = AdrasteaI_MQTTQueue_Align(ADRASTEAI_MQTT_QUEUE_SECTOR_HEADER_LENGTH);
+
+    /* The largest record has to fit into a sector */
+    if (AdrasteaI_MQTTQueue_firstRecordOffset + AdrasteaI_MQTTQueue_Align(ADRASTEAI_MQTT_QUEUE_RECORD_BUFFER_SIZE) > flashP->sectorSize)
+    {
+        AdrasteaI_MQTTQueue_flashP = NULL;
+        return AdrasteaI_EndCommand(false);
+    }
+
+    memset(&AdrasteaI_MQTTQueue_statistics, 0, sizeof(AdrasteaI_MQTTQueue_statistics));
+    AdrasteaI_MQTTQueue_nextSequence = 1;
+    AdrasteaI_MQTTQueue_ackedSequence = 0;
+    AdrasteaI_MQTTQueue_inFlightCount = 0;
+    AdrasteaI_MQTTQueue_deliveredCount = 0;
+    AdrasteaI_MQTTQueue_retryPending = false;
+
+    AdrasteaI_MQTTQueue_Mount();
+
+    if (!AdrasteaI_MQTTQueue_sectors[AdrasteaI_MQTTQueue_headSector].valid)
+    {
+        /* Empty flash: Start the log in the first sector */
+        AdrasteaI_MQTTQueue_headSector = AdrasteaI_MQTTQueue_sectorCount - 1;
+        if (!AdrasteaI_MQTTQueue_OpenNextSector())
+        {
+            AdrasteaI_MQTTQueue_flashP = NULL;
+            return AdrasteaI_EndCommand(false);
+        }
+        AdrasteaI_MQTTQueue_readPosition.sector = AdrasteaI_MQTTQueue_headSector;
+        AdrasteaI_MQTTQueue_readPosition.offset = AdrasteaI_MQTTQueue_headOffset;
+    }
+
+    WE_LOG_INFO(ATMQTT, "Queue mounted, %lu messages pending", (unsigned long)AdrasteaI_MQTTQueue_statistics.pending);
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Appends a message to the queue (without trying to publish it first).
+ *
+ * @param[in] connID MQTT Connection. See AdrasteaI_ATMQTT_Conn_ID_t.
+ * @param[in] qos Quality of Service.
+ * @param[in] retain Whether or not the message will be retained by the broker.
+ * @param[in] topicName MQTT Topic Name.
+ * @param[in] payload Payload to be published to topic.
+ * @param[in] payloadSize Size of the payload in bytes (max. ADRASTEAI_MQTT_QUEUE_MAX_PAYLOAD_SIZE).
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTQueue_Enqueue(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, const uint8_t* payload, uint16_t payloadSize)
+{
+    if ((topicName == NULL) || ((payload == NULL) && (payloadSize > 0)) || (payloadSize > ADRASTEAI_MQTT_QUEUE_MAX_PAYLOAD_SIZE) || (connID < 0) || (connID >= AdrasteaI_ATMQTT_Conn_ID_NumberOfValues))
+    {
+        return false;
+    }
+
+    size_t topicLength = strnlen(topicName, sizeof(AdrasteaI_ATMQTT_Topic_Name_t));
+    if (topicLength > ADRASTEAI_MQTT_QUEUE_MAX_TOPIC_LENGTH)
+    {
+        return false;
+    }
+
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    if (AdrasteaI_MQTTQueue_flashP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    uint32_t length = ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH + topicLength + payloadSize;
+    if (!AdrasteaI_MQTTQueue_Reserve(length))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    uint8_t* record = AdrasteaI_MQTTQueue_buffer;
+    memcpy(record + ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH, topicName, topicLength);
+    if (payloadSize > 0)
+    {
+        memcpy(record + ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH + topicLength, payload, payloadSize);
+    }
+
+    uint32_t sequence = AdrasteaI_MQTTQueue_nextSequence;
+    record[0] = ADRASTEAI_MQTT_QUEUE_RECORD_MESSAGE;
+    record[1] = (uint8_t)((connID & 0x07) | ((qos & 0x03) << 3) | ((retain & 0x01) << 5));
+    record[2] = (uint8_t)topicLength;
+    record[3] = 0xFF;
+    AdrasteaI_MQTTQueue_PutUint32(record + 4, sequence);
+    AdrasteaI_MQTTQueue_PutUint16(record + 8, payloadSize);
+    AdrasteaI_MQTTQueue_PutUint16(record + 10, AdrasteaI_MQTTQueue_CRC(record + ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH, topicLength + payloadSize, 0xFFFF));
+    AdrasteaI_MQTTQueue_PutUint16(record + 12, 0xFFFF);
+    AdrasteaI_MQTTQueue_PutUint16(record + 14, AdrasteaI_MQTTQueue_CRC(record, 14, 0xFFFF));
+
+    if (!AdrasteaI_MQTTQueue_ProgramRecord(length))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    AdrasteaI_MQTTQueue_nextSequence++;
+    AdrasteaI_MQTTQueue_sectors[AdrasteaI_MQTTQueue_headSector].maxMessageSequence = sequence;
+    AdrasteaI_MQTTQueue_statistics.queued++;
+    AdrasteaI_MQTTQueue_statistics.pending++;
+
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Records the outcome of a queued message. Is called by AdrasteaI_MQTTPublisher_Process().
+ */
+static void AdrasteaI_MQTTQueue_PublisherCallback(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_Message_ID_t msgID, AdrasteaI_MQTTPublisher_Result_t result, void* contextP)
+{
+    uint32_t sequence = (uint32_t)(uintptr_t)contextP;
+
+    UNUSED(connID);
+    UNUSED(msgID);
+
+    for (uint8_t i = 0; i < AdrasteaI_MQTTQueue_inFlightCount; i++)
+    {
+        AdrasteaI_MQTTQueue_InFlight_t* inFlightP = &AdrasteaI_MQTTQueue_inFlight[(AdrasteaI_MQTTQueue_inFlightStart + i) % ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE];
+        if (inFlightP->sequence == sequence)
+        {
+            inFlightP->state = (result == AdrasteaI_MQTTPublisher_Result_Success) ? AdrasteaI_MQTTQueue_InFlight_State_Delivered : AdrasteaI_MQTTQueue_InFlight_State_Failed;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Advances the acknowledged sequence number over the messages delivered in order. If a message has failed,
+ * draining is restarted from this message after ADRASTEAI_MQTT_QUEUE_RETRY_INTERVAL_MS.
+ */
+static void AdrasteaI_MQTTQueue_CompleteInFlight(void)
+{
+    while (AdrasteaI_MQTTQueue_inFlightCount > 0)
+    {
+        AdrasteaI_MQTTQueue_InFlight_t* inFlightP = &AdrasteaI_MQTTQueue_inFlight[AdrasteaI_MQTTQueue_inFlightStart];
+
+        if (inFlightP->state == AdrasteaI_MQTTQueue_InFlight_State_Sent)
+        {
+            return;
+        }
+
+        if (inFlightP->state == AdrasteaI_MQTTQueue_InFlight_State_Failed)
+        {
+            WE_LOG_WARNING(ATMQTT, "Queued message %lu not delivered", (unsigned long)inFlightP->sequence);
+
+            /* Publish this message and the following ones again, unless their sector has been erased in the meantime.
+             * The following messages that have been delivered already are skipped (see AdrasteaI_MQTTQueue_SendNext()). */
+            bool restart = false;
+            AdrasteaI_MQTTQueue_deliveredCount = 0;
+            for (uint8_t i = 0; i < AdrasteaI_MQTTQueue_inFlightCount; i++)
+            {
+                AdrasteaI_MQTTQueue_InFlight_t* resendP = &AdrasteaI_MQTTQueue_inFlight[(AdrasteaI_MQTTQueue_inFlightStart + i) % ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE];
+                if (!AdrasteaI_MQTTQueue_sectors[resendP->position.sector].valid || (AdrasteaI_MQTTQueue_sectors[resendP->position.sector].sequence != resendP->sectorSequence))
+                {
+                    continue;
+                }
+
+                if (!restart)
+                {
+                    AdrasteaI_MQTTQueue_readPosition = resendP->position;
+                    restart = true;
+                }
+
+                if (resendP->state == AdrasteaI_MQTTQueue_InFlight_State_Delivered)
+                {
+                    AdrasteaI_MQTTQueue_deliveredSequences[AdrasteaI_MQTTQueue_deliveredCount++] = resendP->sequence;
+                }
+                else
+                {
+                    AdrasteaI_MQTTQueue_statistics.republished++;
+                }
+            }
+            AdrasteaI_MQTTQueue_inFlightCount = 0;
+            AdrasteaI_MQTTQueue_retryPending = true;
+            AdrasteaI_MQTTQueue_retryTime = WE_GetTick();
+            return;
+        }
+
+        if (inFlightP->sequence > AdrasteaI_MQTTQueue_ackedSequence)
+        {
+            AdrasteaI_MQTTQueue_ackedSequence = inFlightP->sequence;
+
+            /* Messages of an erased sector have been counted as dropped already */
+            AdrasteaI_MQTTQueue_Sector_t* sectorP = &AdrasteaI_MQTTQueue_sectors[inFlightP->position.sector];
+            if (sectorP->valid && (sectorP->sequence == inFlightP->sectorSequence))
+            {
+                AdrasteaI_MQTTQueue_statistics.delivered++;
+                AdrasteaI_MQTTQueue_statistics.pending--;
+            }
+        }
+        AdrasteaI_MQTTQueue_inFlightStart = (AdrasteaI_MQTTQueue_inFlightStart + 1) % ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE;
+        AdrasteaI_MQTTQueue_inFlightCount--;
+    }
+}
+
+/**
+ * @brief Hands the next queued message to the publisher.
+ *
+ * @return true if a message has been sent, false if there is nothing to send or the message can't be sent right now
+ */
+static bool AdrasteaI_MQTTQueue_SendNext(void)
+{
+    AdrasteaI_MQTTQueue_Position_t position = AdrasteaI_MQTTQueue_readPosition;
+    AdrasteaI_MQTTQueue_Record_t record;
+    uint8_t* data = AdrasteaI_MQTTQueue_buffer;
+
+    while (1)
+    {
+        if (!AdrasteaI_MQTTQueue_ReadRecord(&position, &record))
+        {
+            AdrasteaI_MQTTQueue_readPosition = position;
+            return false;
+        }
+
+        if ((record.type == ADRASTEAI_MQTT_QUEUE_RECORD_MESSAGE) && (record.sequence > AdrasteaI_MQTTQueue_ackedSequence))
+        {
+            uint32_t length = record.topicLength + record.payloadLength;
+            if ((length <= ADRASTEAI_MQTT_QUEUE_RECORD_BUFFER_SIZE) && AdrasteaI_MQTTQueue_flashP->flashRead(AdrasteaI_MQTTQueue_SectorAddress(position.sector) + position.offset + ADRASTEAI_MQTT_QUEUE_RECORD_HEADER_LENGTH, data, length) && (record.payloadCRC == AdrasteaI_MQTTQueue_CRC(data, length, 0xFFFF)))
+            {
+                break;
+            }
+
+            WE_LOG_WARNING(ATMQTT, "Queued message %lu corrupted", (unsigned long)record.sequence);
+            AdrasteaI_MQTTQueue_statistics.dropped++;
+            AdrasteaI_MQTTQueue_statistics.pending--;
+        }
+
+        position.offset += record.size;
+        AdrasteaI_MQTTQueue_readPosition = position;
+    }
+
+    AdrasteaI_MQTTQueue_InFlight_t* inFlightP = &AdrasteaI_MQTTQueue_inFlight[(AdrasteaI_MQTTQueue_inFlightStart + AdrasteaI_MQTTQueue_inFlightCount) % ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE];
+    inFlightP->sequence = record.sequence;
+    inFlightP->sectorSequence = AdrasteaI_MQTTQueue_sectors[position.sector].sequence;
+    inFlightP->position = position;
+
+    for (uint8_t i = 0; i < AdrasteaI_MQTTQueue_deliveredCount; i++)
+    {
+        if (AdrasteaI_MQTTQueue_deliveredSequences[i] == record.sequence)
+        {
+            /* Delivered before draining has been restarted, only the acknowledgement is still to be completed in order */
+            AdrasteaI_MQTTQueue_deliveredSequences[i] = AdrasteaI_MQTTQueue_deliveredSequences[--AdrasteaI_MQTTQueue_deliveredCount];
+            inFlightP->state = AdrasteaI_MQTTQueue_InFlight_State_Delivered;
+            AdrasteaI_MQTTQueue_inFlightCount++;
+
+            position.offset += record.size;
+            AdrasteaI_MQTTQueue_readPosition = position;
+            return true;
+        }
+    }
+
+    AdrasteaI_ATMQTT_Conn_ID_t connID = (AdrasteaI_ATMQTT_Conn_ID_t)(record.flags & 0x07);
+    if ((connID >= AdrasteaI_ATMQTT_Conn_ID_NumberOfValues) || !AdrasteaI_MQTTQueue_connected[connID])
+    {
+        /* Messages are delivered in order, so wait for the connection of this message */
+        return false;
+    }
+
+    /* The topic is stored without terminating zero */
+    AdrasteaI_ATMQTT_Topic_Name_t topicName;
+    memcpy(topicName, data, record.topicLength);
+    topicName[record.topicLength] = '\0';
+
+    inFlightP->state = AdrasteaI_MQTTQueue_InFlight_State_Sent;
+    AdrasteaI_MQTTQueue_inFlightCount++;
+
+    if (!AdrasteaI_MQTTPublisher_PublishBinary(connID, (AdrasteaI_ATMQTT_QoS_t)((record.flags >> 3) & 0x03), (AdrasteaI_ATMQTT_Retain_t)((record.flags >> 5) & 0x01), topicName, data + record.topicLength, record.payloadLength, 0, AdrasteaI_MQTTQueue_PublisherCallback,
+                                               (void*)(uintptr_t)record.sequence, NULL))
+    {
+        /* Not handed to the publisher, the callback won't be called */
+        AdrasteaI_MQTTQueue_inFlightCount--;
+        AdrasteaI_MQTTQueue_retryPending = true;
+        AdrasteaI_MQTTQueue_retryTime = WE_GetTick();
+        return false;
+    }
+
+    position.offset += record.size;
+    AdrasteaI_MQTTQueue_readPosition = position;
+    return true;
+}
+
+/**
+ * @brief Hands queued messages to the publisher as long as its window has room, unless draining waits for a retry.
+ */
+static void AdrasteaI_MQTTQueue_Drain(void)
+{
+    while (!AdrasteaI_MQTTQueue_retryPending && (AdrasteaI_MQTTQueue_statistics.pending > AdrasteaI_MQTTQueue_inFlightCount) && (AdrasteaI_MQTTQueue_inFlightCount < ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE))
+    {
+        /* The window may be shared with other users of the publisher */
+        AdrasteaI_MQTTPublisher_Statistics_t publisherStatistics;
+        AdrasteaI_MQTTPublisher_GetStatistics(&publisherStatistics);
+        if ((publisherStatistics.inFlight >= ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE) || !AdrasteaI_MQTTQueue_SendNext())
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Appends a message to the queue and hands it to the publisher right away if the connection is established.
+ *
+ * Every message is written to the log before it is published, so it is published again if its acknowledgement
+ * (QoS 1 and 2) fails, times out or is lost with the connection. Messages are published in order, behind any
+ * older queued messages.
+ *
+ * @param[in] connID MQTT Connection. See AdrasteaI_ATMQTT_Conn_ID_t.
+ * @param[in] qos Quality of Service.
+ * @param[in] retain Whether or not the message will be retained by the broker.
+ * @param[in] topicName MQTT Topic Name.
+ * @param[in] payload Payload to be published to topic.
+ * @param[in] payloadSize Size of the payload in bytes (max. ADRASTEAI_MQTT_QUEUE_MAX_PAYLOAD_SIZE).
+ *
+ * @return true if the message has been queued, false otherwise
+ */
+bool AdrasteaI_MQTTQueue_Publish(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, const uint8_t* payload, uint16_t payloadSize)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    if (!AdrasteaI_MQTTQueue_Enqueue(connID, qos, retain, topicName, payload, payloadSize))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    AdrasteaI_MQTTQueue_Drain();
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Drains the queue while the connection is established and persists the delivery progress.
+ *
+ * Keeps the window of the publisher filled with queued messages, i.e. the queue is drained at the rate of the
+ * pipelined publisher. Should be called regularly by the application.
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTQueue_Process(void)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    if (AdrasteaI_MQTTQueue_flashP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    /* Calls AdrasteaI_MQTTQueue_PublisherCallback() for completed messages */
+    AdrasteaI_MQTTPublisher_Process();
+    AdrasteaI_MQTTQueue_CompleteInFlight();
+
+    if (AdrasteaI_MQTTQueue_drainRequested)
+    {
+        /* Connection (re-)established, drain right away */
+        AdrasteaI_MQTTQueue_drainRequested = false;
+        AdrasteaI_MQTTQueue_retryPending = false;
+    }
+    else if (AdrasteaI_MQTTQueue_retryPending && (WE_GetTick() - AdrasteaI_MQTTQueue_retryTime >= ADRASTEAI_MQTT_QUEUE_RETRY_INTERVAL_MS))
+    {
+        AdrasteaI_MQTTQueue_retryPending = false;
+    }
+
+    AdrasteaI_MQTTQueue_Drain();
+
+    return AdrasteaI_EndCommand(AdrasteaI_MQTTQueue_PersistAck());
+}
+
+/**
+ * @brief Sets the connection state (normally tracked using the CONCONF, DISCONF and CONFAIL notifications).
+ *
+ * @param[in] connID MQTT Connection
+ * @param[in] connected true if the connection has been established
+ */
+void AdrasteaI_MQTTQueue_SetConnected(AdrasteaI_ATMQTT_Conn_ID_t connID, bool connected)
+{
+    if ((connID >= 0) && (connID < AdrasteaI_ATMQTT_Conn_ID_NumberOfValues))
+    {
+        AdrasteaI_MQTTQueue_connected[connID] = connected;
+    }
+}
+
+/**
+ * @brief Returns the queue statistics.
+ *
+ * @param[out] statisticsP Statistics
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTQueue_GetStatistics(AdrasteaI_MQTTQueue_Statistics_t* statisticsP)
+{
+    if ((statisticsP == NULL) || !AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    *statisticsP = AdrasteaI_MQTTQueue_statistics;
+
+    if (AdrasteaI_MQTTQueue_flashP != NULL)
+    {
+        uint32_t sectorSize = AdrasteaI_MQTTQueue_flashP->sectorSize;
+        uint8_t tail = AdrasteaI_MQTTQueue_readPosition.sector;
+        uint8_t usedSectors = (uint8_t)((AdrasteaI_MQTTQueue_headSector + AdrasteaI_MQTTQueue_sectorCount - tail) % AdrasteaI_MQTTQueue_sectorCount);
+
+        statisticsP->capacityBytes = AdrasteaI_MQTTQueue_sectorCount * sectorSize;
+        statisticsP->usedBytes = usedSectors * sectorSize + AdrasteaI_MQTTQueue_headOffset - AdrasteaI_MQTTQueue_readPosition.offset;
+    }
+
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Tracks the connection state using the CONCONF, DISCONF and CONFAIL notifications. Is called for each
+ * notification received from the module.
+ *
+ * @param[in] event Event type, parsed once by the driver for all URC handlers
+ * @param[in] pArguments Arguments following the event name (not modified, the line is passed on to the event callback afterwards)
+ */
+void AdrasteaI_MQTTQueue_HandleURC(AdrasteaI_ATEvent_t event, char* pArguments)
+{
+    ATCommand_Arguments_t arguments;
+    /* The parser sets the low byte of the enumeration fields only */
+    AdrasteaI_ATMQTT_Connection_Result_t result;
+    memset(&result, 0, sizeof(result));
+    switch (event)
+    {
+        case AdrasteaI_ATEvent_MQTT_Connection_Confirmation:
+            if (AdrasteaI_ATMQTT_ParseConnectionConfirmationEvent(pArguments, &result))
+            {
+                bool connected = (result.resultCode == AdrasteaI_ATMQTT_Event_Result_Code_Success);
+                AdrasteaI_MQTTQueue_SetConnected(result.connID, connected);
+                if (connected)
+                {
+                    AdrasteaI_MQTTQueue_drainRequested = true;
+                }
+            }
+            break;
+
+        case AdrasteaI_ATEvent_MQTT_Disconnection_Confirmation:
+        case AdrasteaI_ATEvent_MQTT_Connection_Failure:
+            if (ATCommand_TokenizeArguments(pArguments, &arguments) && ATCommand_GetArgumentInt(&arguments, 0, &result.connID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED))
+            {
+                AdrasteaI_MQTTQueue_SetConnected(result.connID, false);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+#endif /* ADRASTEAI_MQTT_QUEUE */
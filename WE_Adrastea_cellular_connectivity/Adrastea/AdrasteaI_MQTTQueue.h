@@ -0,0 +1,114 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Store-and-forward queue for MQTT publications in external flash (enabled by defining ADRASTEAI_MQTT_QUEUE).
+ *
+ * Publications made with AdrasteaI_MQTTQueue_Publish() are appended to a log in flash first, so they are not lost
+ * if the connection is down or the delivery fails. While the connection is established, the queued messages are
+ * published in order through the pipelined publisher (see AdrasteaI_MQTTPublisher.h), right away by
+ * AdrasteaI_MQTTQueue_Publish() and by AdrasteaI_MQTTQueue_Process(). After the CONCONF notification reports that
+ * the connection has been (re-)established, AdrasteaI_MQTTQueue_Process() drains the messages queued meanwhile.
+ *
+ * The log occupies a number of consecutive flash sectors, which are written round-robin, so all sectors are
+ * erased equally often (wear levelling). Each record is programmed exactly once, i.e. no flash memory is ever
+ * overwritten without erasing it first. Delivered messages are not marked in place; instead, acknowledgement
+ * records holding the sequence number of the last delivered message are appended to the log. If the log is full,
+ * the sector holding the oldest messages is erased and these messages are dropped.
+ *
+ * Messages are delivered at least once: Messages that were in flight when the connection or the power was lost
+ * are published again.
+ *
+ * The flash is accessed via WE_Flash_t, i.e. either the external QSPI flash (WE_QSPIFlash_*) or a file-backed
+ * stand-in on a host (see file_flash.h).
+ */
+
+#ifndef ADRASTEAI_MQTTQUEUE_H_INCLUDED
+#define ADRASTEAI_MQTTQUEUE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ATEvent.h"
+#include "ATMQTT.h"
+#include "global_types.h"
+
+#ifndef ADRASTEAI_MQTT_QUEUE_MAX_PAYLOAD_SIZE
+/**
+ * @brief Max. payload size of a queued message (bytes). Determines the size of the record buffer in RAM.
+ */
+#define ADRASTEAI_MQTT_QUEUE_MAX_PAYLOAD_SIZE 1024
+#endif
+
+#ifndef ADRASTEAI_MQTT_QUEUE_MAX_SECTORS
+/**
+ * @brief Max. number of flash sectors used by the queue.
+ */
+#define ADRASTEAI_MQTT_QUEUE_MAX_SECTORS 16
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief Queue statistics.
+ * @see AdrasteaI_MQTTQueue_GetStatistics()
+ */
+    typedef struct AdrasteaI_MQTTQueue_Statistics_t
+    {
+        uint32_t pending;            /**< Messages in the queue, not delivered yet */
+        uint32_t queued;             /**< Messages appended to the queue since initialization */
+        uint32_t delivered;          /**< Queued messages that have been delivered */
+        uint32_t dropped;            /**< Messages dropped because the queue was full or the record was corrupted */
+        uint32_t republished;        /**< Queued messages published again after a failure */
+        uint32_t sectorErases;       /**< Sectors erased since initialization */
+        uint32_t maxSectorEraseCount; /**< Highest erase count of a sector (over the lifetime of the flash) */
+        uint32_t minSectorEraseCount; /**< Lowest erase count of a sector (over the lifetime of the flash) */
+        uint32_t usedBytes;          /**< Bytes used in the log (including delivered messages not erased yet) */
+        uint32_t capacityBytes;      /**< Size of the log */
+    } AdrasteaI_MQTTQueue_Statistics_t;
+
+    extern bool AdrasteaI_MQTTQueue_Init(const WE_Flash_t* flashP, uint32_t baseAddress, uint8_t sectorCount);
+
+    extern bool AdrasteaI_MQTTQueue_Publish(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, const uint8_t* payload, uint16_t payloadSize);
+
+    extern bool AdrasteaI_MQTTQueue_Enqueue(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, const uint8_t* payload, uint16_t payloadSize);
+
+    extern bool AdrasteaI_MQTTQueue_Process(void);
+
+    extern void AdrasteaI_MQTTQueue_SetConnected(AdrasteaI_ATMQTT_Conn_ID_t connID, bool connected);
+
+    extern bool AdrasteaI_MQTTQueue_GetStatistics(AdrasteaI_MQTTQueue_Statistics_t* statisticsP);
+
+    extern void AdrasteaI_MQTTQueue_HandleURC(AdrasteaI_ATEvent_t event, char* pArguments);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADRASTEAI_MQTTQUEUE_H_INCLUDED */
@@ -0,0 +1,624 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Routing of received MQTT publications to handlers by topic filter (enabled by defining ADRASTEAI_MQTT_ROUTER).
+ */
+
+#include <string.h>
+
+#include "AdrasteaI_MQTTRouter.h"
+#include "global.h"
+
+#ifdef ADRASTEAI_MQTT_ROUTER
+
+#if (ADRASTEAI_MQTT_ROUTER_MAX_NODES > 254) || (ADRASTEAI_MQTT_ROUTER_MAX_ROUTES > 254)
+#error "ADRASTEAI_MQTT_ROUTER_MAX_NODES and ADRASTEAI_MQTT_ROUTER_MAX_ROUTES must not exceed 254"
+#endif
+
+/**
+ * @brief Size of the hash table holding the (non-wildcard) children of all nodes.
+ */
+#define ADRASTEAI_MQTT_ROUTER_HASH_SIZE (2 * ADRASTEAI_MQTT_ROUTER_MAX_NODES)
+
+/**
+ * @brief Node/route index: none, and hash table entry: empty.
+ */
+#define ADRASTEAI_MQTT_ROUTER_NONE 0xFF
+
+/**
+ * @brief Trie node, i.e. one level of one or more topic filters. Node 0 is the root.
+ */
+typedef struct AdrasteaI_MQTTRouter_Node_t
+{
+    bool used;
+    uint8_t parent;
+    uint8_t plusChild;  /**< Child for '+' */
+    uint8_t hashChild;  /**< Child for '#' */
+    uint8_t children;   /**< Number of children (including wildcard children) */
+    uint8_t firstRoute; /**< Routes ending at this node */
+    uint8_t levelLength;
+    uint16_t levelOffset; /**< Level name in the string pool */
+} AdrasteaI_MQTTRouter_Node_t;
+
+/**
+ * @brief Route, i.e. handler for a topic filter.
+ */
+typedef struct AdrasteaI_MQTTRouter_Route_t
+{
+    AdrasteaI_MQTTRouter_Handler_t handler; /**< NULL if unused */
+    void* contextP;
+    int8_t connID; /**< AdrasteaI_ATMQTT_Conn_ID_Invalid for all connections */
+    uint8_t node;
+    uint8_t next; /**< Next route ending at the same node */
+} AdrasteaI_MQTTRouter_Route_t;
+
+static AdrasteaI_MQTTRouter_Node_t AdrasteaI_MQTTRouter_nodes[ADRASTEAI_MQTT_ROUTER_MAX_NODES];
+static AdrasteaI_MQTTRouter_Route_t AdrasteaI_MQTTRouter_routes[ADRASTEAI_MQTT_ROUTER_MAX_ROUTES];
+static uint8_t AdrasteaI_MQTTRouter_hashTable[ADRASTEAI_MQTT_ROUTER_HASH_SIZE];
+static char AdrasteaI_MQTTRouter_stringPool[ADRASTEAI_MQTT_ROUTER_STRING_POOL_SIZE];
+static uint16_t AdrasteaI_MQTTRouter_stringPoolUsed = 0;
+static bool AdrasteaI_MQTTRouter_initialized = false;
+
+static void AdrasteaI_MQTTRouter_Init(void)
+{
+    memset(AdrasteaI_MQTTRouter_nodes, 0, sizeof(AdrasteaI_MQTTRouter_nodes));
+    memset(AdrasteaI_MQTTRouter_routes, 0, sizeof(AdrasteaI_MQTTRouter_routes));
+    memset(AdrasteaI_MQTTRouter_hashTable, ADRASTEAI_MQTT_ROUTER_NONE, sizeof(AdrasteaI_MQTTRouter_hashTable));
+    AdrasteaI_MQTTRouter_stringPoolUsed = 0;
+
+    AdrasteaI_MQTTRouter_Node_t* rootP = &AdrasteaI_MQTTRouter_nodes[0];
+    rootP->used = true;
+    rootP->parent = ADRASTEAI_MQTT_ROUTER_NONE;
+    rootP->plusChild = ADRASTEAI_MQTT_ROUTER_NONE;
+    rootP->hashChild = ADRASTEAI_MQTT_ROUTER_NONE;
+    rootP->firstRoute = ADRASTEAI_MQTT_ROUTER_NONE;
+
+    AdrasteaI_MQTTRouter_initialized = true;
+}
+
+static uint16_t AdrasteaI_MQTTRouter_Hash(uint8_t parent, const char* level, uint8_t length)
+{
+    /* FNV-1a */
+    uint32_t hash = 2166136261u ^ parent;
+    for (uint8_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ (uint8_t)level[i]) * 16777619u;
+    }
+    return (uint16_t)((hash ^ (hash >> 16)) % ADRASTEAI_MQTT_ROUTER_HASH_SIZE);
+}
+
+/**
+ * @brief Returns the position of the child with the supplied level name in the hash table.
+ *
+ * @return Position, or ADRASTEAI_MQTT_ROUTER_HASH_SIZE if not found
+ */
+static uint16_t AdrasteaI_MQTTRouter_FindChildSlot(uint8_t parent, const char* level, uint8_t length)
+{
+    uint16_t slot = AdrasteaI_MQTTRouter_Hash(parent, level, length);
+
+    for (uint16_t i = 0; i < ADRASTEAI_MQTT_ROUTER_HASH_SIZE; i++)
+    {
+        uint8_t node = AdrasteaI_MQTTRouter_hashTable[slot];
+        if (node == ADRASTEAI_MQTT_ROUTER_NONE)
+        {
+            break;
+        }
+
+        const AdrasteaI_MQTTRouter_Node_t* nodeP = &AdrasteaI_MQTTRouter_nodes[node];
+        if ((nodeP->parent == parent) && (nodeP->levelLength == length) && (0 == memcmp(&AdrasteaI_MQTTRouter_stringPool[nodeP->levelOffset], level, length)))
+        {
+            return slot;
+        }
+
+        slot = (uint16_t)((slot + 1) % ADRASTEAI_MQTT_ROUTER_HASH_SIZE);
+    }
+
+    return ADRASTEAI_MQTT_ROUTER_HASH_SIZE;
+}
+
+/**
+ * @brief Removes the entry at the supplied position from the hash table.
+ *
+ * Following entries of the probe sequence are shifted back into the gap (backward shift deletion), so no deleted
+ * markers are left behind and lookups stop at the first empty slot regardless of how many routes have been removed.
+ */
+static void AdrasteaI_MQTTRouter_RemoveSlot(uint16_t slot)
+{
+    uint16_t gap = slot;
+    uint16_t next = (uint16_t)((slot + 1) % ADRASTEAI_MQTT_ROUTER_HASH_SIZE);
+
+    while (AdrasteaI_MQTTRouter_hashTable[next] != ADRASTEAI_MQTT_ROUTER_NONE)
+    {
+        const AdrasteaI_MQTTRouter_Node_t* nodeP = &AdrasteaI_MQTTRouter_nodes[AdrasteaI_MQTTRouter_hashTable[next]];
+        uint16_t home = AdrasteaI_MQTTRouter_Hash(nodeP->parent, &AdrasteaI_MQTTRouter_stringPool[nodeP->levelOffset], nodeP->levelLength);
+
+        /* The entry may be moved if the gap is not in front of its home slot */
+        if ((next + ADRASTEAI_MQTT_ROUTER_HASH_SIZE - home) % ADRASTEAI_MQTT_ROUTER_HASH_SIZE >= (next + ADRASTEAI_MQTT_ROUTER_HASH_SIZE - gap) % ADRASTEAI_MQTT_ROUTER_HASH_SIZE)
+        {
+            AdrasteaI_MQTTRouter_hashTable[gap] = AdrasteaI_MQTTRouter_hashTable[next];
+            gap = next;
+        }
+        next = (uint16_t)((next + 1) % ADRASTEAI_MQTT_ROUTER_HASH_SIZE);
+    }
+
+    AdrasteaI_MQTTRouter_hashTable[gap] = ADRASTEAI_MQTT_ROUTER_NONE;
+}
+
+static uint8_t AdrasteaI_MQTTRouter_FindChild(uint8_t parent, const char* level, uint8_t length)
+{
+    uint16_t slot = AdrasteaI_MQTTRouter_FindChildSlot(parent, level, length);
+    return (slot < ADRASTEAI_MQTT_ROUTER_HASH_SIZE) ? AdrasteaI_MQTTRouter_hashTable[slot] : ADRASTEAI_MQTT_ROUTER_NONE;
+}
+
+/**
+ * @brief Returns the child of a node for a level of a topic filter, adding it if it doesn't exist.
+ *
+ * @return Child, or ADRASTEAI_MQTT_ROUTER_NONE if there is no space left
+ */
+static uint8_t AdrasteaI_MQTTRouter_GetOrAddChild(uint8_t parent, const char* level, uint8_t length)
+{
+    AdrasteaI_MQTTRouter_Node_t* parentP = &AdrasteaI_MQTTRouter_nodes[parent];
+    bool plus = (length == 1) && (level[0] == '+');
+    bool hash = (length == 1) && (level[0] == '#');
+
+    uint8_t child = plus ? parentP->plusChild : (hash ? parentP->hashChild : AdrasteaI_MQTTRouter_FindChild(parent, level, length));
+    if (child != ADRASTEAI_MQTT_ROUTER_NONE)
+    {
+        return child;
+    }
+
+    for (child = 1; child < ADRASTEAI_MQTT_ROUTER_MAX_NODES; child++)
+    {
+        if (!AdrasteaI_MQTTRouter_nodes[child].used)
+        {
+            break;
+        }
+    }
+
+    if (child >= ADRASTEAI_MQTT_ROUTER_MAX_NODES)
+    {
+        return ADRASTEAI_MQTT_ROUTER_NONE;
+    }
+
+    uint16_t slot = ADRASTEAI_MQTT_ROUTER_HASH_SIZE;
+    if (!plus && !hash)
+    {
+        if (length > ADRASTEAI_MQTT_ROUTER_STRING_POOL_SIZE - AdrasteaI_MQTTRouter_stringPoolUsed)
+        {
+            return ADRASTEAI_MQTT_ROUTER_NONE;
+        }
+
+        /* There is always a free slot, as the table has twice as many slots as there are nodes */
+        slot = AdrasteaI_MQTTRouter_Hash(parent, level, length);
+        while (AdrasteaI_MQTTRouter_hashTable[slot] != ADRASTEAI_MQTT_ROUTER_NONE)
+        {
+            slot = (uint16_t)((slot + 1) % ADRASTEAI_MQTT_ROUTER_HASH_SIZE);
+        }
+    }
+
+    AdrasteaI_MQTTRouter_Node_t* childP = &AdrasteaI_MQTTRouter_nodes[child];
+    childP->used = true;
+    childP->parent = parent;
+    childP->plusChild = ADRASTEAI_MQTT_ROUTER_NONE;
+    childP->hashChild = ADRASTEAI_MQTT_ROUTER_NONE;
+    childP->children = 0;
+    childP->firstRoute = ADRASTEAI_MQTT_ROUTER_NONE;
+    childP->levelOffset = AdrasteaI_MQTTRouter_stringPoolUsed;
+    childP->levelLength = 0;
+
+    if (plus)
+    {
+        parentP->plusChild = child;
+    }
+    else if (hash)
+    {
+        parentP->hashChild = child;
+    }
+    else
+    {
+        memcpy(&AdrasteaI_MQTTRouter_stringPool[AdrasteaI_MQTTRouter_stringPoolUsed], level, length);
+        AdrasteaI_MQTTRouter_stringPoolUsed += length;
+        childP->levelLength = length;
+        AdrasteaI_MQTTRouter_hashTable[slot] = child;
+    }
+    parentP->children++;
+
+    return child;
+}
+
+/**
+ * @brief Removes a node and its ancestors as long as they have neither routes nor children.
+ */
+static void AdrasteaI_MQTTRouter_Prune(uint8_t node)
+{
+    while (node != 0)
+    {
+        AdrasteaI_MQTTRouter_Node_t* nodeP = &AdrasteaI_MQTTRouter_nodes[node];
+        if ((nodeP->children > 0) || (nodeP->firstRoute != ADRASTEAI_MQTT_ROUTER_NONE))
+        {
+            return;
+        }
+
+        AdrasteaI_MQTTRouter_Node_t* parentP = &AdrasteaI_MQTTRouter_nodes[nodeP->parent];
+        if (parentP->plusChild == node)
+        {
+            parentP->plusChild = ADRASTEAI_MQTT_ROUTER_NONE;
+        }
+        else if (parentP->hashChild == node)
+        {
+            parentP->hashChild = ADRASTEAI_MQTT_ROUTER_NONE;
+        }
+        else
+        {
+            uint16_t slot = AdrasteaI_MQTTRouter_FindChildSlot(nodeP->parent, &AdrasteaI_MQTTRouter_stringPool[nodeP->levelOffset], nodeP->levelLength);
+            if (slot < ADRASTEAI_MQTT_ROUTER_HASH_SIZE)
+            {
+                AdrasteaI_MQTTRouter_RemoveSlot(slot);
+            }
+
+            /* Compact the string pool */
+            uint16_t end = nodeP->levelOffset + nodeP->levelLength;
+            memmove(&AdrasteaI_MQTTRouter_stringPool[nodeP->levelOffset], &AdrasteaI_MQTTRouter_stringPool[end], AdrasteaI_MQTTRouter_stringPoolUsed - end);
+            AdrasteaI_MQTTRouter_stringPoolUsed -= nodeP->levelLength;
+            for (uint8_t i = 1; i < ADRASTEAI_MQTT_ROUTER_MAX_NODES; i++)
+            {
+                if (AdrasteaI_MQTTRouter_nodes[i].used && (AdrasteaI_MQTTRouter_nodes[i].levelOffset >= end))
+                {
+                    AdrasteaI_MQTTRouter_nodes[i].levelOffset -= nodeP->levelLength;
+                }
+            }
+        }
+
+        parentP->children--;
+        nodeP->used = false;
+        node = nodeP->parent;
+    }
+}
+
+/**
+ * @brief Checks a topic filter: '+' and '#' must occupy a whole level, '#' must be the last level.
+ */
+static bool AdrasteaI_MQTTRouter_IsValidFilter(const char* topicFilter)
+{
+    size_t length = strlen(topicFilter);
+    if ((length == 0) || (length >= sizeof(AdrasteaI_ATMQTT_Topic_Name_t)))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < length; i++)
+    {
+        char c = topicFilter[i];
+        if ((c != '+') && (c != '#'))
+        {
+            continue;
+        }
+
+        bool levelStart = (i == 0) || (topicFilter[i - 1] == '/');
+        bool levelEnd = (i + 1 == length) || (topicFilter[i + 1] == '/');
+        if (!levelStart || !levelEnd || ((c == '#') && (i + 1 != length)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Adds a route for a topic filter.
+ *
+ * If a route with the same connection, topic filter and handler exists already, its context is replaced.
+ *
+ * @param[in] connID MQTT Connection, AdrasteaI_ATMQTT_Conn_ID_Invalid for all connections.
+ * @param[in] topicFilter Topic filter, may contain the wildcards '+' and '#'
+ * @param[in] handler Called for matching publications
+ * @param[in] contextP Passed to the handler
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTRouter_AddRoute(AdrasteaI_ATMQTT_Conn_ID_t connID, const char* topicFilter, AdrasteaI_MQTTRouter_Handler_t handler, void* contextP)
+{
+    if ((topicFilter == NULL) || (handler == NULL) || !AdrasteaI_MQTTRouter_IsValidFilter(topicFilter))
+    {
+        return false;
+    }
+
+    uint32_t state = WE_EnterCriticalSection();
+
+    if (!AdrasteaI_MQTTRouter_initialized)
+    {
+        AdrasteaI_MQTTRouter_Init();
+    }
+
+    uint8_t node = 0;
+    const char* level = topicFilter;
+    while (1)
+    {
+        const char* end = strchr(level, '/');
+        uint8_t length = (uint8_t)((end != NULL) ? (size_t)(end - level) : strlen(level));
+
+        uint8_t child = AdrasteaI_MQTTRouter_GetOrAddChild(node, level, length);
+        if (child == ADRASTEAI_MQTT_ROUTER_NONE)
+        {
+            AdrasteaI_MQTTRouter_Prune(node);
+            WE_ExitCriticalSection(state);
+            return false;
+        }
+        node = child;
+
+        if (end == NULL)
+        {
+            break;
+        }
+        level = end + 1;
+    }
+
+    uint8_t* linkP = &AdrasteaI_MQTTRouter_nodes[node].firstRoute;
+    while (*linkP != ADRASTEAI_MQTT_ROUTER_NONE)
+    {
+        AdrasteaI_MQTTRouter_Route_t* routeP = &AdrasteaI_MQTTRouter_routes[*linkP];
+        if ((routeP->handler == handler) && (routeP->connID == connID))
+        {
+            routeP->contextP = contextP;
+            WE_ExitCriticalSection(state);
+            return true;
+        }
+        linkP = &routeP->next;
+    }
+
+    uint8_t route;
+    for (route = 0; route < ADRASTEAI_MQTT_ROUTER_MAX_ROUTES; route++)
+    {
+        if (AdrasteaI_MQTTRouter_routes[route].handler == NULL)
+        {
+            break;
+        }
+    }
+
+    if (route >= ADRASTEAI_MQTT_ROUTER_MAX_ROUTES)
+    {
+        AdrasteaI_MQTTRouter_Prune(node);
+        WE_ExitCriticalSection(state);
+        return false;
+    }
+
+    /* Appended, so handlers are called in the order the routes have been added */
+    AdrasteaI_MQTTRouter_Route_t* routeP = &AdrasteaI_MQTTRouter_routes[route];
+    routeP->handler = handler;
+    routeP->contextP = contextP;
+    routeP->connID = (int8_t)connID;
+    routeP->node = node;
+    routeP->next = ADRASTEAI_MQTT_ROUTER_NONE;
+    *linkP = route;
+
+    WE_ExitCriticalSection(state);
+    return true;
+}
+
+/**
+ * @brief Removes a route.
+ *
+ * @param[in] connID MQTT Connection the route has been added for
+ * @param[in] topicFilter Topic filter the route has been added for
+ * @param[in] handler Handler of the route
+ *
+ * @return true if successful, false otherwise (route not found)
+ */
+bool AdrasteaI_MQTTRouter_RemoveRoute(AdrasteaI_ATMQTT_Conn_ID_t connID, const char* topicFilter, AdrasteaI_MQTTRouter_Handler_t handler)
+{
+    if ((topicFilter == NULL) || !AdrasteaI_MQTTRouter_initialized || !AdrasteaI_MQTTRouter_IsValidFilter(topicFilter))
+    {
+        return false;
+    }
+
+    uint32_t state = WE_EnterCriticalSection();
+
+    uint8_t node = 0;
+    const char* level = topicFilter;
+    while (node != ADRASTEAI_MQTT_ROUTER_NONE)
+    {
+        const char* end = strchr(level, '/');
+        uint8_t length = (uint8_t)((end != NULL) ? (size_t)(end - level) : strlen(level));
+        const AdrasteaI_MQTTRouter_Node_t* nodeP = &AdrasteaI_MQTTRouter_nodes[node];
+
+        if ((length == 1) && (level[0] == '+'))
+        {
+            node = nodeP->plusChild;
+        }
+        else if ((length == 1) && (level[0] == '#'))
+        {
+            node = nodeP->hashChild;
+        }
+        else
+        {
+            node = AdrasteaI_MQTTRouter_FindChild(node, level, length);
+        }
+
+        if (end == NULL)
+        {
+            break;
+        }
+        level = end + 1;
+    }
+
+    if (node != ADRASTEAI_MQTT_ROUTER_NONE)
+    {
+        uint8_t* linkP = &AdrasteaI_MQTTRouter_nodes[node].firstRoute;
+        while (*linkP != ADRASTEAI_MQTT_ROUTER_NONE)
+        {
+            AdrasteaI_MQTTRouter_Route_t* routeP = &AdrasteaI_MQTTRouter_routes[*linkP];
+            if ((routeP->handler == handler) && (routeP->connID == connID))
+            {
+                *linkP = routeP->next;
+                routeP->handler = NULL;
+                AdrasteaI_MQTTRouter_Prune(node);
+                WE_ExitCriticalSection(state);
+                return true;
+            }
+            linkP = &routeP->next;
+        }
+    }
+
+    WE_ExitCriticalSection(state);
+    return false;
+}
+
+/**
+ * @brief Removes all routes.
+ */
+void AdrasteaI_MQTTRouter_Clear(void)
+{
+    uint32_t state = WE_EnterCriticalSection();
+    AdrasteaI_MQTTRouter_Init();
+    WE_ExitCriticalSection(state);
+}
+
+/**
+ * @brief Calls the handlers of the routes ending at a node.
+ */
+static uint8_t AdrasteaI_MQTTRouter_CallRoutes(uint8_t node, const AdrasteaI_ATMQTT_Publication_Received_Result_t* publicationP)
+{
+    uint8_t count = 0;
+
+    if (node == ADRASTEAI_MQTT_ROUTER_NONE)
+    {
+        return 0;
+    }
+
+    for (uint8_t route = AdrasteaI_MQTTRouter_nodes[node].firstRoute; route != ADRASTEAI_MQTT_ROUTER_NONE; route = AdrasteaI_MQTTRouter_routes[route].next)
+    {
+        const AdrasteaI_MQTTRouter_Route_t* routeP = &AdrasteaI_MQTTRouter_routes[route];
+        if ((routeP->connID == AdrasteaI_ATMQTT_Conn_ID_Invalid) || (routeP->connID == publicationP->connID))
+        {
+            routeP->handler(publicationP, routeP->contextP);
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Matches the remaining levels of a topic against the subtree of a node.
+ *
+ * @param[in] node Node matching the levels before level
+ * @param[in] level Remaining levels of the topic
+ * @param[in] firstLevel true if level is the first level of the topic
+ * @param[in] publicationP Publication passed to the handlers
+ *
+ * @return Number of handlers called
+ */
+static uint8_t AdrasteaI_MQTTRouter_Match(uint8_t node, const char* level, bool firstLevel, const AdrasteaI_ATMQTT_Publication_Received_Result_t* publicationP)
+{
+    const AdrasteaI_MQTTRouter_Node_t* nodeP = &AdrasteaI_MQTTRouter_nodes[node];
+    uint8_t count = 0;
+
+    /* Topics starting with '$' are not matched by wildcards in the first level */
+    bool wildcards = !firstLevel || (level[0] != '$');
+
+    const char* end = strchr(level, '/');
+    size_t length = (end != NULL) ? (size_t)(end - level) : strlen(level);
+
+    if (wildcards)
+    {
+        count += AdrasteaI_MQTTRouter_CallRoutes(nodeP->hashChild, publicationP);
+    }
+
+    uint8_t children[2];
+    children[0] = (length <= UINT8_MAX) ? AdrasteaI_MQTTRouter_FindChild(node, level, (uint8_t)length) : ADRASTEAI_MQTT_ROUTER_NONE;
+    children[1] = wildcards ? nodeP->plusChild : ADRASTEAI_MQTT_ROUTER_NONE;
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        uint8_t child = children[i];
+        if (child == ADRASTEAI_MQTT_ROUTER_NONE)
+        {
+            continue;
+        }
+
+        if (end != NULL)
+        {
+            count += AdrasteaI_MQTTRouter_Match(child, end + 1, false, publicationP);
+        }
+        else
+        {
+            /* Last level: "a/#" matches "a" as well */
+            count += AdrasteaI_MQTTRouter_CallRoutes(child, publicationP);
+            count += AdrasteaI_MQTTRouter_CallRoutes(AdrasteaI_MQTTRouter_nodes[child].hashChild, publicationP);
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Calls the handlers of all routes matching the topic of a received publication.
+ *
+ * Handlers must not add or remove routes.
+ *
+ * @param[in] publicationP Received publication. See AdrasteaI_ATMQTT_Publication_Received_Result_t.
+ *
+ * @return Number of handlers called
+ */
+uint8_t AdrasteaI_MQTTRouter_Dispatch(const AdrasteaI_ATMQTT_Publication_Received_Result_t* publicationP)
+{
+    if ((publicationP == NULL) || !AdrasteaI_MQTTRouter_initialized)
+    {
+        return 0;
+    }
+
+    return AdrasteaI_MQTTRouter_Match(0, publicationP->topicName, true, publicationP);
+}
+
+/**
+ * @brief Parses the arguments of a Publication Received event and calls the handlers of all matching routes.
+ *
+ * @param[in] pEventArguments Event arguments (as passed to AdrasteaI_ATMQTT_ParsePublicationReceivedEvent())
+ * @param[out] payload Buffer for the payload
+ * @param[in] payloadMaxBufferSize Size of the payload buffer
+ *
+ * @return Number of handlers called
+ */
+uint8_t AdrasteaI_MQTTRouter_DispatchEvent(char* pEventArguments, char* payload, uint16_t payloadMaxBufferSize)
+{
+    AdrasteaI_ATMQTT_Publication_Received_Result_t publication;
+
+    /* The parser sets the low byte of the enumeration fields only */
+    memset(&publication, 0, sizeof(publication));
+    publication.payload = payload;
+    publication.payloadMaxBufferSize = payloadMaxBufferSize;
+
+    if (!AdrasteaI_ATMQTT_ParsePublicationReceivedEvent(pEventArguments, &publication))
+    {
+        return 0;
+    }
+
+    return AdrasteaI_MQTTRouter_Dispatch(&publication);
+}
+
+#endif /* ADRASTEAI_MQTT_ROUTER */
@@ -0,0 +1,92 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Routing of received MQTT publications to handlers by topic filter (enabled by defining ADRASTEAI_MQTT_ROUTER).
+ *
+ * Topic filters may contain the wildcards '+' (exactly one level) and '#' (any number of levels, last level only).
+ * The filters are stored in a trie with one node per topic level. The children of all nodes are kept in a single
+ * hash table indexed by parent node and level, so a publication is matched with one lookup per topic level
+ * (plus one per matching '+' branch), independent of the number of routes. Memory is allocated statically.
+ *
+ * AdrasteaI_MQTTRouter_Dispatch() is meant to be called from the event callback for
+ * AdrasteaI_ATEvent_MQTT_Publication_Received, so handlers must not send AT commands.
+ */
+
+#ifndef ADRASTEAI_MQTTROUTER_H_INCLUDED
+#define ADRASTEAI_MQTTROUTER_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ATMQTT.h"
+
+#ifndef ADRASTEAI_MQTT_ROUTER_MAX_NODES
+/**
+ * @brief Max. number of distinct topic levels over all routes (max. 254).
+ */
+#define ADRASTEAI_MQTT_ROUTER_MAX_NODES 64
+#endif
+
+#ifndef ADRASTEAI_MQTT_ROUTER_MAX_ROUTES
+/**
+ * @brief Max. number of routes (max. 254).
+ */
+#define ADRASTEAI_MQTT_ROUTER_MAX_ROUTES 16
+#endif
+
+#ifndef ADRASTEAI_MQTT_ROUTER_STRING_POOL_SIZE
+/**
+ * @brief Size of the storage for the topic level names (bytes, each distinct level is stored once).
+ */
+#define ADRASTEAI_MQTT_ROUTER_STRING_POOL_SIZE 512
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief Called for a received publication matching the topic filter of a route.
+ */
+    typedef void (*AdrasteaI_MQTTRouter_Handler_t)(const AdrasteaI_ATMQTT_Publication_Received_Result_t* publicationP, void* contextP);
+
+    extern bool AdrasteaI_MQTTRouter_AddRoute(AdrasteaI_ATMQTT_Conn_ID_t connID, const char* topicFilter, AdrasteaI_MQTTRouter_Handler_t handler, void* contextP);
+
+    extern bool AdrasteaI_MQTTRouter_RemoveRoute(AdrasteaI_ATMQTT_Conn_ID_t connID, const char* topicFilter, AdrasteaI_MQTTRouter_Handler_t handler);
+
+    extern void AdrasteaI_MQTTRouter_Clear(void);
+
+    extern uint8_t AdrasteaI_MQTTRouter_Dispatch(const AdrasteaI_ATMQTT_Publication_Received_Result_t* publicationP);
+
+    extern uint8_t AdrasteaI_MQTTRouter_DispatchEvent(char* pEventArguments, char* payload, uint16_t payloadMaxBufferSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADRASTEAI_MQTTROUTER_H_INCLUDED */
@@ -0,0 +1,332 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Streaming reception of MQTT publications (enabled by defining ADRASTEAI_MQTT_STREAM).
+ */
+
+#include <string.h>
+
+#include "ATEvent.h"
+#include "AdrasteaI.h"
+#include "AdrasteaI_MQTTStream.h"
+#include "global.h"
+#include "log.h"
+
+#ifdef ADRASTEAI_MQTT_STREAM
+
+/**
+ * @brief Reception state.
+ */
+typedef enum AdrasteaI_MQTTStream_State_t
+{
+    AdrasteaI_MQTTStream_State_Idle,    /**< Received bytes are handled as lines */
+    AdrasteaI_MQTTStream_State_Payload, /**< Received bytes are payload */
+    AdrasteaI_MQTTStream_State_Trailer  /**< Waiting for the line end following the payload */
+} AdrasteaI_MQTTStream_State_t;
+
+static AdrasteaI_MQTTStream_Handler_t AdrasteaI_MQTTStream_handler = NULL;
+static void* AdrasteaI_MQTTStream_contextP = NULL;
+
+static volatile AdrasteaI_MQTTStream_State_t AdrasteaI_MQTTStream_state = AdrasteaI_MQTTStream_State_Idle;
+
+/**
+ * @brief Header of the publication currently being received. offset is the position of the chunk buffer.
+ */
+static AdrasteaI_MQTTStream_Chunk_t AdrasteaI_MQTTStream_chunk;
+static AdrasteaI_ATMQTT_Topic_Name_t AdrasteaI_MQTTStream_topicName;
+static uint8_t AdrasteaI_MQTTStream_buffer[ADRASTEAI_MQTT_STREAM_CHUNK_SIZE];
+
+/**
+ * @brief Number of payload bytes in AdrasteaI_MQTTStream_buffer.
+ */
+static uint16_t AdrasteaI_MQTTStream_bufferLength = 0;
+
+/**
+ * @brief Number of line end characters received after the payload.
+ */
+static uint8_t AdrasteaI_MQTTStream_trailerLength = 0;
+
+static uint32_t AdrasteaI_MQTTStream_lastByteTick = 0;
+
+static AdrasteaI_MQTTStream_Statistics_t AdrasteaI_MQTTStream_statistics = {0};
+
+/**
+ * @brief Passes the buffered payload bytes to the handler.
+ */
+static void AdrasteaI_MQTTStream_Deliver(AdrasteaI_MQTTStream_Status_t status)
+{
+    AdrasteaI_MQTTStream_chunk.data = AdrasteaI_MQTTStream_buffer;
+    AdrasteaI_MQTTStream_chunk.length = AdrasteaI_MQTTStream_bufferLength;
+    AdrasteaI_MQTTStream_chunk.status = status;
+
+    if (AdrasteaI_MQTTStream_handler != NULL)
+    {
+        AdrasteaI_MQTTStream_handler(&AdrasteaI_MQTTStream_chunk, AdrasteaI_MQTTStream_contextP);
+    }
+
+    AdrasteaI_MQTTStream_chunk.offset += AdrasteaI_MQTTStream_bufferLength;
+    AdrasteaI_MQTTStream_bufferLength = 0;
+}
+
+/**
+ * @brief Ends the publication currently being received and prepares the aborted chunk.
+ *
+ * Has to be called with the reception state locked, i.e. in the receive context or in a critical section.
+ *
+ * @param[out] chunkP Aborted chunk to be passed to AdrasteaI_MQTTStream_DeliverAbort()
+ */
+static void AdrasteaI_MQTTStream_PrepareAbort(AdrasteaI_MQTTStream_Chunk_t* chunkP)
+{
+    *chunkP = AdrasteaI_MQTTStream_chunk;
+    chunkP->data = AdrasteaI_MQTTStream_buffer;
+    chunkP->length = AdrasteaI_MQTTStream_bufferLength;
+    chunkP->status = AdrasteaI_MQTTStream_Status_Aborted;
+
+    AdrasteaI_MQTTStream_statistics.aborted++;
+    AdrasteaI_MQTTStream_state = AdrasteaI_MQTTStream_State_Idle;
+    AdrasteaI_MQTTStream_chunk.offset += AdrasteaI_MQTTStream_bufferLength;
+    AdrasteaI_MQTTStream_bufferLength = 0;
+}
+
+/**
+ * @brief Passes an aborted chunk prepared by AdrasteaI_MQTTStream_PrepareAbort() to the handler.
+ */
+static void AdrasteaI_MQTTStream_DeliverAbort(const AdrasteaI_MQTTStream_Chunk_t* chunkP)
+{
+    WE_LOG_WARNING(ATMQTT, "Publication msg %u aborted after %lu of %lu bytes", chunkP->msgID, (unsigned long)(chunkP->offset + chunkP->length), (unsigned long)chunkP->payloadSize);
+
+    AdrasteaI_MQTTStream_Handler_t handler = AdrasteaI_MQTTStream_handler;
+    if (handler != NULL)
+    {
+        handler(chunkP, AdrasteaI_MQTTStream_contextP);
+    }
+}
+
+static void AdrasteaI_MQTTStream_Abort(void)
+{
+    AdrasteaI_MQTTStream_Chunk_t chunk;
+    AdrasteaI_MQTTStream_PrepareAbort(&chunk);
+    AdrasteaI_MQTTStream_DeliverAbort(&chunk);
+}
+
+/**
+ * @brief Sets the handler for received publications and enables streaming.
+ *
+ * @param[in] handler Called for each chunk of a received publication, NULL to disable streaming
+ * @param[in] contextP Passed to the handler
+ */
+void AdrasteaI_MQTTStream_SetHandler(AdrasteaI_MQTTStream_Handler_t handler, void* contextP)
+{
+    uint32_t state = WE_EnterCriticalSection();
+    AdrasteaI_MQTTStream_handler = handler;
+    AdrasteaI_MQTTStream_contextP = contextP;
+    WE_ExitCriticalSection(state);
+}
+
+/**
+ * @brief Checks if streaming is enabled, i.e. if a handler has been set.
+ *
+ * @return true if enabled, false otherwise
+ */
+bool AdrasteaI_MQTTStream_IsEnabled(void) { return AdrasteaI_MQTTStream_handler != NULL; }
+
+/**
+ * @brief Returns the streaming statistics.
+ *
+ * @param[out] statisticsP Statistics
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTStream_GetStatistics(AdrasteaI_MQTTStream_Statistics_t* statisticsP)
+{
+    if (statisticsP == NULL)
+    {
+        return false;
+    }
+
+    uint32_t state = WE_EnterCriticalSection();
+    *statisticsP = AdrasteaI_MQTTStream_statistics;
+    WE_ExitCriticalSection(state);
+
+    return true;
+}
+
+/**
+ * @brief Aborts a publication whose payload has stalled for more than ADRASTEAI_MQTT_STREAM_TIMEOUT_MS.
+ *
+ * Should be called regularly by the application. Without it, a stalled payload is only detected when the next
+ * byte is received. In that case, this byte would be the first byte of the following line, and it would reach the
+ * line parser only after the abort. The handler is called with the aborted chunk from the calling context. Its data
+ * stays valid until the header of the next publication is received.
+ */
+void AdrasteaI_MQTTStream_Process(void)
+{
+    AdrasteaI_MQTTStream_Chunk_t chunk;
+    bool aborted = false;
+
+    /* Only decide under the lock, the handler and the log output run after it */
+    uint32_t state = WE_EnterCriticalSection();
+    if ((AdrasteaI_MQTTStream_state != AdrasteaI_MQTTStream_State_Idle) && (WE_GetTick() - AdrasteaI_MQTTStream_lastByteTick > ADRASTEAI_MQTT_STREAM_TIMEOUT_MS))
+    {
+        if (AdrasteaI_MQTTStream_state == AdrasteaI_MQTTStream_State_Payload)
+        {
+            AdrasteaI_MQTTStream_PrepareAbort(&chunk);
+            aborted = true;
+        }
+        AdrasteaI_MQTTStream_state = AdrasteaI_MQTTStream_State_Idle;
+    }
+    WE_ExitCriticalSection(state);
+
+    if (aborted)
+    {
+        AdrasteaI_MQTTStream_DeliverAbort(&chunk);
+    }
+}
+
+/**
+ * @brief Is called by the driver for each received byte before it is added to the current line.
+ *
+ * @param[in] receivedByte Received byte
+ *
+ * @return true if the byte has been consumed as payload of a publication, false if it is to be handled as part of a line
+ */
+bool AdrasteaI_MQTTStream_HandleRxByte(uint8_t receivedByte)
+{
+    if (AdrasteaI_MQTTStream_state == AdrasteaI_MQTTStream_State_Idle)
+    {
+        return false;
+    }
+
+    /* Fallback if AdrasteaI_MQTTStream_Process() has not been called since the payload stalled */
+    uint32_t now = WE_GetTick();
+    if (now - AdrasteaI_MQTTStream_lastByteTick > ADRASTEAI_MQTT_STREAM_TIMEOUT_MS)
+    {
+        if (AdrasteaI_MQTTStream_state == AdrasteaI_MQTTStream_State_Payload)
+        {
+            AdrasteaI_MQTTStream_Abort();
+        }
+        AdrasteaI_MQTTStream_state = AdrasteaI_MQTTStream_State_Idle;
+        return false;
+    }
+    AdrasteaI_MQTTStream_lastByteTick = now;
+
+    if (AdrasteaI_MQTTStream_state == AdrasteaI_MQTTStream_State_Trailer)
+    {
+        if ((receivedByte != '\r') && (receivedByte != '\n'))
+        {
+            AdrasteaI_MQTTStream_state = AdrasteaI_MQTTStream_State_Idle;
+            return false;
+        }
+
+        AdrasteaI_MQTTStream_trailerLength++;
+        if ((receivedByte == '\n') || (AdrasteaI_MQTTStream_trailerLength >= 2))
+        {
+            AdrasteaI_MQTTStream_state = AdrasteaI_MQTTStream_State_Idle;
+        }
+        return true;
+    }
+
+    AdrasteaI_MQTTStream_buffer[AdrasteaI_MQTTStream_bufferLength++] = receivedByte;
+    AdrasteaI_MQTTStream_statistics.bytes++;
+
+    if (AdrasteaI_MQTTStream_chunk.offset + AdrasteaI_MQTTStream_bufferLength >= AdrasteaI_MQTTStream_chunk.payloadSize)
+    {
+        AdrasteaI_MQTTStream_statistics.messages++;
+        AdrasteaI_MQTTStream_trailerLength = 0;
+        AdrasteaI_MQTTStream_state = AdrasteaI_MQTTStream_State_Trailer;
+        AdrasteaI_MQTTStream_Deliver(AdrasteaI_MQTTStream_Status_Complete);
+    }
+    else if (AdrasteaI_MQTTStream_bufferLength >= sizeof(AdrasteaI_MQTTStream_buffer))
+    {
+        AdrasteaI_MQTTStream_Deliver(AdrasteaI_MQTTStream_Status_Data);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Starts streaming the payload if the line is the header of a PUBRCV notification.
+ *
+ * Is called by the driver for each received URC.
+ *
+ * @param[in] event Event type, parsed once by the driver for all URC handlers
+ * @param[in] pArguments Arguments following the event name (not modified, the line is passed on to the event callback afterwards)
+ */
+void AdrasteaI_MQTTStream_HandleURC(AdrasteaI_ATEvent_t event, char* pArguments)
+{
+    if ((AdrasteaI_MQTTStream_handler == NULL) || (event != AdrasteaI_ATEvent_MQTT_Publication_Received))
+    {
+        return;
+    }
+
+    if (AdrasteaI_MQTTStream_state == AdrasteaI_MQTTStream_State_Payload)
+    {
+        AdrasteaI_MQTTStream_Abort();
+    }
+
+    ATCommand_Arguments_t arguments;
+    /* The parser sets the low byte of the enumeration fields only */
+    AdrasteaI_ATMQTT_Conn_ID_t connID = 0;
+    AdrasteaI_ATMQTT_Message_ID_t msgID = 0;
+    uint32_t payloadSize = 0;
+    if (!ATCommand_TokenizeArguments(pArguments, &arguments) || (arguments.count < 4) || !ATCommand_GetArgumentInt(&arguments, 0, &connID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED) ||
+        !ATCommand_GetArgumentInt(&arguments, 1, &msgID, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED) ||
+        !ATCommand_GetArgumentStringWithoutQuotationMarks(&arguments, 2, AdrasteaI_MQTTStream_topicName, sizeof(AdrasteaI_ATMQTT_Topic_Name_t)) ||
+        !ATCommand_GetArgumentInt(&arguments, 3, &payloadSize, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED))
+    {
+        WE_LOG_WARNING(ATMQTT, "Invalid PUBRCV header");
+        return;
+    }
+
+    memset(&AdrasteaI_MQTTStream_chunk, 0, sizeof(AdrasteaI_MQTTStream_chunk));
+    AdrasteaI_MQTTStream_chunk.connID = connID;
+    AdrasteaI_MQTTStream_chunk.msgID = msgID;
+    AdrasteaI_MQTTStream_chunk.topicName = AdrasteaI_MQTTStream_topicName;
+    AdrasteaI_MQTTStream_chunk.payloadSize = payloadSize;
+    AdrasteaI_MQTTStream_bufferLength = 0;
+    AdrasteaI_MQTTStream_trailerLength = 0;
+    AdrasteaI_MQTTStream_lastByteTick = WE_GetTick();
+
+    if (payloadSize > AdrasteaI_MQTTStream_statistics.maxPayloadSize)
+    {
+        AdrasteaI_MQTTStream_statistics.maxPayloadSize = payloadSize;
+    }
+
+    WE_LOG_DEBUG(ATMQTT, "Streaming publication msg %u, %lu bytes", msgID, (unsigned long)payloadSize);
+
+    if (payloadSize == 0)
+    {
+        AdrasteaI_MQTTStream_statistics.messages++;
+        AdrasteaI_MQTTStream_state = AdrasteaI_MQTTStream_State_Trailer;
+        AdrasteaI_MQTTStream_Deliver(AdrasteaI_MQTTStream_Status_Complete);
+        return;
+    }
+
+    AdrasteaI_MQTTStream_state = AdrasteaI_MQTTStream_State_Payload;
+}
+
+#endif /* ADRASTEAI_MQTT_STREAM */
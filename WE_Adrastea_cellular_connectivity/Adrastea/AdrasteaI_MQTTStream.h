@@ -0,0 +1,134 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Streaming reception of MQTT publications (enabled by defining ADRASTEAI_MQTT_STREAM).
+ *
+ * Without streaming, a received publication is only reported once the header and the complete payload have been
+ * collected in the receive line buffer (ADRASTEAI_LINE_MAX_SIZE) and the payload has been copied to the buffer
+ * passed to AdrasteaI_ATMQTT_ParsePublicationReceivedEvent(). If a handler has been registered using
+ * AdrasteaI_MQTTStream_SetHandler(), only the header of the PUBRCV notification is received as a line. The payload
+ * is then taken directly from the UART and passed to the handler in chunks of up to ADRASTEAI_MQTT_STREAM_CHUNK_SIZE
+ * bytes together with topic and offset, so the RAM required does not depend on the size of the messages.
+ *
+ * AdrasteaI_MQTTStream_Process() should be called regularly. It aborts a publication whose payload stalls for
+ * more than ADRASTEAI_MQTT_STREAM_TIMEOUT_MS, so the following lines are parsed again.
+ *
+ * The handler is called from the UART receive context and must therefore not send AT commands. The event callback
+ * still receives the PUBRCV header line, for which AdrasteaI_ATMQTT_ParsePublicationReceivedEvent() fails, as there
+ * is no payload. Streaming requires the default line end "\r\n" (see AdrasteaI_SetEolCharacters()).
+ */
+
+#ifndef ADRASTEAI_MQTTSTREAM_H_INCLUDED
+#define ADRASTEAI_MQTTSTREAM_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ATEvent.h"
+#include "ATMQTT.h"
+
+#ifndef ADRASTEAI_MQTT_STREAM_CHUNK_SIZE
+/**
+ * @brief Max. number of payload bytes passed to the handler at once.
+ */
+#define ADRASTEAI_MQTT_STREAM_CHUNK_SIZE 64
+#endif
+
+#ifndef ADRASTEAI_MQTT_STREAM_TIMEOUT_MS
+/**
+ * @brief Max. gap between two payload bytes (milliseconds). If exceeded, the message is aborted (see
+ * AdrasteaI_MQTTStream_Process()).
+ */
+#define ADRASTEAI_MQTT_STREAM_TIMEOUT_MS 1000
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief Status of a received chunk.
+ */
+    typedef enum AdrasteaI_MQTTStream_Status_t
+    {
+        AdrasteaI_MQTTStream_Status_Invalid = -1,
+        AdrasteaI_MQTTStream_Status_Data,     /**< Part of the payload, more chunks follow */
+        AdrasteaI_MQTTStream_Status_Complete, /**< Last part of the payload (may be empty) */
+        AdrasteaI_MQTTStream_Status_Aborted,  /**< The payload has not been received completely, no more chunks follow */
+        AdrasteaI_MQTTStream_Status_NumberOfValues
+    } AdrasteaI_MQTTStream_Status_t;
+
+    /**
+ * @brief Chunk of a received publication.
+ */
+    typedef struct AdrasteaI_MQTTStream_Chunk_t
+    {
+        AdrasteaI_ATMQTT_Conn_ID_t connID;
+        AdrasteaI_ATMQTT_Message_ID_t msgID;
+        const char* topicName;
+        uint32_t payloadSize; /**< Size of the complete payload */
+        uint32_t offset;      /**< Position of data in the payload */
+        const uint8_t* data;
+        uint16_t length;
+        AdrasteaI_MQTTStream_Status_t status;
+    } AdrasteaI_MQTTStream_Chunk_t;
+
+    /**
+ * @brief Called for each chunk of a received publication.
+ */
+    typedef void (*AdrasteaI_MQTTStream_Handler_t)(const AdrasteaI_MQTTStream_Chunk_t* chunkP, void* contextP);
+
+    /**
+ * @brief Streaming statistics.
+ * @see AdrasteaI_MQTTStream_GetStatistics()
+ */
+    typedef struct AdrasteaI_MQTTStream_Statistics_t
+    {
+        uint32_t messages;       /**< Messages received completely */
+        uint32_t aborted;        /**< Messages aborted */
+        uint32_t bytes;          /**< Payload bytes received */
+        uint32_t maxPayloadSize; /**< Largest payload received (bytes) */
+    } AdrasteaI_MQTTStream_Statistics_t;
+
+    extern void AdrasteaI_MQTTStream_SetHandler(AdrasteaI_MQTTStream_Handler_t handler, void* contextP);
+
+    extern bool AdrasteaI_MQTTStream_IsEnabled(void);
+
+    extern bool AdrasteaI_MQTTStream_GetStatistics(AdrasteaI_MQTTStream_Statistics_t* statisticsP);
+
+    extern void AdrasteaI_MQTTStream_Process(void);
+
+    extern bool AdrasteaI_MQTTStream_HandleRxByte(uint8_t receivedByte);
+
+    extern void AdrasteaI_MQTTStream_HandleURC(AdrasteaI_ATEvent_t event, char* pArguments);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADRASTEAI_MQTTSTREAM_H_INCLUDED */
@@ -0,0 +1,654 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Supervision of an MQTT connection with automatic reconnection (enabled by defining ADRASTEAI_MQTT_SUPERVISOR).
+ */
+
+#include <string.h>
+
+#include "ATEvent.h"
+#include "ATPacketDomain.h"
+#include "AdrasteaI.h"
+#include "AdrasteaI_MQTTSupervisor.h"
+#include "global.h"
+#include "log.h"
+
+#ifdef ADRASTEAI_MQTT_SUPERVISOR
+
+/**
+ * @brief Notifications received since the last call of AdrasteaI_MQTTSupervisor_Process().
+ */
+#define ADRASTEAI_MQTT_SUPERVISOR_EVENT_CONNECTED (uint8_t)(1 << 0)
+#define ADRASTEAI_MQTT_SUPERVISOR_EVENT_CONNECT_FAILED (uint8_t)(1 << 1)
+#define ADRASTEAI_MQTT_SUPERVISOR_EVENT_DISCONNECTED (uint8_t)(1 << 2)
+#define ADRASTEAI_MQTT_SUPERVISOR_EVENT_REGISTERED (uint8_t)(1 << 3)
+#define ADRASTEAI_MQTT_SUPERVISOR_EVENT_REGISTRATION_LOST (uint8_t)(1 << 4)
+
+/**
+ * @brief Cached subscription.
+ */
+typedef struct AdrasteaI_MQTTSupervisor_Subscription_t
+{
+    bool used;
+    AdrasteaI_ATMQTT_QoS_t qos;
+    AdrasteaI_ATMQTT_Topic_Name_t topicName;
+} AdrasteaI_MQTTSupervisor_Subscription_t;
+
+static AdrasteaI_MQTTSupervisor_Config_t AdrasteaI_MQTTSupervisor_config;
+
+/**
+ * @brief Is set to true when the broker configuration has been sent to the module.
+ */
+static bool AdrasteaI_MQTTSupervisor_configApplied = false;
+
+static AdrasteaI_MQTTSupervisor_Callback_t AdrasteaI_MQTTSupervisor_callback = NULL;
+static void* AdrasteaI_MQTTSupervisor_contextP = NULL;
+
+static AdrasteaI_MQTTSupervisor_State_t AdrasteaI_MQTTSupervisor_state = AdrasteaI_MQTTSupervisor_State_Stopped;
+
+/**
+ * @brief Is set to true while the supervisor is running (read by the URC handler).
+ */
+static volatile bool AdrasteaI_MQTTSupervisor_running = false;
+
+static volatile bool AdrasteaI_MQTTSupervisor_registered = false;
+static volatile uint8_t AdrasteaI_MQTTSupervisor_events = 0;
+
+static AdrasteaI_MQTTSupervisor_Subscription_t AdrasteaI_MQTTSupervisor_subscriptions[ADRASTEAI_MQTT_SUPERVISOR_MAX_SUBSCRIPTIONS];
+
+/**
+ * @brief Number of failed connection attempts since the last connection or the last regained registration.
+ */
+static uint8_t AdrasteaI_MQTTSupervisor_failedAttempts = 0;
+
+static uint32_t AdrasteaI_MQTTSupervisor_backoffStartTick = 0;
+static uint32_t AdrasteaI_MQTTSupervisor_connectTick = 0;
+
+/**
+ * @brief Time the connection has been lost. Only valid if AdrasteaI_MQTTSupervisor_connectionLost is true.
+ */
+static uint32_t AdrasteaI_MQTTSupervisor_lostTick = 0;
+static bool AdrasteaI_MQTTSupervisor_connectionLost = false;
+
+/**
+ * @brief Time the registration has been regained. Only valid if AdrasteaI_MQTTSupervisor_registrationRegained is true.
+ */
+static uint32_t AdrasteaI_MQTTSupervisor_registeredTick = 0;
+static bool AdrasteaI_MQTTSupervisor_registrationRegained = false;
+
+static uint32_t AdrasteaI_MQTTSupervisor_randomState = 1;
+
+static AdrasteaI_MQTTSupervisor_Statistics_t AdrasteaI_MQTTSupervisor_statistics = {0};
+
+static uint32_t AdrasteaI_MQTTSupervisor_Random(void)
+{
+    /* xorshift32 */
+    uint32_t x = AdrasteaI_MQTTSupervisor_randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    AdrasteaI_MQTTSupervisor_randomState = x;
+    return x;
+}
+
+static bool AdrasteaI_MQTTSupervisor_IsRegistered(AdrasteaI_ATPacketDomain_Network_Registration_State_t state)
+{
+    return (state == AdrasteaI_ATPacketDomain_Network_Registration_State_Registered_Home_Network) || (state == AdrasteaI_ATPacketDomain_Network_Registration_State_Registered_Roaming);
+}
+
+static bool AdrasteaI_MQTTSupervisor_ConfigEquals(const AdrasteaI_MQTTSupervisor_Config_t* aP, const AdrasteaI_MQTTSupervisor_Config_t* bP)
+{
+    return (aP->connID == bP->connID) && (0 == strcmp(aP->clientID, bP->clientID)) && (0 == strcmp(aP->addr, bP->addr)) && (0 == strcmp(aP->username, bP->username)) && (0 == strcmp(aP->password, bP->password)) && (aP->sessionID == bP->sessionID) &&
+           (aP->ipFormat == bP->ipFormat) && (aP->port == bP->port) && (aP->keepAlive == bP->keepAlive) && (aP->cleanSession == bP->cleanSession);
+}
+
+static void AdrasteaI_MQTTSupervisor_SetState(AdrasteaI_MQTTSupervisor_State_t state)
+{
+    if (state == AdrasteaI_MQTTSupervisor_state)
+    {
+        return;
+    }
+
+    WE_LOG_INFO(ATMQTT, "Supervisor state %d -> %d", AdrasteaI_MQTTSupervisor_state, state);
+
+    AdrasteaI_MQTTSupervisor_state = state;
+    AdrasteaI_MQTTSupervisor_statistics.state = state;
+
+    if (AdrasteaI_MQTTSupervisor_callback != NULL)
+    {
+        AdrasteaI_MQTTSupervisor_callback(state, AdrasteaI_MQTTSupervisor_contextP);
+    }
+}
+
+/**
+ * @brief Waits before the next connection attempt (or for the registration).
+ *
+ * The delay is drawn from the upper half of an exponentially growing interval ("equal jitter").
+ */
+static void AdrasteaI_MQTTSupervisor_StartBackoff(uint32_t now)
+{
+    uint32_t ceiling = ADRASTEAI_MQTT_SUPERVISOR_MIN_BACKOFF_MS;
+    for (uint8_t i = 0; (i < AdrasteaI_MQTTSupervisor_failedAttempts) && (ceiling < ADRASTEAI_MQTT_SUPERVISOR_MAX_BACKOFF_MS); i++)
+    {
+        ceiling *= 2;
+    }
+    if (ceiling > ADRASTEAI_MQTT_SUPERVISOR_MAX_BACKOFF_MS)
+    {
+        ceiling = ADRASTEAI_MQTT_SUPERVISOR_MAX_BACKOFF_MS;
+    }
+
+    if (AdrasteaI_MQTTSupervisor_failedAttempts < UINT8_MAX)
+    {
+        AdrasteaI_MQTTSupervisor_failedAttempts++;
+    }
+
+    AdrasteaI_MQTTSupervisor_statistics.currentBackoffMs = ceiling / 2 + AdrasteaI_MQTTSupervisor_Random() % (ceiling / 2 + 1);
+    AdrasteaI_MQTTSupervisor_backoffStartTick = now;
+
+    WE_LOG_DEBUG(ATMQTT, "Reconnecting in %lu ms", (unsigned long)AdrasteaI_MQTTSupervisor_statistics.currentBackoffMs);
+
+    AdrasteaI_MQTTSupervisor_SetState(AdrasteaI_MQTTSupervisor_registered ? AdrasteaI_MQTTSupervisor_State_Backoff : AdrasteaI_MQTTSupervisor_State_WaitingForRegistration);
+}
+
+static bool AdrasteaI_MQTTSupervisor_ApplyConfig(void)
+{
+    AdrasteaI_MQTTSupervisor_Config_t* configP = &AdrasteaI_MQTTSupervisor_config;
+
+    if (!AdrasteaI_ATMQTT_ConfigureNodes(configP->connID, configP->clientID, configP->addr, configP->username, configP->password) || !AdrasteaI_ATMQTT_ConfigureIP(configP->connID, configP->sessionID, configP->ipFormat, configP->port) ||
+        !AdrasteaI_ATMQTT_ConfigureProtocol(configP->connID, configP->keepAlive, configP->cleanSession))
+    {
+        WE_LOG_WARNING(ATMQTT, "Failed to configure connection %d", configP->connID);
+        return false;
+    }
+
+    AdrasteaI_MQTTSupervisor_configApplied = true;
+    AdrasteaI_MQTTSupervisor_statistics.configurations++;
+    return true;
+}
+
+static void AdrasteaI_MQTTSupervisor_Connect(uint32_t now)
+{
+    if (AdrasteaI_MQTTSupervisor_configApplied)
+    {
+        AdrasteaI_MQTTSupervisor_statistics.configurationsSaved++;
+    }
+    else if (!AdrasteaI_MQTTSupervisor_ApplyConfig())
+    {
+        AdrasteaI_MQTTSupervisor_statistics.connectFailures++;
+        AdrasteaI_MQTTSupervisor_StartBackoff(now);
+        return;
+    }
+
+    AdrasteaI_MQTTSupervisor_statistics.connectAttempts++;
+
+    if (!AdrasteaI_ATMQTT_Connect(AdrasteaI_MQTTSupervisor_config.connID))
+    {
+        /* The module might have lost the configuration, send it again with the next attempt */
+        AdrasteaI_MQTTSupervisor_configApplied = false;
+        AdrasteaI_MQTTSupervisor_statistics.connectFailures++;
+        AdrasteaI_MQTTSupervisor_StartBackoff(now);
+        return;
+    }
+
+    AdrasteaI_MQTTSupervisor_connectTick = now;
+    AdrasteaI_MQTTSupervisor_SetState(AdrasteaI_MQTTSupervisor_State_Connecting);
+}
+
+static void AdrasteaI_MQTTSupervisor_OnConnected(uint32_t now)
+{
+    AdrasteaI_MQTTSupervisor_statistics.connections++;
+    AdrasteaI_MQTTSupervisor_statistics.currentBackoffMs = 0;
+    AdrasteaI_MQTTSupervisor_failedAttempts = 0;
+
+    if (AdrasteaI_MQTTSupervisor_connectionLost)
+    {
+        uint32_t recoveryStart = AdrasteaI_MQTTSupervisor_registrationRegained ? AdrasteaI_MQTTSupervisor_registeredTick : AdrasteaI_MQTTSupervisor_lostTick;
+        AdrasteaI_MQTTSupervisor_statistics.lastOutageMs = now - AdrasteaI_MQTTSupervisor_lostTick;
+        AdrasteaI_MQTTSupervisor_statistics.lastRecoveryMs = now - recoveryStart;
+        if (AdrasteaI_MQTTSupervisor_statistics.lastRecoveryMs > AdrasteaI_MQTTSupervisor_statistics.maxRecoveryMs)
+        {
+            AdrasteaI_MQTTSupervisor_statistics.maxRecoveryMs = AdrasteaI_MQTTSupervisor_statistics.lastRecoveryMs;
+        }
+        AdrasteaI_MQTTSupervisor_connectionLost = false;
+        AdrasteaI_MQTTSupervisor_registrationRegained = false;
+
+        WE_LOG_INFO(ATMQTT, "Reconnected after %lu ms, %lu ms after recovery of coverage", (unsigned long)AdrasteaI_MQTTSupervisor_statistics.lastOutageMs, (unsigned long)AdrasteaI_MQTTSupervisor_statistics.lastRecoveryMs);
+    }
+
+    AdrasteaI_MQTTSupervisor_SetState(AdrasteaI_MQTTSupervisor_State_Connected);
+
+    for (uint8_t i = 0; i < ADRASTEAI_MQTT_SUPERVISOR_MAX_SUBSCRIPTIONS; i++)
+    {
+        AdrasteaI_MQTTSupervisor_Subscription_t* subscriptionP = &AdrasteaI_MQTTSupervisor_subscriptions[i];
+        if (subscriptionP->used && !AdrasteaI_ATMQTT_Subscribe(AdrasteaI_MQTTSupervisor_config.connID, subscriptionP->qos, subscriptionP->topicName))
+        {
+            WE_LOG_WARNING(ATMQTT, "Failed to restore subscription %s", subscriptionP->topicName);
+        }
+    }
+}
+
+/**
+ * @brief Starts supervising the connection.
+ *
+ * Enables the +CEREG and MQTT notifications, reads the current registration state and connects as soon as the
+ * module is registered.
+ *
+ * @param[in] configP Broker configuration (copied)
+ * @param[in] callback Called when the connection state has changed (optional)
+ * @param[in] contextP Passed to the callback
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTSupervisor_Start(const AdrasteaI_MQTTSupervisor_Config_t* configP, AdrasteaI_MQTTSupervisor_Callback_t callback, void* contextP)
+{
+    if ((configP == NULL) || (configP->connID <= AdrasteaI_ATMQTT_Conn_ID_Invalid) || (configP->connID >= AdrasteaI_ATMQTT_Conn_ID_NumberOfValues) || !AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    if (AdrasteaI_MQTTSupervisor_state != AdrasteaI_MQTTSupervisor_State_Stopped)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if (!AdrasteaI_MQTTSupervisor_ConfigEquals(configP, &AdrasteaI_MQTTSupervisor_config))
+    {
+        AdrasteaI_MQTTSupervisor_config = *configP;
+        AdrasteaI_MQTTSupervisor_configApplied = false;
+    }
+    AdrasteaI_MQTTSupervisor_callback = callback;
+    AdrasteaI_MQTTSupervisor_contextP = contextP;
+
+    /* Devices starting at the same time must not retry in lockstep */
+    uint32_t seed = WE_GetTick();
+    for (const char* c = configP->clientID; *c != '\0'; c++)
+    {
+        seed = (seed ^ (uint8_t)*c) * 16777619u;
+    }
+    AdrasteaI_MQTTSupervisor_randomState = (seed != 0) ? seed : 1;
+
+    if (!AdrasteaI_ATMQTT_SetMQTTUnsolicitedNotificationEvents(AdrasteaI_ATMQTT_Event_All, AdrasteaI_ATCommon_Event_State_Enable) || !AdrasteaI_ATPacketDomain_SetNetworkRegistrationResultCode(AdrasteaI_ATPacketDomain_Network_Registration_Result_Code_Enable))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    /* The module may still be connected from before a reset of the host */
+    AdrasteaI_ATMQTT_Disconnect(configP->connID);
+
+    AdrasteaI_MQTTSupervisor_events = 0;
+    AdrasteaI_MQTTSupervisor_running = true;
+
+    /* The parser sets the low byte of the enumeration fields only */
+    AdrasteaI_ATPacketDomain_Network_Registration_Status_t status;
+    memset(&status, 0, sizeof(status));
+    AdrasteaI_MQTTSupervisor_registered = AdrasteaI_ATPacketDomain_ReadNetworkRegistrationStatus(&status) && AdrasteaI_MQTTSupervisor_IsRegistered(status.state);
+
+    AdrasteaI_MQTTSupervisor_failedAttempts = 0;
+    AdrasteaI_MQTTSupervisor_connectionLost = false;
+    AdrasteaI_MQTTSupervisor_registrationRegained = false;
+    AdrasteaI_MQTTSupervisor_statistics.currentBackoffMs = 0;
+    AdrasteaI_MQTTSupervisor_SetState(AdrasteaI_MQTTSupervisor_State_WaitingForRegistration);
+
+    return AdrasteaI_EndCommand(AdrasteaI_MQTTSupervisor_Process());
+}
+
+/**
+ * @brief Stops supervising the connection and disconnects from the broker.
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTSupervisor_Stop(void)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    bool ret = true;
+    AdrasteaI_MQTTSupervisor_running = false;
+
+    if ((AdrasteaI_MQTTSupervisor_state == AdrasteaI_MQTTSupervisor_State_Connecting) || (AdrasteaI_MQTTSupervisor_state == AdrasteaI_MQTTSupervisor_State_Connected))
+    {
+        ret = AdrasteaI_ATMQTT_Disconnect(AdrasteaI_MQTTSupervisor_config.connID);
+    }
+
+    AdrasteaI_MQTTSupervisor_SetState(AdrasteaI_MQTTSupervisor_State_Stopped);
+
+    return AdrasteaI_EndCommand(ret);
+}
+
+/**
+ * @brief Changes the broker configuration.
+ *
+ * If the configuration differs from the current one, it is sent to the module and an existing connection is
+ * re-established.
+ *
+ * @param[in] configP Broker configuration (copied)
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTSupervisor_SetConfig(const AdrasteaI_MQTTSupervisor_Config_t* configP)
+{
+    if ((configP == NULL) || (configP->connID <= AdrasteaI_ATMQTT_Conn_ID_Invalid) || (configP->connID >= AdrasteaI_ATMQTT_Conn_ID_NumberOfValues) || !AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    if (AdrasteaI_MQTTSupervisor_ConfigEquals(configP, &AdrasteaI_MQTTSupervisor_config))
+    {
+        return AdrasteaI_EndCommand(true);
+    }
+
+    bool ret = true;
+    if ((AdrasteaI_MQTTSupervisor_state == AdrasteaI_MQTTSupervisor_State_Connecting) || (AdrasteaI_MQTTSupervisor_state == AdrasteaI_MQTTSupervisor_State_Connected))
+    {
+        ret = AdrasteaI_ATMQTT_Disconnect(AdrasteaI_MQTTSupervisor_config.connID);
+        AdrasteaI_MQTTSupervisor_failedAttempts = 0;
+        AdrasteaI_MQTTSupervisor_SetState(AdrasteaI_MQTTSupervisor_State_WaitingForRegistration);
+    }
+
+    AdrasteaI_MQTTSupervisor_config = *configP;
+    AdrasteaI_MQTTSupervisor_configApplied = false;
+
+    return AdrasteaI_EndCommand(ret);
+}
+
+/**
+ * @brief Sends the broker configuration to the module again before the next connection attempt (e.g. after a reset of the module).
+ */
+void AdrasteaI_MQTTSupervisor_InvalidateConfig(void) { AdrasteaI_MQTTSupervisor_configApplied = false; }
+
+/**
+ * @brief Adds a subscription, which is restored after each (re-)connection.
+ *
+ * @param[in] qos Quality of service
+ * @param[in] topicName Topic (filter)
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTSupervisor_Subscribe(AdrasteaI_ATMQTT_QoS_t qos, const char* topicName)
+{
+    if ((topicName == NULL) || (strlen(topicName) >= sizeof(AdrasteaI_ATMQTT_Topic_Name_t)) || !AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_MQTTSupervisor_Subscription_t* subscriptionP = NULL;
+    for (uint8_t i = 0; i < ADRASTEAI_MQTT_SUPERVISOR_MAX_SUBSCRIPTIONS; i++)
+    {
+        AdrasteaI_MQTTSupervisor_Subscription_t* entryP = &AdrasteaI_MQTTSupervisor_subscriptions[i];
+        if (entryP->used && (0 == strcmp(entryP->topicName, topicName)))
+        {
+            subscriptionP = entryP;
+            break;
+        }
+        if (!entryP->used && (subscriptionP == NULL))
+        {
+            subscriptionP = entryP;
+        }
+    }
+
+    if (subscriptionP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    subscriptionP->used = true;
+    subscriptionP->qos = qos;
+    strcpy(subscriptionP->topicName, topicName);
+
+    if (AdrasteaI_MQTTSupervisor_state != AdrasteaI_MQTTSupervisor_State_Connected)
+    {
+        return AdrasteaI_EndCommand(true);
+    }
+
+    return AdrasteaI_EndCommand(AdrasteaI_ATMQTT_Subscribe(AdrasteaI_MQTTSupervisor_config.connID, qos, subscriptionP->topicName));
+}
+
+/**
+ * @brief Removes a subscription.
+ *
+ * @param[in] topicName Topic (filter)
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTSupervisor_Unsubscribe(const char* topicName)
+{
+    if ((topicName == NULL) || !AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < ADRASTEAI_MQTT_SUPERVISOR_MAX_SUBSCRIPTIONS; i++)
+    {
+        AdrasteaI_MQTTSupervisor_Subscription_t* subscriptionP = &AdrasteaI_MQTTSupervisor_subscriptions[i];
+        if (subscriptionP->used && (0 == strcmp(subscriptionP->topicName, topicName)))
+        {
+            subscriptionP->used = false;
+            if (AdrasteaI_MQTTSupervisor_state != AdrasteaI_MQTTSupervisor_State_Connected)
+            {
+                return AdrasteaI_EndCommand(true);
+            }
+            return AdrasteaI_EndCommand(AdrasteaI_ATMQTT_Unsubscribe(AdrasteaI_MQTTSupervisor_config.connID, subscriptionP->topicName));
+        }
+    }
+
+    return AdrasteaI_EndCommand(false);
+}
+
+/**
+ * @brief Processes the received notifications and (re-)connects if necessary.
+ *
+ * Must be called periodically.
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTSupervisor_Process(void)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    if (AdrasteaI_MQTTSupervisor_state == AdrasteaI_MQTTSupervisor_State_Stopped)
+    {
+        return AdrasteaI_EndCommand(true);
+    }
+
+    uint32_t interruptState = WE_EnterCriticalSection();
+    uint8_t events = AdrasteaI_MQTTSupervisor_events;
+    AdrasteaI_MQTTSupervisor_events = 0;
+    WE_ExitCriticalSection(interruptState);
+
+    uint32_t now = WE_GetTick();
+    bool registered = AdrasteaI_MQTTSupervisor_registered;
+
+    if (events & ADRASTEAI_MQTT_SUPERVISOR_EVENT_REGISTRATION_LOST)
+    {
+        AdrasteaI_MQTTSupervisor_statistics.registrationLosses++;
+    }
+
+    if ((events & ADRASTEAI_MQTT_SUPERVISOR_EVENT_REGISTERED) && registered)
+    {
+        /* Coverage is back, connect without waiting for the backoff delay */
+        AdrasteaI_MQTTSupervisor_registeredTick = now;
+        AdrasteaI_MQTTSupervisor_registrationRegained = AdrasteaI_MQTTSupervisor_connectionLost;
+        AdrasteaI_MQTTSupervisor_failedAttempts = 0;
+        if (AdrasteaI_MQTTSupervisor_state == AdrasteaI_MQTTSupervisor_State_Backoff)
+        {
+            AdrasteaI_MQTTSupervisor_SetState(AdrasteaI_MQTTSupervisor_State_WaitingForRegistration);
+        }
+    }
+
+    if ((events & ADRASTEAI_MQTT_SUPERVISOR_EVENT_CONNECTED) && (AdrasteaI_MQTTSupervisor_state != AdrasteaI_MQTTSupervisor_State_Connected))
+    {
+        AdrasteaI_MQTTSupervisor_OnConnected(now);
+        events &= (uint8_t)~(ADRASTEAI_MQTT_SUPERVISOR_EVENT_CONNECT_FAILED | ADRASTEAI_MQTT_SUPERVISOR_EVENT_DISCONNECTED);
+    }
+
+    switch (AdrasteaI_MQTTSupervisor_state)
+    {
+        case AdrasteaI_MQTTSupervisor_State_WaitingForRegistration:
+            if (registered)
+            {
+                AdrasteaI_MQTTSupervisor_Connect(now);
+            }
+            break;
+
+        case AdrasteaI_MQTTSupervisor_State_Connecting:
+            if (!registered)
+            {
+                AdrasteaI_MQTTSupervisor_SetState(AdrasteaI_MQTTSupervisor_State_WaitingForRegistration);
+            }
+            /* DISCONF is ignored here, it may confirm the disconnection requested by AdrasteaI_MQTTSupervisor_Start() */
+            else if ((events & ADRASTEAI_MQTT_SUPERVISOR_EVENT_CONNECT_FAILED) || (now - AdrasteaI_MQTTSupervisor_connectTick >= ADRASTEAI_MQTT_SUPERVISOR_CONNECT_TIMEOUT_MS))
+            {
+                AdrasteaI_MQTTSupervisor_statistics.connectFailures++;
+                AdrasteaI_MQTTSupervisor_StartBackoff(now);
+            }
+            break;
+
+        case AdrasteaI_MQTTSupervisor_State_Connected:
+            if (!registered || (events & (ADRASTEAI_MQTT_SUPERVISOR_EVENT_CONNECT_FAILED | ADRASTEAI_MQTT_SUPERVISOR_EVENT_DISCONNECTED)))
+            {
+                WE_LOG_WARNING(ATMQTT, "Connection %d lost", AdrasteaI_MQTTSupervisor_config.connID);
+                AdrasteaI_MQTTSupervisor_statistics.connectionLosses++;
+                AdrasteaI_MQTTSupervisor_lostTick = now;
+                AdrasteaI_MQTTSupervisor_connectionLost = true;
+                AdrasteaI_MQTTSupervisor_registrationRegained = false;
+                if (registered)
+                {
+                    AdrasteaI_MQTTSupervisor_StartBackoff(now);
+                }
+                else
+                {
+                    AdrasteaI_MQTTSupervisor_SetState(AdrasteaI_MQTTSupervisor_State_WaitingForRegistration);
+                }
+            }
+            break;
+
+        case AdrasteaI_MQTTSupervisor_State_Backoff:
+            if (!registered)
+            {
+                AdrasteaI_MQTTSupervisor_SetState(AdrasteaI_MQTTSupervisor_State_WaitingForRegistration);
+            }
+            else if (now - AdrasteaI_MQTTSupervisor_backoffStartTick >= AdrasteaI_MQTTSupervisor_statistics.currentBackoffMs)
+            {
+                AdrasteaI_MQTTSupervisor_Connect(now);
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Returns the connection state.
+ *
+ * @return Connection state
+ */
+AdrasteaI_MQTTSupervisor_State_t AdrasteaI_MQTTSupervisor_GetState(void) { return AdrasteaI_MQTTSupervisor_state; }
+
+/**
+ * @brief Returns the supervisor statistics.
+ *
+ * @param[out] statisticsP Statistics
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_MQTTSupervisor_GetStatistics(AdrasteaI_MQTTSupervisor_Statistics_t* statisticsP)
+{
+    if ((statisticsP == NULL) || !AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    *statisticsP = AdrasteaI_MQTTSupervisor_statistics;
+
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Records registration and connection changes.
+ *
+ * Is called by the driver for each received URC.
+ *
+ * @param[in] event Event type, parsed once by the driver for all URC handlers
+ * @param[in] pArguments Arguments following the event name (not modified, the line is passed on to the event callback afterwards)
+ */
+void AdrasteaI_MQTTSupervisor_HandleURC(AdrasteaI_ATEvent_t event, char* pArguments)
+{
+    if (!AdrasteaI_MQTTSupervisor_running)
+    {
+        return;
+    }
+
+    ATCommand_Arguments_t arguments;
+    /* The parsers set the low byte of the enumeration fields only */
+    AdrasteaI_ATPacketDomain_Network_Registration_Status_t status;
+    AdrasteaI_ATMQTT_Connection_Result_t result;
+    memset(&status, 0, sizeof(status));
+    memset(&result, 0, sizeof(result));
+
+    switch (event)
+    {
+        case AdrasteaI_ATEvent_PacketDomain_Network_Registration_Status:
+            if (AdrasteaI_ATPacketDomain_ParseNetworkRegistrationStatusEvent(pArguments, &status))
+            {
+                bool registered = AdrasteaI_MQTTSupervisor_IsRegistered(status.state);
+                if (registered != AdrasteaI_MQTTSupervisor_registered)
+                {
+                    AdrasteaI_MQTTSupervisor_registered = registered;
+                    AdrasteaI_MQTTSupervisor_events |= registered ? ADRASTEAI_MQTT_SUPERVISOR_EVENT_REGISTERED : ADRASTEAI_MQTT_SUPERVISOR_EVENT_REGISTRATION_LOST;
+                }
+            }
+            break;
+
+        case AdrasteaI_ATEvent_MQTT_Connection_Confirmation:
+            if (AdrasteaI_ATMQTT_ParseConnectionConfirmationEvent(pArguments, &result) && (result.connID == AdrasteaI_MQTTSupervisor_config.connID))
+            {
+                AdrasteaI_MQTTSupervisor_events |= (result.resultCode == AdrasteaI_ATMQTT_Event_Result_Code_Success) ? ADRASTEAI_MQTT_SUPERVISOR_EVENT_CONNECTED : ADRASTEAI_MQTT_SUPERVISOR_EVENT_CONNECT_FAILED;
+            }
+            break;
+
+        case AdrasteaI_ATEvent_MQTT_Disconnection_Confirmation:
+        case AdrasteaI_ATEvent_MQTT_Connection_Failure:
+            if (ATCommand_TokenizeArguments(pArguments, &arguments) && ATCommand_GetArgumentInt(&arguments, 0, &result.connID, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED) && (result.connID == AdrasteaI_MQTTSupervisor_config.connID))
+            {
+                AdrasteaI_MQTTSupervisor_events |= (event == AdrasteaI_ATEvent_MQTT_Connection_Failure) ? ADRASTEAI_MQTT_SUPERVISOR_EVENT_CONNECT_FAILED : ADRASTEAI_MQTT_SUPERVISOR_EVENT_DISCONNECTED;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+#endif /* ADRASTEAI_MQTT_SUPERVISOR */
@@ -0,0 +1,166 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Supervision of an MQTT connection with automatic reconnection (enabled by defining ADRASTEAI_MQTT_SUPERVISOR).
+ *
+ * The supervisor tracks the network registration (+CEREG notification) and the MQTT connection (CONCONF, DISCONF
+ * and CONFAIL notifications) and connects to the broker whenever the module is registered. Failed attempts are
+ * repeated after an exponentially growing delay with random jitter, so a fleet of devices does not reconnect in
+ * lockstep. When the registration is regained after a loss of coverage, the connection is attempted immediately.
+ *
+ * The broker configuration (AT%MQTTCFG NODES, IP and PROTOCOL) is only sent to the module when it has changed or
+ * when the connect command has been rejected. Subscriptions are cached and restored after each (re-)connection.
+ * Other settings such as TLS or the will message are kept by the module and can be configured once beforehand.
+ *
+ * Notifications are processed in AdrasteaI_MQTTSupervisor_Process(), which must be called periodically from a task.
+ * The durations of outages and the time needed to recover after coverage returns are recorded in the statistics.
+ */
+
+#ifndef ADRASTEAI_MQTTSUPERVISOR_H_INCLUDED
+#define ADRASTEAI_MQTTSUPERVISOR_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ATCommon.h"
+#include "ATEvent.h"
+#include "ATMQTT.h"
+
+#ifndef ADRASTEAI_MQTT_SUPERVISOR_MAX_SUBSCRIPTIONS
+/**
+ * @brief Max. number of cached subscriptions.
+ */
+#define ADRASTEAI_MQTT_SUPERVISOR_MAX_SUBSCRIPTIONS 8
+#endif
+
+#ifndef ADRASTEAI_MQTT_SUPERVISOR_MIN_BACKOFF_MS
+/**
+ * @brief Delay before the first retry after a failed connection attempt (milliseconds).
+ */
+#define ADRASTEAI_MQTT_SUPERVISOR_MIN_BACKOFF_MS 1000
+#endif
+
+#ifndef ADRASTEAI_MQTT_SUPERVISOR_MAX_BACKOFF_MS
+/**
+ * @brief Max. delay between connection attempts (milliseconds).
+ */
+#define ADRASTEAI_MQTT_SUPERVISOR_MAX_BACKOFF_MS 300000
+#endif
+
+#ifndef ADRASTEAI_MQTT_SUPERVISOR_CONNECT_TIMEOUT_MS
+/**
+ * @brief Time to wait for the CONCONF notification after the connect command (milliseconds).
+ */
+#define ADRASTEAI_MQTT_SUPERVISOR_CONNECT_TIMEOUT_MS 30000
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief Connection state.
+ */
+    typedef enum AdrasteaI_MQTTSupervisor_State_t
+    {
+        AdrasteaI_MQTTSupervisor_State_Invalid = -1,
+        AdrasteaI_MQTTSupervisor_State_Stopped,
+        AdrasteaI_MQTTSupervisor_State_WaitingForRegistration, /**< Not registered to the network */
+        AdrasteaI_MQTTSupervisor_State_Connecting,             /**< Waiting for the CONCONF notification */
+        AdrasteaI_MQTTSupervisor_State_Connected,
+        AdrasteaI_MQTTSupervisor_State_Backoff, /**< Waiting before the next connection attempt */
+        AdrasteaI_MQTTSupervisor_State_NumberOfValues
+    } AdrasteaI_MQTTSupervisor_State_t;
+
+    /**
+ * @brief Broker configuration.
+ */
+    typedef struct AdrasteaI_MQTTSupervisor_Config_t
+    {
+        AdrasteaI_ATMQTT_Conn_ID_t connID;
+        AdrasteaI_ATMQTT_Client_ID_t clientID;
+        AdrasteaI_ATCommon_IP_Addr_t addr;
+        AdrasteaI_ATCommon_Auth_Username_t username;
+        AdrasteaI_ATCommon_Auth_Password_t password;
+        AdrasteaI_ATMQTT_IP_Session_ID_t sessionID;
+        AdrasteaI_ATMQTT_IP_Addr_Format_t ipFormat;
+        AdrasteaI_ATCommon_Port_Number_t port;
+        AdrasteaI_ATMQTT_Keep_Alive_t keepAlive;
+        AdrasteaI_ATMQTT_Clean_Session_t cleanSession;
+    } AdrasteaI_MQTTSupervisor_Config_t;
+
+    /**
+ * @brief Called from AdrasteaI_MQTTSupervisor_Process() when the connection state has changed.
+ */
+    typedef void (*AdrasteaI_MQTTSupervisor_Callback_t)(AdrasteaI_MQTTSupervisor_State_t state, void* contextP);
+
+    /**
+ * @brief Supervisor statistics.
+ * @see AdrasteaI_MQTTSupervisor_GetStatistics()
+ */
+    typedef struct AdrasteaI_MQTTSupervisor_Statistics_t
+    {
+        AdrasteaI_MQTTSupervisor_State_t state;
+        uint32_t connectAttempts;     /**< Connect commands sent */
+        uint32_t connections;         /**< Connections established */
+        uint32_t connectFailures;     /**< Connection attempts failed or timed out */
+        uint32_t connectionLosses;    /**< Established connections lost */
+        uint32_t registrationLosses;  /**< Network registrations lost */
+        uint32_t configurations;      /**< Times the broker configuration has been sent */
+        uint32_t configurationsSaved; /**< Connection attempts without sending the broker configuration */
+        uint32_t currentBackoffMs;    /**< Delay before the next connection attempt (milliseconds) */
+        uint32_t lastOutageMs;        /**< Duration of the last outage, from connection loss to reconnection (milliseconds) */
+        uint32_t lastRecoveryMs;      /**< Time from the end of the last loss of coverage (or from the connection loss) to reconnection (milliseconds) */
+        uint32_t maxRecoveryMs;       /**< Max. value of lastRecoveryMs */
+    } AdrasteaI_MQTTSupervisor_Statistics_t;
+
+    extern bool AdrasteaI_MQTTSupervisor_Start(const AdrasteaI_MQTTSupervisor_Config_t* configP, AdrasteaI_MQTTSupervisor_Callback_t callback, void* contextP);
+
+    extern bool AdrasteaI_MQTTSupervisor_Stop(void);
+
+    extern bool AdrasteaI_MQTTSupervisor_SetConfig(const AdrasteaI_MQTTSupervisor_Config_t* configP);
+
+    extern void AdrasteaI_MQTTSupervisor_InvalidateConfig(void);
+
+    extern bool AdrasteaI_MQTTSupervisor_Subscribe(AdrasteaI_ATMQTT_QoS_t qos, const char* topicName);
+
+    extern bool AdrasteaI_MQTTSupervisor_Unsubscribe(const char* topicName);
+
+    extern bool AdrasteaI_MQTTSupervisor_Process(void);
+
+    extern AdrasteaI_MQTTSupervisor_State_t AdrasteaI_MQTTSupervisor_GetState(void);
+
+    extern bool AdrasteaI_MQTTSupervisor_GetStatistics(AdrasteaI_MQTTSupervisor_Statistics_t* statisticsP);
+
+    extern void AdrasteaI_MQTTSupervisor_HandleURC(AdrasteaI_ATEvent_t event, char* pArguments);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADRASTEAI_MQTTSUPERVISOR_H_INCLUDED */
@@ -0,0 +1,364 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Adrastea driver metrics (command latency histograms and error counters).
+ */
+
+#include <string.h>
+
+#include "AdrasteaI_Metrics.h"
+
+#ifdef ADRASTEAI_METRICS
+
+/**
+ * @brief Inclusive upper bounds (milliseconds) of the latency histogram buckets, the last bucket is unbounded.
+ */
+const uint32_t AdrasteaI_Metrics_BucketUpperBoundsMs[ADRASTEAI_METRICS_HISTOGRAM_BUCKETS] = {10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, UINT32_MAX};
+
+/**
+ * @brief Collected metrics.
+ */
+static AdrasteaI_Metrics_t AdrasteaI_metrics = {0};
+
+/**
+ * @brief Index of the command in AdrasteaI_metrics.commands the pending request belongs to (-1 if not tracked).
+ */
+static int16_t AdrasteaI_Metrics_pendingCommandIndex = -1;
+
+/**
+ * @brief Adds a sample to a latency histogram.
+ */
+static void AdrasteaI_Metrics_AddSample(AdrasteaI_Metrics_Histogram_t* histogramP, uint32_t latencyMs)
+{
+    uint8_t bucket = 0;
+    while ((bucket < ADRASTEAI_METRICS_HISTOGRAM_BUCKETS - 1) && (latencyMs > AdrasteaI_Metrics_BucketUpperBoundsMs[bucket]))
+    {
+        bucket++;
+    }
+    histogramP->buckets[bucket]++;
+    histogramP->count++;
+    histogramP->totalMs += latencyMs;
+    if (latencyMs > histogramP->maxMs)
+    {
+        histogramP->maxMs = latencyMs;
+    }
+}
+
+/**
+ * @brief Returns the index of a command in AdrasteaI_metrics.commands, adding it if it is not tracked yet.
+ *
+ * @return Index of the command or -1 if the table is full
+ */
+static int16_t AdrasteaI_Metrics_GetCommandIndex(const char* commandName)
+{
+    for (uint8_t i = 0; i < AdrasteaI_metrics.numCommands; i++)
+    {
+        if (0 == strncmp(AdrasteaI_metrics.commands[i].name, commandName, ADRASTEAI_METRICS_COMMAND_NAME_LENGTH - 1))
+        {
+            return i;
+        }
+    }
+
+    if (AdrasteaI_metrics.numCommands >= ADRASTEAI_METRICS_MAX_COMMANDS)
+    {
+        AdrasteaI_metrics.droppedCommands++;
+        return -1;
+    }
+
+    AdrasteaI_Metrics_Command_t* commandP = &AdrasteaI_metrics.commands[AdrasteaI_metrics.numCommands];
+    strncpy(commandP->name, commandName, ADRASTEAI_METRICS_COMMAND_NAME_LENGTH - 1);
+    commandP->name[ADRASTEAI_METRICS_COMMAND_NAME_LENGTH - 1] = '\0';
+    return AdrasteaI_metrics.numCommands++;
+}
+
+/**
+ * @brief Records a request sent to the module.
+ *
+ * @param[in] commandName Name of the command (without prefix "AT+", empty if not an AT command)
+ * @param[in] length Length of the request in bytes
+ */
+void AdrasteaI_Metrics_RequestSent(const char* commandName, uint32_t length)
+{
+    AdrasteaI_metrics.txBytes += length;
+    AdrasteaI_Metrics_pendingCommandIndex = (commandName[0] == '\0') ? -1 : AdrasteaI_Metrics_GetCommandIndex(commandName);
+}
+
+/**
+ * @brief Records the completion of the pending request.
+ *
+ * @param[in] timeoutType Timeout (i.e. command) type of the request
+ * @param[in] result Result of the request
+ * @param[in] latencyMs Time from sending the request to the confirmation (or timeout)
+ */
+void AdrasteaI_Metrics_RequestCompleted(AdrasteaI_Timeout_t timeoutType, AdrasteaI_Metrics_Result_t result, uint32_t latencyMs)
+{
+    AdrasteaI_Metrics_Command_t* commandP = (AdrasteaI_Metrics_pendingCommandIndex < 0) ? NULL : &AdrasteaI_metrics.commands[AdrasteaI_Metrics_pendingCommandIndex];
+    AdrasteaI_Metrics_pendingCommandIndex = -1;
+
+    switch (result)
+    {
+        case AdrasteaI_Metrics_Result_Timeout:
+            /* Timed out requests are not part of the latency histograms */
+            AdrasteaI_metrics.timeouts++;
+            if (commandP != NULL)
+            {
+                commandP->timeouts++;
+            }
+            return;
+        case AdrasteaI_Metrics_Result_Error:
+            AdrasteaI_metrics.errors++;
+            if (commandP != NULL)
+            {
+                commandP->errors++;
+            }
+            break;
+        default:
+            break;
+    }
+
+    if (timeoutType < AdrasteaI_Timeout_NumberOfValues)
+    {
+        AdrasteaI_Metrics_AddSample(&AdrasteaI_metrics.timeoutTypeLatency[timeoutType], latencyMs);
+    }
+    if (commandP != NULL)
+    {
+        AdrasteaI_Metrics_AddSample(&commandP->latency, latencyMs);
+    }
+}
+
+/**
+ * @brief Records bytes received from the module.
+ */
+void AdrasteaI_Metrics_BytesReceived(uint32_t length) { AdrasteaI_metrics.rxBytes += length; }
+
+/**
+ * @brief Records a received line that exceeded the receive buffer.
+ */
+void AdrasteaI_Metrics_RxOverrun(void) { AdrasteaI_metrics.rxOverruns++; }
+
+/**
+ * @brief Records a response that has been truncated to fit the response buffer.
+ */
+void AdrasteaI_Metrics_ResponseTruncated(void) { AdrasteaI_metrics.truncatedResponses++; }
+
+/**
+ * @brief Records a line passed to the event callback.
+ *
+ * @param[in] event Event type parsed by the driver (AdrasteaI_ATEvent_Invalid if unknown)
+ */
+void AdrasteaI_Metrics_URCReceived(AdrasteaI_ATEvent_t event)
+{
+    if ((event >= 0) && (event < AdrasteaI_ATEvent_NumberOfValues))
+    {
+        AdrasteaI_metrics.urcs[event]++;
+    }
+    else
+    {
+        AdrasteaI_metrics.unknownURCs++;
+    }
+}
+
+/**
+ * @brief Returns a snapshot of the driver metrics.
+ *
+ * Holds the command lock while copying, so the command related metrics are consistent.
+ *
+ * @param[out] snapshotP Metrics are returned in this argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Metrics_GetSnapshot(AdrasteaI_Metrics_t* snapshotP)
+{
+    if (snapshotP == NULL)
+    {
+        return false;
+    }
+
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    memcpy(snapshotP, &AdrasteaI_metrics, sizeof(AdrasteaI_metrics));
+
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Resets all driver metrics.
+ */
+void AdrasteaI_Metrics_Reset(void)
+{
+    bool locked = AdrasteaI_BeginCommand();
+
+    memset(&AdrasteaI_metrics, 0, sizeof(AdrasteaI_metrics));
+    AdrasteaI_Metrics_pendingCommandIndex = -1;
+
+    if (locked)
+    {
+        AdrasteaI_EndCommand(true);
+    }
+}
+
+/**
+ * @brief Appends an unsigned LEB128 encoded value to the export buffer.
+ */
+static bool AdrasteaI_Metrics_PutVarint(uint8_t* pOutBuffer, uint16_t bufferSize, uint16_t* pOffset, uint32_t value)
+{
+    do
+    {
+        if (*pOffset >= bufferSize)
+        {
+            return false;
+        }
+        uint8_t b = value & 0x7F;
+        value >>= 7;
+        pOutBuffer[(*pOffset)++] = (value != 0) ? (b | 0x80) : b;
+    } while (value != 0);
+    return true;
+}
+
+static bool AdrasteaI_Metrics_PutHistogram(uint8_t* pOutBuffer, uint16_t bufferSize, uint16_t* pOffset, const AdrasteaI_Metrics_Histogram_t* histogramP)
+{
+    if (!AdrasteaI_Metrics_PutVarint(pOutBuffer, bufferSize, pOffset, histogramP->count) || !AdrasteaI_Metrics_PutVarint(pOutBuffer, bufferSize, pOffset, histogramP->totalMs) || !AdrasteaI_Metrics_PutVarint(pOutBuffer, bufferSize, pOffset, histogramP->maxMs))
+    {
+        return false;
+    }
+    for (uint8_t i = 0; i < ADRASTEAI_METRICS_HISTOGRAM_BUCKETS; i++)
+    {
+        if (!AdrasteaI_Metrics_PutVarint(pOutBuffer, bufferSize, pOffset, histogramP->buckets[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Writes the export format described at AdrasteaI_Metrics_Export(), the command lock has to be held by the caller.
+ */
+static bool AdrasteaI_Metrics_Write(const AdrasteaI_Metrics_t* metricsP, uint8_t* pOutBuffer, uint16_t bufferSize, uint16_t* pOutLength)
+{
+    uint16_t offset = 0;
+    pOutBuffer[offset++] = 'A';
+    pOutBuffer[offset++] = 'M';
+    pOutBuffer[offset++] = ADRASTEAI_METRICS_EXPORT_VERSION;
+    pOutBuffer[offset++] = ADRASTEAI_METRICS_HISTOGRAM_BUCKETS;
+
+    const uint32_t header[] = {AdrasteaI_Timeout_NumberOfValues, AdrasteaI_ATEvent_NumberOfValues, metricsP->numCommands, metricsP->txBytes, metricsP->rxBytes, metricsP->timeouts, metricsP->errors, metricsP->truncatedResponses, metricsP->rxOverruns, metricsP->unknownURCs, metricsP->droppedCommands};
+    for (uint8_t i = 0; i < sizeof(header) / sizeof(header[0]); i++)
+    {
+        if (!AdrasteaI_Metrics_PutVarint(pOutBuffer, bufferSize, &offset, header[i]))
+        {
+            return false;
+        }
+    }
+
+    for (uint8_t i = 0; i < ADRASTEAI_METRICS_HISTOGRAM_BUCKETS; i++)
+    {
+        uint32_t bound = (AdrasteaI_Metrics_BucketUpperBoundsMs[i] == UINT32_MAX) ? 0 : AdrasteaI_Metrics_BucketUpperBoundsMs[i];
+        if (!AdrasteaI_Metrics_PutVarint(pOutBuffer, bufferSize, &offset, bound))
+        {
+            return false;
+        }
+    }
+
+    for (uint8_t i = 0; i < AdrasteaI_Timeout_NumberOfValues; i++)
+    {
+        if (!AdrasteaI_Metrics_PutHistogram(pOutBuffer, bufferSize, &offset, &metricsP->timeoutTypeLatency[i]))
+        {
+            return false;
+        }
+    }
+
+    for (uint16_t i = 0; i < AdrasteaI_ATEvent_NumberOfValues; i++)
+    {
+        if (!AdrasteaI_Metrics_PutVarint(pOutBuffer, bufferSize, &offset, metricsP->urcs[i]))
+        {
+            return false;
+        }
+    }
+
+    for (uint8_t i = 0; i < metricsP->numCommands; i++)
+    {
+        const AdrasteaI_Metrics_Command_t* commandP = &metricsP->commands[i];
+        uint8_t nameLength = (uint8_t)strlen(commandP->name);
+
+        if (offset + 1 + nameLength > bufferSize)
+        {
+            return false;
+        }
+        pOutBuffer[offset++] = nameLength;
+        memcpy(&pOutBuffer[offset], commandP->name, nameLength);
+        offset += nameLength;
+
+        if (!AdrasteaI_Metrics_PutVarint(pOutBuffer, bufferSize, &offset, commandP->timeouts) || !AdrasteaI_Metrics_PutVarint(pOutBuffer, bufferSize, &offset, commandP->errors) || !AdrasteaI_Metrics_PutHistogram(pOutBuffer, bufferSize, &offset, &commandP->latency))
+        {
+            return false;
+        }
+    }
+
+    *pOutLength = offset;
+    return true;
+}
+
+/**
+ * @brief Exports a snapshot of the driver metrics in a compact binary format.
+ *
+ * All numbers are unsigned LEB128 varints unless noted otherwise:
+ * - header: 'A', 'M', version (byte), number of histogram buckets (byte)
+ * - number of timeout types, number of event types, number of commands
+ * - txBytes, rxBytes, timeouts, errors, truncatedResponses, rxOverruns, unknownURCs, droppedCommands
+ * - bucket upper bounds (the unbounded last bucket is written as 0)
+ * - one histogram per timeout type
+ * - one counter per event type
+ * - per command: name length (byte), name (without terminating zero), timeouts, errors, histogram
+ *
+ * A histogram is written as count, totalMs, maxMs followed by the bucket counters.
+ *
+ * @param[out] pOutBuffer Buffer receiving the exported data
+ * @param[in] bufferSize Size of pOutBuffer
+ * @param[out] pOutLength Number of bytes written to pOutBuffer
+ *
+ * @return true if successful, false otherwise (e.g. buffer too small)
+ */
+bool AdrasteaI_Metrics_Export(uint8_t* pOutBuffer, uint16_t bufferSize, uint16_t* pOutLength)
+{
+    if ((pOutBuffer == NULL) || (pOutLength == NULL) || (bufferSize < 4))
+    {
+        return false;
+    }
+
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    return AdrasteaI_EndCommand(AdrasteaI_Metrics_Write(&AdrasteaI_metrics, pOutBuffer, bufferSize, pOutLength));
+}
+
+#endif /* ADRASTEAI_METRICS */
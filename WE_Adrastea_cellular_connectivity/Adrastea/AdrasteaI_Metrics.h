@@ -0,0 +1,140 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Adrastea driver metrics (command latency histograms and error counters).
+ *
+ * Metrics are collected if ADRASTEAI_METRICS is defined for all driver sources.
+ */
+
+#ifndef ADRASTEAI_METRICS_H_INCLUDED
+#define ADRASTEAI_METRICS_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ATEvent.h"
+#include "AdrasteaI.h"
+
+/**
+ * @brief Number of latency histogram buckets.
+ * @see AdrasteaI_Metrics_BucketUpperBoundsMs
+ */
+#define ADRASTEAI_METRICS_HISTOGRAM_BUCKETS 12
+
+#ifndef ADRASTEAI_METRICS_MAX_COMMANDS
+/**
+ * @brief Max. number of distinct command names tracked. Commands beyond this are counted in droppedCommands.
+ */
+#define ADRASTEAI_METRICS_MAX_COMMANDS 32
+#endif
+
+/**
+ * @brief Max. length of a tracked command name (without prefix "AT+", including terminating zero).
+ */
+#define ADRASTEAI_METRICS_COMMAND_NAME_LENGTH 16
+
+/**
+ * @brief Version of the binary format written by AdrasteaI_Metrics_Export().
+ */
+#define ADRASTEAI_METRICS_EXPORT_VERSION 1
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief Latency histogram.
+ */
+    typedef struct AdrasteaI_Metrics_Histogram_t
+    {
+        uint32_t count;                                       /**< Number of samples */
+        uint32_t totalMs;                                     /**< Sum of all samples (milliseconds) */
+        uint32_t maxMs;                                       /**< Largest sample (milliseconds) */
+        uint32_t buckets[ADRASTEAI_METRICS_HISTOGRAM_BUCKETS]; /**< Samples per bucket, see AdrasteaI_Metrics_BucketUpperBoundsMs */
+    } AdrasteaI_Metrics_Histogram_t;
+
+    /**
+ * @brief Metrics of one command (identified by its name, e.g. "CSQ" for AT+CSQ).
+ */
+    typedef struct AdrasteaI_Metrics_Command_t
+    {
+        char name[ADRASTEAI_METRICS_COMMAND_NAME_LENGTH];
+        uint32_t timeouts;                     /**< Number of commands without confirmation */
+        uint32_t errors;                       /**< Number of ERROR responses */
+        AdrasteaI_Metrics_Histogram_t latency; /**< Time from sending the request to receiving the confirmation */
+    } AdrasteaI_Metrics_Command_t;
+
+    /**
+ * @brief Snapshot of all driver metrics.
+ */
+    typedef struct AdrasteaI_Metrics_t
+    {
+        uint32_t txBytes;                                                      /**< Bytes of AT requests sent to the module */
+        uint32_t rxBytes;                                                      /**< Bytes received from the module */
+        uint32_t timeouts;                                                     /**< Commands without confirmation */
+        uint32_t errors;                                                       /**< ERROR responses */
+        uint32_t truncatedResponses;                                           /**< Responses that did not fit into the response buffer */
+        uint32_t rxOverruns;                                                   /**< Received lines that exceeded ADRASTEAI_LINE_MAX_SIZE */
+        uint32_t unknownURCs;                                                  /**< Lines passed to the event callback with unknown event type */
+        uint32_t droppedCommands;                                              /**< Commands not tracked because the command table was full */
+        uint32_t urcs[AdrasteaI_ATEvent_NumberOfValues];                       /**< Lines passed to the event callback per event type */
+        AdrasteaI_Metrics_Histogram_t timeoutTypeLatency[AdrasteaI_Timeout_NumberOfValues]; /**< Latency per timeout (i.e. command) type */
+        uint8_t numCommands;                                                   /**< Number of valid entries in commands */
+        AdrasteaI_Metrics_Command_t commands[ADRASTEAI_METRICS_MAX_COMMANDS];  /**< Metrics per command name */
+    } AdrasteaI_Metrics_t;
+
+    /**
+ * @brief Result of a command as recorded by the metrics.
+ */
+    typedef enum AdrasteaI_Metrics_Result_t
+    {
+        AdrasteaI_Metrics_Result_Success,
+        AdrasteaI_Metrics_Result_Error,
+        AdrasteaI_Metrics_Result_Timeout,
+        AdrasteaI_Metrics_Result_NumberOfValues
+    } AdrasteaI_Metrics_Result_t;
+
+    extern const uint32_t AdrasteaI_Metrics_BucketUpperBoundsMs[ADRASTEAI_METRICS_HISTOGRAM_BUCKETS];
+
+    extern bool AdrasteaI_Metrics_GetSnapshot(AdrasteaI_Metrics_t* snapshotP);
+    extern void AdrasteaI_Metrics_Reset(void);
+    extern bool AdrasteaI_Metrics_Export(uint8_t* pOutBuffer, uint16_t bufferSize, uint16_t* pOutLength);
+
+    /* Called by the driver */
+    extern void AdrasteaI_Metrics_RequestSent(const char* commandName, uint32_t length);
+    extern void AdrasteaI_Metrics_RequestCompleted(AdrasteaI_Timeout_t timeoutType, AdrasteaI_Metrics_Result_t result, uint32_t latencyMs);
+    extern void AdrasteaI_Metrics_BytesReceived(uint32_t length);
+    extern void AdrasteaI_Metrics_RxOverrun(void);
+    extern void AdrasteaI_Metrics_ResponseTruncated(void);
+    extern void AdrasteaI_Metrics_URCReceived(AdrasteaI_ATEvent_t event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADRASTEAI_METRICS_H_INCLUDED */
@@ -0,0 +1,239 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief poll()-style readiness multiplexer for module sockets (enabled by defining ADRASTEAI_POLL).
+ */
+
+#include <string.h>
+
+#include "ATEvent.h"
+#include "AdrasteaI_Poll.h"
+#include "global.h"
+#include "os.h"
+
+#ifdef ADRASTEAI_POLL
+
+/**
+ * @brief Index of the conditions in the notification counters (bit number of the ADRASTEAI_POLL_xxx flag).
+ */
+typedef enum AdrasteaI_Poll_Condition_t
+{
+    AdrasteaI_Poll_Condition_Readable,
+    AdrasteaI_Poll_Condition_IdleDeactivated,
+    AdrasteaI_Poll_Condition_Terminated,
+    AdrasteaI_Poll_Condition_Accepted,
+    AdrasteaI_Poll_Condition_NumberOfValues
+} AdrasteaI_Poll_Condition_t;
+
+#define ADRASTEAI_POLL_CONDITIONS AdrasteaI_Poll_Condition_NumberOfValues
+
+/**
+ * @brief Number of notifications received per socket ID and condition.
+ *
+ * The counters are only incremented by the URC handler. The waiting task compares a snapshot of each counter to
+ * AdrasteaI_Poll_consumed and stores the snapshot when reporting the condition, so notifications received while
+ * the task evaluates them are not lost.
+ */
+static volatile uint8_t AdrasteaI_Poll_received[ADRASTEAI_POLL_MAX_SOCKET_ID + 1][ADRASTEAI_POLL_CONDITIONS];
+
+/**
+ * @brief Number of notifications reported per socket ID and condition.
+ */
+static uint8_t AdrasteaI_Poll_consumed[ADRASTEAI_POLL_MAX_SOCKET_ID + 1][ADRASTEAI_POLL_CONDITIONS];
+
+/**
+ * @brief Given by the URC handler for each recorded notification to wake up the waiting task.
+ */
+static WE_OS_Semaphore_t AdrasteaI_Poll_semaphore;
+static volatile bool AdrasteaI_Poll_semaphoreInitialized = false;
+
+/**
+ * @brief Evaluates the recorded notifications for all entries.
+ *
+ * The ADRASTEAI_POLL_READABLE and ADRASTEAI_POLL_ACCEPTED conditions reported are consumed.
+ *
+ * @return Number of entries with conditions that occurred
+ */
+static uint8_t AdrasteaI_Poll_Check(AdrasteaI_Poll_Entry_t* entries, uint8_t entryCount)
+{
+    uint8_t readyCount = 0;
+
+    for (uint8_t i = 0; i < entryCount; i++)
+    {
+        AdrasteaI_Poll_Entry_t* entryP = &entries[i];
+        entryP->revents = 0;
+
+        if ((entryP->socketID == AdrasteaI_ATSocket_ID_Invalid) || (entryP->socketID > ADRASTEAI_POLL_MAX_SOCKET_ID))
+        {
+            continue;
+        }
+
+        for (uint8_t condition = AdrasteaI_Poll_Condition_Readable; condition < ADRASTEAI_POLL_CONDITIONS; condition++)
+        {
+            uint8_t flag = (uint8_t)(1 << condition);
+            if ((entryP->events & flag) == 0)
+            {
+                continue;
+            }
+
+            uint8_t received = AdrasteaI_Poll_received[entryP->socketID][condition];
+            if (received != AdrasteaI_Poll_consumed[entryP->socketID][condition])
+            {
+                entryP->revents |= flag;
+                if ((condition == AdrasteaI_Poll_Condition_Readable) || (condition == AdrasteaI_Poll_Condition_Accepted))
+                {
+                    AdrasteaI_Poll_consumed[entryP->socketID][condition] = received;
+                }
+            }
+        }
+
+        if (entryP->revents != 0)
+        {
+            readyCount++;
+        }
+    }
+
+    return readyCount;
+}
+
+/**
+ * @brief Waits until one of the conditions of a set of sockets occurs.
+ *
+ * The ADRASTEAI_POLL_READABLE and ADRASTEAI_POLL_ACCEPTED conditions reported are consumed, i.e. they are reported
+ * again only after the next notification of the module.
+ *
+ * The calling task sleeps until a notification is received, only one task may wait at a time.
+ * Must not be called from the event callback with a timeout other than 0.
+ *
+ * @param[in,out] entries Sockets and conditions to wait for, revents contains the conditions that occurred on return
+ * @param[in] entryCount Number of entries
+ * @param[in] timeoutMs Max. time to wait in milliseconds (0: return immediately, WE_OS_WAIT_FOREVER: no timeout)
+ * @param[out] readyCountP Number of entries with conditions that occurred (0 on timeout)
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Poll_Wait(AdrasteaI_Poll_Entry_t* entries, uint8_t entryCount, uint32_t timeoutMs, uint8_t* readyCountP)
+{
+    if ((entries == NULL) || (readyCountP == NULL))
+    {
+        return false;
+    }
+
+    if (!AdrasteaI_Poll_semaphoreInitialized)
+    {
+        if (!WE_OS_SemaphoreInit(&AdrasteaI_Poll_semaphore, 0, 1))
+        {
+            return false;
+        }
+        AdrasteaI_Poll_semaphoreInitialized = true;
+    }
+
+    uint32_t startTime = WE_GetTick();
+    uint8_t readyCount;
+    while (0 == (readyCount = AdrasteaI_Poll_Check(entries, entryCount)))
+    {
+        uint32_t elapsed = WE_GetTick() - startTime;
+        if ((timeoutMs != WE_OS_WAIT_FOREVER) && (elapsed >= timeoutMs))
+        {
+            break;
+        }
+
+        /* A notification recorded since the check has given the semaphore already, so it is not missed */
+        WE_OS_SemaphoreTake(&AdrasteaI_Poll_semaphore, (timeoutMs == WE_OS_WAIT_FOREVER) ? WE_OS_WAIT_FOREVER : (timeoutMs - elapsed));
+    }
+
+    *readyCountP = readyCount;
+    return true;
+}
+
+/**
+ * @brief Discards the recorded notifications of a socket ID. Should be called when a socket is allocated.
+ *
+ * @param[in] socketID Module socket ID
+ */
+void AdrasteaI_Poll_Reset(AdrasteaI_ATSocket_ID_t socketID)
+{
+    if ((socketID == AdrasteaI_ATSocket_ID_Invalid) || (socketID > ADRASTEAI_POLL_MAX_SOCKET_ID))
+    {
+        return;
+    }
+
+    for (uint8_t condition = AdrasteaI_Poll_Condition_Readable; condition < ADRASTEAI_POLL_CONDITIONS; condition++)
+    {
+        AdrasteaI_Poll_consumed[socketID][condition] = AdrasteaI_Poll_received[socketID][condition];
+    }
+}
+
+/**
+ * @brief Records %SOCKETEV notifications. Is called by the driver for each received URC.
+ *
+ * @param[in] event Event type, parsed once by the driver for all URC handlers
+ * @param[in] pArguments Arguments following the event name (not modified, the line is passed on to the event callback afterwards)
+ */
+void AdrasteaI_Poll_HandleURC(AdrasteaI_ATEvent_t event, char* pArguments)
+{
+    AdrasteaI_ATSocket_ID_t socketID = AdrasteaI_ATSocket_ID_Invalid;
+    AdrasteaI_Poll_Condition_t condition;
+    switch (event)
+    {
+        case AdrasteaI_ATEvent_Socket_Data_Received:
+            condition = AdrasteaI_Poll_Condition_Readable;
+            AdrasteaI_ATSocket_ParseDataReceivedEvent(pArguments, &socketID);
+            break;
+        case AdrasteaI_ATEvent_Socket_Deactivated_Idle_Timer:
+            condition = AdrasteaI_Poll_Condition_IdleDeactivated;
+            AdrasteaI_ATSocket_ParseSocketTerminatedEvent(pArguments, &socketID);
+            break;
+        case AdrasteaI_ATEvent_Socket_Terminated_By_Peer:
+            condition = AdrasteaI_Poll_Condition_Terminated;
+            AdrasteaI_ATSocket_ParseSocketTerminatedEvent(pArguments, &socketID);
+            break;
+        case AdrasteaI_ATEvent_Socket_New_Socket_Accepted:
+        {
+            AdrasteaI_ATSocket_Accepted_t accepted;
+            condition = AdrasteaI_Poll_Condition_Accepted;
+            if (AdrasteaI_ATSocket_ParseNewSocketAcceptedEvent(pArguments, &accepted))
+            {
+                socketID = accepted.listenSocketID;
+            }
+            break;
+        }
+        default:
+            return;
+    }
+
+    if ((socketID != AdrasteaI_ATSocket_ID_Invalid) && (socketID <= ADRASTEAI_POLL_MAX_SOCKET_ID))
+    {
+        AdrasteaI_Poll_received[socketID][condition]++;
+        if (AdrasteaI_Poll_semaphoreInitialized)
+        {
+            WE_OS_SemaphoreGive(&AdrasteaI_Poll_semaphore);
+        }
+    }
+}
+
+#endif /* ADRASTEAI_POLL */
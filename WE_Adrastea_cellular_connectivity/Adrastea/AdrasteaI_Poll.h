@@ -0,0 +1,86 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief poll()-style readiness multiplexer for module sockets (enabled by defining ADRASTEAI_POLL).
+ *
+ * The multiplexer records the %SOCKETEV notifications of the module per socket ID as they are received.
+ * AdrasteaI_Poll_Wait() only evaluates these records, so waiting for sockets causes no AT traffic. The waiting task
+ * sleeps on a semaphore that is given for each recorded notification.
+ * The notifications must be enabled using AdrasteaI_ATSocket_SetSocketUnsolicitedNotificationEvents().
+ *
+ * Data received and new connection notifications are reported once (edge triggered), the application is expected
+ * to read all data or accept the connection when they are reported. Termination notifications are reported until
+ * the socket ID is reset by AdrasteaI_Poll_Reset(), which should be called when a socket is allocated.
+ */
+
+#ifndef ADRASTEAI_POLL_H_INCLUDED
+#define ADRASTEAI_POLL_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ATEvent.h"
+#include "ATSocket.h"
+
+#ifndef ADRASTEAI_POLL_MAX_SOCKET_ID
+/**
+ * @brief Highest module socket ID tracked. Notifications for higher IDs are ignored.
+ */
+#define ADRASTEAI_POLL_MAX_SOCKET_ID 16
+#endif
+
+#define ADRASTEAI_POLL_READABLE (1 << 0)         /**< Data has been received (%SOCKETEV: 1) */
+#define ADRASTEAI_POLL_IDLE_DEACTIVATED (1 << 1) /**< Socket has been deactivated by the idle timer (%SOCKETEV: 2) */
+#define ADRASTEAI_POLL_TERMINATED (1 << 2)       /**< Connection has been terminated by the peer (%SOCKETEV: 3) */
+#define ADRASTEAI_POLL_ACCEPTED (1 << 3)         /**< Listening socket has accepted a connection (%SOCKETEV: 4) */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief Socket to wait for.
+ */
+    typedef struct AdrasteaI_Poll_Entry_t
+    {
+        AdrasteaI_ATSocket_ID_t socketID; /**< Module socket ID */
+        uint8_t events;                   /**< Conditions to wait for (ADRASTEAI_POLL_xxx) */
+        uint8_t revents;                  /**< Output: Conditions that occurred */
+    } AdrasteaI_Poll_Entry_t;
+
+    extern bool AdrasteaI_Poll_Wait(AdrasteaI_Poll_Entry_t* entries, uint8_t entryCount, uint32_t timeoutMs, uint8_t* readyCountP);
+
+    extern void AdrasteaI_Poll_Reset(AdrasteaI_ATSocket_ID_t socketID);
+
+    extern void AdrasteaI_Poll_HandleURC(AdrasteaI_ATEvent_t event, char* pArguments);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADRASTEAI_POLL_H_INCLUDED */
@@ -0,0 +1,319 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Cache of kept SSL sessions for resuming TLS sessions on reconnect (enabled by defining ADRASTEAI_SSL_SESSION_CACHE).
+ */
+
+#include <string.h>
+
+#include "AdrasteaI.h"
+#include "AdrasteaI_SSLSessionCache.h"
+#include "global.h"
+#include "log.h"
+
+#ifdef ADRASTEAI_SSL_SESSION_CACHE
+
+/**
+ * @brief Cached session.
+ */
+typedef struct AdrasteaI_SSLSessionCache_Entry_t
+{
+    bool used;
+    AdrasteaI_ATCommon_Session_ID_t sessionID; /**< ID of the socket that kept the session */
+    AdrasteaI_ATCommon_SSL_Profile_ID_t profileID;
+    AdrasteaI_ATCommon_Port_Number_t port;
+    uint32_t createdTime;
+    uint32_t lastUsedTime;
+    char host[ADRASTEAI_SSL_SESSION_CACHE_HOST_LENGTH];
+} AdrasteaI_SSLSessionCache_Entry_t;
+
+static AdrasteaI_SSLSessionCache_Entry_t AdrasteaI_SSLSessionCache_entries[ADRASTEAI_SSL_SESSION_CACHE_SIZE];
+
+static AdrasteaI_SSLSessionCache_Statistics_t AdrasteaI_SSLSessionCache_statistics;
+
+/**
+ * @brief Deletes the session of an entry in the module and frees the entry.
+ */
+static void AdrasteaI_SSLSessionCache_Remove(AdrasteaI_SSLSessionCache_Entry_t* entryP)
+{
+    /* If deleting fails, the module has discarded the session already */
+    AdrasteaI_ATSocket_DeleteSocketSSLSession(entryP->sessionID);
+    entryP->used = false;
+}
+
+/**
+ * @brief Removes all sessions older than ADRASTEAI_SSL_SESSION_CACHE_MAX_AGE_MS.
+ */
+static void AdrasteaI_SSLSessionCache_RemoveExpired(void)
+{
+    uint32_t now = WE_GetTick();
+    for (uint8_t i = 0; i < ADRASTEAI_SSL_SESSION_CACHE_SIZE; i++)
+    {
+        AdrasteaI_SSLSessionCache_Entry_t* entryP = &AdrasteaI_SSLSessionCache_entries[i];
+        if (entryP->used && ((now - entryP->createdTime) > ADRASTEAI_SSL_SESSION_CACHE_MAX_AGE_MS))
+        {
+            WE_LOG_DEBUG(SSLSessionCache, "Session %u expired", entryP->sessionID);
+            AdrasteaI_SSLSessionCache_Remove(entryP);
+            AdrasteaI_SSLSessionCache_statistics.evictionsAge++;
+        }
+    }
+}
+
+/**
+ * @brief Returns the entry of a destination (NULL if there is none).
+ */
+static AdrasteaI_SSLSessionCache_Entry_t* AdrasteaI_SSLSessionCache_Find(const char* host, AdrasteaI_ATCommon_Port_Number_t port, AdrasteaI_ATCommon_SSL_Profile_ID_t profileID)
+{
+    for (uint8_t i = 0; i < ADRASTEAI_SSL_SESSION_CACHE_SIZE; i++)
+    {
+        AdrasteaI_SSLSessionCache_Entry_t* entryP = &AdrasteaI_SSLSessionCache_entries[i];
+        if (entryP->used && (entryP->port == port) && (entryP->profileID == profileID) && (0 == strcmp(entryP->host, host)))
+        {
+            return entryP;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Activates a socket with SSL, resuming a cached session to the same destination if possible.
+ *
+ * If the module fails to activate the socket with the cached session, the session is deleted and the socket is
+ * activated with a full handshake. After a full handshake, the new session is kept and added to the cache.
+ * SSL must have been added to the socket using AdrasteaI_ATSocket_AddSSLtoSocket() with the same profile.
+ *
+ * @param[in] socketID Socket ID
+ * @param[in] host Destination host the socket has been allocated with
+ * @param[in] port Destination port the socket has been allocated with
+ * @param[in] profileID SSL profile of the socket
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_SSLSessionCache_ActivateSocket(AdrasteaI_ATSocket_ID_t socketID, const char* host, AdrasteaI_ATCommon_Port_Number_t port, AdrasteaI_ATCommon_SSL_Profile_ID_t profileID)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_ATCommon_Session_ID_t sessionID = AdrasteaI_SSLSessionCache_Lookup(host, port, profileID);
+    if (sessionID != AdrasteaI_ATCommon_Session_ID_Invalid)
+    {
+        if (AdrasteaI_ATSocket_ActivateSocket(socketID, sessionID))
+        {
+            AdrasteaI_SSLSessionCache_statistics.handshakesSaved++;
+            WE_LOG_DEBUG(SSLSessionCache, "Socket %u: resumed session %u", socketID, sessionID);
+            return AdrasteaI_EndCommand(true);
+        }
+
+        WE_LOG_WARNING(SSLSessionCache, "Socket %u: failed to resume session %u", socketID, sessionID);
+        AdrasteaI_SSLSessionCache_statistics.resumeFailures++;
+        AdrasteaI_SSLSessionCache_Invalidate(sessionID);
+    }
+
+    if (!AdrasteaI_ATSocket_ActivateSocket(socketID, AdrasteaI_ATCommon_Session_ID_Invalid))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    AdrasteaI_SSLSessionCache_statistics.fullHandshakes++;
+
+    /* The socket is usable even if its session cannot be kept */
+    AdrasteaI_SSLSessionCache_Store(socketID, host, port, profileID);
+
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Returns the cached session of a destination and marks it as recently used.
+ *
+ * @param[in] host Destination host
+ * @param[in] port Destination port
+ * @param[in] profileID SSL profile
+ *
+ * @return Session ID to pass to AdrasteaI_ATSocket_ActivateSocket() (AdrasteaI_ATCommon_Session_ID_Invalid if there is none)
+ */
+AdrasteaI_ATCommon_Session_ID_t AdrasteaI_SSLSessionCache_Lookup(const char* host, AdrasteaI_ATCommon_Port_Number_t port, AdrasteaI_ATCommon_SSL_Profile_ID_t profileID)
+{
+    if ((host == NULL) || !AdrasteaI_BeginCommand())
+    {
+        return AdrasteaI_ATCommon_Session_ID_Invalid;
+    }
+
+    AdrasteaI_SSLSessionCache_RemoveExpired();
+
+    AdrasteaI_ATCommon_Session_ID_t sessionID = AdrasteaI_ATCommon_Session_ID_Invalid;
+    AdrasteaI_SSLSessionCache_Entry_t* entryP = AdrasteaI_SSLSessionCache_Find(host, port, profileID);
+    if (entryP != NULL)
+    {
+        entryP->lastUsedTime = WE_GetTick();
+        sessionID = entryP->sessionID;
+    }
+
+    AdrasteaI_EndCommand(true);
+    return sessionID;
+}
+
+/**
+ * @brief Keeps the SSL session of an activated socket in the module and adds it to the cache.
+ *
+ * A session cached for the same destination before is replaced. If the cache is full, the least recently used
+ * session is evicted.
+ *
+ * @param[in] socketID Socket ID
+ * @param[in] host Destination host the socket has been allocated with
+ * @param[in] port Destination port the socket has been allocated with
+ * @param[in] profileID SSL profile of the socket
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_SSLSessionCache_Store(AdrasteaI_ATSocket_ID_t socketID, const char* host, AdrasteaI_ATCommon_Port_Number_t port, AdrasteaI_ATCommon_SSL_Profile_ID_t profileID)
+{
+    if ((host == NULL) || (strlen(host) >= ADRASTEAI_SSL_SESSION_CACHE_HOST_LENGTH))
+    {
+        return false;
+    }
+
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    if (!AdrasteaI_ATSocket_KeepSocketSSLSession(socketID))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    AdrasteaI_SSLSessionCache_RemoveExpired();
+
+    AdrasteaI_SSLSessionCache_Entry_t* entryP = NULL;
+    for (uint8_t i = 0; i < ADRASTEAI_SSL_SESSION_CACHE_SIZE; i++)
+    {
+        /* The module reuses socket IDs, a session with the same ID has been replaced by the module */
+        if (AdrasteaI_SSLSessionCache_entries[i].used && (AdrasteaI_SSLSessionCache_entries[i].sessionID == socketID))
+        {
+            AdrasteaI_SSLSessionCache_entries[i].used = false;
+        }
+    }
+
+    AdrasteaI_SSLSessionCache_Entry_t* previousP = AdrasteaI_SSLSessionCache_Find(host, port, profileID);
+    if (previousP != NULL)
+    {
+        AdrasteaI_SSLSessionCache_Remove(previousP);
+    }
+
+    for (uint8_t i = 0; i < ADRASTEAI_SSL_SESSION_CACHE_SIZE; i++)
+    {
+        AdrasteaI_SSLSessionCache_Entry_t* candidateP = &AdrasteaI_SSLSessionCache_entries[i];
+        if (!candidateP->used)
+        {
+            entryP = candidateP;
+            break;
+        }
+        if ((entryP == NULL) || ((int32_t)(candidateP->lastUsedTime - entryP->lastUsedTime) < 0))
+        {
+            entryP = candidateP;
+        }
+    }
+
+    if (entryP->used)
+    {
+        WE_LOG_DEBUG(SSLSessionCache, "Session %u evicted", entryP->sessionID);
+        AdrasteaI_SSLSessionCache_Remove(entryP);
+        AdrasteaI_SSLSessionCache_statistics.evictionsCapacity++;
+    }
+
+    entryP->used = true;
+    entryP->sessionID = socketID;
+    entryP->profileID = profileID;
+    entryP->port = port;
+    entryP->createdTime = WE_GetTick();
+    entryP->lastUsedTime = entryP->createdTime;
+    strcpy(entryP->host, host);
+
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Deletes a session in the module and removes it from the cache, e.g. if the connection using it failed.
+ *
+ * @param[in] sessionID Session ID
+ */
+void AdrasteaI_SSLSessionCache_Invalidate(AdrasteaI_ATCommon_Session_ID_t sessionID)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; i < ADRASTEAI_SSL_SESSION_CACHE_SIZE; i++)
+    {
+        AdrasteaI_SSLSessionCache_Entry_t* entryP = &AdrasteaI_SSLSessionCache_entries[i];
+        if (entryP->used && (entryP->sessionID == sessionID))
+        {
+            AdrasteaI_SSLSessionCache_Remove(entryP);
+        }
+    }
+
+    AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Deletes all cached sessions in the module and clears the cache.
+ */
+void AdrasteaI_SSLSessionCache_Clear(void)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; i < ADRASTEAI_SSL_SESSION_CACHE_SIZE; i++)
+    {
+        if (AdrasteaI_SSLSessionCache_entries[i].used)
+        {
+            AdrasteaI_SSLSessionCache_Remove(&AdrasteaI_SSLSessionCache_entries[i]);
+        }
+    }
+
+    AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Returns the session cache statistics.
+ *
+ * @param[out] statisticsP Statistics
+ */
+void AdrasteaI_SSLSessionCache_GetStatistics(AdrasteaI_SSLSessionCache_Statistics_t* statisticsP)
+{
+    if (statisticsP != NULL)
+    {
+        *statisticsP = AdrasteaI_SSLSessionCache_statistics;
+    }
+}
+
+#endif /* ADRASTEAI_SSL_SESSION_CACHE */
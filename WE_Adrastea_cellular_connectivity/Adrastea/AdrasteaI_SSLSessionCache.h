@@ -0,0 +1,100 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Cache of kept SSL sessions for resuming TLS sessions on reconnect (enabled by defining ADRASTEAI_SSL_SESSION_CACHE).
+ *
+ * A session kept in the module (see AdrasteaI_ATSocket_KeepSocketSSLSession()) is identified by the ID of the
+ * socket it has been established with. The cache maps destination host, port and SSL profile to that ID, so that
+ * a new socket to the same destination can be activated with the kept session instead of a full handshake.
+ *
+ * Sessions are evicted when they are older than ADRASTEAI_SSL_SESSION_CACHE_MAX_AGE_MS or, if the cache is full,
+ * in least recently used order. Evicted sessions and sessions the module failed to resume are deleted in the module.
+ */
+
+#ifndef ADRASTEAI_SSLSESSIONCACHE_H_INCLUDED
+#define ADRASTEAI_SSLSESSIONCACHE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ATSocket.h"
+
+#ifndef ADRASTEAI_SSL_SESSION_CACHE_SIZE
+/**
+ * @brief Max. number of cached sessions.
+ */
+#define ADRASTEAI_SSL_SESSION_CACHE_SIZE 4
+#endif
+
+#ifndef ADRASTEAI_SSL_SESSION_CACHE_MAX_AGE_MS
+/**
+ * @brief Max. age of a cached session (milliseconds). Should not exceed the session lifetime of the servers.
+ */
+#define ADRASTEAI_SSL_SESSION_CACHE_MAX_AGE_MS (60UL * 60UL * 1000UL)
+#endif
+
+#ifndef ADRASTEAI_SSL_SESSION_CACHE_HOST_LENGTH
+/**
+ * @brief Max. length of a cached destination host (including terminating zero). Sessions to longer host names are not cached.
+ */
+#define ADRASTEAI_SSL_SESSION_CACHE_HOST_LENGTH 64
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief Session cache statistics.
+ */
+    typedef struct AdrasteaI_SSLSessionCache_Statistics_t
+    {
+        uint32_t handshakesSaved;   /**< Sockets activated with a cached session */
+        uint32_t fullHandshakes;    /**< Sockets activated without cached session */
+        uint32_t resumeFailures;    /**< Cached sessions the module failed to resume */
+        uint32_t evictionsAge;      /**< Sessions evicted because of their age */
+        uint32_t evictionsCapacity; /**< Sessions evicted because the cache was full */
+    } AdrasteaI_SSLSessionCache_Statistics_t;
+
+    extern bool AdrasteaI_SSLSessionCache_ActivateSocket(AdrasteaI_ATSocket_ID_t socketID, const char* host, AdrasteaI_ATCommon_Port_Number_t port, AdrasteaI_ATCommon_SSL_Profile_ID_t profileID);
+
+    extern AdrasteaI_ATCommon_Session_ID_t AdrasteaI_SSLSessionCache_Lookup(const char* host, AdrasteaI_ATCommon_Port_Number_t port, AdrasteaI_ATCommon_SSL_Profile_ID_t profileID);
+
+    extern bool AdrasteaI_SSLSessionCache_Store(AdrasteaI_ATSocket_ID_t socketID, const char* host, AdrasteaI_ATCommon_Port_Number_t port, AdrasteaI_ATCommon_SSL_Profile_ID_t profileID);
+
+    extern void AdrasteaI_SSLSessionCache_Invalidate(AdrasteaI_ATCommon_Session_ID_t sessionID);
+
+    extern void AdrasteaI_SSLSessionCache_Clear(void);
+
+    extern void AdrasteaI_SSLSessionCache_GetStatistics(AdrasteaI_SSLSessionCache_Statistics_t* statisticsP);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADRASTEAI_SSLSESSIONCACHE_H_INCLUDED */
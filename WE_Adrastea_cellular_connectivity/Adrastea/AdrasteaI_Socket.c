@@ -0,0 +1,1134 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief BSD-style socket layer with per-socket receive buffers (enabled by defining ADRASTEAI_SOCKET).
+ */
+
+#include <string.h>
+
+#include "ATCommands.h"
+#include "ATEvent.h"
+#include "AdrasteaI.h"
+#include "AdrasteaI_Socket.h"
+#include "AdrasteaI_SocketTuner.h"
+#include "global.h"
+#include "log.h"
+#include "os.h"
+
+#ifdef ADRASTEAI_SOCKET
+
+/**
+ * @brief Socket layer state of a socket.
+ */
+typedef struct AdrasteaI_Socket_Entry_t
+{
+    AdrasteaI_Socket_State_t state;
+    AdrasteaI_ATSocket_Type_t type;
+    AdrasteaI_ATCommon_Session_ID_t sessionID;
+    AdrasteaI_ATSocket_ID_t moduleSocketID;
+    AdrasteaI_Socket_Error_t lastError;
+    uint32_t receiveTimeoutMs;
+    volatile bool dataPending; /**< Module has reported received data that has not been read yet (set by event) */
+    volatile bool peerClosed;  /**< Module has reported the connection as closed (set by event) */
+    uint16_t rxHead;
+    uint16_t rxTail;
+    uint16_t rxUsed;
+    uint8_t rxBuffer[ADRASTEAI_SOCKET_RX_BUFFER_SIZE];
+    AdrasteaI_Socket_Send_Statistics_t txStatistics;
+    AdrasteaI_Socket_t listener; /**< Listening socket of an accepted connection (AdrasteaI_Socket_Invalid otherwise) */
+    uint32_t lastActivityTime;   /**< Time data has last been sent or received (accepted connections only) */
+    volatile uint8_t acceptWrite; /**< Number of connections added to the accept queue (incremented by event) */
+    uint8_t acceptRead;          /**< Number of connections taken from the accept queue */
+    AdrasteaI_ATSocket_ID_t acceptQueue[ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE];
+    AdrasteaI_Socket_Listener_Statistics_t listenerStatistics;
+} AdrasteaI_Socket_Entry_t;
+
+#if (ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE & (ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE - 1)) != 0 || ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE > 128
+#error "ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE must be a power of two not larger than 128"
+#endif
+
+/* The data is received hex encoded, the response also holds socket ID, lengths and source address */
+#if 2 * ADRASTEAI_SOCKET_TRANSFER_CHUNK_SIZE + 128 > ADRASTEAI_LINE_MAX_SIZE
+#error "ADRASTEAI_SOCKET_TRANSFER_CHUNK_SIZE too large for the hex encoded response to fit into ADRASTEAI_LINE_MAX_SIZE"
+#endif
+
+static AdrasteaI_Socket_Entry_t AdrasteaI_Socket_sockets[ADRASTEAI_SOCKET_MAX_SOCKETS];
+
+/**
+ * @brief Buffer for data received by AT%SOCKETDATA (decoded).
+ */
+static uint8_t AdrasteaI_Socket_transferBuffer[ADRASTEAI_SOCKET_TRANSFER_CHUNK_SIZE];
+
+/**
+ * @brief Buffer for preparing the next AT%SOCKETDATA command while sending (see AdrasteaI_ATSocket_SendStream()).
+ */
+static char AdrasteaI_Socket_segmentBuffer[AT_MAX_COMMAND_BUFFER_SIZE];
+
+/**
+ * @brief Stream of the running send call. Sends are serialized by the command lock, so one stream is sufficient.
+ */
+static AdrasteaI_ATSocket_Send_Stream_t AdrasteaI_Socket_sendStream;
+
+/**
+ * @brief Socket the running send call is sending to (AdrasteaI_Socket_Invalid if none).
+ */
+static volatile AdrasteaI_Socket_t AdrasteaI_Socket_sendingSocket = AdrasteaI_Socket_Invalid;
+
+/**
+ * @brief Module sockets of connections that did not fit into an accept queue, to be deleted by the calling task.
+ *
+ * If this queue is full as well, the module keeps the connection until it is terminated by the peer or the idle timer.
+ */
+static volatile AdrasteaI_ATSocket_ID_t AdrasteaI_Socket_rejected[ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE];
+static volatile uint8_t AdrasteaI_Socket_rejectedWrite = 0;
+static uint8_t AdrasteaI_Socket_rejectedRead = 0;
+
+/**
+ * @brief Given by the URC handler when data is received, a connection is closed or accepted, to wake up the task
+ * waiting in AdrasteaI_Socket_Receive() or AdrasteaI_Socket_Accept(). Not part of the entries, which are cleared on allocation.
+ */
+static WE_OS_Semaphore_t AdrasteaI_Socket_semaphores[ADRASTEAI_SOCKET_MAX_SOCKETS];
+static volatile bool AdrasteaI_Socket_semaphoresInitialized = false;
+
+static AdrasteaI_Socket_Entry_t* AdrasteaI_Socket_Get(AdrasteaI_Socket_t socket)
+{
+    if ((socket >= ADRASTEAI_SOCKET_MAX_SOCKETS) || (AdrasteaI_Socket_sockets[socket].state == AdrasteaI_Socket_State_Free))
+    {
+        return NULL;
+    }
+    return &AdrasteaI_Socket_sockets[socket];
+}
+
+/**
+ * @brief Wakes up the task waiting for an event of a socket (if any). Is called by the URC handler.
+ */
+static void AdrasteaI_Socket_Notify(AdrasteaI_Socket_Entry_t* entryP)
+{
+    if (AdrasteaI_Socket_semaphoresInitialized)
+    {
+        WE_OS_SemaphoreGive(&AdrasteaI_Socket_semaphores[entryP - AdrasteaI_Socket_sockets]);
+    }
+}
+
+/**
+ * @brief Releases the command lock and sleeps until an event of a socket is reported or the timeout has expired.
+ *
+ * An event reported since the socket has last been checked has given the semaphore already, so it is not missed.
+ *
+ * @param[in] socket Socket handle
+ * @param[in] t0 Start time of the call
+ * @param[in] timeoutMs Timeout of the call
+ */
+static void AdrasteaI_Socket_Wait(AdrasteaI_Socket_t socket, uint32_t t0, uint32_t timeoutMs)
+{
+    AdrasteaI_EndCommand(true);
+
+    uint32_t elapsed = WE_GetTick() - t0;
+    WE_OS_SemaphoreTake(&AdrasteaI_Socket_semaphores[socket], (timeoutMs == WE_OS_WAIT_FOREVER) ? WE_OS_WAIT_FOREVER : ((elapsed < timeoutMs) ? (timeoutMs - elapsed) : 0));
+}
+
+static AdrasteaI_Socket_Entry_t* AdrasteaI_Socket_GetByModuleSocketID(AdrasteaI_ATSocket_ID_t moduleSocketID)
+{
+    for (uint8_t i = 0; i < ADRASTEAI_SOCKET_MAX_SOCKETS; i++)
+    {
+        AdrasteaI_Socket_Entry_t* entryP = &AdrasteaI_Socket_sockets[i];
+        if ((entryP->state != AdrasteaI_Socket_State_Free) && (entryP->moduleSocketID == moduleSocketID))
+        {
+            return entryP;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Takes the command lock, without waiting if ADRASTEAI_SOCKET_FLAGS_NONBLOCKING is set.
+ */
+static bool AdrasteaI_Socket_Lock(uint8_t flags) { return (flags & ADRASTEAI_SOCKET_FLAGS_NONBLOCKING) ? AdrasteaI_TryBeginCommand() : AdrasteaI_BeginCommand(); }
+
+static bool AdrasteaI_Socket_Fail(AdrasteaI_Socket_Entry_t* entryP, AdrasteaI_Socket_Error_t error)
+{
+    entryP->lastError = error;
+    return false;
+}
+
+static bool AdrasteaI_Socket_LockFailed(AdrasteaI_Socket_t socket, uint8_t flags)
+{
+    AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_Socket_Get(socket);
+    if (entryP != NULL)
+    {
+        entryP->lastError = (flags & ADRASTEAI_SOCKET_FLAGS_NONBLOCKING) ? AdrasteaI_Socket_Error_WouldBlock : AdrasteaI_Socket_Error_TimedOut;
+    }
+    return false;
+}
+
+/**
+ * @brief Returns a free entry initialized for a new socket (NULL if all sockets are in use).
+ */
+static AdrasteaI_Socket_Entry_t* AdrasteaI_Socket_Allocate(AdrasteaI_ATCommon_Session_ID_t sessionID, AdrasteaI_ATSocket_Type_t socketType)
+{
+    for (uint8_t i = 0; i < ADRASTEAI_SOCKET_MAX_SOCKETS; i++)
+    {
+        AdrasteaI_Socket_Entry_t* entryP = &AdrasteaI_Socket_sockets[i];
+        if (entryP->state == AdrasteaI_Socket_State_Free)
+        {
+            memset(entryP, 0, sizeof(*entryP));
+            entryP->type = socketType;
+            entryP->sessionID = sessionID;
+            entryP->moduleSocketID = AdrasteaI_ATSocket_ID_Invalid;
+            entryP->receiveTimeoutMs = ADRASTEAI_SOCKET_DEFAULT_RECEIVE_TIMEOUT_MS;
+            entryP->listener = AdrasteaI_Socket_Invalid;
+#ifdef ADRASTEAI_SOCKET_TUNER
+            AdrasteaI_SocketTuner_Disable(i);
+#endif
+            return entryP;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Deactivates and deletes a socket in the module.
+ */
+static bool AdrasteaI_Socket_DeleteModuleSocket(AdrasteaI_ATSocket_ID_t moduleSocketID, bool deactivate)
+{
+    if (deactivate)
+    {
+        /* Fails if the module has deactivated the socket already, deleting it is what matters */
+        AdrasteaI_ATSocket_DeactivateSocket(moduleSocketID);
+    }
+    return AdrasteaI_ATSocket_DeleteSocket(moduleSocketID);
+}
+
+/**
+ * @brief Deletes the module socket of an entry (if any) and frees the entry. Has to be called with the command lock held.
+ */
+static bool AdrasteaI_Socket_Release(AdrasteaI_Socket_Entry_t* entryP)
+{
+    bool ret = true;
+    AdrasteaI_Socket_t socket = (AdrasteaI_Socket_t)(entryP - AdrasteaI_Socket_sockets);
+
+    if (entryP->state == AdrasteaI_Socket_State_Listening)
+    {
+        /* Close connections that have not been accepted yet */
+        while (entryP->acceptRead != entryP->acceptWrite)
+        {
+            AdrasteaI_ATSocket_ID_t acceptedID = entryP->acceptQueue[entryP->acceptRead % ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE];
+            if (acceptedID != entryP->moduleSocketID)
+            {
+                AdrasteaI_Socket_DeleteModuleSocket(acceptedID, true);
+            }
+            entryP->acceptRead++;
+        }
+
+        for (uint8_t i = 0; i < ADRASTEAI_SOCKET_MAX_SOCKETS; i++)
+        {
+            if (AdrasteaI_Socket_sockets[i].listener == socket)
+            {
+                AdrasteaI_Socket_sockets[i].listener = AdrasteaI_Socket_Invalid;
+            }
+        }
+    }
+
+    if (entryP->moduleSocketID != AdrasteaI_ATSocket_ID_Invalid)
+    {
+        ret = AdrasteaI_Socket_DeleteModuleSocket(entryP->moduleSocketID, !entryP->peerClosed);
+    }
+
+    entryP->state = AdrasteaI_Socket_State_Free;
+    return ret;
+}
+
+/**
+ * @brief Deletes the module sockets of connections that did not fit into an accept queue. Has to be called with the command lock held.
+ */
+static void AdrasteaI_Socket_DeleteRejected(void)
+{
+    while (AdrasteaI_Socket_rejectedRead != AdrasteaI_Socket_rejectedWrite)
+    {
+        AdrasteaI_Socket_DeleteModuleSocket(AdrasteaI_Socket_rejected[AdrasteaI_Socket_rejectedRead % ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE], true);
+        AdrasteaI_Socket_rejectedRead++;
+    }
+}
+
+/**
+ * @brief Closes accepted connections without sent or received data for ADRASTEAI_SOCKET_IDLE_TIMEOUT_MS. Has to be called with the command lock held.
+ *
+ * The connections have been handed out to the application already, so only the module socket is deleted. The entry
+ * is moved to AdrasteaI_Socket_State_Closed and detached from the listener, the handle stays valid until the
+ * application calls AdrasteaI_Socket_Close(). Data in the receive buffer can still be read.
+ *
+ * @return Number of connections closed
+ */
+static uint8_t AdrasteaI_Socket_EvictIdle(void)
+{
+    uint8_t evicted = 0;
+    uint32_t now = WE_GetTick();
+
+    for (uint8_t i = 0; i < ADRASTEAI_SOCKET_MAX_SOCKETS; i++)
+    {
+        AdrasteaI_Socket_Entry_t* entryP = &AdrasteaI_Socket_sockets[i];
+        if (((entryP->state == AdrasteaI_Socket_State_Connected) || (entryP->state == AdrasteaI_Socket_State_Closed)) && (entryP->listener != AdrasteaI_Socket_Invalid) && ((now - entryP->lastActivityTime) >= ADRASTEAI_SOCKET_IDLE_TIMEOUT_MS))
+        {
+            WE_LOG_INFO(ATSocket, "Socket %u: closing idle accepted connection", entryP->moduleSocketID);
+            AdrasteaI_Socket_sockets[entryP->listener].listenerStatistics.evicted++;
+            if (entryP->moduleSocketID != AdrasteaI_ATSocket_ID_Invalid)
+            {
+                AdrasteaI_Socket_DeleteModuleSocket(entryP->moduleSocketID, !entryP->peerClosed);
+            }
+            entryP->moduleSocketID = AdrasteaI_ATSocket_ID_Invalid;
+            entryP->listener = AdrasteaI_Socket_Invalid;
+            entryP->dataPending = false;
+            entryP->peerClosed = true;
+            entryP->state = AdrasteaI_Socket_State_Closed;
+            AdrasteaI_Socket_Notify(entryP);
+            evicted++;
+        }
+    }
+
+    return evicted;
+}
+
+/**
+ * @brief Returns the number of open accepted connections of a listening socket.
+ */
+static uint8_t AdrasteaI_Socket_CountConnections(AdrasteaI_Socket_t listenSocket)
+{
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < ADRASTEAI_SOCKET_MAX_SOCKETS; i++)
+    {
+        if ((AdrasteaI_Socket_sockets[i].state != AdrasteaI_Socket_State_Free) && (AdrasteaI_Socket_sockets[i].listener == listenSocket))
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Reads data reported by the module into the receive buffer, as long as there is space. Has to be called with the command lock held.
+ *
+ * @return true if successful, false otherwise
+ */
+static bool AdrasteaI_Socket_Drain(AdrasteaI_Socket_Entry_t* entryP)
+{
+    while (entryP->dataPending && (entryP->rxUsed < ADRASTEAI_SOCKET_RX_BUFFER_SIZE))
+    {
+        uint16_t length = ADRASTEAI_SOCKET_RX_BUFFER_SIZE - entryP->rxUsed;
+        if (length > ADRASTEAI_SOCKET_TRANSFER_CHUNK_SIZE)
+        {
+            length = ADRASTEAI_SOCKET_TRANSFER_CHUNK_SIZE;
+        }
+
+        /* Cleared before reading, so a notification arriving meanwhile is not lost */
+        entryP->dataPending = false;
+
+        AdrasteaI_ATSocket_Data_Read_t dataRead;
+        dataRead.data = (char*)AdrasteaI_Socket_transferBuffer;
+        if (!AdrasteaI_ATSocket_ReceiveBinaryFromSocket(entryP->moduleSocketID, &dataRead, length))
+        {
+            entryP->dataPending = true;
+            return AdrasteaI_Socket_Fail(entryP, AdrasteaI_Socket_Error_Command);
+        }
+
+        /* Binary receive: the length reported by the module is the number of bytes decoded */
+        uint16_t received = dataRead.dataLength;
+
+        uint16_t chunk = ADRASTEAI_SOCKET_RX_BUFFER_SIZE - entryP->rxHead;
+        if (chunk > received)
+        {
+            chunk = received;
+        }
+        memcpy(&entryP->rxBuffer[entryP->rxHead], dataRead.data, chunk);
+        memcpy(&entryP->rxBuffer[0], dataRead.data + chunk, received - chunk);
+        entryP->rxHead = (entryP->rxHead + received) % ADRASTEAI_SOCKET_RX_BUFFER_SIZE;
+        entryP->rxUsed += received;
+        entryP->lastActivityTime = WE_GetTick();
+
+        WE_LOG_DEBUG(ATSocket, "Socket %u: buffered %u bytes, %u bytes left in module", entryP->moduleSocketID, received, dataRead.dataLeftLength);
+
+        if (dataRead.dataLeftLength > 0)
+        {
+            entryP->dataPending = true;
+        }
+
+        if (received == 0)
+        {
+            break;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Initializes the socket layer and enables the socket notifications of the module.
+ *
+ * Must be called after AdrasteaI_Init().
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Socket_Init(void)
+{
+    if (!AdrasteaI_Socket_semaphoresInitialized)
+    {
+        for (uint8_t i = 0; i < ADRASTEAI_SOCKET_MAX_SOCKETS; i++)
+        {
+            if (!WE_OS_SemaphoreInit(&AdrasteaI_Socket_semaphores[i], 0, 1))
+            {
+                return false;
+            }
+        }
+        AdrasteaI_Socket_semaphoresInitialized = true;
+    }
+
+    memset(AdrasteaI_Socket_sockets, 0, sizeof(AdrasteaI_Socket_sockets));
+    AdrasteaI_Socket_rejectedRead = AdrasteaI_Socket_rejectedWrite;
+    return AdrasteaI_ATSocket_SetSocketUnsolicitedNotificationEvents(AdrasteaI_ATSocket_Event_All, AdrasteaI_ATCommon_Event_State_Enable);
+}
+
+/**
+ * @brief Creates a socket. The socket is allocated in the module by AdrasteaI_Socket_Connect().
+ *
+ * @param[in] sessionID Session ID (PDP context ID)
+ * @param[in] socketType Socket type (TCP or UDP)
+ * @param[out] socketP Handle of the created socket
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Socket_Open(AdrasteaI_ATCommon_Session_ID_t sessionID, AdrasteaI_ATSocket_Type_t socketType, AdrasteaI_Socket_t* socketP)
+{
+    if ((socketP == NULL) || (socketType <= AdrasteaI_ATSocket_Type_Invalid) || (socketType >= AdrasteaI_ATSocket_Type_NumberOfValues))
+    {
+        return false;
+    }
+
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_Socket_Allocate(sessionID, socketType);
+    if (entryP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    entryP->state = AdrasteaI_Socket_State_Open;
+    *socketP = (AdrasteaI_Socket_t)(entryP - AdrasteaI_Socket_sockets);
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Connects a socket, i.e. allocates and activates it in the module.
+ *
+ * For UDP sockets, this sets the destination of sent datagrams.
+ *
+ * @param[in] socket Socket handle
+ * @param[in] ipAddress Destination IP address or host name
+ * @param[in] portNumber Destination port
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Socket_Connect(AdrasteaI_Socket_t socket, const char* ipAddress, AdrasteaI_ATCommon_Port_Number_t portNumber)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_Socket_Get(socket);
+    if (entryP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    AdrasteaI_ATCommon_IP_Addr_t destination;
+    if ((ipAddress == NULL) || (strlen(ipAddress) >= sizeof(destination)) || (entryP->state != AdrasteaI_Socket_State_Open))
+    {
+        return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(entryP, AdrasteaI_Socket_Error_InvalidArgument));
+    }
+    strcpy(destination, ipAddress);
+
+    AdrasteaI_ATSocket_ID_t moduleSocketID;
+    if (!AdrasteaI_ATSocket_AllocateSocket(entryP->sessionID, entryP->type, AdrasteaI_ATSocket_Behaviour_Open_Connection, destination, portNumber, AdrasteaI_ATCommon_Port_Number_Invalid, AdrasteaI_ATSocket_Data_Length_Automatic, AdrasteaI_ATSocket_Timeout_Invalid,
+                                          AdrasteaI_ATSocket_IP_Addr_Format_Invalid, &moduleSocketID))
+    {
+        return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(entryP, AdrasteaI_Socket_Error_Command));
+    }
+
+    entryP->moduleSocketID = moduleSocketID;
+    entryP->dataPending = false;
+    entryP->peerClosed = false;
+
+    if (!AdrasteaI_ATSocket_ActivateSocket(moduleSocketID, AdrasteaI_ATCommon_Session_ID_Invalid))
+    {
+        AdrasteaI_ATSocket_DeleteSocket(moduleSocketID);
+        entryP->moduleSocketID = AdrasteaI_ATSocket_ID_Invalid;
+        return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(entryP, AdrasteaI_Socket_Error_Command));
+    }
+
+    entryP->state = AdrasteaI_Socket_State_Connected;
+    entryP->lastError = AdrasteaI_Socket_Error_None;
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Starts listening for TCP connections, i.e. allocates and activates a listening socket in the module.
+ *
+ * @param[in] socket Socket handle (TCP socket created by AdrasteaI_Socket_Open())
+ * @param[in] portNumber Local port to listen on
+ * @param[in] multiple true: accept any number of connections (LISTENP), false: accept a single connection (LISTEN)
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Socket_Listen(AdrasteaI_Socket_t socket, AdrasteaI_ATCommon_Port_Number_t portNumber, bool multiple)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_Socket_Get(socket);
+    if (entryP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if ((entryP->state != AdrasteaI_Socket_State_Open) || (entryP->type != AdrasteaI_ATSocket_Type_TCP) || (portNumber == AdrasteaI_ATCommon_Port_Number_Invalid))
+    {
+        return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(entryP, AdrasteaI_Socket_Error_InvalidArgument));
+    }
+
+    AdrasteaI_ATCommon_IP_Addr_t anyAddress = "0.0.0.0";
+    AdrasteaI_ATSocket_ID_t moduleSocketID;
+    if (!AdrasteaI_ATSocket_AllocateSocket(entryP->sessionID, entryP->type, multiple ? AdrasteaI_ATSocket_Behaviour_ListenMultiple : AdrasteaI_ATSocket_Behaviour_Listen, anyAddress, AdrasteaI_ATCommon_Port_Number_Invalid, portNumber, AdrasteaI_ATSocket_Data_Length_Automatic,
+                                          AdrasteaI_ATSocket_Timeout_Invalid, AdrasteaI_ATSocket_IP_Addr_Format_Invalid, &moduleSocketID))
+    {
+        return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(entryP, AdrasteaI_Socket_Error_Command));
+    }
+
+    if (!AdrasteaI_ATSocket_ActivateSocket(moduleSocketID, AdrasteaI_ATCommon_Session_ID_Invalid))
+    {
+        AdrasteaI_ATSocket_DeleteSocket(moduleSocketID);
+        return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(entryP, AdrasteaI_Socket_Error_Command));
+    }
+
+    entryP->acceptRead = entryP->acceptWrite;
+    entryP->moduleSocketID = moduleSocketID;
+    entryP->state = AdrasteaI_Socket_State_Listening;
+    entryP->lastError = AdrasteaI_Socket_Error_None;
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Takes the next connection from the accept queue of a listening socket.
+ *
+ * If the accepted connection would exceed ADRASTEAI_SOCKET_MAX_CONNECTIONS_PER_LISTENER, idle connections are
+ * evicted first (see ADRASTEAI_SOCKET_IDLE_TIMEOUT_MS). If there is still no room or there is no free socket,
+ * the connection is closed and the next queued connection is tried. Blocking calls wait for a connection for at
+ * most the receive timeout of the listening socket, sleeping until the module reports a connection.
+ *
+ * A socket listening for a single connection (LISTEN) is closed when the connection has been accepted.
+ *
+ * @param[in] listenSocket Listening socket handle
+ * @param[in] flags ADRASTEAI_SOCKET_FLAGS_NONBLOCKING: fail with AdrasteaI_Socket_Error_WouldBlock instead of waiting
+ * @param[out] socketP Handle of the accepted connection
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Socket_Accept(AdrasteaI_Socket_t listenSocket, uint8_t flags, AdrasteaI_Socket_t* socketP)
+{
+    uint32_t t0 = WE_GetTick();
+
+    while (1)
+    {
+        if (!AdrasteaI_Socket_Lock(flags))
+        {
+            return AdrasteaI_Socket_LockFailed(listenSocket, flags);
+        }
+
+        AdrasteaI_Socket_Entry_t* listenerP = AdrasteaI_Socket_Get(listenSocket);
+        if (listenerP == NULL)
+        {
+            return AdrasteaI_EndCommand(false);
+        }
+
+        if (socketP == NULL)
+        {
+            return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(listenerP, AdrasteaI_Socket_Error_InvalidArgument));
+        }
+
+        if (listenerP->state != AdrasteaI_Socket_State_Listening)
+        {
+            return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(listenerP, AdrasteaI_Socket_Error_NotConnected));
+        }
+
+        AdrasteaI_Socket_DeleteRejected();
+
+        while (listenerP->acceptRead != listenerP->acceptWrite)
+        {
+            AdrasteaI_ATSocket_ID_t acceptedID = listenerP->acceptQueue[listenerP->acceptRead % ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE];
+            listenerP->acceptRead++;
+
+            bool ownSocket = (acceptedID == listenerP->moduleSocketID);
+            AdrasteaI_Socket_Entry_t* entryP = NULL;
+            if (ownSocket || (AdrasteaI_Socket_CountConnections(listenSocket) < ADRASTEAI_SOCKET_MAX_CONNECTIONS_PER_LISTENER) || (AdrasteaI_Socket_EvictIdle() > 0))
+            {
+                entryP = AdrasteaI_Socket_Allocate(listenerP->sessionID, listenerP->type);
+            }
+
+            if (entryP == NULL)
+            {
+                WE_LOG_WARNING(ATSocket, "Socket %u: rejecting accepted connection %u", listenerP->moduleSocketID, acceptedID);
+                listenerP->listenerStatistics.rejected++;
+                AdrasteaI_Socket_DeleteModuleSocket(acceptedID, true);
+                if (ownSocket)
+                {
+                    listenerP->moduleSocketID = AdrasteaI_ATSocket_ID_Invalid;
+                    listenerP->state = AdrasteaI_Socket_State_Closed;
+                    return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(listenerP, AdrasteaI_Socket_Error_NoResources));
+                }
+                continue;
+            }
+
+            if (ownSocket)
+            {
+                /* A single connection listener has turned into the connection */
+                listenerP->moduleSocketID = AdrasteaI_ATSocket_ID_Invalid;
+                listenerP->state = AdrasteaI_Socket_State_Closed;
+            }
+
+            /* Data may have been received before the connection has been accepted */
+            entryP->dataPending = true;
+            entryP->listener = ownSocket ? AdrasteaI_Socket_Invalid : listenSocket;
+            entryP->lastActivityTime = WE_GetTick();
+            entryP->moduleSocketID = acceptedID;
+            entryP->state = AdrasteaI_Socket_State_Connected;
+
+            listenerP->listenerStatistics.accepted++;
+            listenerP->lastError = AdrasteaI_Socket_Error_None;
+            *socketP = (AdrasteaI_Socket_t)(entryP - AdrasteaI_Socket_sockets);
+            return AdrasteaI_EndCommand(true);
+        }
+
+        if (flags & ADRASTEAI_SOCKET_FLAGS_NONBLOCKING)
+        {
+            return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(listenerP, AdrasteaI_Socket_Error_WouldBlock));
+        }
+
+        if (WE_GetTick() - t0 >= listenerP->receiveTimeoutMs)
+        {
+            return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(listenerP, AdrasteaI_Socket_Error_TimedOut));
+        }
+
+        /* Release the lock while waiting, so other tasks can send commands */
+        AdrasteaI_Socket_Wait(listenSocket, t0, listenerP->receiveTimeoutMs);
+    }
+}
+
+/**
+ * @brief Sends data.
+ *
+ * The data may contain arbitrary bytes, it is sent hex encoded in segments (see AdrasteaI_ATSocket_SendStream()).
+ * The function returns when all data has been handed over to the module. If sending fails or is canceled by
+ * AdrasteaI_Socket_CancelSend(), the number of bytes accepted by the module can be read using AdrasteaI_Socket_GetSendStatistics().
+ *
+ * @param[in] socket Socket handle
+ * @param[in] data Data to send
+ * @param[in] length Number of bytes to send
+ * @param[in] flags ADRASTEAI_SOCKET_FLAGS_NONBLOCKING: fail with AdrasteaI_Socket_Error_WouldBlock if the command lock is taken
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Socket_Send(AdrasteaI_Socket_t socket, const uint8_t* data, uint32_t length, uint8_t flags)
+{
+    if (!AdrasteaI_Socket_Lock(flags))
+    {
+        return AdrasteaI_Socket_LockFailed(socket, flags);
+    }
+
+    AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_Socket_Get(socket);
+    if (entryP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if ((data == NULL) && (length > 0))
+    {
+        return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(entryP, AdrasteaI_Socket_Error_InvalidArgument));
+    }
+
+    if ((entryP->state != AdrasteaI_Socket_State_Connected) || entryP->peerClosed)
+    {
+        return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(entryP, AdrasteaI_Socket_Error_NotConnected));
+    }
+
+    AdrasteaI_ATSocket_Send_Stream_t* streamP = &AdrasteaI_Socket_sendStream;
+    streamP->socketID = entryP->moduleSocketID;
+    streamP->data = data;
+    streamP->dataLength = length;
+    streamP->segmentBuffer = AdrasteaI_Socket_segmentBuffer;
+    streamP->segmentBufferSize = sizeof(AdrasteaI_Socket_segmentBuffer);
+    streamP->cancel = false;
+    AdrasteaI_Socket_sendingSocket = socket;
+
+    bool ret = AdrasteaI_ATSocket_SendStream(streamP);
+
+    AdrasteaI_Socket_sendingSocket = AdrasteaI_Socket_Invalid;
+
+    entryP->txStatistics.bytesAcknowledged += streamP->bytesAcknowledged;
+    entryP->txStatistics.lastSendBytes = streamP->bytesAcknowledged;
+    entryP->txStatistics.lastSendDurationUsec = streamP->durationUsec;
+    entryP->txStatistics.lastSendGoodput = streamP->goodput;
+    entryP->txStatistics.lastSendGoodputLimit = streamP->goodputLimit;
+
+    if (!ret)
+    {
+        return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(entryP, streamP->cancel ? AdrasteaI_Socket_Error_Canceled : AdrasteaI_Socket_Error_Command));
+    }
+
+#ifdef ADRASTEAI_SOCKET_TUNER
+    AdrasteaI_SocketTuner_SendObserved(socket, entryP->moduleSocketID, length);
+#endif
+
+    entryP->lastActivityTime = WE_GetTick();
+
+    entryP->lastError = AdrasteaI_Socket_Error_None;
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Cancels a running AdrasteaI_Socket_Send() call, e.g. from another task.
+ *
+ * Sending stops after the segment currently processed by the module, the canceled call fails with
+ * AdrasteaI_Socket_Error_Canceled. Does nothing if no data is being sent to the socket.
+ *
+ * @param[in] socket Socket handle
+ */
+void AdrasteaI_Socket_CancelSend(AdrasteaI_Socket_t socket)
+{
+    if ((socket != AdrasteaI_Socket_Invalid) && (AdrasteaI_Socket_sendingSocket == socket))
+    {
+        AdrasteaI_Socket_sendStream.cancel = true;
+    }
+}
+
+/**
+ * @brief Receives data from the receive buffer of a socket.
+ *
+ * Reads data reported by the module into the receive buffer first. Blocking calls wait until data is
+ * available, the connection is closed or the receive timeout has expired. The calling task sleeps until the module
+ * reports an event of the socket, only one task may wait per socket.
+ *
+ * @param[in] socket Socket handle
+ * @param[out] buffer Received data is returned in this argument
+ * @param[in] bufferSize Size of buffer
+ * @param[in] flags ADRASTEAI_SOCKET_FLAGS_NONBLOCKING: fail with AdrasteaI_Socket_Error_WouldBlock instead of waiting
+ * @param[out] receivedLengthP Number of bytes received (0 if the connection has been closed by the peer)
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Socket_Receive(AdrasteaI_Socket_t socket, uint8_t* buffer, uint16_t bufferSize, uint8_t flags, uint16_t* receivedLengthP)
+{
+    uint32_t t0 = WE_GetTick();
+
+    while (1)
+    {
+        if (!AdrasteaI_Socket_Lock(flags))
+        {
+            return AdrasteaI_Socket_LockFailed(socket, flags);
+        }
+
+        AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_Socket_Get(socket);
+        if (entryP == NULL)
+        {
+            return AdrasteaI_EndCommand(false);
+        }
+
+        if ((buffer == NULL) || (bufferSize == 0) || (receivedLengthP == NULL))
+        {
+            return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(entryP, AdrasteaI_Socket_Error_InvalidArgument));
+        }
+
+        if ((entryP->state != AdrasteaI_Socket_State_Connected) && (entryP->state != AdrasteaI_Socket_State_Closed))
+        {
+            return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(entryP, AdrasteaI_Socket_Error_NotConnected));
+        }
+
+        if (!AdrasteaI_Socket_Drain(entryP) && (entryP->rxUsed == 0))
+        {
+            return AdrasteaI_EndCommand(false);
+        }
+
+        if (entryP->rxUsed > 0)
+        {
+            uint16_t length = (bufferSize < entryP->rxUsed) ? bufferSize : entryP->rxUsed;
+            uint16_t chunk = ADRASTEAI_SOCKET_RX_BUFFER_SIZE - entryP->rxTail;
+            if (chunk > length)
+            {
+                chunk = length;
+            }
+            memcpy(buffer, &entryP->rxBuffer[entryP->rxTail], chunk);
+            memcpy(buffer + chunk, &entryP->rxBuffer[0], length - chunk);
+            entryP->rxTail = (entryP->rxTail + length) % ADRASTEAI_SOCKET_RX_BUFFER_SIZE;
+            entryP->rxUsed -= length;
+            *receivedLengthP = length;
+            entryP->lastError = AdrasteaI_Socket_Error_None;
+            return AdrasteaI_EndCommand(true);
+        }
+
+        if (entryP->peerClosed)
+        {
+            *receivedLengthP = 0;
+            entryP->state = AdrasteaI_Socket_State_Closed;
+            entryP->lastError = AdrasteaI_Socket_Error_None;
+            return AdrasteaI_EndCommand(true);
+        }
+
+        if (flags & ADRASTEAI_SOCKET_FLAGS_NONBLOCKING)
+        {
+            return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(entryP, AdrasteaI_Socket_Error_WouldBlock));
+        }
+
+        if (WE_GetTick() - t0 >= entryP->receiveTimeoutMs)
+        {
+            return AdrasteaI_EndCommand(AdrasteaI_Socket_Fail(entryP, AdrasteaI_Socket_Error_TimedOut));
+        }
+
+        /* Release the lock while waiting, so other tasks can send commands */
+        AdrasteaI_Socket_Wait(socket, t0, entryP->receiveTimeoutMs);
+    }
+}
+
+/**
+ * @brief Closes a socket, i.e. deactivates and deletes it in the module. Buffered received data is discarded.
+ *
+ * @param[in] socket Socket handle
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Socket_Close(AdrasteaI_Socket_t socket)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_Socket_Get(socket);
+    if (entryP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    return AdrasteaI_EndCommand(AdrasteaI_Socket_Release(entryP));
+}
+
+/**
+ * @brief Reads data reported by the module into the receive buffers of all sockets.
+ *
+ * Also closes idle accepted connections and connections that did not fit into an accept queue.
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Socket_Process(void)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_Socket_DeleteRejected();
+    AdrasteaI_Socket_EvictIdle();
+
+    bool ret = true;
+    for (uint8_t i = 0; i < ADRASTEAI_SOCKET_MAX_SOCKETS; i++)
+    {
+        AdrasteaI_Socket_Entry_t* entryP = &AdrasteaI_Socket_sockets[i];
+        if ((entryP->state == AdrasteaI_Socket_State_Connected) || (entryP->state == AdrasteaI_Socket_State_Closed))
+        {
+            ret = AdrasteaI_Socket_Drain(entryP) && ret;
+        }
+    }
+
+    return AdrasteaI_EndCommand(ret);
+}
+
+/**
+ * @brief Returns the readiness of a socket.
+ *
+ * The getters take the command lock, as the entry may be released by another task meanwhile. If the lock cannot be
+ * taken (e.g. in the event callback), they return the same as for an invalid handle.
+ *
+ * @param[in] socket Socket handle
+ *
+ * @return Combination of ADRASTEAI_SOCKET_READY_xxx flags
+ */
+uint8_t AdrasteaI_Socket_GetReadiness(AdrasteaI_Socket_t socket)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return 0;
+    }
+
+    AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_Socket_Get(socket);
+    if (entryP == NULL)
+    {
+        AdrasteaI_EndCommand(true);
+        return 0;
+    }
+
+    uint8_t readiness = 0;
+    if (entryP->state == AdrasteaI_Socket_State_Listening)
+    {
+        readiness = (entryP->acceptRead != entryP->acceptWrite) ? ADRASTEAI_SOCKET_READY_ACCEPT : 0;
+        AdrasteaI_EndCommand(true);
+        return readiness;
+    }
+    if ((entryP->rxUsed > 0) || entryP->dataPending || entryP->peerClosed)
+    {
+        readiness |= ADRASTEAI_SOCKET_READY_READ;
+    }
+    if (entryP->peerClosed)
+    {
+        readiness |= ADRASTEAI_SOCKET_READY_HANGUP;
+    }
+    else if (entryP->state == AdrasteaI_Socket_State_Connected)
+    {
+        readiness |= ADRASTEAI_SOCKET_READY_WRITE;
+    }
+
+    AdrasteaI_EndCommand(true);
+    return readiness;
+}
+
+/**
+ * @brief Returns the number of bytes in the receive buffer of a socket.
+ *
+ * Data reported by the module but not read into the receive buffer yet is not included.
+ *
+ * @param[in] socket Socket handle
+ *
+ * @return Number of bytes that can be received without AT command
+ */
+uint16_t AdrasteaI_Socket_GetAvailable(AdrasteaI_Socket_t socket)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return 0;
+    }
+
+    AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_Socket_Get(socket);
+    uint16_t available = (entryP == NULL) ? 0 : entryP->rxUsed;
+
+    AdrasteaI_EndCommand(true);
+    return available;
+}
+
+/**
+ * @brief Returns the state of a socket.
+ *
+ * @param[in] socket Socket handle
+ *
+ * @return State of the socket (AdrasteaI_Socket_State_Free if the handle is not in use)
+ */
+AdrasteaI_Socket_State_t AdrasteaI_Socket_GetState(AdrasteaI_Socket_t socket)
+{
+    if (socket >= ADRASTEAI_SOCKET_MAX_SOCKETS)
+    {
+        return AdrasteaI_Socket_State_Invalid;
+    }
+
+    if (!AdrasteaI_BeginCommand())
+    {
+        return AdrasteaI_Socket_State_Invalid;
+    }
+
+    AdrasteaI_Socket_State_t state = AdrasteaI_Socket_sockets[socket].state;
+
+    AdrasteaI_EndCommand(true);
+    return state;
+}
+
+/**
+ * @brief Returns the error of the last failed operation on a socket.
+ *
+ * @param[in] socket Socket handle
+ *
+ * @return Error of the last operation (AdrasteaI_Socket_Error_None if it was successful)
+ */
+AdrasteaI_Socket_Error_t AdrasteaI_Socket_GetLastError(AdrasteaI_Socket_t socket)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return AdrasteaI_Socket_Error_InvalidArgument;
+    }
+
+    AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_Socket_Get(socket);
+    AdrasteaI_Socket_Error_t error = (entryP == NULL) ? AdrasteaI_Socket_Error_InvalidArgument : entryP->lastError;
+
+    AdrasteaI_EndCommand(true);
+    return error;
+}
+
+/**
+ * @brief Returns the statistics of a listening socket.
+ *
+ * @param[in] listenSocket Listening socket handle
+ * @param[out] statisticsP Statistics
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Socket_GetListenerStatistics(AdrasteaI_Socket_t listenSocket, AdrasteaI_Socket_Listener_Statistics_t* statisticsP)
+{
+    if ((statisticsP == NULL) || !AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_Socket_Get(listenSocket);
+    if (entryP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+    *statisticsP = entryP->listenerStatistics;
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Returns the send statistics of a socket.
+ *
+ * @param[in] socket Socket handle
+ * @param[out] statisticsP Send statistics
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Socket_GetSendStatistics(AdrasteaI_Socket_t socket, AdrasteaI_Socket_Send_Statistics_t* statisticsP)
+{
+    if ((statisticsP == NULL) || !AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_Socket_Get(socket);
+    if (entryP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+    *statisticsP = entryP->txStatistics;
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Sets the timeout of blocking receive calls.
+ *
+ * @param[in] socket Socket handle
+ * @param[in] timeoutMs Timeout in milliseconds
+ */
+void AdrasteaI_Socket_SetReceiveTimeout(AdrasteaI_Socket_t socket, uint32_t timeoutMs)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return;
+    }
+
+    AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_Socket_Get(socket);
+    if (entryP != NULL)
+    {
+        entryP->receiveTimeoutMs = timeoutMs;
+    }
+
+    AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Tracks %SOCKETEV notifications. Is called by the driver for each received URC.
+ *
+ * Only sets flags, data is read later from the calling task (see AdrasteaI_Socket_Process()).
+ *
+ * @param[in] event Event type, parsed once by the driver for all URC handlers
+ * @param[in] pArguments Arguments following the event name (not modified, the line is passed on to the event callback afterwards)
+ */
+void AdrasteaI_Socket_HandleURC(AdrasteaI_ATEvent_t event, char* pArguments)
+{
+    AdrasteaI_ATSocket_ID_t moduleSocketID;
+    switch (event)
+    {
+        case AdrasteaI_ATEvent_Socket_Data_Received:
+        {
+            AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_ATSocket_ParseDataReceivedEvent(pArguments, &moduleSocketID) ? AdrasteaI_Socket_GetByModuleSocketID(moduleSocketID) : NULL;
+            if (entryP != NULL)
+            {
+                entryP->dataPending = true;
+                AdrasteaI_Socket_Notify(entryP);
+            }
+            break;
+        }
+        case AdrasteaI_ATEvent_Socket_Deactivated_Idle_Timer:
+        case AdrasteaI_ATEvent_Socket_Terminated_By_Peer:
+        {
+            AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_ATSocket_ParseSocketTerminatedEvent(pArguments, &moduleSocketID) ? AdrasteaI_Socket_GetByModuleSocketID(moduleSocketID) : NULL;
+            if (entryP != NULL)
+            {
+                entryP->peerClosed = true;
+                AdrasteaI_Socket_Notify(entryP);
+            }
+            break;
+        }
+        case AdrasteaI_ATEvent_Socket_New_Socket_Accepted:
+        {
+            AdrasteaI_ATSocket_Accepted_t accepted;
+            AdrasteaI_Socket_Entry_t* entryP = AdrasteaI_ATSocket_ParseNewSocketAcceptedEvent(pArguments, &accepted) ? AdrasteaI_Socket_GetByModuleSocketID(accepted.listenSocketID) : NULL;
+            if ((entryP == NULL) || (entryP->state != AdrasteaI_Socket_State_Listening))
+            {
+                break;
+            }
+
+            /* A single connection listener reports the connection on the listening socket itself */
+            AdrasteaI_ATSocket_ID_t acceptedID = (accepted.acceptedSocketID != AdrasteaI_ATSocket_ID_Invalid) ? accepted.acceptedSocketID : accepted.listenSocketID;
+            if ((uint8_t)(entryP->acceptWrite - entryP->acceptRead) < ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE)
+            {
+                entryP->acceptQueue[entryP->acceptWrite % ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE] = acceptedID;
+                entryP->acceptWrite++;
+                AdrasteaI_Socket_Notify(entryP);
+            }
+            else
+            {
+                entryP->listenerStatistics.dropped++;
+                if ((acceptedID != entryP->moduleSocketID) && ((uint8_t)(AdrasteaI_Socket_rejectedWrite - AdrasteaI_Socket_rejectedRead) < ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE))
+                {
+                    AdrasteaI_Socket_rejected[AdrasteaI_Socket_rejectedWrite % ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE] = acceptedID;
+                    AdrasteaI_Socket_rejectedWrite++;
+                }
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+#endif /* ADRASTEAI_SOCKET */
@@ -0,0 +1,227 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief BSD-style socket layer with per-socket receive buffers (enabled by defining ADRASTEAI_SOCKET).
+ *
+ * The socket layer tracks the %SOCKETEV notifications of the module. When data has been received by the
+ * module, it is read into the receive ring buffer of the socket by the next call of AdrasteaI_Socket_Receive()
+ * or AdrasteaI_Socket_Process(). Data is read from the module only as long as there is space in the ring buffer,
+ * remaining data stays buffered in the module.
+ *
+ * AT commands cannot be sent from the event callback, so the module buffers are drained from the calling task
+ * only. Applications should call AdrasteaI_Socket_Process() regularly if they do not call AdrasteaI_Socket_Receive()
+ * right away.
+ *
+ * TCP servers use AdrasteaI_Socket_Listen() and AdrasteaI_Socket_Accept(). Connections accepted by the module are
+ * queued by the notification handler without sending AT commands, up to ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE per
+ * listening socket. Connections arriving while the queue is full are closed by the next call of
+ * AdrasteaI_Socket_Accept() or AdrasteaI_Socket_Process().
+ */
+
+#ifndef ADRASTEAI_SOCKET_H_INCLUDED
+#define ADRASTEAI_SOCKET_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ATEvent.h"
+#include "ATSocket.h"
+
+#ifndef ADRASTEAI_SOCKET_MAX_SOCKETS
+/**
+ * @brief Max. number of sockets handled by the socket layer.
+ */
+#define ADRASTEAI_SOCKET_MAX_SOCKETS 4
+#endif
+
+#ifndef ADRASTEAI_SOCKET_RX_BUFFER_SIZE
+/**
+ * @brief Size of the receive ring buffer of each socket in bytes.
+ */
+#define ADRASTEAI_SOCKET_RX_BUFFER_SIZE 1024
+#endif
+
+#ifndef ADRASTEAI_SOCKET_TRANSFER_CHUNK_SIZE
+/**
+ * @brief Max. number of bytes read from the module by a single AT%SOCKETDATA command.
+ */
+#define ADRASTEAI_SOCKET_TRANSFER_CHUNK_SIZE 512
+#endif
+
+#ifndef ADRASTEAI_SOCKET_DEFAULT_RECEIVE_TIMEOUT_MS
+/**
+ * @brief Default timeout of blocking receive calls (milliseconds).
+ * @see AdrasteaI_Socket_SetReceiveTimeout()
+ */
+#define ADRASTEAI_SOCKET_DEFAULT_RECEIVE_TIMEOUT_MS 10000
+#endif
+
+#ifndef ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE
+/**
+ * @brief Number of accepted connections queued per listening socket (power of two, max. 128).
+ */
+#define ADRASTEAI_SOCKET_ACCEPT_QUEUE_SIZE 4
+#endif
+
+#ifndef ADRASTEAI_SOCKET_MAX_CONNECTIONS_PER_LISTENER
+/**
+ * @brief Max. number of open accepted connections per listening socket.
+ */
+#define ADRASTEAI_SOCKET_MAX_CONNECTIONS_PER_LISTENER (ADRASTEAI_SOCKET_MAX_SOCKETS - 1)
+#endif
+
+#ifndef ADRASTEAI_SOCKET_IDLE_TIMEOUT_MS
+/**
+ * @brief Time without sent or received data after which accepted connections are evicted (milliseconds).
+ *
+ * Idle connections are closed by AdrasteaI_Socket_Process(), and by AdrasteaI_Socket_Accept() if the listener has
+ * reached ADRASTEAI_SOCKET_MAX_CONNECTIONS_PER_LISTENER. An evicted connection no longer counts for the listener, but
+ * its handle stays valid in state AdrasteaI_Socket_State_Closed until it is closed by AdrasteaI_Socket_Close().
+ */
+#define ADRASTEAI_SOCKET_IDLE_TIMEOUT_MS 60000
+#endif
+
+/**
+ * @brief Return immediately instead of waiting for data or for the command lock.
+ */
+#define ADRASTEAI_SOCKET_FLAGS_NONBLOCKING (1 << 0)
+
+#define ADRASTEAI_SOCKET_READY_READ (1 << 0)   /**< Data can be read (or end of stream reached) */
+#define ADRASTEAI_SOCKET_READY_WRITE (1 << 1)  /**< Socket is connected and may be written */
+#define ADRASTEAI_SOCKET_READY_HANGUP (1 << 2) /**< Connection has been closed by the peer or the module */
+#define ADRASTEAI_SOCKET_READY_ACCEPT (1 << 3) /**< Listening socket has a connection to accept */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief Socket handle.
+ */
+    typedef uint8_t AdrasteaI_Socket_t;
+
+#define AdrasteaI_Socket_Invalid 0xFF
+
+    /**
+ * @brief Socket states.
+ */
+    typedef enum AdrasteaI_Socket_State_t
+    {
+        AdrasteaI_Socket_State_Invalid = -1,
+        AdrasteaI_Socket_State_Free,
+        AdrasteaI_Socket_State_Open,
+        AdrasteaI_Socket_State_Connected,
+        AdrasteaI_Socket_State_Closed,
+        AdrasteaI_Socket_State_Listening,
+        AdrasteaI_Socket_State_NumberOfValues
+    } AdrasteaI_Socket_State_t;
+
+    /**
+ * @brief Socket errors.
+ * @see AdrasteaI_Socket_GetLastError()
+ */
+    typedef enum AdrasteaI_Socket_Error_t
+    {
+        AdrasteaI_Socket_Error_Invalid = -1,
+        AdrasteaI_Socket_Error_None,
+        AdrasteaI_Socket_Error_InvalidArgument,
+        AdrasteaI_Socket_Error_NoResources,
+        AdrasteaI_Socket_Error_NotConnected,
+        AdrasteaI_Socket_Error_WouldBlock,
+        AdrasteaI_Socket_Error_TimedOut,
+        AdrasteaI_Socket_Error_Command,
+        AdrasteaI_Socket_Error_Canceled,
+        AdrasteaI_Socket_Error_NumberOfValues
+    } AdrasteaI_Socket_Error_t;
+
+    /**
+ * @brief Send statistics of a socket.
+ * @see AdrasteaI_Socket_GetSendStatistics()
+ */
+    typedef struct AdrasteaI_Socket_Send_Statistics_t
+    {
+        uint32_t bytesAcknowledged;     /**< Total number of bytes acknowledged by the module since the socket has been opened */
+        uint32_t lastSendBytes;         /**< Number of bytes acknowledged by the last call of AdrasteaI_Socket_Send() */
+        uint32_t lastSendDurationUsec;  /**< Duration of the last call of AdrasteaI_Socket_Send() in microseconds */
+        uint32_t lastSendGoodput;       /**< Achieved payload rate of the last call of AdrasteaI_Socket_Send() in bytes per second */
+        uint32_t lastSendGoodputLimit;  /**< Max. payload rate the UART could have transferred in bytes per second */
+    } AdrasteaI_Socket_Send_Statistics_t;
+
+    /**
+ * @brief Statistics of a listening socket.
+ * @see AdrasteaI_Socket_GetListenerStatistics()
+ */
+    typedef struct AdrasteaI_Socket_Listener_Statistics_t
+    {
+        uint32_t accepted; /**< Connections returned by AdrasteaI_Socket_Accept() */
+        uint32_t dropped;  /**< Connections closed because the accept queue was full */
+        uint32_t rejected; /**< Connections closed because of ADRASTEAI_SOCKET_MAX_CONNECTIONS_PER_LISTENER or a lack of free sockets */
+        uint32_t evicted;  /**< Connections closed because they were idle */
+    } AdrasteaI_Socket_Listener_Statistics_t;
+
+    extern bool AdrasteaI_Socket_Init(void);
+
+    extern bool AdrasteaI_Socket_Open(AdrasteaI_ATCommon_Session_ID_t sessionID, AdrasteaI_ATSocket_Type_t socketType, AdrasteaI_Socket_t* socketP);
+
+    extern bool AdrasteaI_Socket_Connect(AdrasteaI_Socket_t socket, const char* ipAddress, AdrasteaI_ATCommon_Port_Number_t portNumber);
+
+    extern bool AdrasteaI_Socket_Listen(AdrasteaI_Socket_t socket, AdrasteaI_ATCommon_Port_Number_t portNumber, bool multiple);
+
+    extern bool AdrasteaI_Socket_Accept(AdrasteaI_Socket_t listenSocket, uint8_t flags, AdrasteaI_Socket_t* socketP);
+
+    extern bool AdrasteaI_Socket_Send(AdrasteaI_Socket_t socket, const uint8_t* data, uint32_t length, uint8_t flags);
+
+    extern void AdrasteaI_Socket_CancelSend(AdrasteaI_Socket_t socket);
+
+    extern bool AdrasteaI_Socket_Receive(AdrasteaI_Socket_t socket, uint8_t* buffer, uint16_t bufferSize, uint8_t flags, uint16_t* receivedLengthP);
+
+    extern bool AdrasteaI_Socket_Close(AdrasteaI_Socket_t socket);
+
+    extern bool AdrasteaI_Socket_Process(void);
+
+    extern uint8_t AdrasteaI_Socket_GetReadiness(AdrasteaI_Socket_t socket);
+
+    extern uint16_t AdrasteaI_Socket_GetAvailable(AdrasteaI_Socket_t socket);
+
+    extern AdrasteaI_Socket_State_t AdrasteaI_Socket_GetState(AdrasteaI_Socket_t socket);
+
+    extern AdrasteaI_Socket_Error_t AdrasteaI_Socket_GetLastError(AdrasteaI_Socket_t socket);
+
+    extern bool AdrasteaI_Socket_GetListenerStatistics(AdrasteaI_Socket_t listenSocket, AdrasteaI_Socket_Listener_Statistics_t* statisticsP);
+
+    extern bool AdrasteaI_Socket_GetSendStatistics(AdrasteaI_Socket_t socket, AdrasteaI_Socket_Send_Statistics_t* statisticsP);
+
+    extern void AdrasteaI_Socket_SetReceiveTimeout(AdrasteaI_Socket_t socket, uint32_t timeoutMs);
+
+    extern void AdrasteaI_Socket_HandleURC(AdrasteaI_ATEvent_t event, char* pArguments);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADRASTEAI_SOCKET_H_INCLUDED */
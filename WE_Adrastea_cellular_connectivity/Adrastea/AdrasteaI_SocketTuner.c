@@ -0,0 +1,246 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Traffic-aware tuning of the socket aggregation options (enabled by defining ADRASTEAI_SOCKET_TUNER).
+ */
+
+#include <string.h>
+
+#include "AdrasteaI.h"
+#include "AdrasteaI_SocketTuner.h"
+#include "global.h"
+#include "log.h"
+
+#ifdef ADRASTEAI_SOCKET_TUNER
+
+#ifndef ADRASTEAI_SOCKET
+#error "ADRASTEAI_SOCKET_TUNER requires ADRASTEAI_SOCKET"
+#endif
+
+/**
+ * @brief Tuner state of a socket.
+ */
+typedef struct AdrasteaI_SocketTuner_Entry_t
+{
+    AdrasteaI_SocketTuner_Config_t config;
+    AdrasteaI_SocketTuner_State_t state;
+    uint32_t sendSizeX8;   /**< Average send size multiplied by 8 (avoids rounding bias of the moving average) */
+    uint32_t intervalMsX8; /**< Average send interval multiplied by 8 */
+    uint32_t lastSendTime;
+    uint32_t sendCount;
+    bool optionsSet; /**< Options have been sent to the module at least once */
+} AdrasteaI_SocketTuner_Entry_t;
+
+static AdrasteaI_SocketTuner_Entry_t AdrasteaI_SocketTuner_entries[ADRASTEAI_SOCKET_MAX_SOCKETS];
+
+/**
+ * @brief Returns true if value differs from reference by more than ADRASTEAI_SOCKET_TUNER_HYSTERESIS_PERCENT.
+ */
+static bool AdrasteaI_SocketTuner_Differs(uint32_t value, uint32_t reference)
+{
+    uint32_t difference = (value > reference) ? (value - reference) : (reference - value);
+    return (difference * 100) > (reference * ADRASTEAI_SOCKET_TUNER_HYSTERESIS_PERCENT);
+}
+
+/**
+ * @brief Derives the aggregation options from the observed traffic and sends them to the module if they changed significantly.
+ *
+ * Combining n sends into one packet requires holding back the first of them for (n - 1) send intervals and
+ * buffering n sends. n is chosen as large as the latency budget and the max. buffer size allow.
+ */
+static void AdrasteaI_SocketTuner_Evaluate(AdrasteaI_SocketTuner_Entry_t* entryP, AdrasteaI_Socket_t socket, AdrasteaI_ATSocket_ID_t moduleSocketID)
+{
+    AdrasteaI_SocketTuner_State_t* stateP = &entryP->state;
+
+    uint32_t interval = (stateP->averageIntervalMs > 0) ? stateP->averageIntervalMs : 1;
+    uint32_t size = (stateP->averageSendSize > 0) ? stateP->averageSendSize : 1;
+
+    uint32_t sendsPerPacket = entryP->config.maxLatencyMs / interval + 1;
+    uint32_t sendsPerBuffer = entryP->config.maxBufferSize / size;
+    if (sendsPerPacket > sendsPerBuffer)
+    {
+        sendsPerPacket = sendsPerBuffer;
+    }
+    if (sendsPerPacket < 1)
+    {
+        sendsPerPacket = 1;
+    }
+    if (sendsPerPacket > UINT16_MAX)
+    {
+        sendsPerPacket = UINT16_MAX;
+    }
+
+    uint32_t aggregationTime = (sendsPerPacket - 1) * interval;
+    uint32_t aggregationBufferSize = sendsPerPacket * size;
+    if (aggregationBufferSize > entryP->config.maxBufferSize)
+    {
+        aggregationBufferSize = entryP->config.maxBufferSize;
+    }
+
+    if (entryP->optionsSet && !AdrasteaI_SocketTuner_Differs(aggregationTime, stateP->aggregationTime) && !AdrasteaI_SocketTuner_Differs(aggregationBufferSize, stateP->aggregationBufferSize))
+    {
+        return;
+    }
+
+    if (!AdrasteaI_ATSocket_SetSocketOptions(moduleSocketID, (AdrasteaI_ATSocket_Aggregation_Time_t)aggregationTime, (AdrasteaI_ATSocket_Aggregation_Buffer_Size_t)aggregationBufferSize, entryP->config.idleTime))
+    {
+        WE_LOG_WARNING(SocketTuner, "Socket %u: failed to set aggregation options", socket);
+        return;
+    }
+
+    /* Effect at the current send rate: without options set by the tuner, each send is assumed to be one packet */
+    uint32_t sendsPerSecondX100 = 100000 / interval;
+    uint32_t packetsPerSecondX100 = sendsPerSecondX100 / sendsPerPacket;
+
+    WE_LOG_INFO(SocketTuner, "Socket %u: aggregation %u ms, %u bytes (%u sends per packet)", socket, aggregationTime, aggregationBufferSize, sendsPerPacket);
+    WE_LOG_INFO(SocketTuner, "Socket %u: packets per second x100: %u -> %u (sends per second x100: %u)", socket, sendsPerSecondX100 / (entryP->optionsSet ? stateP->sendsPerPacket : 1), packetsPerSecondX100, sendsPerSecondX100);
+
+    stateP->aggregationTime = (AdrasteaI_ATSocket_Aggregation_Time_t)aggregationTime;
+    stateP->aggregationBufferSize = (AdrasteaI_ATSocket_Aggregation_Buffer_Size_t)aggregationBufferSize;
+    stateP->sendsPerPacket = (uint16_t)sendsPerPacket;
+    stateP->packetsPerSecondX100 = packetsPerSecondX100;
+    stateP->updates++;
+    entryP->optionsSet = true;
+}
+
+/**
+ * @brief Enables tuning of the aggregation options of a socket.
+ *
+ * The options are evaluated after every ADRASTEAI_SOCKET_TUNER_EVALUATION_SENDS sends. Until then, the options
+ * set in the module are not changed.
+ *
+ * @param[in] socket Socket handle
+ * @param[in] configP Tuning limits
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_SocketTuner_Enable(AdrasteaI_Socket_t socket, const AdrasteaI_SocketTuner_Config_t* configP)
+{
+    if ((socket >= ADRASTEAI_SOCKET_MAX_SOCKETS) || (configP == NULL) || (configP->maxBufferSize == 0))
+    {
+        return false;
+    }
+
+    AdrasteaI_SocketTuner_Entry_t* entryP = &AdrasteaI_SocketTuner_entries[socket];
+    memset(entryP, 0, sizeof(*entryP));
+    entryP->config = *configP;
+    entryP->state.enabled = true;
+    return true;
+}
+
+/**
+ * @brief Disables tuning of the aggregation options of a socket. The options set in the module are not changed.
+ *
+ * Is called by the socket layer when a socket is opened.
+ *
+ * @param[in] socket Socket handle
+ */
+void AdrasteaI_SocketTuner_Disable(AdrasteaI_Socket_t socket)
+{
+    if (socket < ADRASTEAI_SOCKET_MAX_SOCKETS)
+    {
+        AdrasteaI_SocketTuner_entries[socket].state.enabled = false;
+    }
+}
+
+/**
+ * @brief Returns the observed traffic and the current aggregation options of a socket.
+ *
+ * @param[in] socket Socket handle
+ * @param[out] stateP Tuner state
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_SocketTuner_GetState(AdrasteaI_Socket_t socket, AdrasteaI_SocketTuner_State_t* stateP)
+{
+    if ((socket >= ADRASTEAI_SOCKET_MAX_SOCKETS) || (stateP == NULL))
+    {
+        return false;
+    }
+    *stateP = AdrasteaI_SocketTuner_entries[socket].state;
+    return true;
+}
+
+/**
+ * @brief Records a send. Is called by the socket layer for each successful send (with the command lock taken).
+ *
+ * Averages are exponentially weighted (weight 1/8 for the latest send).
+ *
+ * @param[in] socket Socket handle
+ * @param[in] moduleSocketID Socket ID in the module
+ * @param[in] length Number of bytes sent
+ */
+void AdrasteaI_SocketTuner_SendObserved(AdrasteaI_Socket_t socket, AdrasteaI_ATSocket_ID_t moduleSocketID, uint32_t length)
+{
+    if (socket >= ADRASTEAI_SOCKET_MAX_SOCKETS)
+    {
+        return;
+    }
+
+    AdrasteaI_SocketTuner_Entry_t* entryP = &AdrasteaI_SocketTuner_entries[socket];
+    AdrasteaI_SocketTuner_State_t* stateP = &entryP->state;
+    if (!stateP->enabled)
+    {
+        return;
+    }
+
+    uint32_t now = WE_GetTick();
+
+    if (length > ADRASTEAI_MAX_PAYLOAD_SIZE * 64)
+    {
+        length = ADRASTEAI_MAX_PAYLOAD_SIZE * 64;
+    }
+
+    if (entryP->sendCount == 0)
+    {
+        entryP->sendSizeX8 = length * 8;
+    }
+    else
+    {
+        uint32_t interval = now - entryP->lastSendTime;
+        if (interval > ADRASTEAI_SOCKET_TUNER_MAX_INTERVAL_MS)
+        {
+            interval = ADRASTEAI_SOCKET_TUNER_MAX_INTERVAL_MS;
+        }
+
+        entryP->sendSizeX8 = entryP->sendSizeX8 - entryP->sendSizeX8 / 8 + length;
+        entryP->intervalMsX8 = (entryP->sendCount == 1) ? (interval * 8) : (entryP->intervalMsX8 - entryP->intervalMsX8 / 8 + interval);
+    }
+
+    stateP->averageSendSize = (entryP->sendSizeX8 + 4) / 8;
+    stateP->averageIntervalMs = (entryP->intervalMsX8 + 4) / 8;
+
+    entryP->lastSendTime = now;
+    entryP->sendCount++;
+
+    if ((entryP->sendCount % ADRASTEAI_SOCKET_TUNER_EVALUATION_SENDS) == 0)
+    {
+        AdrasteaI_SocketTuner_Evaluate(entryP, socket, moduleSocketID);
+    }
+}
+
+#endif /* ADRASTEAI_SOCKET_TUNER */
@@ -0,0 +1,108 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Traffic-aware tuning of the socket aggregation options (enabled by defining ADRASTEAI_SOCKET_TUNER).
+ *
+ * The tuner observes the size and interval of the data sent by AdrasteaI_Socket_Send() and sets the aggregation
+ * options of the module (see AdrasteaI_ATSocket_SetSocketOptions()) so that as many sends as possible are combined
+ * into one radio packet without delaying data by more than the configured latency budget.
+ *
+ * Tuning is enabled per socket by AdrasteaI_SocketTuner_Enable(). Decisions are logged at level info of the module
+ * SocketTuner (see log.h), together with the estimated number of radio packets per second before and after.
+ * Requires ADRASTEAI_SOCKET.
+ */
+
+#ifndef ADRASTEAI_SOCKETTUNER_H_INCLUDED
+#define ADRASTEAI_SOCKETTUNER_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "AdrasteaI_Socket.h"
+
+#ifndef ADRASTEAI_SOCKET_TUNER_EVALUATION_SENDS
+/**
+ * @brief Number of observed sends between two evaluations of the aggregation options.
+ */
+#define ADRASTEAI_SOCKET_TUNER_EVALUATION_SENDS 8
+#endif
+
+#ifndef ADRASTEAI_SOCKET_TUNER_HYSTERESIS_PERCENT
+/**
+ * @brief Min. change of the aggregation options (percent) for sending new options to the module.
+ */
+#define ADRASTEAI_SOCKET_TUNER_HYSTERESIS_PERCENT 25
+#endif
+
+/**
+ * @brief Max. send interval taken into account (milliseconds). Longer pauses are counted as this value.
+ */
+#define ADRASTEAI_SOCKET_TUNER_MAX_INTERVAL_MS 60000
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief Tuning limits of a socket.
+ */
+    typedef struct AdrasteaI_SocketTuner_Config_t
+    {
+        AdrasteaI_ATSocket_Aggregation_Time_t maxLatencyMs;         /**< Max. time data may be held back for aggregation (milliseconds) */
+        AdrasteaI_ATSocket_Aggregation_Buffer_Size_t maxBufferSize; /**< Max. aggregation buffer size (bytes), e.g. ADRASTEAI_MAX_PAYLOAD_SIZE */
+        AdrasteaI_ATSocket_TCP_Idle_Time_t idleTime;                /**< TCP idle time passed to the module unchanged (seconds) */
+    } AdrasteaI_SocketTuner_Config_t;
+
+    /**
+ * @brief Observed traffic and current aggregation options of a socket.
+ */
+    typedef struct AdrasteaI_SocketTuner_State_t
+    {
+        bool enabled;                                                       /**< Tuning is enabled */
+        uint32_t averageSendSize;                                           /**< Average number of bytes per send */
+        uint32_t averageIntervalMs;                                         /**< Average time between two sends (milliseconds) */
+        AdrasteaI_ATSocket_Aggregation_Time_t aggregationTime;              /**< Aggregation time currently set in the module (milliseconds) */
+        AdrasteaI_ATSocket_Aggregation_Buffer_Size_t aggregationBufferSize; /**< Aggregation buffer size currently set in the module (bytes) */
+        uint16_t sendsPerPacket;                                            /**< Estimated number of sends combined into one radio packet */
+        uint32_t packetsPerSecondX100;                                      /**< Estimated radio packets per second (multiplied by 100) */
+        uint16_t updates;                                                   /**< Number of times new options have been set */
+    } AdrasteaI_SocketTuner_State_t;
+
+    extern bool AdrasteaI_SocketTuner_Enable(AdrasteaI_Socket_t socket, const AdrasteaI_SocketTuner_Config_t* configP);
+
+    extern void AdrasteaI_SocketTuner_Disable(AdrasteaI_Socket_t socket);
+
+    extern bool AdrasteaI_SocketTuner_GetState(AdrasteaI_Socket_t socket, AdrasteaI_SocketTuner_State_t* stateP);
+
+    extern void AdrasteaI_SocketTuner_SendObserved(AdrasteaI_Socket_t socket, AdrasteaI_ATSocket_ID_t moduleSocketID, uint32_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADRASTEAI_SOCKETTUNER_H_INCLUDED */
@@ -0,0 +1,190 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Compact CBOR encoding of the driver's measurement structures for publishing (enabled by defining ADRASTEAI_TELEMETRY).
+ */
+
+#include "AdrasteaI_Telemetry.h"
+
+#ifdef ADRASTEAI_TELEMETRY
+
+#ifndef WE_CBOR
+#error "ADRASTEAI_TELEMETRY requires WE_CBOR"
+#endif
+
+/**
+ * @brief Values reported by the module if a quantity is not known or not detectable (see 3GPP TS 27.007).
+ */
+#define ADRASTEAI_TELEMETRY_UNKNOWN_CSQ 99
+#define ADRASTEAI_TELEMETRY_UNKNOWN_CESQ 255
+
+/**
+ * @brief Field of a map, encoded if present is true.
+ */
+typedef struct AdrasteaI_Telemetry_Field_t
+{
+    bool present;
+    int64_t value;
+} AdrasteaI_Telemetry_Field_t;
+
+/**
+ * @brief Encodes the present fields as a map with the field indices as keys.
+ */
+static bool AdrasteaI_Telemetry_EncodeFields(WE_CBOR_Encoder_t* encoderP, const AdrasteaI_Telemetry_Field_t* fields, uint8_t count)
+{
+    uint8_t presentCount = 0;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (fields[i].present)
+        {
+            presentCount++;
+        }
+    }
+
+    bool ret = WE_CBOR_StartMap(encoderP, presentCount);
+    for (uint8_t i = 0; ret && (i < count); i++)
+    {
+        if (fields[i].present)
+        {
+            ret = WE_CBOR_EncodeUInt(encoderP, i) && WE_CBOR_EncodeInt(encoderP, fields[i].value);
+        }
+    }
+
+    return ret;
+}
+
+#ifndef ADRASTEAI_FIXED_POINT
+/**
+ * @brief Converts a value to thousandths (or millionths) of its unit, rounded to the nearest integer.
+ */
+static int64_t AdrasteaI_Telemetry_Scale(double value, double factor)
+{
+    double scaled = value * factor;
+    return (int64_t)((scaled < 0) ? (scaled - 0.5) : (scaled + 0.5));
+}
+#endif
+
+/**
+ * @brief Encodes a signal quality as a CBOR map (see AdrasteaI_Telemetry_Signal_Quality_Key_t).
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] sqP Signal quality as read using AdrasteaI_ATNetService_ReadSignalQuality()
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Telemetry_EncodeSignalQuality(WE_CBOR_Encoder_t* encoderP, const AdrasteaI_ATNetService_Signal_Quality_t* sqP)
+{
+    if (sqP == NULL)
+    {
+        return false;
+    }
+
+    AdrasteaI_Telemetry_Field_t fields[AdrasteaI_Telemetry_Signal_Quality_Key_NumberOfValues] = {
+        [AdrasteaI_Telemetry_Signal_Quality_Key_RSSI] = {sqP->rssi != ADRASTEAI_TELEMETRY_UNKNOWN_CSQ, sqP->rssi},
+        [AdrasteaI_Telemetry_Signal_Quality_Key_BER] = {sqP->ber != ADRASTEAI_TELEMETRY_UNKNOWN_CSQ, sqP->ber},
+    };
+
+    return AdrasteaI_Telemetry_EncodeFields(encoderP, fields, AdrasteaI_Telemetry_Signal_Quality_Key_NumberOfValues);
+}
+
+/**
+ * @brief Encodes an extended signal quality as a CBOR map (see AdrasteaI_Telemetry_Extended_Signal_Quality_Key_t).
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] esqP Extended signal quality as read using AdrasteaI_ATNetService_ReadExtendedSignalQuality()
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Telemetry_EncodeExtendedSignalQuality(WE_CBOR_Encoder_t* encoderP, const AdrasteaI_ATNetService_Extended_Signal_Quality_t* esqP)
+{
+    if (esqP == NULL)
+    {
+        return false;
+    }
+
+    AdrasteaI_Telemetry_Field_t fields[AdrasteaI_Telemetry_Extended_Signal_Quality_Key_NumberOfValues] = {
+        [AdrasteaI_Telemetry_Extended_Signal_Quality_Key_RXLEV] = {esqP->rxlev != ADRASTEAI_TELEMETRY_UNKNOWN_CSQ, esqP->rxlev},
+        [AdrasteaI_Telemetry_Extended_Signal_Quality_Key_BER] = {esqP->ber != ADRASTEAI_TELEMETRY_UNKNOWN_CSQ, esqP->ber},
+        [AdrasteaI_Telemetry_Extended_Signal_Quality_Key_RSCP] = {esqP->rscp != ADRASTEAI_TELEMETRY_UNKNOWN_CESQ, esqP->rscp},
+        [AdrasteaI_Telemetry_Extended_Signal_Quality_Key_ECNO] = {esqP->ecno != ADRASTEAI_TELEMETRY_UNKNOWN_CESQ, esqP->ecno},
+        [AdrasteaI_Telemetry_Extended_Signal_Quality_Key_RSRQ] = {esqP->rsrq != ADRASTEAI_TELEMETRY_UNKNOWN_CESQ, esqP->rsrq},
+        [AdrasteaI_Telemetry_Extended_Signal_Quality_Key_RSRP] = {esqP->rsrp != ADRASTEAI_TELEMETRY_UNKNOWN_CESQ, esqP->rsrp},
+    };
+
+    return AdrasteaI_Telemetry_EncodeFields(encoderP, fields, AdrasteaI_Telemetry_Extended_Signal_Quality_Key_NumberOfValues);
+}
+
+/**
+ * @brief Encodes a GNSS fix as a CBOR map (see AdrasteaI_Telemetry_GNSS_Fix_Key_t).
+ *
+ * Position, accuracy and speed are encoded as integers in the fixed point units of ADRASTEAI_FIXED_POINT, which
+ * takes 5 bytes per coordinate instead of 9 for a double. Time and date are not encoded, as they are contained in
+ * the UTC timestamp.
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] fixP GNSS fix as read using AdrasteaI_ATGNSS_QueryGNSSFix()
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_Telemetry_EncodeGNSSFix(WE_CBOR_Encoder_t* encoderP, const AdrasteaI_ATGNSS_Fix_t* fixP)
+{
+    if (fixP == NULL)
+    {
+        return false;
+    }
+
+    bool position = (fixP->fixType > AdrasteaI_ATGNSS_Fix_Type_No_Fix) && (fixP->fixType < AdrasteaI_ATGNSS_Fix_Type_NumberOfValues);
+
+#ifdef ADRASTEAI_FIXED_POINT
+    int64_t latitude = fixP->latitude;
+    int64_t longitude = fixP->longitude;
+    int64_t altitude = fixP->altitude;
+    int64_t accuracy = fixP->accuracy;
+    int64_t speed = fixP->speed;
+#else
+    int64_t latitude = AdrasteaI_Telemetry_Scale(fixP->latitude, 1e6);
+    int64_t longitude = AdrasteaI_Telemetry_Scale(fixP->longitude, 1e6);
+    int64_t altitude = AdrasteaI_Telemetry_Scale(fixP->altitude, 1e3);
+    int64_t accuracy = AdrasteaI_Telemetry_Scale(fixP->accuracy, 1e3);
+    int64_t speed = AdrasteaI_Telemetry_Scale(fixP->speed, 1e3);
+#endif
+
+    AdrasteaI_Telemetry_Field_t fields[AdrasteaI_Telemetry_GNSS_Fix_Key_NumberOfValues] = {
+        [AdrasteaI_Telemetry_GNSS_Fix_Key_Fix_Type] = {true, fixP->fixType},
+        [AdrasteaI_Telemetry_GNSS_Fix_Key_UTC_Timestamp] = {fixP->utcTimestamp != 0, (int64_t)fixP->utcTimestamp},
+        [AdrasteaI_Telemetry_GNSS_Fix_Key_Latitude] = {position, latitude},
+        [AdrasteaI_Telemetry_GNSS_Fix_Key_Longitude] = {position, longitude},
+        [AdrasteaI_Telemetry_GNSS_Fix_Key_Altitude] = {position, altitude},
+        [AdrasteaI_Telemetry_GNSS_Fix_Key_Accuracy] = {position, accuracy},
+        [AdrasteaI_Telemetry_GNSS_Fix_Key_Speed] = {position, speed},
+        [AdrasteaI_Telemetry_GNSS_Fix_Key_Ephemeris] = {(fixP->ephType > AdrasteaI_ATGNSS_Ephemeris_Invalid) && (fixP->ephType < AdrasteaI_ATGNSS_Ephemeris_NumberOfValues), fixP->ephType},
+    };
+
+    return AdrasteaI_Telemetry_EncodeFields(encoderP, fields, AdrasteaI_Telemetry_GNSS_Fix_Key_NumberOfValues);
+}
+
+#endif /* ADRASTEAI_TELEMETRY */
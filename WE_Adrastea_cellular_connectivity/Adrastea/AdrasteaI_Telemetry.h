@@ -0,0 +1,106 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Compact CBOR encoding of the driver's measurement structures for publishing (enabled by defining ADRASTEAI_TELEMETRY).
+ *
+ * Each structure is encoded as a CBOR map with small integer keys (see the AdrasteaI_Telemetry_*_Key_t enumerations),
+ * so most fields take two or three bytes. Values are encoded as integers in the units reported by the module;
+ * values the module reports as unknown are omitted. The encoder writes directly into the payload buffer, e.g.:
+ *
+ *     WE_CBOR_Init(&encoder, payload, sizeof(payload));
+ *     AdrasteaI_Telemetry_EncodeSignalQuality(&encoder, &sq);
+ *     AdrasteaI_ATMQTT_PublishBinary(connID, qos, retain, topic, payload, WE_CBOR_GetLength(&encoder), &msgID);
+ *
+ * Requires WE_CBOR (see cbor.h).
+ */
+
+#ifndef ADRASTEAI_TELEMETRY_H_INCLUDED
+#define ADRASTEAI_TELEMETRY_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ATGNSS.h"
+#include "ATNetService.h"
+#include "cbor.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief Keys of the signal quality map.
+ */
+    typedef enum AdrasteaI_Telemetry_Signal_Quality_Key_t
+    {
+        AdrasteaI_Telemetry_Signal_Quality_Key_RSSI, /**< 0..31 (see AT+CSQ) */
+        AdrasteaI_Telemetry_Signal_Quality_Key_BER,  /**< 0..7 */
+        AdrasteaI_Telemetry_Signal_Quality_Key_NumberOfValues
+    } AdrasteaI_Telemetry_Signal_Quality_Key_t;
+
+    /**
+ * @brief Keys of the extended signal quality map.
+ */
+    typedef enum AdrasteaI_Telemetry_Extended_Signal_Quality_Key_t
+    {
+        AdrasteaI_Telemetry_Extended_Signal_Quality_Key_RXLEV, /**< 0..63 (see AT+CESQ) */
+        AdrasteaI_Telemetry_Extended_Signal_Quality_Key_BER,   /**< 0..7 */
+        AdrasteaI_Telemetry_Extended_Signal_Quality_Key_RSCP,  /**< 0..96 */
+        AdrasteaI_Telemetry_Extended_Signal_Quality_Key_ECNO,  /**< 0..49 */
+        AdrasteaI_Telemetry_Extended_Signal_Quality_Key_RSRQ,  /**< 0..34 */
+        AdrasteaI_Telemetry_Extended_Signal_Quality_Key_RSRP,  /**< 0..97 */
+        AdrasteaI_Telemetry_Extended_Signal_Quality_Key_NumberOfValues
+    } AdrasteaI_Telemetry_Extended_Signal_Quality_Key_t;
+
+    /**
+ * @brief Keys of the GNSS fix map.
+ */
+    typedef enum AdrasteaI_Telemetry_GNSS_Fix_Key_t
+    {
+        AdrasteaI_Telemetry_GNSS_Fix_Key_Fix_Type,      /**< AdrasteaI_ATGNSS_Fix_Type_t */
+        AdrasteaI_Telemetry_GNSS_Fix_Key_UTC_Timestamp, /**< Seconds since 1970 (omitted if 0) */
+        AdrasteaI_Telemetry_GNSS_Fix_Key_Latitude,      /**< Micro degrees */
+        AdrasteaI_Telemetry_GNSS_Fix_Key_Longitude,     /**< Micro degrees */
+        AdrasteaI_Telemetry_GNSS_Fix_Key_Altitude,      /**< Millimetres */
+        AdrasteaI_Telemetry_GNSS_Fix_Key_Accuracy,      /**< Thousandths of the unit reported by the module */
+        AdrasteaI_Telemetry_GNSS_Fix_Key_Speed,         /**< Thousandths of the unit reported by the module */
+        AdrasteaI_Telemetry_GNSS_Fix_Key_Ephemeris,     /**< AdrasteaI_ATGNSS_Ephemeris_t */
+        AdrasteaI_Telemetry_GNSS_Fix_Key_NumberOfValues
+    } AdrasteaI_Telemetry_GNSS_Fix_Key_t;
+
+    extern bool AdrasteaI_Telemetry_EncodeSignalQuality(WE_CBOR_Encoder_t* encoderP, const AdrasteaI_ATNetService_Signal_Quality_t* sqP);
+
+    extern bool AdrasteaI_Telemetry_EncodeExtendedSignalQuality(WE_CBOR_Encoder_t* encoderP, const AdrasteaI_ATNetService_Extended_Signal_Quality_t* esqP);
+
+    extern bool AdrasteaI_Telemetry_EncodeGNSSFix(WE_CBOR_Encoder_t* encoderP, const AdrasteaI_ATGNSS_Fix_t* fixP);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADRASTEAI_TELEMETRY_H_INCLUDED */
@@ -0,0 +1,418 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Batching of small UDP datagrams (enabled by defining ADRASTEAI_UDP_BATCH).
+ */
+
+#include <string.h>
+
+#include "AdrasteaI.h"
+#include "AdrasteaI_UDPBatch.h"
+#include "global.h"
+#include "log.h"
+
+#ifdef ADRASTEAI_UDP_BATCH
+
+#if ADRASTEAI_UDP_BATCH_BUFFER_SIZE > ADRASTEAI_ATSOCKET_HEX_SEGMENT_SIZE
+#error "ADRASTEAI_UDP_BATCH_BUFFER_SIZE must not exceed ADRASTEAI_ATSOCKET_HEX_SEGMENT_SIZE"
+#endif
+
+/**
+ * @brief Batch of a socket.
+ */
+typedef struct AdrasteaI_UDPBatch_Entry_t
+{
+    AdrasteaI_ATSocket_ID_t socketID; /**< Module socket (AdrasteaI_ATSocket_ID_Invalid if the entry is free) */
+    AdrasteaI_UDPBatch_Config_t config;
+    uint8_t buffer[ADRASTEAI_UDP_BATCH_BUFFER_SIZE];
+    uint16_t used;
+    uint16_t lengths[ADRASTEAI_UDP_BATCH_MAX_DATAGRAMS]; /**< Length of each datagram in the buffer (without framing) */
+    uint8_t count;
+    uint32_t firstAddTime; /**< Time the oldest datagram in the batch has been added */
+    uint32_t enableTime;
+    uint32_t lastSendTime;          /**< Time of the last transmission */
+    uint32_t lastUnbatchedSendTime; /**< Time of the last transmission if datagrams were not batched */
+    AdrasteaI_UDPBatch_Statistics_t statistics;
+} AdrasteaI_UDPBatch_Entry_t;
+
+static AdrasteaI_UDPBatch_Entry_t AdrasteaI_UDPBatch_entries[ADRASTEAI_UDP_BATCH_MAX_BATCHES];
+
+static AdrasteaI_UDPBatch_Entry_t* AdrasteaI_UDPBatch_Get(AdrasteaI_ATSocket_ID_t socketID)
+{
+    if (socketID == AdrasteaI_ATSocket_ID_Invalid)
+    {
+        return NULL;
+    }
+
+    for (uint8_t i = 0; i < ADRASTEAI_UDP_BATCH_MAX_BATCHES; i++)
+    {
+        if (AdrasteaI_UDPBatch_entries[i].socketID == socketID)
+        {
+            return &AdrasteaI_UDPBatch_entries[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Counts a transmission at time now as radio wake-up if the radio is assumed to be idle.
+ */
+static void AdrasteaI_UDPBatch_CountWakeup(uint32_t* wakeupsP, uint32_t* lastSendTimeP, bool first, uint32_t now)
+{
+    if (first || ((now - *lastSendTimeP) >= ADRASTEAI_UDP_BATCH_RADIO_INACTIVITY_MS))
+    {
+        (*wakeupsP)++;
+    }
+    *lastSendTimeP = now;
+}
+
+/**
+ * @brief Returns the size of a datagram including framing.
+ */
+static uint16_t AdrasteaI_UDPBatch_FramedSize(const AdrasteaI_UDPBatch_Entry_t* entryP, uint16_t length)
+{
+    if ((entryP->config.mode == AdrasteaI_UDPBatch_Mode_Coalesce) && (entryP->config.framing == AdrasteaI_UDPBatch_Framing_Length))
+    {
+        return length + ADRASTEAI_UDP_BATCH_LENGTH_PREFIX_SIZE;
+    }
+    return length;
+}
+
+/**
+ * @brief Sends the datagrams of a batch and empties the batch. Has to be called with the command lock held.
+ *
+ * If sending fails, the remaining datagrams are discarded.
+ */
+static bool AdrasteaI_UDPBatch_Send(AdrasteaI_UDPBatch_Entry_t* entryP)
+{
+    if (entryP->count == 0)
+    {
+        return true;
+    }
+
+    AdrasteaI_UDPBatch_Statistics_t* statisticsP = &entryP->statistics;
+    uint32_t now = WE_GetTick();
+    bool ret = true;
+    uint8_t sent = 0;
+
+    AdrasteaI_UDPBatch_CountWakeup(&statisticsP->wakeups, &entryP->lastSendTime, statisticsP->flushes == 0, now);
+    statisticsP->flushes++;
+
+    if (entryP->config.mode == AdrasteaI_UDPBatch_Mode_Coalesce)
+    {
+        statisticsP->commands++;
+        ret = AdrasteaI_ATSocket_SendBinaryToSocket(entryP->socketID, entryP->buffer, entryP->used);
+        if (ret)
+        {
+            sent = entryP->count;
+        }
+    }
+    else
+    {
+        const uint8_t* data = entryP->buffer;
+        for (; sent < entryP->count; sent++)
+        {
+            statisticsP->commands++;
+            if (!AdrasteaI_ATSocket_SendBinaryToSocket(entryP->socketID, data, entryP->lengths[sent]))
+            {
+                ret = false;
+                break;
+            }
+            data += entryP->lengths[sent];
+        }
+    }
+
+    if (!ret)
+    {
+        WE_LOG_WARNING(UDPBatch, "Socket %u: sending batch failed, %u of %u datagrams discarded", entryP->socketID, entryP->count - sent, entryP->count);
+        statisticsP->failedDatagrams += entryP->count - sent;
+    }
+    else
+    {
+        WE_LOG_DEBUG(UDPBatch, "Socket %u: sent %u datagrams, %u bytes after %u ms", entryP->socketID, entryP->count, entryP->used, now - entryP->firstAddTime);
+    }
+
+    entryP->used = 0;
+    entryP->count = 0;
+    return ret;
+}
+
+/**
+ * @brief Enables batching of the datagrams sent on a module socket.
+ *
+ * @param[in] socketID Activated UDP socket in the module
+ * @param[in] configP Batching parameters
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_UDPBatch_Enable(AdrasteaI_ATSocket_ID_t socketID, const AdrasteaI_UDPBatch_Config_t* configP)
+{
+    if ((socketID == AdrasteaI_ATSocket_ID_Invalid) || (configP == NULL) || (configP->mode <= AdrasteaI_UDPBatch_Mode_Invalid) || (configP->mode >= AdrasteaI_UDPBatch_Mode_NumberOfValues) ||
+        (configP->framing <= AdrasteaI_UDPBatch_Framing_Invalid) || (configP->framing >= AdrasteaI_UDPBatch_Framing_NumberOfValues) || (configP->maxSize > ADRASTEAI_UDP_BATCH_BUFFER_SIZE))
+    {
+        return false;
+    }
+
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_UDPBatch_Entry_t* entryP = AdrasteaI_UDPBatch_Get(socketID);
+    if (entryP == NULL)
+    {
+        for (uint8_t i = 0; (entryP == NULL) && (i < ADRASTEAI_UDP_BATCH_MAX_BATCHES); i++)
+        {
+            if (AdrasteaI_UDPBatch_entries[i].socketID == AdrasteaI_ATSocket_ID_Invalid)
+            {
+                entryP = &AdrasteaI_UDPBatch_entries[i];
+            }
+        }
+    }
+    else if (!AdrasteaI_UDPBatch_Send(entryP))
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    if (entryP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    memset(entryP, 0, sizeof(*entryP));
+    entryP->socketID = socketID;
+    entryP->config = *configP;
+    if (entryP->config.maxSize == 0)
+    {
+        entryP->config.maxSize = ADRASTEAI_UDP_BATCH_BUFFER_SIZE;
+    }
+    entryP->enableTime = WE_GetTick();
+    return AdrasteaI_EndCommand(true);
+}
+
+/**
+ * @brief Sends the pending datagrams of a socket and disables batching.
+ *
+ * Has to be called before the socket is deactivated or deleted.
+ *
+ * @param[in] socketID Module socket
+ *
+ * @return true if successful, false otherwise (batching is disabled in any case)
+ */
+bool AdrasteaI_UDPBatch_Disable(AdrasteaI_ATSocket_ID_t socketID)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_UDPBatch_Entry_t* entryP = AdrasteaI_UDPBatch_Get(socketID);
+    if (entryP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    bool ret = AdrasteaI_UDPBatch_Send(entryP);
+    entryP->socketID = AdrasteaI_ATSocket_ID_Invalid;
+    return AdrasteaI_EndCommand(ret);
+}
+
+/**
+ * @brief Adds a datagram to the batch of a socket.
+ *
+ * If the datagram does not fit into the batch, the batch is sent first. The batch is sent right away if it is full
+ * afterwards or its oldest datagram has reached the max. latency.
+ *
+ * @param[in] socketID Module socket with batching enabled
+ * @param[in] data Datagram
+ * @param[in] length Length of the datagram (bytes)
+ *
+ * @return true if successful, false otherwise (the datagram has been added if a failed send discarded older datagrams only)
+ */
+bool AdrasteaI_UDPBatch_Add(AdrasteaI_ATSocket_ID_t socketID, const uint8_t* data, uint16_t length)
+{
+    if ((data == NULL) || (length == 0))
+    {
+        return false;
+    }
+
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_UDPBatch_Entry_t* entryP = AdrasteaI_UDPBatch_Get(socketID);
+    if (entryP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    uint16_t framedSize = AdrasteaI_UDPBatch_FramedSize(entryP, length);
+    if (framedSize > entryP->config.maxSize)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    bool ret = true;
+    if ((entryP->used + framedSize > entryP->config.maxSize) || (entryP->count == ADRASTEAI_UDP_BATCH_MAX_DATAGRAMS))
+    {
+        ret = AdrasteaI_UDPBatch_Send(entryP);
+    }
+
+    uint32_t now = WE_GetTick();
+    AdrasteaI_UDPBatch_Statistics_t* statisticsP = &entryP->statistics;
+    AdrasteaI_UDPBatch_CountWakeup(&statisticsP->wakeupsUnbatched, &entryP->lastUnbatchedSendTime, statisticsP->datagrams == 0, now);
+    statisticsP->datagrams++;
+
+    if (entryP->count == 0)
+    {
+        entryP->firstAddTime = now;
+    }
+
+    if (framedSize != length)
+    {
+        entryP->buffer[entryP->used++] = (uint8_t)(length >> 8);
+        entryP->buffer[entryP->used++] = (uint8_t)length;
+    }
+    memcpy(&entryP->buffer[entryP->used], data, length);
+    entryP->used += length;
+    entryP->lengths[entryP->count++] = length;
+
+    /* Sent right away if the smallest possible datagram would not fit anymore */
+    if ((entryP->used + AdrasteaI_UDPBatch_FramedSize(entryP, 1) > entryP->config.maxSize) || (entryP->count == ADRASTEAI_UDP_BATCH_MAX_DATAGRAMS) || ((now - entryP->firstAddTime) >= entryP->config.maxLatencyMs))
+    {
+        ret = AdrasteaI_UDPBatch_Send(entryP) && ret;
+    }
+
+    return AdrasteaI_EndCommand(ret);
+}
+
+/**
+ * @brief Sends the pending datagrams of a socket right away.
+ *
+ * @param[in] socketID Module socket with batching enabled
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_UDPBatch_Flush(AdrasteaI_ATSocket_ID_t socketID)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    AdrasteaI_UDPBatch_Entry_t* entryP = AdrasteaI_UDPBatch_Get(socketID);
+    if (entryP == NULL)
+    {
+        return AdrasteaI_EndCommand(false);
+    }
+
+    return AdrasteaI_EndCommand(AdrasteaI_UDPBatch_Send(entryP));
+}
+
+/**
+ * @brief Sends all batches whose oldest datagram has reached the max. latency.
+ *
+ * @param[out] nextDeadlineMsP Time until the next batch has to be sent (milliseconds, UINT32_MAX if all batches are empty). Can be NULL.
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_UDPBatch_Process(uint32_t* nextDeadlineMsP)
+{
+    if (!AdrasteaI_BeginCommand())
+    {
+        return false;
+    }
+
+    bool ret = true;
+    uint32_t nextDeadline = UINT32_MAX;
+    uint32_t now = WE_GetTick();
+
+    for (uint8_t i = 0; i < ADRASTEAI_UDP_BATCH_MAX_BATCHES; i++)
+    {
+        AdrasteaI_UDPBatch_Entry_t* entryP = &AdrasteaI_UDPBatch_entries[i];
+        if ((entryP->socketID == AdrasteaI_ATSocket_ID_Invalid) || (entryP->count == 0))
+        {
+            continue;
+        }
+
+        uint32_t age = now - entryP->firstAddTime;
+        if (age >= entryP->config.maxLatencyMs)
+        {
+            ret = AdrasteaI_UDPBatch_Send(entryP) && ret;
+        }
+        else if (entryP->config.maxLatencyMs - age < nextDeadline)
+        {
+            nextDeadline = entryP->config.maxLatencyMs - age;
+        }
+    }
+
+    if (nextDeadlineMsP != NULL)
+    {
+        *nextDeadlineMsP = nextDeadline;
+    }
+
+    return AdrasteaI_EndCommand(ret);
+}
+
+/**
+ * @brief Scales a count observed during elapsedMs to one hour.
+ */
+static uint32_t AdrasteaI_UDPBatch_PerHour(uint32_t count, uint32_t elapsedMs)
+{
+    return (elapsedMs == 0) ? 0 : (uint32_t)(((uint64_t)count * 3600000) / elapsedMs);
+}
+
+/**
+ * @brief Returns the statistics of a socket since batching has been enabled.
+ *
+ * Without batching, each datagram is one command. Radio wake-ups are estimated using
+ * ADRASTEAI_UDP_BATCH_RADIO_INACTIVITY_MS.
+ *
+ * @param[in] socketID Module socket with batching enabled
+ * @param[out] statisticsP Statistics
+ *
+ * @return true if successful, false otherwise
+ */
+bool AdrasteaI_UDPBatch_GetStatistics(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_UDPBatch_Statistics_t* statisticsP)
+{
+    AdrasteaI_UDPBatch_Entry_t* entryP = AdrasteaI_UDPBatch_Get(socketID);
+    if ((entryP == NULL) || (statisticsP == NULL))
+    {
+        return false;
+    }
+
+    *statisticsP = entryP->statistics;
+    statisticsP->elapsedMs = WE_GetTick() - entryP->enableTime;
+    statisticsP->commandsPerHour = AdrasteaI_UDPBatch_PerHour(statisticsP->commands, statisticsP->elapsedMs);
+    statisticsP->commandsPerHourUnbatched = AdrasteaI_UDPBatch_PerHour(statisticsP->datagrams, statisticsP->elapsedMs);
+    statisticsP->wakeupsPerHour = AdrasteaI_UDPBatch_PerHour(statisticsP->wakeups, statisticsP->elapsedMs);
+    statisticsP->wakeupsPerHourUnbatched = AdrasteaI_UDPBatch_PerHour(statisticsP->wakeupsUnbatched, statisticsP->elapsedMs);
+    return true;
+}
+
+#endif /* ADRASTEAI_UDP_BATCH */
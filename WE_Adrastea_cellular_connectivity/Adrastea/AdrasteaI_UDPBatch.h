@@ -0,0 +1,159 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Batching of small UDP datagrams (enabled by defining ADRASTEAI_UDP_BATCH).
+ *
+ * Datagrams added by AdrasteaI_UDPBatch_Add() are collected per module socket and sent when the oldest of them
+ * has waited for the configured max. latency, or when the batch is full. In mode AdrasteaI_UDPBatch_Mode_Coalesce,
+ * the batch is sent as a single datagram with a single AT%SOCKETDATA command, optionally with a length prefix per
+ * datagram so the receiver can split it again. In mode AdrasteaI_UDPBatch_Mode_Pipeline, the datagrams are sent
+ * unchanged, back to back without interleaving commands of other tasks, so the module transmits them within one
+ * radio connection.
+ *
+ * Deadlines are checked by AdrasteaI_UDPBatch_Add() and AdrasteaI_UDPBatch_Process(), which has to be called at
+ * least as often as the shortest latency requires. AdrasteaI_UDPBatch_GetStatistics() reports the number of
+ * commands and (estimated) radio wake-ups per hour compared to sending each datagram on its own.
+ */
+
+#ifndef ADRASTEAI_UDPBATCH_H_INCLUDED
+#define ADRASTEAI_UDPBATCH_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ATSocket.h"
+
+#ifndef ADRASTEAI_UDP_BATCH_MAX_BATCHES
+/**
+ * @brief Max. number of sockets with batching enabled at the same time.
+ */
+#define ADRASTEAI_UDP_BATCH_MAX_BATCHES 2
+#endif
+
+#ifndef ADRASTEAI_UDP_BATCH_BUFFER_SIZE
+/**
+ * @brief Size of the buffer of each batch (bytes). Must not exceed ADRASTEAI_ATSOCKET_HEX_SEGMENT_SIZE.
+ */
+#define ADRASTEAI_UDP_BATCH_BUFFER_SIZE 512
+#endif
+
+#ifndef ADRASTEAI_UDP_BATCH_MAX_DATAGRAMS
+/**
+ * @brief Max. number of datagrams per batch.
+ */
+#define ADRASTEAI_UDP_BATCH_MAX_DATAGRAMS 32
+#endif
+
+#ifndef ADRASTEAI_UDP_BATCH_RADIO_INACTIVITY_MS
+/**
+ * @brief Time the radio is assumed to stay connected after a transmission (milliseconds).
+ *
+ * Used for estimating radio wake-ups only: a transmission starting later than this after the previous one counts
+ * as a wake-up. Should match the RRC inactivity timer of the network.
+ */
+#define ADRASTEAI_UDP_BATCH_RADIO_INACTIVITY_MS 10000
+#endif
+
+/**
+ * @brief Size of the length prefix added per datagram with AdrasteaI_UDPBatch_Framing_Length (bytes).
+ */
+#define ADRASTEAI_UDP_BATCH_LENGTH_PREFIX_SIZE 2
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief How a batch is sent.
+ */
+    typedef enum AdrasteaI_UDPBatch_Mode_t
+    {
+        AdrasteaI_UDPBatch_Mode_Invalid = -1,
+        AdrasteaI_UDPBatch_Mode_Coalesce, /**< One datagram containing all datagrams of the batch */
+        AdrasteaI_UDPBatch_Mode_Pipeline, /**< Datagrams sent unchanged, one command each, back to back */
+        AdrasteaI_UDPBatch_Mode_NumberOfValues
+    } AdrasteaI_UDPBatch_Mode_t;
+
+    /**
+ * @brief Framing of the datagrams coalesced into one datagram (AdrasteaI_UDPBatch_Mode_Coalesce only).
+ */
+    typedef enum AdrasteaI_UDPBatch_Framing_t
+    {
+        AdrasteaI_UDPBatch_Framing_Invalid = -1,
+        AdrasteaI_UDPBatch_Framing_None,   /**< Datagrams are concatenated (for self-delimiting or fixed size records) */
+        AdrasteaI_UDPBatch_Framing_Length, /**< Each datagram is preceded by its length (16 bit, big endian) */
+        AdrasteaI_UDPBatch_Framing_NumberOfValues
+    } AdrasteaI_UDPBatch_Framing_t;
+
+    /**
+ * @brief Batching parameters of a socket.
+ */
+    typedef struct AdrasteaI_UDPBatch_Config_t
+    {
+        AdrasteaI_UDPBatch_Mode_t mode;
+        AdrasteaI_UDPBatch_Framing_t framing;
+        uint32_t maxLatencyMs; /**< Max. time a datagram is held back (milliseconds) */
+        uint16_t maxSize;      /**< Max. size of a batch including framing (bytes), 0 for ADRASTEAI_UDP_BATCH_BUFFER_SIZE */
+    } AdrasteaI_UDPBatch_Config_t;
+
+    /**
+ * @brief Statistics of a socket since batching has been enabled.
+ * @see AdrasteaI_UDPBatch_GetStatistics()
+ */
+    typedef struct AdrasteaI_UDPBatch_Statistics_t
+    {
+        uint32_t datagrams;                /**< Datagrams added */
+        uint32_t failedDatagrams;          /**< Datagrams discarded because sending failed */
+        uint32_t flushes;                  /**< Batches sent */
+        uint32_t commands;                 /**< AT%SOCKETDATA commands sent */
+        uint32_t wakeups;                  /**< Estimated radio wake-ups */
+        uint32_t wakeupsUnbatched;         /**< Estimated radio wake-ups if each datagram had been sent when added */
+        uint32_t elapsedMs;                /**< Time since batching has been enabled (milliseconds) */
+        uint32_t commandsPerHour;          /**< Commands per hour */
+        uint32_t commandsPerHourUnbatched; /**< Commands per hour if each datagram had been sent on its own */
+        uint32_t wakeupsPerHour;           /**< Estimated radio wake-ups per hour */
+        uint32_t wakeupsPerHourUnbatched;  /**< Estimated radio wake-ups per hour if each datagram had been sent when added */
+    } AdrasteaI_UDPBatch_Statistics_t;
+
+    extern bool AdrasteaI_UDPBatch_Enable(AdrasteaI_ATSocket_ID_t socketID, const AdrasteaI_UDPBatch_Config_t* configP);
+
+    extern bool AdrasteaI_UDPBatch_Disable(AdrasteaI_ATSocket_ID_t socketID);
+
+    extern bool AdrasteaI_UDPBatch_Add(AdrasteaI_ATSocket_ID_t socketID, const uint8_t* data, uint16_t length);
+
+    extern bool AdrasteaI_UDPBatch_Flush(AdrasteaI_ATSocket_ID_t socketID);
+
+    extern bool AdrasteaI_UDPBatch_Process(uint32_t* nextDeadlineMsP);
+
+    extern bool AdrasteaI_UDPBatch_GetStatistics(AdrasteaI_ATSocket_ID_t socketID, AdrasteaI_UDPBatch_Statistics_t* statisticsP);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADRASTEAI_UDPBATCH_H_INCLUDED */
@@ -27,6 +27,7 @@
  * @file
  * @brief ATCommand driver general AT command definitions.
  */
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -35,7 +36,194 @@
 
 char AT_commandBuffer[AT_MAX_COMMAND_BUFFER_SIZE];
 
-static const char* ATCommand_BooleanValueStrings[ATCommand_BooleanValue_NumberOfValues] = {"false", "true"};
+#define ATCommand_BooleanValue_Entries(ENTRY) \
+    ENTRY("true", ATCommand_BooleanValue_True)   \
+    ENTRY("false", ATCommand_BooleanValue_False)
+ATCOMMAND_STRINGTABLE(ATCommand_BooleanValueStrings, ATCommand_BooleanValue_NumberOfValues, ATCommand_BooleanValue_Entries);
+
+/**
+ * @brief Looks up a string of the given length in a string table (case insensitive).
+ *
+ * Binary search in the index of the table, which is ordered by length and then alphabetically. Entries of a different
+ * length are told apart by their length tag, strncasecmp() is only called for entries of the same length.
+ *
+ * @param[in] tableP String table to search in
+ * @param[in] str String to look for (need not be null terminated)
+ * @param[in] length Length of str
+ * @param[out] index Enumeration value of the string
+ *
+ * @return true if the string is found, false otherwise
+ */
+static bool ATCommand_FindStringN(const ATCommand_StringTable_t* tableP, const char* str, size_t length, uint8_t* index)
+{
+    if (length > UINT8_MAX)
+    {
+        return false;
+    }
+
+    uint8_t low = 0;
+    uint8_t high = tableP->numStrings;
+
+    while (low < high)
+    {
+        uint8_t middle = (uint8_t)((low + high) / 2);
+        const ATCommand_StringIndex_t* entryP = &tableP->index[middle];
+
+        int order = (entryP->length != length) ? ((entryP->length < length) ? -1 : 1) : strncasecmp(tableP->strings[entryP->value], str, length);
+        if (order == 0)
+        {
+            *index = entryP->value;
+            return true;
+        }
+
+        if (order < 0)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Records the position of an argument in an argument index.
+ *
+ * @param[in,out] pArguments Argument index
+ * @param[in] offset Offset of the argument in the argument string
+ * @param[in] length Length of the argument
+ */
+static void ATCommand_AddArgument(ATCommand_Arguments_t* pArguments, size_t offset, size_t length)
+{
+    ATCommand_Argument_t* argumentP = &pArguments->arguments[pArguments->count++];
+
+    argumentP->offset = (uint16_t)offset;
+    argumentP->length = (uint16_t)length;
+    argumentP->quoted = (length >= 2) && (pArguments->pString[offset] == '"') && (pArguments->pString[offset + length - 1] == '"');
+}
+
+/**
+ * @brief Gets the position of an argument (or of all arguments starting at an argument) in a tokenized argument string.
+ *
+ * @param[in] pArguments Argument index
+ * @param[in] index Index of the argument
+ * @param[in] removeQuotationMarks Exclude the enclosing quotation marks (fails if there are none)
+ * @param[in] toEnd Span up to the end of the argument string instead of up to the end of the argument
+ * @param[out] pStart First character of the argument
+ * @param[out] pLength Length of the argument
+ *
+ * @return true if successful, false otherwise
+ */
+static bool ATCommand_GetArgumentSpan(const ATCommand_Arguments_t* pArguments, uint8_t index, bool removeQuotationMarks, bool toEnd, const char** pStart, size_t* pLength)
+{
+    if ((NULL == pArguments) || (index >= pArguments->count))
+    {
+        return false;
+    }
+
+    const ATCommand_Argument_t* argumentP = &pArguments->arguments[index];
+
+    size_t offset = argumentP->offset;
+    size_t length = toEnd ? (size_t)(pArguments->length - offset) : argumentP->length;
+
+    if (removeQuotationMarks)
+    {
+        if ((length < 2) || (pArguments->pString[offset] != '"') || (pArguments->pString[offset + length - 1] != '"'))
+        {
+            return false;
+        }
+        offset++;
+        length -= 2;
+    }
+
+    *pStart = &pArguments->pString[offset];
+    *pLength = length;
+
+    return true;
+}
+
+/**
+ * @brief Copies an argument (or all arguments starting at an argument) from a tokenized argument string.
+ *
+ * @param[in] pArguments Argument index
+ * @param[in] index Index of the argument to copy
+ * @param[in] removeQuotationMarks Remove the enclosing quotation marks (fails if there are none)
+ * @param[in] toEnd Copy up to the end of the argument string instead of up to the end of the argument
+ * @param[out] pOutArgument Argument as string
+ * @param[in] maxLength Max. length of string to get (including termination character).
+ *
+ * @return true if successful, false otherwise
+ */
+static bool ATCommand_CopyArgument(const ATCommand_Arguments_t* pArguments, uint8_t index, bool removeQuotationMarks, bool toEnd, char* pOutArgument, uint16_t maxLength)
+{
+    const char* start;
+    size_t length;
+
+    if ((NULL == pOutArgument) || !ATCommand_GetArgumentSpan(pArguments, index, removeQuotationMarks, toEnd, &start, &length) || (length >= maxLength))
+    {
+        return false;
+    }
+
+    memcpy(pOutArgument, start, length);
+    pOutArgument[length] = ATCOMMAND_STRING_TERMINATE;
+
+    return true;
+}
+
+/**
+ * @brief Reads the integer member described by a field from a struct.
+ *
+ * @param[in] pStruct Struct to read from
+ * @param[in] fieldP Field describing the member
+ *
+ * @return Value of the member (sign extended for signed fields)
+ */
+static uint32_t ATCommand_ReadFieldValue(const void* pStruct, const ATCommand_Field_t* fieldP)
+{
+    const uint8_t* memberP = (const uint8_t*)pStruct + fieldP->offset;
+    bool signedValue = (fieldP->intFlags & ATCOMMAND_INTFLAGS_SIGNED) != 0;
+
+    switch (fieldP->size)
+    {
+        case 1:
+            return signedValue ? (uint32_t)(*(const int8_t*)memberP) : *(const uint8_t*)memberP;
+        case 2:
+            return signedValue ? (uint32_t)(*(const int16_t*)memberP) : *(const uint16_t*)memberP;
+        default:
+            return *(const uint32_t*)memberP;
+    }
+}
+
+/**
+ * @brief Writes an integer to the member described by a field.
+ *
+ * @param[out] pStruct Struct to write to
+ * @param[in] fieldP Field describing the member
+ * @param[in] value Value to write (truncated to the size of the member)
+ */
+static void ATCommand_WriteFieldValue(void* pStruct, const ATCommand_Field_t* fieldP, uint64_t value)
+{
+    uint8_t* memberP = (uint8_t*)pStruct + fieldP->offset;
+
+    switch (fieldP->size)
+    {
+        case 1:
+            *(uint8_t*)memberP = (uint8_t)value;
+            break;
+        case 2:
+            *(uint16_t*)memberP = (uint16_t)value;
+            break;
+        case 4:
+            *(uint32_t*)memberP = (uint32_t)value;
+            break;
+        default:
+            *(uint64_t*)memberP = value;
+            break;
+    }
+}
 
 /**
  * @brief Converts an integer to string.
@@ -187,6 +375,24 @@ bool ATCommand_AppendArgumentBytes(char* pOutString, const char* pInArgument, ui
     return true;
 }
 
+/**
+ * @brief Encodes binary data as hex string (two upper case hex digits per byte, no termination character).
+ *
+ * @param[in] pInData Data to encode
+ * @param[in] numBytes Number of bytes to encode
+ * @param[out] pOutHex Encoded data (2 * numBytes characters)
+ */
+void ATCommand_EncodeHex(const uint8_t* pInData, uint16_t numBytes, char* pOutHex)
+{
+    static const char hexDigits[] = "0123456789ABCDEF";
+
+    for (uint16_t i = 0; i < numBytes; i++)
+    {
+        pOutHex[2 * i] = hexDigits[pInData[i] >> 4];
+        pOutHex[2 * i + 1] = hexDigits[pInData[i] & 0x0F];
+    }
+}
+
 /**
  * @brief Appends a string argument to the end of an AT command.
  *
@@ -264,28 +470,27 @@ bool ATCommand_AppendArgumentStringQuotationMarks(char* pOutString, const char*
  * @brief Appends bitmask strings to the supplied string.
  *
  * @param[out] pOutString AT command after appending argument
- * @param[in] stringList List of strings containing the string representations of the bits in the input bitmask
- * @param[in] numStrings Number of elements in stringList (max. number of bits in input bitmask)
+ * @param[in] tableP String table containing the string representations of the bits in the input bitmask
  * @param[in] bitmask Input bitmask
  * @param[in] delimiter Delimiter to append after argument
  * @param[in] maxStringLength Max. length of output string
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_AppendArgumentBitmask(char* pOutString, const char* stringList[], uint8_t numStrings, uint32_t bitmask, char delimiter, uint16_t maxStringLength)
+bool ATCommand_AppendArgumentBitmask(char* pOutString, const ATCommand_StringTable_t* tableP, uint32_t bitmask, char delimiter, uint16_t maxStringLength)
 {
     size_t outStrLength = strlen(pOutString) + 1;
     bool empty = true;
-    for (uint8_t i = 0; i < numStrings; i++)
+    for (uint8_t i = 0; i < tableP->numStrings; i++)
     {
         if (0 != (bitmask & (1 << i)))
         {
-            outStrLength += strlen(stringList[i]) + 1;
+            outStrLength += strlen(tableP->strings[i]) + 1;
             if (outStrLength > maxStringLength)
             {
                 return false;
             }
-            if (!ATCommand_AppendArgumentString(pOutString, stringList[i], ATCOMMAND_BITMASK_DELIM))
+            if (!ATCommand_AppendArgumentString(pOutString, tableP->strings[i], ATCOMMAND_BITMASK_DELIM))
             {
                 return false;
             }
@@ -306,7 +511,7 @@ bool ATCommand_AppendArgumentBitmask(char* pOutString, const char* stringList[],
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_AppendArgumentBoolean(char* pOutString, bool inBool, char delimiter) { return ATCommand_AppendArgumentString(pOutString, ATCommand_BooleanValueStrings[(inBool == true) ? 1 : 0], delimiter); }
+bool ATCommand_AppendArgumentBoolean(char* pOutString, bool inBool, char delimiter) { return ATCommand_AppendArgumentString(pOutString, ATCommand_BooleanValueStrings.strings[(inBool == true) ? 1 : 0], delimiter); }
 
 /**
  * @brief Gets the next string argument from the supplied AT command.
@@ -478,14 +683,13 @@ bool ATCommand_AppendArgumentIntQuotationMarks(char* pOutString, uint32_t pInVal
  *
  * @param[in,out] pInArguments AT command to get argument from
  * @param[out] pOutArgument Enumeration value corresponding to the string read from the input AT command
- * @param[in] stringList List of strings containing the string representations of the enumeration's values
- * @param[in] numStrings Number of elements in stringList (number of elements in the enumeration)
+ * @param[in] tableP String table containing the string representations of the enumeration's values
  * @param[in] maxStringLength Max. length of individual enumeration value strings
  * @param[in] delimiter Delimiter which occurs after argument to get
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_GetNextArgumentEnum(char** pInArguments, uint8_t* pOutArgument, const char* stringList[], uint8_t numStrings, uint16_t maxStringLength, char delimiter)
+bool ATCommand_GetNextArgumentEnum(char** pInArguments, uint8_t* pOutArgument, const ATCommand_StringTable_t* tableP, uint16_t maxStringLength, char delimiter)
 {
     char tempString[maxStringLength];
 
@@ -495,7 +699,7 @@ bool ATCommand_GetNextArgumentEnum(char** pInArguments, uint8_t* pOutArgument, c
     }
 
     bool ok;
-    *pOutArgument = ATCommand_FindString(stringList, numStrings, tempString, 0, &ok);
+    *pOutArgument = ATCommand_FindString(tableP, tempString, 0, &ok);
     return ok;
 }
 
@@ -530,30 +734,57 @@ bool ATCommand_GetNextArgumentByteArray(char** pInArguments, uint16_t length, ui
  * @brief Gets the next bitmask argument from the supplied AT command.
  *
  * @param[in,out] pInArguments AT command to get argument from
- * @param[in] stringList List of strings containing the string representations of the bits in the output bitmask
- * @param[in] numStrings Number of elements in stringList (max. number of bits in output bitmask)
+ * @param[in] tableP String table containing the string representations of the bits in the output bitmask
  * @param[in] maxStringLength Max. length of individual bitmask strings
  * @param[out] bitmask Output bitmask
  * @param[in] delimiter Delimiter which occurs after argument to get
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_GetNextArgumentBitmask(char** pInArguments, const char* stringList[], uint8_t numStrings, uint16_t maxStringLength, uint32_t* bitmask, char delimiter)
+bool ATCommand_GetNextArgumentBitmask(char** pInArguments, const ATCommand_StringTable_t* tableP, uint16_t maxStringLength, uint32_t* bitmask, char delimiter)
 {
-    bool ret = false;
-    char tempString[maxStringLength];
+    if ((NULL == pInArguments) || (NULL == bitmask))
+    {
+        return false;
+    }
+
+    char* elementP = *pInArguments;
 
     *bitmask = 0;
 
-    while (**pInArguments != '\0' && ((ret = ATCommand_GetNextArgumentString(pInArguments, tempString, ATCOMMAND_BITMASK_DELIM, sizeof(tempString))) || (ret = ATCommand_GetNextArgumentString(pInArguments, tempString, delimiter, sizeof(tempString)))))
+    while (*elementP != ATCOMMAND_STRING_TERMINATE)
     {
-        bool ok;
-        uint8_t flag = ATCommand_FindString(stringList, numStrings, tempString, 0, &ok);
-        if (ok)
+        /* Elements end at the bitmask delimiter, the argument delimiter or the end of the string */
+        size_t elementLength = 0;
+        while ((elementP[elementLength] != ATCOMMAND_BITMASK_DELIM) && (elementP[elementLength] != delimiter) && (elementP[elementLength] != ATCOMMAND_STRING_TERMINATE))
+        {
+            elementLength++;
+        }
+
+        uint8_t flag;
+        if ((elementLength < maxStringLength) && ATCommand_FindStringN(tableP, elementP, elementLength, &flag))
         {
             *bitmask |= (1 << flag);
         }
+
+        char endChar = elementP[elementLength];
+        if (endChar == ATCOMMAND_STRING_TERMINATE)
+        {
+            elementP += elementLength;
+            break;
+        }
+
+        elementP += elementLength + 1;
+
+        if (endChar != ATCOMMAND_BITMASK_DELIM)
+        {
+            /* End of argument reached */
+            break;
+        }
     }
+
+    *pInArguments = elementP;
+
     return true;
 }
 
@@ -569,7 +800,7 @@ bool ATCommand_GetNextArgumentBitmask(char** pInArguments, const char* stringLis
 bool ATCommand_GetNextArgumentBoolean(char** pInArguments, bool* outBool, char delimiter)
 {
     uint8_t enumValue;
-    bool ok = ATCommand_GetNextArgumentEnum(pInArguments, &enumValue, ATCommand_BooleanValueStrings, ATCommand_BooleanValue_NumberOfValues, 6, delimiter);
+    bool ok = ATCommand_GetNextArgumentEnum(pInArguments, &enumValue, &ATCommand_BooleanValueStrings, 6, delimiter);
     if (ok)
     {
         *outBool = (enumValue == 1) ? true : false;
@@ -699,36 +930,27 @@ bool ATCommand_GetCmdName(char** pInAtCmd, char* pCmdName, size_t CmdNameLen, ch
 }
 
 /**
- * @brief Looks up a string in a list of strings (case insensitive) and returns the
- * index of the string or the supplied default value, if the string is not found.
+ * @brief Looks up a string in a string table (case insensitive) and returns the
+ * enumeration value of the string or the supplied default value, if the string is not found.
  *
- * @param[in] stringList List of strings to search in
- * @param[in] numStrings Number of strings in stringList
+ * @param[in] tableP String table to search in
  * @param[in] str String to look for
  * @param[in] defaultValue Value to return if the string is not found
  * @param[out] ok Is set to true if the string is found. Optional.
  *
- * @return Index of the first occurrence of str in stringList or defaultValue, if string is not found
+ * @return Enumeration value of str or defaultValue, if string is not found
  */
-uint8_t ATCommand_FindString(const char* stringList[], uint8_t numStrings, const char* str, uint8_t defaultValue, bool* ok)
+uint8_t ATCommand_FindString(const ATCommand_StringTable_t* tableP, const char* str, uint8_t defaultValue, bool* ok)
 {
-    for (uint8_t i = 0; i < numStrings; i++)
-    {
-        if (0 == strcasecmp(stringList[i], str))
-        {
-            if (ok)
-            {
-                *ok = true;
-            }
-            return i;
-        }
-    }
+    uint8_t index = defaultValue;
+
+    bool found = ATCommand_FindStringN(tableP, str, strlen(str), &index);
 
     if (ok)
     {
-        *ok = false;
+        *ok = found;
     }
-    return defaultValue;
+    return found ? index : defaultValue;
 }
 
 /**
@@ -815,14 +1037,13 @@ bool ATCommand_GetNextArgumentBitsWithoutQuotationMarks(char** pInArguments, voi
  *
  * @param[in,out] pInArguments AT command to get argument from
  * @param[out] pOutArgument Enumeration value corresponding to the string read from the input AT command
- * @param[in] stringList List of strings containing the string representations of the enumeration's values
- * @param[in] numStrings Number of elements in stringList (number of elements in the enumeration)
+ * @param[in] tableP String table containing the string representations of the enumeration's values
  * @param[in] maxStringLength Max. length of individual enumeration value strings
  * @param[in] delimiter Delimiter which occurs after argument to get
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_GetNextArgumentEnumWithoutQuotationMarks(char** pInArguments, uint8_t* pOutArgument, const char* stringList[], uint8_t numStrings, uint16_t maxStringLength, char delimiter)
+bool ATCommand_GetNextArgumentEnumWithoutQuotationMarks(char** pInArguments, uint8_t* pOutArgument, const ATCommand_StringTable_t* tableP, uint16_t maxStringLength, char delimiter)
 {
     char tempString[maxStringLength];
 
@@ -832,7 +1053,7 @@ bool ATCommand_GetNextArgumentEnumWithoutQuotationMarks(char** pInArguments, uin
     }
 
     bool ok;
-    *pOutArgument = ATCommand_FindString(stringList, numStrings, tempString, 0, &ok);
+    *pOutArgument = ATCommand_FindString(tableP, tempString, 0, &ok);
     return ok;
 }
 
@@ -1020,6 +1241,169 @@ bool ATCommand_GetNextArgumentFloatWithoutQuotationMarks(char** pInArguments, vo
     return true;
 }
 
+/**
+ * @brief Parses a decimal string to a fixed point integer without using strtod.
+ *
+ * The value is scaled by 10^decimals, i.e. "48.123456" with 6 decimals results in
+ * 48123456. Surplus fractional digits are rounded half away from zero, so the result
+ * equals the double conversion rounded to the nearest 10^-decimals.
+ *
+ * @param[out] number Parsed value (int32_t)
+ * @param[in] inString String to be parsed (optional sign, digits, optional decimal point)
+ * @param[in] decimals Number of decimal places kept (max. ATCOMMAND_FIXEDPOINT_MAX_DECIMALS)
+ *
+ * @return true if successful, false otherwise (also if the scaled value exceeds int32_t)
+ */
+bool ATCommand_StringToFixedPoint(void* number, const char* inString, uint8_t decimals)
+{
+    if ((NULL == inString) || (NULL == number) || (decimals > ATCOMMAND_FIXEDPOINT_MAX_DECIMALS))
+    {
+        return false;
+    }
+
+    const char* pChar = inString;
+    bool negative = false;
+
+    if ((*pChar == '-') || (*pChar == '+'))
+    {
+        negative = (*pChar == '-');
+        pChar++;
+    }
+
+    uint32_t value = 0;
+    uint8_t fractionDigits = 0;
+    bool digitFound = false;
+    bool pointFound = false;
+    bool roundUp = false;
+    bool truncated = false;
+
+    for (; *pChar != ATCOMMAND_STRING_TERMINATE; pChar++)
+    {
+        if ((*pChar == '.') && !pointFound)
+        {
+            pointFound = true;
+            continue;
+        }
+
+        if ((*pChar < '0') || (*pChar > '9'))
+        {
+            return false;
+        }
+
+        digitFound = true;
+        uint32_t digit = (uint32_t)(*pChar - '0');
+
+        if (pointFound && (fractionDigits == decimals))
+        {
+            /* First surplus digit decides rounding, the remaining ones are dropped */
+            if (!truncated)
+            {
+                roundUp = (digit >= 5);
+                truncated = true;
+            }
+            continue;
+        }
+
+        if (value > (INT32_MAX - digit) / 10)
+        {
+            return false;
+        }
+        value = value * 10 + digit;
+
+        if (pointFound)
+        {
+            fractionDigits++;
+        }
+    }
+
+    if (!digitFound)
+    {
+        return false;
+    }
+
+    for (; fractionDigits < decimals; fractionDigits++)
+    {
+        if (value > INT32_MAX / 10)
+        {
+            return false;
+        }
+        value *= 10;
+    }
+
+    if (roundUp)
+    {
+        if (value == INT32_MAX)
+        {
+            return false;
+        }
+        value++;
+    }
+
+    *((int32_t*)number) = negative ? -(int32_t)value : (int32_t)value;
+
+    return true;
+}
+
+/**
+ * @brief Gets the next fixed point argument from the supplied AT command.
+ *
+ * @param[in,out] pInArguments AT command to get argument from
+ * @param[out] pOutArgument Argument parsed as fixed point value (int32_t scaled by 10^decimals)
+ * @param[in] decimals Number of decimal places kept
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetNextArgumentFixedPoint(char** pInArguments, void* pOutArgument, uint8_t decimals, char delimiter)
+{
+    if ((NULL == pInArguments) || (NULL == pOutArgument))
+    {
+        return false;
+    }
+
+    char tempString[40];
+
+    char* tempstartlocation = *pInArguments;
+
+    if (!ATCommand_GetNextArgumentString(pInArguments, tempString, delimiter, sizeof(tempString)) || !ATCommand_StringToFixedPoint(pOutArgument, tempString, decimals))
+    {
+        *pInArguments = tempstartlocation;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Gets the next fixed point argument from the supplied AT command and removes the quotation marks.
+ *
+ * @param[in,out] pInArguments AT command to get argument from
+ * @param[out] pOutArgument Argument parsed as fixed point value (int32_t scaled by 10^decimals)
+ * @param[in] decimals Number of decimal places kept
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetNextArgumentFixedPointWithoutQuotationMarks(char** pInArguments, void* pOutArgument, uint8_t decimals, char delimiter)
+{
+    if ((NULL == pInArguments) || (NULL == pOutArgument))
+    {
+        return false;
+    }
+
+    char tempString[40];
+
+    char* tempstartlocation = *pInArguments;
+
+    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(pInArguments, tempString, delimiter, sizeof(tempString)) || !ATCommand_StringToFixedPoint(pOutArgument, tempString, decimals))
+    {
+        *pInArguments = tempstartlocation;
+        return false;
+    }
+
+    return true;
+}
+
 /**
  * @brief Count the number of arguments in argument string.
  *
@@ -1059,6 +1443,410 @@ int ATCommand_CountArgs(char* stringP)
     return argscount;
 }
 
+/**
+ * @brief Splits an argument string into its arguments in a single pass.
+ *
+ * Arguments are delimited by ATCOMMAND_ARGUMENT_DELIM, delimiters enclosed in quotation marks
+ * are ignored and leading spaces are skipped. Only the position of each argument is recorded, no data
+ * is copied. If the string holds more than ATCOMMAND_MAX_ARGUMENTS arguments, the last recorded argument
+ * spans the rest of the string. An empty string has no arguments.
+ *
+ * @param[in] pInArguments Argument string to tokenize
+ * @param[out] pOutArguments Argument index
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_TokenizeArguments(const char* pInArguments, ATCommand_Arguments_t* pOutArguments)
+{
+    if ((NULL == pInArguments) || (NULL == pOutArguments))
+    {
+        return false;
+    }
+
+    pOutArguments->pString = pInArguments;
+    pOutArguments->count = 0;
+
+    size_t argumentStart = 0;
+    size_t i = 0;
+    bool inQuotationMarks = false;
+
+    for (; pInArguments[i] != ATCOMMAND_STRING_TERMINATE; i++)
+    {
+        if (i >= UINT16_MAX)
+        {
+            return false;
+        }
+
+        if ((i == argumentStart) && (pInArguments[i] == ' '))
+        {
+            /* Skip leading spaces (e.g. after the event name or between arguments) */
+            argumentStart++;
+        }
+        else if (pInArguments[i] == '"')
+        {
+            inQuotationMarks = !inQuotationMarks;
+        }
+        else if (!inQuotationMarks && (pInArguments[i] == ATCOMMAND_ARGUMENT_DELIM) && (pOutArguments->count < (ATCOMMAND_MAX_ARGUMENTS - 1)))
+        {
+            ATCommand_AddArgument(pOutArguments, argumentStart, i - argumentStart);
+            argumentStart = i + 1;
+        }
+    }
+
+    pOutArguments->length = (uint16_t)i;
+
+    if (i > 0)
+    {
+        ATCommand_AddArgument(pOutArguments, argumentStart, i - argumentStart);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Gets a string argument from a tokenized argument string.
+ *
+ * @param[in] pArguments Argument index created by ATCommand_TokenizeArguments()
+ * @param[in] index Index of the argument to get
+ * @param[out] pOutArgument Argument as string
+ * @param[in] maxLength Max. length of string to get (including termination character).
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetArgumentString(const ATCommand_Arguments_t* pArguments, uint8_t index, char* pOutArgument, uint16_t maxLength) { return ATCommand_CopyArgument(pArguments, index, false, false, pOutArgument, maxLength); }
+
+/**
+ * @brief Gets a string argument from a tokenized argument string and removes the quotation marks.
+ *
+ * @param[in] pArguments Argument index created by ATCommand_TokenizeArguments()
+ * @param[in] index Index of the argument to get
+ * @param[out] pOutArgument Argument as string
+ * @param[in] maxLength Max. length of string to get (including termination character).
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetArgumentStringWithoutQuotationMarks(const ATCommand_Arguments_t* pArguments, uint8_t index, char* pOutArgument, uint16_t maxLength) { return ATCommand_CopyArgument(pArguments, index, true, false, pOutArgument, maxLength); }
+
+/**
+ * @brief Gets a hex string argument (with or without quotation marks) from a tokenized argument string and decodes it.
+ *
+ * @param[in] pArguments Argument index created by ATCommand_TokenizeArguments()
+ * @param[in] index Index of the argument to get
+ * @param[out] pOutData Decoded data (not null terminated)
+ * @param[in] maxLength Size of pOutData in bytes
+ * @param[out] pOutLength Number of decoded bytes
+ *
+ * @return true if successful, false otherwise (odd number of digits, invalid digit or pOutData too small)
+ */
+bool ATCommand_GetArgumentHex(const ATCommand_Arguments_t* pArguments, uint8_t index, uint8_t* pOutData, uint16_t maxLength, uint16_t* pOutLength)
+{
+    const char* start;
+    size_t length;
+
+    if (!ATCommand_GetArgumentSpan(pArguments, index, false, false, &start, &length))
+    {
+        return false;
+    }
+
+    if ((length >= 2) && (start[0] == '"') && (start[length - 1] == '"'))
+    {
+        start++;
+        length -= 2;
+    }
+
+    if (((length % 2) != 0) || (length / 2 > maxLength))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < length; i += 2)
+    {
+        uint8_t byte = 0;
+        for (size_t j = i; j < i + 2; j++)
+        {
+            char c = start[j];
+            uint8_t nibble;
+            if ((c >= '0') && (c <= '9'))
+            {
+                nibble = (uint8_t)(c - '0');
+            }
+            else if ((c >= 'A') && (c <= 'F'))
+            {
+                nibble = (uint8_t)(c - 'A' + 10);
+            }
+            else if ((c >= 'a') && (c <= 'f'))
+            {
+                nibble = (uint8_t)(c - 'a' + 10);
+            }
+            else
+            {
+                return false;
+            }
+            byte = (uint8_t)((byte << 4) | nibble);
+        }
+        pOutData[i / 2] = byte;
+    }
+
+    *pOutLength = (uint16_t)(length / 2);
+    return true;
+}
+
+/**
+ * @brief Gets the rest of a tokenized argument string, starting at the argument with the supplied index.
+ *
+ * Used for trailing payloads, which may contain argument delimiters.
+ *
+ * @param[in] pArguments Argument index created by ATCommand_TokenizeArguments()
+ * @param[in] index Index of the first argument to get
+ * @param[out] pOutArgument Remaining arguments as string
+ * @param[in] maxLength Max. length of string to get (including termination character).
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetArgumentRemainder(const ATCommand_Arguments_t* pArguments, uint8_t index, char* pOutArgument, uint16_t maxLength) { return ATCommand_CopyArgument(pArguments, index, false, true, pOutArgument, maxLength); }
+
+/**
+ * @brief Gets the rest of a tokenized argument string, starting at the argument with the supplied index,
+ * and removes the enclosing quotation marks.
+ *
+ * @param[in] pArguments Argument index created by ATCommand_TokenizeArguments()
+ * @param[in] index Index of the first argument to get
+ * @param[out] pOutArgument Remaining arguments as string
+ * @param[in] maxLength Max. length of string to get (including termination character).
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetArgumentRemainderWithoutQuotationMarks(const ATCommand_Arguments_t* pArguments, uint8_t index, char* pOutArgument, uint16_t maxLength) { return ATCommand_CopyArgument(pArguments, index, true, true, pOutArgument, maxLength); }
+
+/**
+ * @brief Gets an integer argument from a tokenized argument string.
+ *
+ * @param[in] pArguments Argument index created by ATCommand_TokenizeArguments()
+ * @param[in] index Index of the argument to get
+ * @param[out] pOutArgument Argument parsed as integer
+ * @param[in] intFlags Flags to determine how to parse
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetArgumentInt(const ATCommand_Arguments_t* pArguments, uint8_t index, void* pOutArgument, uint16_t intFlags)
+{
+    char tempString[40];
+
+    return ATCommand_GetArgumentString(pArguments, index, tempString, sizeof(tempString)) && ATCommand_StringToInt(pOutArgument, tempString, intFlags);
+}
+
+/**
+ * @brief Gets an integer argument from a tokenized argument string and removes the quotation marks.
+ *
+ * @param[in] pArguments Argument index created by ATCommand_TokenizeArguments()
+ * @param[in] index Index of the argument to get
+ * @param[out] pOutArgument Argument parsed as integer
+ * @param[in] intFlags Flags to determine how to parse
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetArgumentIntWithoutQuotationMarks(const ATCommand_Arguments_t* pArguments, uint8_t index, void* pOutArgument, uint16_t intFlags)
+{
+    char tempString[40];
+
+    return ATCommand_GetArgumentStringWithoutQuotationMarks(pArguments, index, tempString, sizeof(tempString)) && ATCommand_StringToInt(pOutArgument, tempString, intFlags);
+}
+
+/**
+ * @brief Gets an enumeration argument from a tokenized argument string.
+ *
+ * @param[in] pArguments Argument index created by ATCommand_TokenizeArguments()
+ * @param[in] index Index of the argument to get
+ * @param[out] pOutArgument Enumeration value corresponding to the argument
+ * @param[in] tableP String table containing the string representations of the enumeration's values
+ * @param[in] maxStringLength Max. length of individual enumeration value strings
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetArgumentEnum(const ATCommand_Arguments_t* pArguments, uint8_t index, uint8_t* pOutArgument, const ATCommand_StringTable_t* tableP, uint16_t maxStringLength)
+{
+    const char* start;
+    size_t length;
+
+    if ((NULL == pOutArgument) || !ATCommand_GetArgumentSpan(pArguments, index, false, false, &start, &length) || (length >= maxStringLength))
+    {
+        return false;
+    }
+
+    /* Match in place, no copy of the argument required */
+    return ATCommand_FindStringN(tableP, start, length, pOutArgument);
+}
+
+/**
+ * @brief Gets an enumeration argument from a tokenized argument string and removes the quotation marks.
+ *
+ * @param[in] pArguments Argument index created by ATCommand_TokenizeArguments()
+ * @param[in] index Index of the argument to get
+ * @param[out] pOutArgument Enumeration value corresponding to the argument
+ * @param[in] tableP String table containing the string representations of the enumeration's values
+ * @param[in] maxStringLength Max. length of individual enumeration value strings
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetArgumentEnumWithoutQuotationMarks(const ATCommand_Arguments_t* pArguments, uint8_t index, uint8_t* pOutArgument, const ATCommand_StringTable_t* tableP, uint16_t maxStringLength)
+{
+    const char* start;
+    size_t length;
+
+    if ((NULL == pOutArgument) || !ATCommand_GetArgumentSpan(pArguments, index, true, false, &start, &length) || (length >= maxStringLength))
+    {
+        return false;
+    }
+
+    /* Match in place, no copy of the argument required */
+    return ATCommand_FindStringN(tableP, start, length, pOutArgument);
+}
+
+/**
+ * @brief Appends the struct members described by a field table to the end of an AT command.
+ *
+ * Members are separated by ATCOMMAND_ARGUMENT_DELIM, the supplied delimiter is appended after the last one.
+ * The size of integer members is taken from the field table, integers without notation flag are appended in decimal notation.
+ *
+ * @param[out] pOutString AT command after appending arguments
+ * @param[in] fields Field table describing the arguments
+ * @param[in] numFields Number of entries in fields
+ * @param[in] pIn Struct holding the values to append
+ * @param[in] delimiter Delimiter to append after the last argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_AppendFields(char* pOutString, const ATCommand_Field_t* fields, uint8_t numFields, const void* pIn, char delimiter)
+{
+    if ((NULL == pOutString) || (NULL == fields) || (NULL == pIn))
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < numFields; i++)
+    {
+        const ATCommand_Field_t* fieldP = &fields[i];
+        const char* memberP = (const char*)pIn + fieldP->offset;
+        char fieldDelimiter = (i == (numFields - 1)) ? delimiter : ATCOMMAND_ARGUMENT_DELIM;
+        uint16_t intFlags = fieldP->intFlags;
+        bool ok = false;
+
+        if (0 == (intFlags & ATCOMMAND_INTFLAGS_NOTATION))
+        {
+            intFlags |= ATCOMMAND_INTFLAGS_NOTATION_DEC;
+        }
+
+        switch (fieldP->type)
+        {
+            case ATCommand_FieldType_Int:
+                ok = ATCommand_AppendArgumentInt(pOutString, ATCommand_ReadFieldValue(pIn, fieldP), intFlags, fieldDelimiter);
+                break;
+            case ATCommand_FieldType_IntQuotationMarks:
+                ok = ATCommand_AppendArgumentIntQuotationMarks(pOutString, ATCommand_ReadFieldValue(pIn, fieldP), intFlags, fieldDelimiter);
+                break;
+            case ATCommand_FieldType_String:
+                ok = ATCommand_AppendArgumentString(pOutString, memberP, fieldDelimiter);
+                break;
+            case ATCommand_FieldType_StringQuotationMarks:
+                ok = ATCommand_AppendArgumentStringQuotationMarks(pOutString, memberP, fieldDelimiter);
+                break;
+            case ATCommand_FieldType_EnumString:
+            case ATCommand_FieldType_EnumStringQuotationMarks:
+            {
+                uint32_t value = ATCommand_ReadFieldValue(pIn, fieldP);
+                if (value >= fieldP->strings->numStrings)
+                {
+                    return false;
+                }
+                ok = (fieldP->type == ATCommand_FieldType_EnumString) ? ATCommand_AppendArgumentString(pOutString, fieldP->strings->strings[value], fieldDelimiter) : ATCommand_AppendArgumentStringQuotationMarks(pOutString, fieldP->strings->strings[value], fieldDelimiter);
+                break;
+            }
+            default:
+                break;
+        }
+
+        if (!ok)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Fills the struct members described by a field table from a tokenized argument string.
+ *
+ * Field i is read from the argument with index firstIndex + i.
+ *
+ * @param[in] pArguments Argument index created by ATCommand_TokenizeArguments()
+ * @param[in] firstIndex Index of the argument corresponding to the first field
+ * @param[in] fields Field table describing the arguments
+ * @param[in] numFields Number of entries in fields
+ * @param[out] pOut Struct receiving the values
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetFields(const ATCommand_Arguments_t* pArguments, uint8_t firstIndex, const ATCommand_Field_t* fields, uint8_t numFields, void* pOut)
+{
+    if ((NULL == pArguments) || (NULL == fields) || (NULL == pOut))
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < numFields; i++)
+    {
+        const ATCommand_Field_t* fieldP = &fields[i];
+        uint8_t index = firstIndex + i;
+        char* memberP = (char*)pOut + fieldP->offset;
+
+        switch (fieldP->type)
+        {
+            case ATCommand_FieldType_Int:
+            case ATCommand_FieldType_IntQuotationMarks:
+            {
+                char tempString[40];
+                uint64_t value;
+                uint16_t intFlags = (fieldP->intFlags & ~ATCOMMAND_INTFLAGS_SIZE) | ATCOMMAND_INTFLAGS_SIZE64;
+
+                if (!ATCommand_CopyArgument(pArguments, index, fieldP->type == ATCommand_FieldType_IntQuotationMarks, false, tempString, sizeof(tempString)) || !ATCommand_StringToInt(&value, tempString, intFlags))
+                {
+                    return false;
+                }
+                ATCommand_WriteFieldValue(pOut, fieldP, value);
+                break;
+            }
+            case ATCommand_FieldType_String:
+            case ATCommand_FieldType_StringQuotationMarks:
+            {
+                if (!ATCommand_CopyArgument(pArguments, index, fieldP->type == ATCommand_FieldType_StringQuotationMarks, false, memberP, fieldP->size))
+                {
+                    return false;
+                }
+                break;
+            }
+            case ATCommand_FieldType_EnumString:
+            case ATCommand_FieldType_EnumStringQuotationMarks:
+            {
+                const char* start;
+                size_t length;
+                uint8_t value;
+
+                if (!ATCommand_GetArgumentSpan(pArguments, index, fieldP->type == ATCommand_FieldType_EnumStringQuotationMarks, false, &start, &length) || !ATCommand_FindStringN(fieldP->strings, start, length, &value))
+                {
+                    return false;
+                }
+                ATCommand_WriteFieldValue(pOut, fieldP, value);
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
 bool ATCommand_ParseEventType(char** pAtCommand, const ATCommand_Event_t* pmoduleEvents, char* delimiters, uint8_t number_of_delimiters, uint16_t* pEvent)
 {
     const ATCommand_Event_t* eventP = &pmoduleEvents[0];
@@ -32,6 +32,7 @@
 #define GLOBAL_AT_COMMMANDS_H_INCLUDED
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -74,6 +75,10 @@
 #define ATCOMMAND_INTFLAGS_NOTATION_HEX (uint16_t)(0x40) /**< Hexadecimal notation */
 #define ATCOMMAND_INTFLAGS_NOTATION_DEC (uint16_t)(0x80) /**< Decimal notation */
 
+#define ATCOMMAND_FIXEDPOINT_MAX_DECIMALS (uint8_t)(9) /**< Max. number of decimal places supported by fixed point conversion (10^9 fits into int32_t) */
+
+#define ATCOMMAND_MAX_ARGUMENTS (uint8_t)(16) /**< Max. number of arguments recorded by ATCommand_TokenizeArguments(), surplus arguments are merged into the last one */
+
 #define FULLEVENTENTRY(name, id, subevent, subdelimiter, l) {.eventName = name, .eventID = id, .subEventsP = subevent, .subDelimiter = subdelimiter, .last = l},
 
 #define EVENTENTRY(name, id) FULLEVENTENTRY(name, id, NULL, ATCOMMAND_STRING_TERMINATE, false)
@@ -101,6 +106,108 @@ typedef struct ATCommand_Event_t
     bool last;
 } ATCommand_Event_t;
 
+/**
+ * @brief Position of a single argument inside a tokenized argument string.
+ */
+typedef struct ATCommand_Argument_t
+{
+    uint16_t offset; /**< Offset of the first character (including an opening quotation mark) */
+    uint16_t length; /**< Number of characters (including quotation marks) */
+    bool quoted;     /**< Argument is enclosed in quotation marks */
+} ATCommand_Argument_t;
+
+/**
+ * @brief Argument index of an argument string as created by ATCommand_TokenizeArguments().
+ *
+ * The index refers to the tokenized string, which must remain unchanged while the index is in use.
+ */
+typedef struct ATCommand_Arguments_t
+{
+    const char* pString;                                     /**< Tokenized argument string */
+    uint16_t length;                                         /**< Length of the tokenized argument string */
+    uint8_t count;                                           /**< Number of arguments */
+    ATCommand_Argument_t arguments[ATCOMMAND_MAX_ARGUMENTS]; /**< Argument positions */
+} ATCommand_Arguments_t;
+
+/**
+ * @brief Entry of the lookup index of a string table.
+ */
+typedef struct ATCommand_StringIndex_t
+{
+    uint8_t length; /**< Length of the string */
+    uint8_t value;  /**< Enumeration value (index of the string in the string table) */
+} ATCommand_StringIndex_t;
+
+/**
+ * @brief String representations of the values of an enumeration, with an index for looking up strings.
+ *
+ * The index is ordered by length and then alphabetically (case insensitive), so a string is looked up by a binary
+ * search that mostly compares lengths only. Use ATCOMMAND_STRINGTABLE() to define tables.
+ */
+typedef struct ATCommand_StringTable_t
+{
+    const char* const* strings;           /**< Strings by enumeration value */
+    const ATCommand_StringIndex_t* index; /**< Enumeration values in lookup order */
+    uint8_t numStrings;                   /**< Number of strings (number of elements in the enumeration) */
+} ATCommand_StringTable_t;
+
+#define ATCOMMAND_STRINGTABLE_STRING(str, value) [value] = str,
+#define ATCOMMAND_STRINGTABLE_INDEX(str, value) {sizeof(str) - 1, value},
+
+/**
+ * @brief Defines a string table from a list of ENTRY(string, value) entries.
+ *
+ * The entries must be listed in lookup order, i.e. ordered by length and then alphabetically (case insensitive).
+ * The string array and the index are both generated from this list at compile time.
+ *
+ * @param[in] name Name of the table
+ * @param[in] count Number of values of the enumeration (all values must be listed)
+ * @param[in] ENTRIES Macro expanding to the list of entries, taking the ENTRY macro as argument
+ */
+#define ATCOMMAND_STRINGTABLE(name, count, ENTRIES)                                                    \
+    static const char* const name##_List[count] = {ENTRIES(ATCOMMAND_STRINGTABLE_STRING)};             \
+    static const ATCommand_StringIndex_t name##_Index[count] = {ENTRIES(ATCOMMAND_STRINGTABLE_INDEX)}; \
+    static const ATCommand_StringTable_t name = {name##_List, name##_Index, count}
+
+/**
+ * @brief Encoding of a single argument described by ATCommand_Field_t.
+ */
+typedef enum ATCommand_FieldType_t
+{
+    ATCommand_FieldType_Int,                       /**< Integer, formatted according to intFlags */
+    ATCommand_FieldType_IntQuotationMarks,         /**< Integer enclosed in quotation marks */
+    ATCommand_FieldType_String,                    /**< Character array */
+    ATCommand_FieldType_StringQuotationMarks,      /**< Character array enclosed in quotation marks */
+    ATCommand_FieldType_EnumString,                /**< Enumeration value represented by a string from the string table */
+    ATCommand_FieldType_EnumStringQuotationMarks,  /**< Enumeration value represented by a string from the string table, enclosed in quotation marks */
+    ATCommand_FieldType_NumberOfValues
+} ATCommand_FieldType_t;
+
+/**
+ * @brief Describes how a struct member maps to an AT command argument.
+ *
+ * Tables of fields are used to both append the members of a struct to a request
+ * (ATCommand_AppendFields()) and to fill the members from a tokenized response (ATCommand_GetFields()).
+ * Use the ATCOMMAND_FIELD_* macros to create entries.
+ */
+typedef struct ATCommand_Field_t
+{
+    ATCommand_FieldType_t type; /**< Argument encoding */
+    uint16_t offset;            /**< Offset of the member in the struct */
+    uint16_t size;              /**< Size of the member in bytes */
+    uint16_t intFlags;          /**< Integer conversion flags (integer fields only) */
+    const ATCommand_StringTable_t* strings; /**< String representations of the enumeration's values (enumeration fields only) */
+} ATCommand_Field_t;
+
+#define ATCOMMAND_MEMBER_SIZE(structType, member) ((uint16_t)sizeof(((structType*)0)->member))
+
+#define ATCOMMAND_FIELD_INT(structType, member, flags) {.type = ATCommand_FieldType_Int, .offset = offsetof(structType, member), .size = ATCOMMAND_MEMBER_SIZE(structType, member), .intFlags = (flags)}
+#define ATCOMMAND_FIELD_INT_QUOTATIONMARKS(structType, member, flags) {.type = ATCommand_FieldType_IntQuotationMarks, .offset = offsetof(structType, member), .size = ATCOMMAND_MEMBER_SIZE(structType, member), .intFlags = (flags)}
+#define ATCOMMAND_FIELD_STRING(structType, member) {.type = ATCommand_FieldType_String, .offset = offsetof(structType, member), .size = ATCOMMAND_MEMBER_SIZE(structType, member)}
+#define ATCOMMAND_FIELD_STRING_QUOTATIONMARKS(structType, member) {.type = ATCommand_FieldType_StringQuotationMarks, .offset = offsetof(structType, member), .size = ATCOMMAND_MEMBER_SIZE(structType, member)}
+#define ATCOMMAND_FIELD_ENUMSTRING(structType, member, table) {.type = ATCommand_FieldType_EnumString, .offset = offsetof(structType, member), .size = ATCOMMAND_MEMBER_SIZE(structType, member), .strings = (table)}
+#define ATCOMMAND_FIELD_ENUMSTRING_QUOTATIONMARKS(structType, member, table) {.type = ATCommand_FieldType_EnumStringQuotationMarks, .offset = offsetof(structType, member), .size = ATCOMMAND_MEMBER_SIZE(structType, member), .strings = (table)}
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -117,11 +224,13 @@ extern "C"
 
     extern bool ATCommand_AppendArgumentBytes(char* pOutString, const char* pInArgument, uint16_t numBytes, char delimiter);
 
+    extern void ATCommand_EncodeHex(const uint8_t* pInData, uint16_t numBytes, char* pOutHex);
+
     extern bool ATCommand_AppendArgumentString(char* pOutString, const char* pInArgument, char delimiter);
 
     extern bool ATCommand_AppendArgumentStringQuotationMarks(char* pOutString, const char* pInArgument, char delimiter);
 
-    extern bool ATCommand_AppendArgumentBitmask(char* pOutString, const char* stringList[], uint8_t numStrings, uint32_t bitmask, char delimiter, uint16_t maxStringLength);
+    extern bool ATCommand_AppendArgumentBitmask(char* pOutString, const ATCommand_StringTable_t* tableP, uint32_t bitmask, char delimiter, uint16_t maxStringLength);
 
     extern bool ATCommand_AppendArgumentBoolean(char* pOutString, bool inBool, char delimiter);
 
@@ -143,15 +252,15 @@ extern "C"
 
     extern bool ATCommand_GetNextArgumentInt(char** pInArguments, void* pOutArgument, uint16_t intFlags, char delimiter);
 
-    extern bool ATCommand_GetNextArgumentEnum(char** pInArguments, uint8_t* pOutArgument, const char* stringList[], uint8_t numStrings, uint16_t maxStringLength, char delimiter);
-    extern bool ATCommand_GetNextArgumentBitmask(char** pInArguments, const char* stringList[], uint8_t numStrings, uint16_t maxStringLength, uint32_t* bitmask, char delimiter);
+    extern bool ATCommand_GetNextArgumentEnum(char** pInArguments, uint8_t* pOutArgument, const ATCommand_StringTable_t* tableP, uint16_t maxStringLength, char delimiter);
+    extern bool ATCommand_GetNextArgumentBitmask(char** pInArguments, const ATCommand_StringTable_t* tableP, uint16_t maxStringLength, uint32_t* bitmask, char delimiter);
     extern bool ATCommand_GetNextArgumentBoolean(char** pInArguments, bool* outBool, char delimiter);
 
     extern bool ATCommand_GetCmdName(char** pInAtCmd, char* pCmdName, size_t CmdNameLen, char* delimiters, uint8_t number_of_delimiters);
 
-    extern uint8_t ATCommand_FindString(const char* stringList[], uint8_t numStrings, const char* str, uint8_t defaultValue, bool* ok);
+    extern uint8_t ATCommand_FindString(const ATCommand_StringTable_t* tableP, const char* str, uint8_t defaultValue, bool* ok);
 
-    extern bool ATCommand_GetNextArgumentEnumWithoutQuotationMarks(char** pInArguments, uint8_t* pOutArgument, const char* stringList[], uint8_t numStrings, uint16_t maxStringLength, char delimiter);
+    extern bool ATCommand_GetNextArgumentEnumWithoutQuotationMarks(char** pInArguments, uint8_t* pOutArgument, const ATCommand_StringTable_t* tableP, uint16_t maxStringLength, char delimiter);
 
     extern bool ATCommand_StringToDouble(void* number, const char* inString);
 
@@ -165,8 +274,38 @@ extern "C"
 
     extern bool ATCommand_GetNextArgumentFloatWithoutQuotationMarks(char** pInArguments, void* pOutArgument, char delimiter);
 
+    extern bool ATCommand_StringToFixedPoint(void* number, const char* inString, uint8_t decimals);
+
+    extern bool ATCommand_GetNextArgumentFixedPoint(char** pInArguments, void* pOutArgument, uint8_t decimals, char delimiter);
+
+    extern bool ATCommand_GetNextArgumentFixedPointWithoutQuotationMarks(char** pInArguments, void* pOutArgument, uint8_t decimals, char delimiter);
+
     extern int ATCommand_CountArgs(char* stringP);
 
+    extern bool ATCommand_TokenizeArguments(const char* pInArguments, ATCommand_Arguments_t* pOutArguments);
+
+    extern bool ATCommand_GetArgumentString(const ATCommand_Arguments_t* pArguments, uint8_t index, char* pOutArgument, uint16_t maxLength);
+
+    extern bool ATCommand_GetArgumentStringWithoutQuotationMarks(const ATCommand_Arguments_t* pArguments, uint8_t index, char* pOutArgument, uint16_t maxLength);
+
+    extern bool ATCommand_GetArgumentHex(const ATCommand_Arguments_t* pArguments, uint8_t index, uint8_t* pOutData, uint16_t maxLength, uint16_t* pOutLength);
+
+    extern bool ATCommand_GetArgumentRemainder(const ATCommand_Arguments_t* pArguments, uint8_t index, char* pOutArgument, uint16_t maxLength);
+
+    extern bool ATCommand_GetArgumentRemainderWithoutQuotationMarks(const ATCommand_Arguments_t* pArguments, uint8_t index, char* pOutArgument, uint16_t maxLength);
+
+    extern bool ATCommand_GetArgumentInt(const ATCommand_Arguments_t* pArguments, uint8_t index, void* pOutArgument, uint16_t intFlags);
+
+    extern bool ATCommand_GetArgumentIntWithoutQuotationMarks(const ATCommand_Arguments_t* pArguments, uint8_t index, void* pOutArgument, uint16_t intFlags);
+
+    extern bool ATCommand_GetArgumentEnum(const ATCommand_Arguments_t* pArguments, uint8_t index, uint8_t* pOutArgument, const ATCommand_StringTable_t* tableP, uint16_t maxStringLength);
+
+    extern bool ATCommand_GetArgumentEnumWithoutQuotationMarks(const ATCommand_Arguments_t* pArguments, uint8_t index, uint8_t* pOutArgument, const ATCommand_StringTable_t* tableP, uint16_t maxStringLength);
+
+    extern bool ATCommand_AppendFields(char* pOutString, const ATCommand_Field_t* fields, uint8_t numFields, const void* pIn, char delimiter);
+
+    extern bool ATCommand_GetFields(const ATCommand_Arguments_t* pArguments, uint8_t firstIndex, const ATCommand_Field_t* fields, uint8_t numFields, void* pOut);
+
     extern bool ATCommand_ParseEventType(char** pAtCommand, const ATCommand_Event_t* pmoduleEvents, char* delimiters, uint8_t number_of_delimiters, uint16_t* pEvent);
 
 #ifdef __cplusplus
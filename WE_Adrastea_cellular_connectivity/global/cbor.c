@@ -0,0 +1,387 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Compact CBOR (RFC 8949) encoder writing directly into a caller supplied buffer (enabled by defining WE_CBOR).
+ */
+
+#include <string.h>
+
+#include "cbor.h"
+
+#ifdef WE_CBOR
+
+/**
+ * @brief CBOR major types.
+ */
+#define WE_CBOR_MAJOR_UINT (uint8_t)(0 << 5)
+#define WE_CBOR_MAJOR_NEGATIVE_INT (uint8_t)(1 << 5)
+#define WE_CBOR_MAJOR_BYTES (uint8_t)(2 << 5)
+#define WE_CBOR_MAJOR_TEXT (uint8_t)(3 << 5)
+#define WE_CBOR_MAJOR_ARRAY (uint8_t)(4 << 5)
+#define WE_CBOR_MAJOR_MAP (uint8_t)(5 << 5)
+#define WE_CBOR_MAJOR_TAG (uint8_t)(6 << 5)
+#define WE_CBOR_MAJOR_SIMPLE (uint8_t)(7 << 5)
+
+/**
+ * @brief Initial bytes of simple values and floating point numbers.
+ */
+#define WE_CBOR_FALSE (uint8_t)(WE_CBOR_MAJOR_SIMPLE | 20)
+#define WE_CBOR_TRUE (uint8_t)(WE_CBOR_MAJOR_SIMPLE | 21)
+#define WE_CBOR_NULL (uint8_t)(WE_CBOR_MAJOR_SIMPLE | 22)
+#define WE_CBOR_FLOAT32 (uint8_t)(WE_CBOR_MAJOR_SIMPLE | 26)
+#define WE_CBOR_FLOAT64 (uint8_t)(WE_CBOR_MAJOR_SIMPLE | 27)
+
+/**
+ * @brief Reserves space for an item.
+ *
+ * @return Pointer to the reserved space, NULL if the item does not fit into the buffer
+ */
+static uint8_t* WE_CBOR_Reserve(WE_CBOR_Encoder_t* encoderP, size_t length)
+{
+    if ((encoderP == NULL) || encoderP->overflow)
+    {
+        return NULL;
+    }
+
+    if (length > encoderP->size - encoderP->length)
+    {
+        encoderP->overflow = true;
+        return NULL;
+    }
+
+    uint8_t* p = &encoderP->buffer[encoderP->length];
+    encoderP->length += length;
+    return p;
+}
+
+/**
+ * @brief Writes value in big endian byte order.
+ */
+static void WE_CBOR_PutBigEndian(uint8_t* p, uint64_t value, uint8_t length)
+{
+    for (uint8_t i = length; i > 0; i--)
+    {
+        p[i - 1] = (uint8_t)value;
+        value >>= 8;
+    }
+}
+
+/**
+ * @brief Encodes the initial byte of an item and its argument (value, length or count) in the shortest form.
+ */
+static bool WE_CBOR_EncodeHead(WE_CBOR_Encoder_t* encoderP, uint8_t majorType, uint64_t argument)
+{
+    uint8_t argumentLength;
+    uint8_t additionalInfo;
+
+    if (argument < 24)
+    {
+        argumentLength = 0;
+        additionalInfo = (uint8_t)argument;
+    }
+    else if (argument <= UINT8_MAX)
+    {
+        argumentLength = 1;
+        additionalInfo = 24;
+    }
+    else if (argument <= UINT16_MAX)
+    {
+        argumentLength = 2;
+        additionalInfo = 25;
+    }
+    else if (argument <= UINT32_MAX)
+    {
+        argumentLength = 4;
+        additionalInfo = 26;
+    }
+    else
+    {
+        argumentLength = 8;
+        additionalInfo = 27;
+    }
+
+    uint8_t* p = WE_CBOR_Reserve(encoderP, 1 + argumentLength);
+    if (p == NULL)
+    {
+        return false;
+    }
+
+    p[0] = majorType | additionalInfo;
+    WE_CBOR_PutBigEndian(&p[1], argument, argumentLength);
+    return true;
+}
+
+static bool WE_CBOR_EncodeByte(WE_CBOR_Encoder_t* encoderP, uint8_t value)
+{
+    uint8_t* p = WE_CBOR_Reserve(encoderP, 1);
+    if (p == NULL)
+    {
+        return false;
+    }
+
+    *p = value;
+    return true;
+}
+
+static bool WE_CBOR_EncodeStringItem(WE_CBOR_Encoder_t* encoderP, uint8_t majorType, const void* data, size_t length)
+{
+    if ((data == NULL) && (length > 0))
+    {
+        return false;
+    }
+
+    /* Check the total size first, so a string that doesn't fit leaves no partial item */
+    size_t headLength = (length < 24) ? 1 : ((length <= UINT8_MAX) ? 2 : ((length <= UINT16_MAX) ? 3 : ((length <= UINT32_MAX) ? 5 : 9)));
+    if ((encoderP == NULL) || encoderP->overflow || (headLength + length > encoderP->size - encoderP->length))
+    {
+        if (encoderP != NULL)
+        {
+            encoderP->overflow = true;
+        }
+        return false;
+    }
+
+    WE_CBOR_EncodeHead(encoderP, majorType, length);
+    if (length > 0)
+    {
+        memcpy(WE_CBOR_Reserve(encoderP, length), data, length);
+    }
+    return true;
+}
+
+/**
+ * @brief Initializes the encoder.
+ *
+ * @param[out] encoderP Encoder
+ * @param[in] buffer Buffer for the encoded data (e.g. the payload buffer of a publication)
+ * @param[in] size Size of the buffer
+ */
+void WE_CBOR_Init(WE_CBOR_Encoder_t* encoderP, uint8_t* buffer, size_t size)
+{
+    if (encoderP == NULL)
+    {
+        return;
+    }
+
+    encoderP->buffer = buffer;
+    encoderP->size = (buffer != NULL) ? size : 0;
+    encoderP->length = 0;
+    encoderP->overflow = false;
+}
+
+/**
+ * @brief Encodes an unsigned integer.
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] value Value
+ *
+ * @return true if successful, false otherwise
+ */
+bool WE_CBOR_EncodeUInt(WE_CBOR_Encoder_t* encoderP, uint64_t value) { return WE_CBOR_EncodeHead(encoderP, WE_CBOR_MAJOR_UINT, value); }
+
+/**
+ * @brief Encodes a signed integer.
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] value Value
+ *
+ * @return true if successful, false otherwise
+ */
+bool WE_CBOR_EncodeInt(WE_CBOR_Encoder_t* encoderP, int64_t value)
+{
+    if (value >= 0)
+    {
+        return WE_CBOR_EncodeHead(encoderP, WE_CBOR_MAJOR_UINT, (uint64_t)value);
+    }
+
+    /* -1 - n, computed without overflow for INT64_MIN */
+    return WE_CBOR_EncodeHead(encoderP, WE_CBOR_MAJOR_NEGATIVE_INT, ~(uint64_t)value);
+}
+
+/**
+ * @brief Encodes a boolean value.
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] value Value
+ *
+ * @return true if successful, false otherwise
+ */
+bool WE_CBOR_EncodeBool(WE_CBOR_Encoder_t* encoderP, bool value) { return WE_CBOR_EncodeByte(encoderP, value ? WE_CBOR_TRUE : WE_CBOR_FALSE); }
+
+/**
+ * @brief Encodes null.
+ *
+ * @param[in,out] encoderP Encoder
+ *
+ * @return true if successful, false otherwise
+ */
+bool WE_CBOR_EncodeNull(WE_CBOR_Encoder_t* encoderP) { return WE_CBOR_EncodeByte(encoderP, WE_CBOR_NULL); }
+
+/**
+ * @brief Encodes a single precision floating point number.
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] value Value
+ *
+ * @return true if successful, false otherwise
+ */
+bool WE_CBOR_EncodeFloat(WE_CBOR_Encoder_t* encoderP, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint8_t* p = WE_CBOR_Reserve(encoderP, 1 + sizeof(bits));
+    if (p == NULL)
+    {
+        return false;
+    }
+
+    p[0] = WE_CBOR_FLOAT32;
+    WE_CBOR_PutBigEndian(&p[1], bits, sizeof(bits));
+    return true;
+}
+
+/**
+ * @brief Encodes a double precision floating point number.
+ *
+ * Values that can be represented exactly in single precision are encoded as such (5 instead of 9 bytes).
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] value Value
+ *
+ * @return true if successful, false otherwise
+ */
+bool WE_CBOR_EncodeDouble(WE_CBOR_Encoder_t* encoderP, double value)
+{
+    if ((double)(float)value == value)
+    {
+        return WE_CBOR_EncodeFloat(encoderP, (float)value);
+    }
+
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint8_t* p = WE_CBOR_Reserve(encoderP, 1 + sizeof(bits));
+    if (p == NULL)
+    {
+        return false;
+    }
+
+    p[0] = WE_CBOR_FLOAT64;
+    WE_CBOR_PutBigEndian(&p[1], bits, sizeof(bits));
+    return true;
+}
+
+/**
+ * @brief Encodes a byte string.
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] data Bytes
+ * @param[in] length Number of bytes
+ *
+ * @return true if successful, false otherwise
+ */
+bool WE_CBOR_EncodeBytes(WE_CBOR_Encoder_t* encoderP, const uint8_t* data, size_t length) { return WE_CBOR_EncodeStringItem(encoderP, WE_CBOR_MAJOR_BYTES, data, length); }
+
+/**
+ * @brief Encodes a UTF-8 text string.
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] text Text (not necessarily null-terminated)
+ * @param[in] length Length of text in bytes
+ *
+ * @return true if successful, false otherwise
+ */
+bool WE_CBOR_EncodeText(WE_CBOR_Encoder_t* encoderP, const char* text, size_t length) { return WE_CBOR_EncodeStringItem(encoderP, WE_CBOR_MAJOR_TEXT, text, length); }
+
+/**
+ * @brief Encodes a null-terminated UTF-8 text string.
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] string Text
+ *
+ * @return true if successful, false otherwise
+ */
+bool WE_CBOR_EncodeString(WE_CBOR_Encoder_t* encoderP, const char* string)
+{
+    if (string == NULL)
+    {
+        return false;
+    }
+
+    return WE_CBOR_EncodeStringItem(encoderP, WE_CBOR_MAJOR_TEXT, string, strlen(string));
+}
+
+/**
+ * @brief Encodes a tag, which applies to the next item.
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] tag Tag number (e.g. 1 for a following epoch timestamp)
+ *
+ * @return true if successful, false otherwise
+ */
+bool WE_CBOR_EncodeTag(WE_CBOR_Encoder_t* encoderP, uint64_t tag) { return WE_CBOR_EncodeHead(encoderP, WE_CBOR_MAJOR_TAG, tag); }
+
+/**
+ * @brief Starts an array, the items have to be encoded next.
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] count Number of items
+ *
+ * @return true if successful, false otherwise
+ */
+bool WE_CBOR_StartArray(WE_CBOR_Encoder_t* encoderP, size_t count) { return WE_CBOR_EncodeHead(encoderP, WE_CBOR_MAJOR_ARRAY, count); }
+
+/**
+ * @brief Starts a map, the keys and values have to be encoded next (alternating).
+ *
+ * @param[in,out] encoderP Encoder
+ * @param[in] count Number of key/value pairs
+ *
+ * @return true if successful, false otherwise
+ */
+bool WE_CBOR_StartMap(WE_CBOR_Encoder_t* encoderP, size_t count) { return WE_CBOR_EncodeHead(encoderP, WE_CBOR_MAJOR_MAP, count); }
+
+/**
+ * @brief Returns the number of bytes encoded.
+ *
+ * @param[in] encoderP Encoder
+ *
+ * @return Number of bytes encoded
+ */
+size_t WE_CBOR_GetLength(const WE_CBOR_Encoder_t* encoderP) { return (encoderP != NULL) ? encoderP->length : 0; }
+
+/**
+ * @brief Checks if all items have been encoded, i.e. if the buffer has not overflowed.
+ *
+ * @param[in] encoderP Encoder
+ *
+ * @return true if valid, false otherwise
+ */
+bool WE_CBOR_IsValid(const WE_CBOR_Encoder_t* encoderP) { return (encoderP != NULL) && (encoderP->buffer != NULL) && !encoderP->overflow; }
+
+#endif /* WE_CBOR */
@@ -0,0 +1,96 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Compact CBOR (RFC 8949) encoder writing directly into a caller supplied buffer (enabled by defining WE_CBOR).
+ *
+ * The encoder does not allocate memory. If an item does not fit into the buffer, nothing is written and the
+ * encoder is marked as overflowed, so a sequence of items can be encoded without checking every call. Integers
+ * and lengths always use the shortest encoding, so small values take a single byte.
+ *
+ * Arrays and maps are encoded with definite length, i.e. the number of items (map: number of key/value pairs)
+ * must be passed to WE_CBOR_StartArray() or WE_CBOR_StartMap() before the items.
+ */
+
+#ifndef CBOR_H_INCLUDED
+#define CBOR_H_INCLUDED
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Encoder state.
+ * @see WE_CBOR_Init()
+ */
+typedef struct WE_CBOR_Encoder_t
+{
+    uint8_t* buffer;
+    size_t size;   /**< Size of buffer */
+    size_t length; /**< Number of bytes encoded */
+    bool overflow; /**< Is set to true if an item did not fit into the buffer */
+} WE_CBOR_Encoder_t;
+
+extern void WE_CBOR_Init(WE_CBOR_Encoder_t* encoderP, uint8_t* buffer, size_t size);
+
+extern bool WE_CBOR_EncodeUInt(WE_CBOR_Encoder_t* encoderP, uint64_t value);
+
+extern bool WE_CBOR_EncodeInt(WE_CBOR_Encoder_t* encoderP, int64_t value);
+
+extern bool WE_CBOR_EncodeBool(WE_CBOR_Encoder_t* encoderP, bool value);
+
+extern bool WE_CBOR_EncodeNull(WE_CBOR_Encoder_t* encoderP);
+
+extern bool WE_CBOR_EncodeFloat(WE_CBOR_Encoder_t* encoderP, float value);
+
+extern bool WE_CBOR_EncodeDouble(WE_CBOR_Encoder_t* encoderP, double value);
+
+extern bool WE_CBOR_EncodeBytes(WE_CBOR_Encoder_t* encoderP, const uint8_t* data, size_t length);
+
+extern bool WE_CBOR_EncodeText(WE_CBOR_Encoder_t* encoderP, const char* text, size_t length);
+
+extern bool WE_CBOR_EncodeString(WE_CBOR_Encoder_t* encoderP, const char* string);
+
+extern bool WE_CBOR_EncodeTag(WE_CBOR_Encoder_t* encoderP, uint64_t tag);
+
+extern bool WE_CBOR_StartArray(WE_CBOR_Encoder_t* encoderP, size_t count);
+
+extern bool WE_CBOR_StartMap(WE_CBOR_Encoder_t* encoderP, size_t count);
+
+extern size_t WE_CBOR_GetLength(const WE_CBOR_Encoder_t* encoderP);
+
+extern bool WE_CBOR_IsValid(const WE_CBOR_Encoder_t* encoderP);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CBOR_H_INCLUDED */
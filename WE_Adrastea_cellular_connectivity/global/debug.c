@@ -44,6 +44,7 @@
 
 
 #include "debug.h"
+#include "global.h"
 
 
 
@@ -77,48 +78,76 @@ static uint8_t debugBuffer[WE_DEBUG_BUFFER_SIZE];
  * @brief Current write position in ring buffer used for debug output
  * (next character to be queued).
  */
-static uint16_t debugBufferWritePos = 0;
+static volatile uint16_t debugBufferWritePos = 0;
 
 /**
  * @brief Current read position in ring buffer used for debug output
  * (next character to be transferred).
  */
-static uint16_t debugBufferReadPos = 0;
+static volatile uint16_t debugBufferReadPos = 0;
 
-static bool transferRunning = false;
+/**
+ * @brief Is set to true while a DMA transfer of a ring buffer segment is running.
+ */
+static volatile bool transferRunning = false;
 
+/**
+ * @brief Length of the segment currently being transferred.
+ */
+static uint16_t transferLength = 0;
 
+/**
+ * @brief If true, _write() waits for free space in the ring buffer instead of dropping output
+ * (only outside of interrupt handlers).
+ */
+static bool blockWhenFull = false;
 
-void debug_uart_event_handler(void *callback_arg, cyhal_uart_event_t event)
+/**
+ * @brief Number of bytes dropped because the ring buffer was full.
+ */
+static volatile uint32_t droppedBytes = 0;
+
+/**
+ * @brief Starts the transfer of the next contiguous segment of the ring buffer (if any).
+ *
+ * The segment ends at the write position or at the end of the buffer, whichever comes first,
+ * so a wrapped buffer is transferred in two DMA transfers. Has to be called with interrupts disabled.
+ */
+static void debug_StartTransfer()
 {
-	if (event & CYHAL_UART_IRQ_TX_DONE)
-	{
-		        if (debugBufferReadPos != debugBufferWritePos)
-        {
-            /* Ring buffer read and write positions differ -> transfer is active */
-
-            /* Move to next position in ring buffer */
-            debugBufferReadPos++;
-            if (debugBufferReadPos >= WE_DEBUG_BUFFER_SIZE)
-            {
-                debugBufferReadPos = 0;
-            }
-
-            transferRunning = debugBufferReadPos != debugBufferWritePos;
-            if (transferRunning)
-            {
-				/* More characters to be transferred -> transmit next character */
-                cyhal_uart_putc(&debugUartObj,  debugBuffer[debugBufferReadPos]);
-            }
-        }
-	}
+    if (transferRunning || (debugBufferReadPos == debugBufferWritePos))
+    {
+        return;
+    }
+
+    uint16_t writePos = debugBufferWritePos;
+    transferLength = (writePos > debugBufferReadPos) ? (writePos - debugBufferReadPos) : (WE_DEBUG_BUFFER_SIZE - debugBufferReadPos);
+    transferRunning = true;
+    if (CY_RSLT_SUCCESS != cyhal_uart_write_async(&debugUartObj, debugBuffer + debugBufferReadPos, transferLength))
+    {
+        transferRunning = false;
+    }
+}
 
+void debug_uart_event_handler(void *callback_arg, cyhal_uart_event_t event)
+{
+    if (event & CYHAL_UART_IRQ_TX_DONE)
+    {
+        /* Segment transferred -> release it and continue with the next one */
+        debugBufferReadPos = (debugBufferReadPos + transferLength) % WE_DEBUG_BUFFER_SIZE;
+        transferLength = 0;
+        transferRunning = false;
+        debug_StartTransfer();
+    }
 }
 
 
 /**
  * @brief Initializes UART and connects this interface to WE_DEBUG_PRINT().
  *
+ * Debug output is queued in a ring buffer and transferred by DMA in contiguous segments,
+ * so there is one interrupt per segment instead of one per character.
+ *
  * Note that it is not safe to call WE_DEBUG_PRINT() from different contexts (e.g.
  * inside main and inside ISRs) - there is no guarantee, that the debug output is
  * forwarded correctly in all circumstances.
@@ -143,6 +172,7 @@ void WE_Debug_Init()
 
 	cyhal_uart_init(&debugUartObj, UART_TX_PIN, UART_RX_PIN, NC, NC, NULL, &uart_config);
 	cyhal_uart_set_baud(&debugUartObj, DEBUG_BAUD_RATE, NULL);
+	cyhal_uart_set_async_mode(&debugUartObj, CYHAL_ASYNC_DMA, CYHAL_DMA_PRIORITY_DEFAULT);
 	cyhal_uart_register_callback(&debugUartObj, debug_uart_event_handler, NULL);
 	cyhal_uart_enable_event(&debugUartObj, CYHAL_UART_IRQ_TX_DONE, CYHAL_ISR_PRIORITY_DEFAULT, true);
 
@@ -153,78 +183,108 @@ void WE_Debug_Init()
  */
 void WE_Debug_Flush()
 {
-    while (transferRunning)
+    while (transferRunning || (debugBufferReadPos != debugBufferWritePos))
     {
     }
 }
 
+/**
+ * @brief Selects what happens if debug output doesn't fit into the ring buffer.
+ *
+ * @param[in] block If true, wait until the output has been queued (not applicable in interrupt handlers,
+ * where output is always dropped). If false (default), drop the output that doesn't fit.
+ */
+void WE_Debug_SetBlocking(bool block) { blockWhenFull = block; }
 
+/**
+ * @brief Returns the number of bytes of debug output dropped because the ring buffer was full.
+ */
+uint32_t WE_Debug_GetDroppedBytes() { return droppedBytes; }
 
+/**
+ * @brief Copies as much data as fits into the ring buffer and starts the transfer.
+ *
+ * The data is copied without disabling interrupts: The transfer completion interrupt only advances the
+ * read position, which only increases the free space, and never touches the bytes behind the write
+ * position. The new write position is published and the transfer started in a short critical section.
+ * Requires a single writer (see the lock in _write()).
+ *
+ * @return Number of bytes queued
+ */
+static int32_t debug_Queue(const cy_char8_t* ptr, int32_t len)
+{
+    uint16_t readPos = debugBufferReadPos;
+    uint16_t writePos = debugBufferWritePos;
+
+    /* Remaining space in ring buffer */
+    uint16_t spaceRemaining = readPos > writePos ? readPos - writePos - 1 : WE_DEBUG_BUFFER_SIZE - writePos + readPos - 1;
+
+    if (len > spaceRemaining)
+    {
+        len = spaceRemaining;
+    }
 
+    /* Store data between writePos and end of buffer, then wrap to the start of the buffer */
+    int32_t chunkSize = len;
+    if (chunkSize > WE_DEBUG_BUFFER_SIZE - writePos)
+    {
+        chunkSize = WE_DEBUG_BUFFER_SIZE - writePos;
+    }
+    memcpy(debugBuffer + writePos, ptr, chunkSize);
+    memcpy(debugBuffer, ptr + chunkSize, len - chunkSize);
+
+    uint32_t state = WE_EnterCriticalSection();
+    debugBufferWritePos = (writePos + len) % WE_DEBUG_BUFFER_SIZE;
+    debug_StartTransfer();
+    WE_ExitCriticalSection(state);
+
+    return len;
+}
+
+/**
+ * @brief Writes debug output to the ring buffer (called by the C library for stdout and stderr).
+ *
+ * @return Number of bytes queued, which is less than len if the ring buffer is full. If nothing
+ * could be queued, -1 is returned and the output is counted as dropped.
+ */
 __attribute__((weak)) int32_t _write(int32_t fd, const cy_char8_t* ptr, int32_t len)
 {
     /* Note that it is not safe to call this function from different contexts! */
 
     if (fd == STDOUT_FILENO || fd == STDERR_FILENO)
     {
-        /* Rudimentary check for concurrent access to this function */
+        /* Rudimentary check for concurrent access to this function (test and set in a critical section,
+         * as the flag may be set by an interrupt handler in between) */
         static bool lock = false;
-        if (lock != false)
+        uint32_t state = WE_EnterCriticalSection();
+        bool locked = lock;
+        lock = true;
+        WE_ExitCriticalSection(state);
+        if (locked)
         {
+            droppedBytes += len;
             errno = EIO;
             return -1;
         }
-        lock = true;
-
-        uint16_t readPos = debugBufferReadPos;
-        uint16_t writePos = debugBufferWritePos;
 
-        /* Remaining space in ring buffer */
-        uint16_t spaceRemaining = readPos > writePos ? readPos - writePos - 1 : WE_DEBUG_BUFFER_SIZE - writePos + readPos - 1;
+        /* Blocking is not possible in interrupt handlers, as the DMA completion interrupt might not get served */
+        bool block = blockWhenFull && (__get_IPSR() == 0);
 
-        if (len > spaceRemaining)
+        int32_t bytesWritten = debug_Queue(ptr, len);
+        while (block && (bytesWritten < len))
         {
-            /* Data to be written doesn't fit into ring buffer - limit to spaceRemaining */
-            len = spaceRemaining;
+            bytesWritten += debug_Queue(ptr + bytesWritten, len - bytesWritten);
         }
 
-        /* Store data in ring buffer */
-        int bytesWritten = 0;
-        if (writePos > readPos)
-        {
-            /* Store data between writePos and end of buffer */
-
-            int chunkSize = len;
-            if (chunkSize > WE_DEBUG_BUFFER_SIZE - writePos)
-            {
-                chunkSize = WE_DEBUG_BUFFER_SIZE - writePos;
-            }
-            memcpy(debugBuffer + writePos, ptr, chunkSize);
-            len -= chunkSize;
-            writePos = (writePos + chunkSize) % WE_DEBUG_BUFFER_SIZE;
-            bytesWritten += chunkSize;
-        }
-
-        if (len > 0)
-        {
-            /* Store remaining data between start of buffer and read pos */
-
-            memcpy(debugBuffer + writePos, ptr + bytesWritten, len);
-            writePos = (writePos + len) % WE_DEBUG_BUFFER_SIZE;
-            bytesWritten += len;
-        }
-
-        debugBufferWritePos = writePos;
+        lock = false;
 
-        /* Start transfer if not already running */
-        if (!transferRunning)
+        if ((bytesWritten == 0) && (len > 0))
         {
-            transferRunning = true;
-            cyhal_uart_putc(&debugUartObj,  *(debugBuffer + debugBufferReadPos));
+            droppedBytes += len;
+            errno = EAGAIN;
+            return -1;
         }
 
-        lock = false;
-
         return bytesWritten;
     }
 
@@ -31,6 +31,9 @@
 #ifndef GLOBAL_DEBUG_H_INCLUDED
 #define GLOBAL_DEBUG_H_INCLUDED
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #define WE_DEBUG 1
 #define WE_DEBUG_INTI 1
 #if defined(WE_DEBUG) || defined(WE_DEBUG_INIT)
@@ -42,6 +45,8 @@ extern "C"
 
     void WE_Debug_Init();
     void WE_Debug_Flush();
+    void WE_Debug_SetBlocking(bool block);
+    uint32_t WE_Debug_GetDroppedBytes();
 
 #ifdef __cplusplus
 }
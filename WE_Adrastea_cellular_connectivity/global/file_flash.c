@@ -0,0 +1,222 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief File-backed flash for running flash based modules on a host (enabled by defining WE_FILE_FLASH).
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "file_flash.h"
+
+#ifdef WE_FILE_FLASH
+
+static FILE* WE_FileFlash_file = NULL;
+static uint32_t WE_FileFlash_size = 0;
+static uint32_t WE_FileFlash_sectorSize = 0;
+static WE_FileFlash_Statistics_t WE_FileFlash_statistics;
+
+static bool WE_FileFlash_Init()
+{
+    return WE_FileFlash_file != NULL;
+}
+
+static bool WE_FileFlash_Read(uint32_t address, uint8_t* data, uint32_t length)
+{
+    if ((WE_FileFlash_file == NULL) || (data == NULL) || (address > WE_FileFlash_size) || (length > WE_FileFlash_size - address))
+    {
+        return false;
+    }
+
+    WE_FileFlash_statistics.reads++;
+    WE_FileFlash_statistics.readBytes += length;
+
+    return (0 == fseek(WE_FileFlash_file, (long)address, SEEK_SET)) && (length == fread(data, 1, length, WE_FileFlash_file));
+}
+
+static bool WE_FileFlash_Program(uint32_t address, const uint8_t* data, uint32_t length)
+{
+    uint8_t block[256];
+
+    if ((WE_FileFlash_file == NULL) || (data == NULL) || (address > WE_FileFlash_size) || (length > WE_FileFlash_size - address))
+    {
+        return false;
+    }
+
+    WE_FileFlash_statistics.programs++;
+    WE_FileFlash_statistics.programBytes += length;
+
+    bool violation = false;
+    while (length > 0)
+    {
+        uint32_t blockLength = (length > sizeof(block)) ? sizeof(block) : length;
+
+        if ((0 != fseek(WE_FileFlash_file, (long)address, SEEK_SET)) || (blockLength != fread(block, 1, blockLength, WE_FileFlash_file)))
+        {
+            return false;
+        }
+
+        /* Programming can only clear bits */
+        for (uint32_t i = 0; i < blockLength; i++)
+        {
+            if (block[i] != 0xFF)
+            {
+                violation = true;
+            }
+            block[i] &= data[i];
+        }
+
+        if ((0 != fseek(WE_FileFlash_file, (long)address, SEEK_SET)) || (blockLength != fwrite(block, 1, blockLength, WE_FileFlash_file)))
+        {
+            return false;
+        }
+
+        address += blockLength;
+        data += blockLength;
+        length -= blockLength;
+    }
+
+    if (violation)
+    {
+        WE_FileFlash_statistics.programViolations++;
+    }
+
+    return 0 == fflush(WE_FileFlash_file);
+}
+
+static bool WE_FileFlash_EraseSector(uint32_t address)
+{
+    uint8_t block[256];
+
+    if ((WE_FileFlash_file == NULL) || (address % WE_FileFlash_sectorSize != 0) || (address >= WE_FileFlash_size))
+    {
+        return false;
+    }
+
+    WE_FileFlash_statistics.erases++;
+
+    memset(block, 0xFF, sizeof(block));
+    if (0 != fseek(WE_FileFlash_file, (long)address, SEEK_SET))
+    {
+        return false;
+    }
+
+    for (uint32_t written = 0; written < WE_FileFlash_sectorSize; written += sizeof(block))
+    {
+        uint32_t blockLength = (WE_FileFlash_sectorSize - written > sizeof(block)) ? sizeof(block) : WE_FileFlash_sectorSize - written;
+        if (blockLength != fwrite(block, 1, blockLength, WE_FileFlash_file))
+        {
+            return false;
+        }
+    }
+
+    return 0 == fflush(WE_FileFlash_file);
+}
+
+/**
+ * @brief Opens the file-backed flash.
+ *
+ * An existing file is reused (i.e. its content survives like flash content survives a reset), a new file is
+ * created in erased state.
+ *
+ * @param[in] path Path of the file
+ * @param[in] size Flash size in bytes (multiple of the sector size)
+ * @param[in] sectorSize Sector size in bytes
+ * @param[in] writeAlignment Smallest unit that may be programmed only once after erasing
+ * @param[out] flashP Flash functions and geometry for use by flash based modules
+ *
+ * @return true if successful, false otherwise
+ */
+bool WE_FileFlash_Open(const char* path, uint32_t size, uint32_t sectorSize, uint32_t writeAlignment, WE_Flash_t* flashP)
+{
+    if ((path == NULL) || (flashP == NULL) || (sectorSize == 0) || (size == 0) || (size % sectorSize != 0))
+    {
+        return false;
+    }
+
+    WE_FileFlash_Close();
+
+    WE_FileFlash_size = size;
+    WE_FileFlash_sectorSize = sectorSize;
+    memset(&WE_FileFlash_statistics, 0, sizeof(WE_FileFlash_statistics));
+
+    WE_FileFlash_file = fopen(path, "r+b");
+    if (WE_FileFlash_file == NULL)
+    {
+        WE_FileFlash_file = fopen(path, "w+b");
+        if (WE_FileFlash_file == NULL)
+        {
+            return false;
+        }
+
+        for (uint32_t address = 0; address < size; address += sectorSize)
+        {
+            if (!WE_FileFlash_EraseSector(address))
+            {
+                WE_FileFlash_Close();
+                return false;
+            }
+        }
+        WE_FileFlash_statistics.erases = 0;
+    }
+
+    flashP->flashInit = WE_FileFlash_Init;
+    flashP->flashRead = WE_FileFlash_Read;
+    flashP->flashProgram = WE_FileFlash_Program;
+    flashP->flashEraseSector = WE_FileFlash_EraseSector;
+    flashP->sectorSize = sectorSize;
+    flashP->writeAlignment = writeAlignment;
+
+    return true;
+}
+
+/**
+ * @brief Closes the file-backed flash.
+ */
+void WE_FileFlash_Close()
+{
+    if (WE_FileFlash_file != NULL)
+    {
+        fclose(WE_FileFlash_file);
+        WE_FileFlash_file = NULL;
+    }
+}
+
+/**
+ * @brief Returns the number of flash operations since opening the flash.
+ *
+ * @param[out] statisticsP Statistics
+ */
+void WE_FileFlash_GetStatistics(WE_FileFlash_Statistics_t* statisticsP)
+{
+    if (statisticsP != NULL)
+    {
+        *statisticsP = WE_FileFlash_statistics;
+    }
+}
+
+#endif /* WE_FILE_FLASH */
@@ -0,0 +1,72 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief File-backed flash for running flash based modules on a host (enabled by defining WE_FILE_FLASH).
+ *
+ * The flash content is stored in a file. Erasing sets a sector to 0xFF and programming clears bits only,
+ * like NOR flash. Programming memory that has not been erased is counted as violation, so the usage of the
+ * flash by a module can be checked on the host.
+ */
+
+#ifndef FILE_FLASH_H_INCLUDED
+#define FILE_FLASH_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "global_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief File-backed flash statistics.
+ * @see WE_FileFlash_GetStatistics()
+ */
+typedef struct WE_FileFlash_Statistics_t
+{
+    uint32_t reads;              /**< Number of read operations */
+    uint32_t readBytes;          /**< Number of bytes read */
+    uint32_t programs;           /**< Number of program operations */
+    uint32_t programBytes;       /**< Number of bytes programmed */
+    uint32_t erases;             /**< Number of erased sectors */
+    uint32_t programViolations;  /**< Program operations to memory that had not been erased */
+} WE_FileFlash_Statistics_t;
+
+extern bool WE_FileFlash_Open(const char* path, uint32_t size, uint32_t sectorSize, uint32_t writeAlignment, WE_Flash_t* flashP);
+
+extern void WE_FileFlash_Close();
+
+extern void WE_FileFlash_GetStatistics(WE_FileFlash_Statistics_t* statisticsP);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FILE_FLASH_H_INCLUDED */
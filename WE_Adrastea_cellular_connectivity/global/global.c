@@ -33,6 +33,7 @@
 #include "cyhal.h"
 #include "cybsp.h"
 #include "cyhal_uart.h"
+#include "cycfg_qspi_memslot.h"
 #include "global_types.h"
 
 
@@ -48,10 +49,14 @@ extern "C"
 
 #define TEMP_RX_SIZE 1
 
+#define QSPI_BUS_FREQUENCY_HZ 50000000lu
+
 
 cyhal_uart_t uart_obj;
 uint8_t temp_rx[TEMP_RX_SIZE];
 
+cyhal_qspi_t qspi_obj;
+
 volatile uint32_t ms_ticks = 0;
 volatile bool rx_done = false;
 volatile bool tx_done = false;
@@ -246,9 +251,38 @@ uint32_t WE_GetTick() { return ms_ticks; }
  */
 uint32_t WE_GetTickMicroseconds()
 {
+#ifdef WE_MICROSECOND_TICK
+    /* Interpolate between ms ticks using the SysTick down counter. Re-read if a tick occurred in between. */
+    uint32_t ticks, value;
+    do
+    {
+        ticks = ms_ticks;
+        value = Cy_SysTick_GetValue();
+    } while (ticks != ms_ticks);
+
+    uint32_t reload = Cy_SysTick_GetReload();
+    return ticks * 1000 + ((reload - value) * 1000) / (reload + 1);
+#else
     /* Microsecond tick is disabled: return ms tick * 1000 */
     return ms_ticks * 1000;
+#endif
 }
+
+    /**
+ * @brief Disables interrupts
+ *
+ * @return returns the previous interrupt state
+ *
+ */
+uint32_t WE_EnterCriticalSection(void) { return cyhal_system_critical_section_enter(); }
+
+    /**
+ * @brief Restores the interrupt state
+ *
+ * @param[in] state: interrupt state returned by WE_EnterCriticalSection()
+ *
+ */
+void WE_ExitCriticalSection(uint32_t state) { cyhal_system_critical_section_exit(state); }
     /**
  * @brief Gets the Driver version
  *
@@ -386,6 +420,71 @@ bool WE_UART1_Transmit(const uint8_t *data, uint16_t length)
 	}
 	return true;
 }
+
+/**
+ * @brief Initialize the external QSPI flash (configuration generated by the QSPI Configurator).
+ */
+bool WE_QSPIFlash_Init()
+{
+	cyhal_qspi_slave_pin_config_t memory_pin_set = {
+		.io = { CYBSP_QSPI_D0, CYBSP_QSPI_D1, CYBSP_QSPI_D2, CYBSP_QSPI_D3, NC, NC, NC, NC },
+		.ssel = CYBSP_QSPI_SS
+	};
+
+	if (CY_RSLT_SUCCESS != cyhal_qspi_init(&qspi_obj, CYBSP_QSPI_SCK, &memory_pin_set, QSPI_BUS_FREQUENCY_HZ, 0, NULL))
+	{
+		return false;
+	}
+
+	if (CY_SMIF_SUCCESS != Cy_SMIF_MemInit(qspi_obj.base, &smifBlockConfig, &qspi_obj.context))
+	{
+		cyhal_qspi_free(&qspi_obj);
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Read data from the external QSPI flash.
+ *
+ * @param[in] address Flash address
+ * @param[out] data Pointer to data buffer
+ * @param[in] length Number of bytes to read
+ */
+bool WE_QSPIFlash_Read(uint32_t address, uint8_t *data, uint32_t length)
+{
+	if (data == NULL)
+		return false;
+
+	return CY_SMIF_SUCCESS == Cy_SMIF_MemRead(qspi_obj.base, smifMemConfigs[0], address, data, length, &qspi_obj.context);
+}
+
+/**
+ * @brief Program data to erased memory of the external QSPI flash.
+ *
+ * @param[in] address Flash address
+ * @param[in] data Pointer to data to program
+ * @param[in] length Number of bytes to program
+ */
+bool WE_QSPIFlash_Program(uint32_t address, const uint8_t *data, uint32_t length)
+{
+	if (data == NULL)
+		return false;
+
+	/* Cy_SMIF_MemWrite() splits the data into program pages and waits until each page has been programmed */
+	return CY_SMIF_SUCCESS == Cy_SMIF_MemWrite(qspi_obj.base, smifMemConfigs[0], address, data, length, &qspi_obj.context);
+}
+
+/**
+ * @brief Erase one sector of the external QSPI flash.
+ *
+ * @param[in] address Start address of the sector
+ */
+bool WE_QSPIFlash_EraseSector(uint32_t address)
+{
+	return CY_SMIF_SUCCESS == Cy_SMIF_MemEraseSector(qspi_obj.base, smifMemConfigs[0], address, WE_QSPI_FLASH_SECTOR_SIZE, &qspi_obj.context);
+}
 #ifdef __cplusplus
 }
 #endif
@@ -176,6 +176,20 @@ extern "C"
  * @return Current tick value (in microseconds)
  */
     extern uint32_t WE_GetTickMicroseconds();
+
+    /**
+ * @brief Disables interrupts to protect data shared with interrupt handlers.
+ *
+ * @return Interrupt state to be passed to WE_ExitCriticalSection()
+ */
+    extern uint32_t WE_EnterCriticalSection(void);
+
+    /**
+ * @brief Restores the interrupt state saved by WE_EnterCriticalSection().
+ *
+ * @param[in] state Interrupt state returned by WE_EnterCriticalSection()
+ */
+    extern void WE_ExitCriticalSection(uint32_t state);
 /**
  * @brief Initialize and start the UART.
  *
@@ -199,6 +213,51 @@ extern bool WE_UART1_DeInit();
  */
 extern bool WE_UART1_Transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * @brief Sector size of the uniform sector region of the external QSPI flash (bytes).
+ */
+#define WE_QSPI_FLASH_SECTOR_SIZE 0x40000
+
+/**
+ * @brief Start address of the uniform sector region of the external QSPI flash.
+ */
+#define WE_QSPI_FLASH_UNIFORM_REGION_ADDRESS 0x40000
+
+/**
+ * @brief Smallest unit of the external QSPI flash that may be programmed only once after erasing (ECC unit).
+ */
+#define WE_QSPI_FLASH_WRITE_ALIGNMENT 16
+
+/**
+ * @brief Initialize the external QSPI flash (configuration generated by the QSPI Configurator).
+ */
+extern bool WE_QSPIFlash_Init();
+
+/**
+ * @brief Read data from the external QSPI flash.
+ *
+ * @param[in] address Flash address
+ * @param[out] data Pointer to data buffer
+ * @param[in] length Number of bytes to read
+ */
+extern bool WE_QSPIFlash_Read(uint32_t address, uint8_t *data, uint32_t length);
+
+/**
+ * @brief Program data to erased memory of the external QSPI flash.
+ *
+ * @param[in] address Flash address
+ * @param[in] data Pointer to data to program
+ * @param[in] length Number of bytes to program
+ */
+extern bool WE_QSPIFlash_Program(uint32_t address, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Erase one sector of the external QSPI flash.
+ *
+ * @param[in] address Start address of the sector
+ */
+extern bool WE_QSPIFlash_EraseSector(uint32_t address);
+
 #ifdef __cplusplus
 }
 #endif
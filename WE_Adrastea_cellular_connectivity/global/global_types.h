@@ -134,4 +134,39 @@ typedef struct WE_UART_t
     WE_Parity_t parity;
 } WE_UART_t;
 
+/**
+ * @brief Flash Init.
+ */
+typedef bool (*WE_Flash_Init_t)();
+
+/**
+ * @brief Read data from flash.
+ * Arguments: address, pointer to the data buffer, number of bytes to read
+ */
+typedef bool (*WE_Flash_Read_t)(uint32_t, uint8_t*, uint32_t);
+
+/**
+ * @brief Program data to (erased) flash.
+ * Arguments: address, pointer to the data, number of bytes to program
+ */
+typedef bool (*WE_Flash_Program_t)(uint32_t, const uint8_t*, uint32_t);
+
+/**
+ * @brief Erase the flash sector starting at the supplied address.
+ */
+typedef bool (*WE_Flash_EraseSector_t)(uint32_t);
+
+/**
+ * @brief Used to store pointers to flash functions and the flash geometry.
+ */
+typedef struct WE_Flash_t
+{
+    WE_Flash_Init_t flashInit;
+    WE_Flash_Read_t flashRead;
+    WE_Flash_Program_t flashProgram;
+    WE_Flash_EraseSector_t flashEraseSector;
+    uint32_t sectorSize;     /**< Size of an erase sector in bytes */
+    uint32_t writeAlignment; /**< Smallest unit that may be programmed only once after erasing (e.g. ECC unit) */
+} WE_Flash_t;
+
 #endif /* GLOBAL_TYPES_H_INCLUDED */
@@ -0,0 +1,67 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Binary logging with deferred formatting (enabled by defining WE_LOG, requires WE_TRACE).
+ */
+
+#include "log.h"
+
+#ifdef WE_LOG
+
+/**
+ * @brief Writes a log record to the trace buffer. Is called by the log macros only.
+ *
+ * The record payload is the address of the format string entry followed by the arguments,
+ * all as little endian uint32_t.
+ *
+ * @param[in] entry Format string entry in section .we_log_strings
+ * @param[in] arguments Argument values
+ * @param[in] argumentCount Number of arguments
+ */
+void WE_Log_Write(const char* entry, const uint32_t* arguments, uint8_t argumentCount)
+{
+    uint8_t payload[sizeof(uint32_t) * (1 + WE_LOG_MAX_ARGUMENTS)];
+    uint32_t value = (uint32_t)(uintptr_t)entry;
+    uint16_t length = 0;
+
+    for (uint8_t i = 0;; i++)
+    {
+        payload[length++] = (uint8_t)value;
+        payload[length++] = (uint8_t)(value >> 8);
+        payload[length++] = (uint8_t)(value >> 16);
+        payload[length++] = (uint8_t)(value >> 24);
+        if (i == argumentCount)
+        {
+            break;
+        }
+        value = arguments[i];
+    }
+
+    WE_Trace_Record(WE_Trace_Record_Type_Log, payload, length);
+}
+
+#endif /* WE_LOG */
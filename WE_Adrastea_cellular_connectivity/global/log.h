@@ -0,0 +1,193 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Binary logging with deferred formatting (enabled by defining WE_LOG, requires WE_TRACE).
+ *
+ * Log statements are filtered at compile time per module and level. Each log statement places its
+ * format string in the section ".we_log_strings", at runtime only the address of the format string and
+ * the raw argument values are written to the trace buffer (record type WE_Trace_Record_Type_Log).
+ * tools/trace_decode.py formats the records on the host using the string table from the ELF file.
+ *
+ * Adding the following output section to the GCC linker script keeps the format strings out of flash:
+ * @code
+ * .we_log_strings 0 (INFO) : { KEEP(*(.we_log_strings)) }
+ * @endcode
+ * The IAR and ARM linker scripts of the BSP place the section outside the device memory instead, as these linkers
+ * have no equivalent of a non-loaded section. That address range has to be left out of the programmed image.
+ *
+ * Usage:
+ * @code
+ * WE_LOG_DEBUG(ATSocket, "socket %u: %u bytes received", socketID, length);
+ * @endcode
+ *
+ * Restrictions:
+ * - At most WE_LOG_MAX_ARGUMENTS arguments.
+ * - Every argument is stored as 32 bit value, so 64 bit integers and floating point values are not supported.
+ * - %s arguments are decoded only if they point to constant strings contained in the ELF file.
+ *
+ * The level of a module is set by defining WE_LOG_LEVEL_<module> (e.g. WE_LOG_LEVEL_ATSocket=4),
+ * modules without explicit level use WE_LOG_LEVEL_DEFAULT. Modules of the application have to define
+ * WE_LOG_LEVEL_<module> themselves.
+ */
+
+#ifndef GLOBAL_LOG_H_INCLUDED
+#define GLOBAL_LOG_H_INCLUDED
+
+#include <stdint.h>
+
+#include "trace.h"
+
+#define WE_LOG_LEVEL_NONE 0
+#define WE_LOG_LEVEL_ERROR 1
+#define WE_LOG_LEVEL_WARNING 2
+#define WE_LOG_LEVEL_INFO 3
+#define WE_LOG_LEVEL_DEBUG 4
+
+#ifndef WE_LOG_LEVEL_DEFAULT
+/**
+ * @brief Level of modules for which no WE_LOG_LEVEL_<module> is defined.
+ */
+#define WE_LOG_LEVEL_DEFAULT WE_LOG_LEVEL_WARNING
+#endif
+
+#ifndef WE_LOG_LEVEL_AdrasteaI
+#define WE_LOG_LEVEL_AdrasteaI WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_ATCommands
+#define WE_LOG_LEVEL_ATCommands WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_ATDevice
+#define WE_LOG_LEVEL_ATDevice WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_ATGNSS
+#define WE_LOG_LEVEL_ATGNSS WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_ATHTTP
+#define WE_LOG_LEVEL_ATHTTP WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_ATMQTT
+#define WE_LOG_LEVEL_ATMQTT WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_ATNetService
+#define WE_LOG_LEVEL_ATNetService WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_ATPacketDomain
+#define WE_LOG_LEVEL_ATPacketDomain WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_ATPower
+#define WE_LOG_LEVEL_ATPower WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_ATSIM
+#define WE_LOG_LEVEL_ATSIM WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_ATSMS
+#define WE_LOG_LEVEL_ATSMS WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_ATSocket
+#define WE_LOG_LEVEL_ATSocket WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_SSLSessionCache
+#define WE_LOG_LEVEL_SSLSessionCache WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_SocketTuner
+#define WE_LOG_LEVEL_SocketTuner WE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef WE_LOG_LEVEL_UDPBatch
+#define WE_LOG_LEVEL_UDPBatch WE_LOG_LEVEL_DEFAULT
+#endif
+
+/**
+ * @brief Maximum number of arguments of a log statement.
+ */
+#define WE_LOG_MAX_ARGUMENTS 6
+
+#ifdef WE_LOG
+
+#ifndef WE_TRACE
+#error "WE_LOG requires WE_TRACE"
+#endif
+
+#define WE_LOG_STRINGIFY_(X) #X
+#define WE_LOG_STRINGIFY(X) WE_LOG_STRINGIFY_(X)
+#define WE_LOG_CONCAT_(A, B) A##B
+#define WE_LOG_CONCAT(A, B) WE_LOG_CONCAT_(A, B)
+
+#define WE_LOG_COUNT_(_0, _1, _2, _3, _4, _5, _6, N, ...) N
+#define WE_LOG_COUNT(...) WE_LOG_COUNT_(_, ##__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0)
+
+#define WE_LOG_ARGUMENT(X) , (uint32_t)(uintptr_t)(X)
+#define WE_LOG_MAP_0(F)
+#define WE_LOG_MAP_1(F, A) F(A)
+#define WE_LOG_MAP_2(F, A, ...) F(A) WE_LOG_MAP_1(F, __VA_ARGS__)
+#define WE_LOG_MAP_3(F, A, ...) F(A) WE_LOG_MAP_2(F, __VA_ARGS__)
+#define WE_LOG_MAP_4(F, A, ...) F(A) WE_LOG_MAP_3(F, __VA_ARGS__)
+#define WE_LOG_MAP_5(F, A, ...) F(A) WE_LOG_MAP_4(F, __VA_ARGS__)
+#define WE_LOG_MAP_6(F, A, ...) F(A) WE_LOG_MAP_5(F, __VA_ARGS__)
+#define WE_LOG_MAP(F, ...) WE_LOG_CONCAT(WE_LOG_MAP_, WE_LOG_COUNT(__VA_ARGS__))(F, ##__VA_ARGS__)
+
+/**
+ * @brief Format string entry: level, module, source location and format, separated by 0x1F.
+ */
+#define WE_LOG_ENTRY(MODULE, LEVEL, FORMAT) WE_LOG_STRINGIFY(LEVEL) "\x1f" #MODULE "\x1f" __FILE__ ":" WE_LOG_STRINGIFY(__LINE__) "\x1f" FORMAT
+
+#define WE_LOG_WRITE(MODULE, LEVEL, FORMAT, ...)                                                                                                                                                                                                                                                                                                                                                               \
+    do                                                                                                                                                                                                                                                                                                                                                                                                         \
+    {                                                                                                                                                                                                                                                                                                                                                                                                          \
+        if (WE_LOG_LEVEL_##MODULE >= (LEVEL))                                                                                                                                                                                                                                                                                                                                                                  \
+        {                                                                                                                                                                                                                                                                                                                                                                                                      \
+            static const char WE_Log_entry[] __attribute__((section(".we_log_strings"))) = WE_LOG_ENTRY(MODULE, LEVEL, FORMAT);                                                                                                                                                                                                                                                                                \
+            const uint32_t WE_Log_arguments[] = {0 WE_LOG_MAP(WE_LOG_ARGUMENT, ##__VA_ARGS__)};                                                                                                                                                                                                                                                                                                                \
+            WE_Log_Write(WE_Log_entry, &WE_Log_arguments[1], WE_LOG_COUNT(__VA_ARGS__));                                                                                                                                                                                                                                                                                                                       \
+        }                                                                                                                                                                                                                                                                                                                                                                                                      \
+    } while (0)
+
+#else /* WE_LOG */
+
+#define WE_LOG_WRITE(MODULE, LEVEL, FORMAT, ...)                                                                                                                                                                                                                                                                                                                                                               \
+    do                                                                                                                                                                                                                                                                                                                                                                                                         \
+    {                                                                                                                                                                                                                                                                                                                                                                                                          \
+    } while (0)
+
+#endif /* WE_LOG */
+
+#define WE_LOG_ERROR(MODULE, ...) WE_LOG_WRITE(MODULE, WE_LOG_LEVEL_ERROR, __VA_ARGS__)
+#define WE_LOG_WARNING(MODULE, ...) WE_LOG_WRITE(MODULE, WE_LOG_LEVEL_WARNING, __VA_ARGS__)
+#define WE_LOG_INFO(MODULE, ...) WE_LOG_WRITE(MODULE, WE_LOG_LEVEL_INFO, __VA_ARGS__)
+#define WE_LOG_DEBUG(MODULE, ...) WE_LOG_WRITE(MODULE, WE_LOG_LEVEL_DEBUG, __VA_ARGS__)
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    extern void WE_Log_Write(const char* entry, const uint32_t* arguments, uint8_t argumentCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLOBAL_LOG_H_INCLUDED */
@@ -0,0 +1,267 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Operating system abstraction (mutex, semaphore) used by the drivers.
+ */
+
+#include "os.h"
+#include "global.h"
+
+#if defined(WE_OS_FREERTOS)
+
+static TickType_t WE_OS_ToTicks(uint32_t timeoutMs)
+{
+    return (timeoutMs == WE_OS_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+}
+
+bool WE_OS_MutexInit(WE_OS_Mutex_t* mutexP)
+{
+    mutexP->handle = xSemaphoreCreateRecursiveMutex();
+    return mutexP->handle != NULL;
+}
+
+bool WE_OS_MutexLock(WE_OS_Mutex_t* mutexP, uint32_t timeoutMs) { return xSemaphoreTakeRecursive(mutexP->handle, WE_OS_ToTicks(timeoutMs)) == pdTRUE; }
+
+bool WE_OS_MutexUnlock(WE_OS_Mutex_t* mutexP) { return xSemaphoreGiveRecursive(mutexP->handle) == pdTRUE; }
+
+void WE_OS_MutexDeinit(WE_OS_Mutex_t* mutexP)
+{
+    vSemaphoreDelete(mutexP->handle);
+    mutexP->handle = NULL;
+}
+
+bool WE_OS_SemaphoreInit(WE_OS_Semaphore_t* semaphoreP, uint32_t initialCount, uint32_t maxCount)
+{
+    semaphoreP->handle = xSemaphoreCreateCounting(maxCount, initialCount);
+    return semaphoreP->handle != NULL;
+}
+
+bool WE_OS_SemaphoreTake(WE_OS_Semaphore_t* semaphoreP, uint32_t timeoutMs) { return xSemaphoreTake(semaphoreP->handle, WE_OS_ToTicks(timeoutMs)) == pdTRUE; }
+
+bool WE_OS_SemaphoreGive(WE_OS_Semaphore_t* semaphoreP)
+{
+    if (xPortIsInsideInterrupt())
+    {
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+        bool ret = xSemaphoreGiveFromISR(semaphoreP->handle, &higherPriorityTaskWoken) == pdTRUE;
+        portYIELD_FROM_ISR(higherPriorityTaskWoken);
+        return ret;
+    }
+    return xSemaphoreGive(semaphoreP->handle) == pdTRUE;
+}
+
+void WE_OS_SemaphoreDeinit(WE_OS_Semaphore_t* semaphoreP)
+{
+    vSemaphoreDelete(semaphoreP->handle);
+    semaphoreP->handle = NULL;
+}
+
+#elif defined(WE_OS_POSIX)
+
+#include <errno.h>
+#include <time.h>
+
+/**
+ * @brief Converts a relative timeout to the absolute CLOCK_REALTIME deadline expected by the pthread timed functions.
+ */
+static void WE_OS_GetDeadline(uint32_t timeoutMs, struct timespec* deadlineP)
+{
+    clock_gettime(CLOCK_REALTIME, deadlineP);
+    deadlineP->tv_sec += timeoutMs / 1000;
+    deadlineP->tv_nsec += (long)(timeoutMs % 1000) * 1000000L;
+    if (deadlineP->tv_nsec >= 1000000000L)
+    {
+        deadlineP->tv_sec++;
+        deadlineP->tv_nsec -= 1000000000L;
+    }
+}
+
+/**
+ * @brief Waits on a condition variable, the mutex has to be locked by the caller.
+ *
+ * @return false on timeout
+ */
+static bool WE_OS_CondWait(pthread_cond_t* condP, pthread_mutex_t* mutexP, const struct timespec* deadlineP, uint32_t timeoutMs)
+{
+    if (timeoutMs == WE_OS_WAIT_FOREVER)
+    {
+        return pthread_cond_wait(condP, mutexP) == 0;
+    }
+    return pthread_cond_timedwait(condP, mutexP, deadlineP) != ETIMEDOUT;
+}
+
+bool WE_OS_MutexInit(WE_OS_Mutex_t* mutexP)
+{
+    pthread_mutexattr_t attr;
+    if (pthread_mutexattr_init(&attr) != 0)
+    {
+        return false;
+    }
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    bool ret = pthread_mutex_init(&mutexP->mutex, &attr) == 0;
+    pthread_mutexattr_destroy(&attr);
+    return ret;
+}
+
+bool WE_OS_MutexLock(WE_OS_Mutex_t* mutexP, uint32_t timeoutMs)
+{
+    if (timeoutMs == WE_OS_WAIT_FOREVER)
+    {
+        return pthread_mutex_lock(&mutexP->mutex) == 0;
+    }
+    if (timeoutMs == WE_OS_NO_WAIT)
+    {
+        return pthread_mutex_trylock(&mutexP->mutex) == 0;
+    }
+    struct timespec deadline;
+    WE_OS_GetDeadline(timeoutMs, &deadline);
+    return pthread_mutex_timedlock(&mutexP->mutex, &deadline) == 0;
+}
+
+bool WE_OS_MutexUnlock(WE_OS_Mutex_t* mutexP) { return pthread_mutex_unlock(&mutexP->mutex) == 0; }
+
+void WE_OS_MutexDeinit(WE_OS_Mutex_t* mutexP) { pthread_mutex_destroy(&mutexP->mutex); }
+
+bool WE_OS_SemaphoreInit(WE_OS_Semaphore_t* semaphoreP, uint32_t initialCount, uint32_t maxCount)
+{
+    semaphoreP->count = initialCount;
+    semaphoreP->maxCount = maxCount;
+    if (pthread_mutex_init(&semaphoreP->mutex, NULL) != 0)
+    {
+        return false;
+    }
+    if (pthread_cond_init(&semaphoreP->cond, NULL) != 0)
+    {
+        pthread_mutex_destroy(&semaphoreP->mutex);
+        return false;
+    }
+    return true;
+}
+
+bool WE_OS_SemaphoreTake(WE_OS_Semaphore_t* semaphoreP, uint32_t timeoutMs)
+{
+    struct timespec deadline;
+    WE_OS_GetDeadline(timeoutMs, &deadline);
+
+    pthread_mutex_lock(&semaphoreP->mutex);
+    while (semaphoreP->count == 0)
+    {
+        if ((timeoutMs == WE_OS_NO_WAIT) || !WE_OS_CondWait(&semaphoreP->cond, &semaphoreP->mutex, &deadline, timeoutMs))
+        {
+            pthread_mutex_unlock(&semaphoreP->mutex);
+            return false;
+        }
+    }
+    semaphoreP->count--;
+    pthread_mutex_unlock(&semaphoreP->mutex);
+    return true;
+}
+
+bool WE_OS_SemaphoreGive(WE_OS_Semaphore_t* semaphoreP)
+{
+    bool ret = false;
+    pthread_mutex_lock(&semaphoreP->mutex);
+    if (semaphoreP->count < semaphoreP->maxCount)
+    {
+        semaphoreP->count++;
+        pthread_cond_signal(&semaphoreP->cond);
+        ret = true;
+    }
+    pthread_mutex_unlock(&semaphoreP->mutex);
+    return ret;
+}
+
+void WE_OS_SemaphoreDeinit(WE_OS_Semaphore_t* semaphoreP)
+{
+    pthread_cond_destroy(&semaphoreP->cond);
+    pthread_mutex_destroy(&semaphoreP->mutex);
+}
+
+#else /* bare metal */
+
+bool WE_OS_MutexInit(WE_OS_Mutex_t* mutexP) { return mutexP != NULL; }
+
+bool WE_OS_MutexLock(WE_OS_Mutex_t* mutexP, uint32_t timeoutMs)
+{
+    UNUSED(mutexP);
+    UNUSED(timeoutMs);
+    return true;
+}
+
+bool WE_OS_MutexUnlock(WE_OS_Mutex_t* mutexP)
+{
+    UNUSED(mutexP);
+    return true;
+}
+
+void WE_OS_MutexDeinit(WE_OS_Mutex_t* mutexP) { UNUSED(mutexP); }
+
+bool WE_OS_SemaphoreInit(WE_OS_Semaphore_t* semaphoreP, uint32_t initialCount, uint32_t maxCount)
+{
+    semaphoreP->count = initialCount;
+    semaphoreP->maxCount = maxCount;
+    return true;
+}
+
+bool WE_OS_SemaphoreTake(WE_OS_Semaphore_t* semaphoreP, uint32_t timeoutMs)
+{
+    /* Without a scheduler, the semaphore can only be given from an interrupt while waiting here */
+    uint32_t t0 = WE_GetTick();
+    while (true)
+    {
+        uint32_t state = WE_EnterCriticalSection();
+        if (semaphoreP->count > 0)
+        {
+            semaphoreP->count--;
+            WE_ExitCriticalSection(state);
+            return true;
+        }
+        WE_ExitCriticalSection(state);
+
+        if ((timeoutMs != WE_OS_WAIT_FOREVER) && ((WE_GetTick() - t0) >= timeoutMs))
+        {
+            return false;
+        }
+    }
+}
+
+bool WE_OS_SemaphoreGive(WE_OS_Semaphore_t* semaphoreP)
+{
+    bool ret = false;
+    uint32_t state = WE_EnterCriticalSection();
+    if (semaphoreP->count < semaphoreP->maxCount)
+    {
+        semaphoreP->count++;
+        ret = true;
+    }
+    WE_ExitCriticalSection(state);
+    return ret;
+}
+
+void WE_OS_SemaphoreDeinit(WE_OS_Semaphore_t* semaphoreP) { UNUSED(semaphoreP); }
+
+#endif
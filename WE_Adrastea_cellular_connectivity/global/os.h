@@ -0,0 +1,169 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Operating system abstraction (mutex, semaphore) used by the drivers.
+ *
+ * The backend is selected at compile time:
+ * - WE_OS_FREERTOS: FreeRTOS (requires configUSE_RECURSIVE_MUTEXES and configUSE_COUNTING_SEMAPHORES)
+ * - WE_OS_POSIX: POSIX threads (e.g. for running the drivers on a host)
+ * - none of the above: bare metal, where mutexes always succeed and taking a semaphore busy-waits
+ *   until it is given from an interrupt
+ */
+
+#ifndef GLOBAL_OS_H_INCLUDED
+#define GLOBAL_OS_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(WE_OS_FREERTOS)
+#include "FreeRTOS.h"
+#include "semphr.h"
+#elif defined(WE_OS_POSIX)
+#include <pthread.h>
+#endif
+
+/**
+ * @brief Timeout value to wait without time limit.
+ */
+#define WE_OS_WAIT_FOREVER UINT32_MAX
+
+/**
+ * @brief Timeout value to return immediately.
+ */
+#define WE_OS_NO_WAIT (uint32_t)0
+
+#if defined(WE_OS_FREERTOS)
+
+typedef struct WE_OS_Mutex_t
+{
+    SemaphoreHandle_t handle;
+} WE_OS_Mutex_t;
+
+typedef struct WE_OS_Semaphore_t
+{
+    SemaphoreHandle_t handle;
+} WE_OS_Semaphore_t;
+
+#elif defined(WE_OS_POSIX)
+
+typedef struct WE_OS_Mutex_t
+{
+    pthread_mutex_t mutex;
+} WE_OS_Mutex_t;
+
+typedef struct WE_OS_Semaphore_t
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    uint32_t count;
+    uint32_t maxCount;
+} WE_OS_Semaphore_t;
+
+#else
+
+typedef struct WE_OS_Mutex_t
+{
+    uint8_t unused;
+} WE_OS_Mutex_t;
+
+typedef struct WE_OS_Semaphore_t
+{
+    volatile uint32_t count;
+    uint32_t maxCount;
+} WE_OS_Semaphore_t;
+
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief Creates a recursive mutex (may be locked several times by the owning task).
+ *
+ * @param[out] mutexP Mutex to initialize
+ * @return true if successful, false otherwise
+ */
+    extern bool WE_OS_MutexInit(WE_OS_Mutex_t* mutexP);
+
+    /**
+ * @brief Locks a mutex.
+ *
+ * @param[in] mutexP Mutex to lock
+ * @param[in] timeoutMs Maximum time to wait in milliseconds (WE_OS_NO_WAIT, WE_OS_WAIT_FOREVER)
+ * @return true if the mutex has been locked, false on timeout
+ */
+    extern bool WE_OS_MutexLock(WE_OS_Mutex_t* mutexP, uint32_t timeoutMs);
+
+    /**
+ * @brief Unlocks a mutex previously locked by the calling task.
+ *
+ * @param[in] mutexP Mutex to unlock
+ * @return true if successful, false otherwise
+ */
+    extern bool WE_OS_MutexUnlock(WE_OS_Mutex_t* mutexP);
+
+    extern void WE_OS_MutexDeinit(WE_OS_Mutex_t* mutexP);
+
+    /**
+ * @brief Creates a counting semaphore.
+ *
+ * @param[out] semaphoreP Semaphore to initialize
+ * @param[in] initialCount Initial count
+ * @param[in] maxCount Maximum count
+ * @return true if successful, false otherwise
+ */
+    extern bool WE_OS_SemaphoreInit(WE_OS_Semaphore_t* semaphoreP, uint32_t initialCount, uint32_t maxCount);
+
+    /**
+ * @brief Takes a semaphore (decrements its count).
+ *
+ * @param[in] semaphoreP Semaphore to take
+ * @param[in] timeoutMs Maximum time to wait in milliseconds (WE_OS_NO_WAIT, WE_OS_WAIT_FOREVER)
+ * @return true if the semaphore has been taken, false on timeout
+ */
+    extern bool WE_OS_SemaphoreTake(WE_OS_Semaphore_t* semaphoreP, uint32_t timeoutMs);
+
+    /**
+ * @brief Gives a semaphore (increments its count).
+ *
+ * May also be called from interrupt context.
+ *
+ * @param[in] semaphoreP Semaphore to give
+ * @return true if successful, false if the maximum count has been reached
+ */
+    extern bool WE_OS_SemaphoreGive(WE_OS_Semaphore_t* semaphoreP);
+
+    extern void WE_OS_SemaphoreDeinit(WE_OS_Semaphore_t* semaphoreP);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLOBAL_OS_H_INCLUDED */
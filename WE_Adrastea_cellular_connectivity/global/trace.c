@@ -0,0 +1,271 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Binary trace recorder for UART traffic (enabled by defining WE_TRACE).
+ */
+
+#include <string.h>
+
+#include "global.h"
+#include "trace.h"
+
+#ifdef WE_TRACE
+
+/**
+ * @brief Trace ring buffer.
+ */
+static uint8_t WE_Trace_buffer[WE_TRACE_BUFFER_SIZE];
+
+/**
+ * @brief Write position (end of the newest record).
+ */
+static uint32_t WE_Trace_head = 0;
+
+/**
+ * @brief Read position (start of the oldest record).
+ */
+static uint32_t WE_Trace_tail = 0;
+
+/**
+ * @brief Number of bytes used in the ring buffer.
+ */
+static uint32_t WE_Trace_used = 0;
+
+/**
+ * @brief Position of the RX record received bytes may be appended to (-1 if none).
+ */
+static int32_t WE_Trace_openRxRecord = -1;
+
+/**
+ * @brief Time (microseconds) of the last received bytes.
+ */
+static uint32_t WE_Trace_lastRxUsec = 0;
+
+static WE_Trace_Statistics_t WE_Trace_statistics = {0};
+
+static uint32_t WE_Trace_Put(uint32_t position, const uint8_t* data, uint32_t length)
+{
+    uint32_t chunk = WE_TRACE_BUFFER_SIZE - position;
+    if (chunk > length)
+    {
+        chunk = length;
+    }
+    memcpy(&WE_Trace_buffer[position], data, chunk);
+    memcpy(&WE_Trace_buffer[0], data + chunk, length - chunk);
+    return (position + length) % WE_TRACE_BUFFER_SIZE;
+}
+
+static void WE_Trace_Get(uint32_t position, uint8_t* pOut, uint32_t length)
+{
+    uint32_t chunk = WE_TRACE_BUFFER_SIZE - position;
+    if (chunk > length)
+    {
+        chunk = length;
+    }
+    memcpy(pOut, &WE_Trace_buffer[position], chunk);
+    memcpy(pOut + chunk, &WE_Trace_buffer[0], length - chunk);
+}
+
+static uint16_t WE_Trace_GetPayloadLength(uint32_t recordPosition)
+{
+    uint8_t length[2];
+    WE_Trace_Get((recordPosition + 5) % WE_TRACE_BUFFER_SIZE, length, sizeof(length));
+    return (uint16_t)(length[0] | (length[1] << 8));
+}
+
+static void WE_Trace_SetPayloadLength(uint32_t recordPosition, uint16_t payloadLength)
+{
+    uint8_t length[2] = {(uint8_t)payloadLength, (uint8_t)(payloadLength >> 8)};
+    WE_Trace_Put((recordPosition + 5) % WE_TRACE_BUFFER_SIZE, length, sizeof(length));
+}
+
+/**
+ * @brief Drops the oldest records until the requested number of bytes is free. Has to be called in a critical section.
+ */
+static void WE_Trace_MakeSpace(uint32_t length)
+{
+    while (WE_TRACE_BUFFER_SIZE - WE_Trace_used < length)
+    {
+        uint32_t recordSize = WE_TRACE_RECORD_HEADER_SIZE + WE_Trace_GetPayloadLength(WE_Trace_tail);
+        if ((int32_t)WE_Trace_tail == WE_Trace_openRxRecord)
+        {
+            WE_Trace_openRxRecord = -1;
+        }
+        WE_Trace_tail = (WE_Trace_tail + recordSize) % WE_TRACE_BUFFER_SIZE;
+        WE_Trace_used -= recordSize;
+        WE_Trace_statistics.overwrittenRecords++;
+    }
+}
+
+/**
+ * @brief Writes a new record. Has to be called in a critical section.
+ */
+static void WE_Trace_Write(WE_Trace_Record_Type_t type, uint32_t timestamp, const uint8_t* data, uint16_t length)
+{
+    if (length > WE_TRACE_BUFFER_SIZE - WE_TRACE_RECORD_HEADER_SIZE)
+    {
+        length = WE_TRACE_BUFFER_SIZE - WE_TRACE_RECORD_HEADER_SIZE;
+        WE_Trace_statistics.truncatedRecords++;
+    }
+
+    WE_Trace_MakeSpace(WE_TRACE_RECORD_HEADER_SIZE + length);
+
+    uint8_t header[WE_TRACE_RECORD_HEADER_SIZE] = {(uint8_t)type, (uint8_t)timestamp, (uint8_t)(timestamp >> 8), (uint8_t)(timestamp >> 16), (uint8_t)(timestamp >> 24), (uint8_t)length, (uint8_t)(length >> 8)};
+    WE_Trace_head = WE_Trace_Put(WE_Trace_head, header, sizeof(header));
+    WE_Trace_head = WE_Trace_Put(WE_Trace_head, data, length);
+    WE_Trace_used += WE_TRACE_RECORD_HEADER_SIZE + length;
+    WE_Trace_statistics.records++;
+}
+
+/**
+ * @brief Clears the trace buffer and writes a start record.
+ */
+void WE_Trace_Init(void)
+{
+    uint32_t state = WE_EnterCriticalSection();
+    WE_Trace_head = 0;
+    WE_Trace_tail = 0;
+    WE_Trace_used = 0;
+    WE_Trace_openRxRecord = -1;
+    memset(&WE_Trace_statistics, 0, sizeof(WE_Trace_statistics));
+    WE_Trace_Write(WE_Trace_Record_Type_Start, WE_GetTickMicroseconds(), NULL, 0);
+    WE_ExitCriticalSection(state);
+}
+
+/**
+ * @brief Adds a record to the trace.
+ *
+ * Only copies the data, no formatting is done. May be called from interrupt context.
+ *
+ * @param[in] type Record type
+ * @param[in] data Payload
+ * @param[in] length Payload length
+ */
+void WE_Trace_Record(WE_Trace_Record_Type_t type, const uint8_t* data, uint16_t length)
+{
+    /* Timestamp taken inside the critical section, so records are stored in timestamp order */
+    uint32_t state = WE_EnterCriticalSection();
+    uint32_t timestamp = WE_GetTickMicroseconds();
+    WE_Trace_Write(type, timestamp, data, length);
+    WE_Trace_openRxRecord = -1;
+    WE_ExitCriticalSection(state);
+}
+
+/**
+ * @brief Adds received bytes to the trace.
+ *
+ * Bytes received within WE_TRACE_RX_GAP_USEC of the previous ones are appended to the previous RX record,
+ * so byte-wise reception does not cost a record header per byte.
+ *
+ * @param[in] data Received bytes
+ * @param[in] length Number of received bytes
+ */
+void WE_Trace_RecordRx(const uint8_t* data, uint16_t length)
+{
+    uint32_t state = WE_EnterCriticalSection();
+    uint32_t timestamp = WE_GetTickMicroseconds();
+
+    bool append = (WE_Trace_openRxRecord >= 0) && (timestamp - WE_Trace_lastRxUsec <= WE_TRACE_RX_GAP_USEC);
+    if (append)
+    {
+        /* May overwrite the open record itself if the buffer is tiny */
+        WE_Trace_MakeSpace(length);
+        append = (WE_Trace_openRxRecord >= 0) && (WE_Trace_GetPayloadLength((uint32_t)WE_Trace_openRxRecord) + length <= WE_TRACE_BUFFER_SIZE - WE_TRACE_RECORD_HEADER_SIZE);
+    }
+
+    if (append)
+    {
+        WE_Trace_head = WE_Trace_Put(WE_Trace_head, data, length);
+        WE_Trace_used += length;
+        WE_Trace_SetPayloadLength((uint32_t)WE_Trace_openRxRecord, (uint16_t)(WE_Trace_GetPayloadLength((uint32_t)WE_Trace_openRxRecord) + length));
+    }
+    else
+    {
+        /* Making space only moves the tail, so the new record starts at the current head */
+        uint32_t position = WE_Trace_head;
+        WE_Trace_Write(WE_Trace_Record_Type_RX, timestamp, data, length);
+        WE_Trace_openRxRecord = (int32_t)position;
+    }
+    WE_Trace_lastRxUsec = timestamp;
+
+    WE_ExitCriticalSection(state);
+}
+
+/**
+ * @brief Removes complete records from the trace and copies them to a buffer (e.g. for sending them to a host).
+ *
+ * @param[out] pOutBuffer Buffer receiving the records
+ * @param[in] bufferSize Size of pOutBuffer
+ *
+ * @return Number of bytes written to pOutBuffer
+ */
+uint32_t WE_Trace_Read(uint8_t* pOutBuffer, uint32_t bufferSize)
+{
+    uint32_t length = 0;
+
+    while (1)
+    {
+        uint32_t state = WE_EnterCriticalSection();
+        if (WE_Trace_used == 0)
+        {
+            WE_ExitCriticalSection(state);
+            break;
+        }
+        uint32_t recordSize = WE_TRACE_RECORD_HEADER_SIZE + WE_Trace_GetPayloadLength(WE_Trace_tail);
+        if (length + recordSize > bufferSize)
+        {
+            WE_ExitCriticalSection(state);
+            break;
+        }
+        if ((int32_t)WE_Trace_tail == WE_Trace_openRxRecord)
+        {
+            WE_Trace_openRxRecord = -1;
+        }
+        WE_Trace_Get(WE_Trace_tail, &pOutBuffer[length], recordSize);
+        WE_Trace_tail = (WE_Trace_tail + recordSize) % WE_TRACE_BUFFER_SIZE;
+        WE_Trace_used -= recordSize;
+        WE_ExitCriticalSection(state);
+
+        length += recordSize;
+    }
+
+    return length;
+}
+
+/**
+ * @brief Returns the trace statistics.
+ *
+ * @param[out] statisticsP Statistics are returned in this argument
+ */
+void WE_Trace_GetStatistics(WE_Trace_Statistics_t* statisticsP)
+{
+    uint32_t state = WE_EnterCriticalSection();
+    *statisticsP = WE_Trace_statistics;
+    WE_ExitCriticalSection(state);
+}
+
+#endif /* WE_TRACE */
@@ -0,0 +1,101 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Binary trace recorder for UART traffic (enabled by defining WE_TRACE).
+ *
+ * Records are stored in a RAM ring buffer, the oldest records are overwritten when the buffer is full.
+ * Each record consists of a 7 byte header followed by the payload:
+ * - type (1 byte, see WE_Trace_Record_Type_t)
+ * - timestamp in microseconds (uint32_t, little endian, see WE_GetTickMicroseconds())
+ * - payload length (uint16_t, little endian)
+ *
+ * WE_Trace_Read() returns complete records in this format, tools/trace_decode.py decodes them on the host.
+ */
+
+#ifndef GLOBAL_TRACE_H_INCLUDED
+#define GLOBAL_TRACE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef WE_TRACE_BUFFER_SIZE
+/**
+ * @brief Size of the trace ring buffer in bytes.
+ */
+#define WE_TRACE_BUFFER_SIZE 4096
+#endif
+
+#ifndef WE_TRACE_RX_GAP_USEC
+/**
+ * @brief Received bytes are appended to the previous RX record unless the line has been idle for longer than this (microseconds).
+ */
+#define WE_TRACE_RX_GAP_USEC 500
+#endif
+
+/**
+ * @brief Size of the header preceding the payload of each record.
+ */
+#define WE_TRACE_RECORD_HEADER_SIZE 7
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+ * @brief Trace record types.
+ */
+    typedef enum WE_Trace_Record_Type_t
+    {
+        WE_Trace_Record_Type_Start = 0,  /**< Trace has been (re)started, payload is empty */
+        WE_Trace_Record_Type_TX = 1,     /**< Bytes sent to the radio module */
+        WE_Trace_Record_Type_RX = 2,     /**< Bytes received from the radio module */
+        WE_Trace_Record_Type_Marker = 3, /**< Application defined marker text */
+        WE_Trace_Record_Type_Log = 4     /**< Log record, see log.h */
+    } WE_Trace_Record_Type_t;
+
+    /**
+ * @brief Trace statistics.
+ */
+    typedef struct WE_Trace_Statistics_t
+    {
+        uint32_t records;            /**< Records written */
+        uint32_t overwrittenRecords; /**< Records overwritten before being read */
+        uint32_t truncatedRecords;   /**< Records whose payload has been cut to fit the buffer */
+    } WE_Trace_Statistics_t;
+
+    extern void WE_Trace_Init(void);
+    extern void WE_Trace_Record(WE_Trace_Record_Type_t type, const uint8_t* data, uint16_t length);
+    extern void WE_Trace_RecordRx(const uint8_t* data, uint16_t length);
+    extern uint32_t WE_Trace_Read(uint8_t* pOutBuffer, uint32_t bufferSize);
+    extern void WE_Trace_GetStatistics(WE_Trace_Statistics_t* statisticsP);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLOBAL_TRACE_H_INCLUDED */
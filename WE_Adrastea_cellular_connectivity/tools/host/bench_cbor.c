@@ -0,0 +1,245 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+
+/**
+ * @file
+ * @brief Size and encoding time of the CBOR telemetry payloads (AdrasteaI_Telemetry.h) compared to sprintf().
+ *
+ * First checks the encoder (cbor.h) against the examples of RFC 8949 appendix A. Half precision is not used by the
+ * encoder, so the floating point examples encoded as half precision in the RFC are left out. Then encodes each
+ * telemetry structure with the encoder and as comma separated text with sprintf() and reports the payload size and
+ * the time per payload on this host.
+ *
+ * Usage: bench_cbor [repetitions]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "AdrasteaI_Telemetry.h"
+
+static uint32_t Bench_failures = 0;
+
+/**
+ * @brief Compares the encoded bytes to the expected hex string of RFC 8949 appendix A.
+ */
+static void Bench_CheckVector(const char* name, const WE_CBOR_Encoder_t* encoderP, const char* expected)
+{
+    char encoded[2 * 32 + 1] = {0};
+    for (size_t i = 0; (i < encoderP->length) && (i < 32); i++)
+    {
+        sprintf(encoded + 2 * i, "%02x", encoderP->buffer[i]);
+    }
+
+    if (!WE_CBOR_IsValid(encoderP) || (strcmp(encoded, expected) != 0))
+    {
+        printf("%-50s FAILED: %s, expected %s\n", name, encoded, expected);
+        Bench_failures++;
+    }
+}
+
+/* Encodes the items of __VA_ARGS__ (using the encoder "e") and compares them to the expected hex string */
+#define BENCH_VECTOR(expected, ...)                    \
+    do                                                 \
+    {                                                  \
+        uint8_t buffer[32];                            \
+        WE_CBOR_Encoder_t e;                           \
+        WE_CBOR_Init(&e, buffer, sizeof(buffer));      \
+        __VA_ARGS__;                                   \
+        Bench_CheckVector(#__VA_ARGS__, &e, expected); \
+        vectors++;                                     \
+    } while (0)
+
+static void Bench_CheckVectors(void)
+{
+    uint32_t vectors = 0;
+
+    BENCH_VECTOR("00", WE_CBOR_EncodeUInt(&e, 0));
+    BENCH_VECTOR("0a", WE_CBOR_EncodeUInt(&e, 10));
+    BENCH_VECTOR("17", WE_CBOR_EncodeUInt(&e, 23));
+    BENCH_VECTOR("1818", WE_CBOR_EncodeUInt(&e, 24));
+    BENCH_VECTOR("1864", WE_CBOR_EncodeUInt(&e, 100));
+    BENCH_VECTOR("1903e8", WE_CBOR_EncodeUInt(&e, 1000));
+    BENCH_VECTOR("1a000f4240", WE_CBOR_EncodeUInt(&e, 1000000));
+    BENCH_VECTOR("1b000000e8d4a51000", WE_CBOR_EncodeUInt(&e, 1000000000000ull));
+    BENCH_VECTOR("1bffffffffffffffff", WE_CBOR_EncodeUInt(&e, UINT64_MAX));
+    BENCH_VECTOR("3b7fffffffffffffff", WE_CBOR_EncodeInt(&e, INT64_MIN));
+    BENCH_VECTOR("20", WE_CBOR_EncodeInt(&e, -1));
+    BENCH_VECTOR("29", WE_CBOR_EncodeInt(&e, -10));
+    BENCH_VECTOR("3863", WE_CBOR_EncodeInt(&e, -100));
+    BENCH_VECTOR("3903e7", WE_CBOR_EncodeInt(&e, -1000));
+    BENCH_VECTOR("fb3ff199999999999a", WE_CBOR_EncodeDouble(&e, 1.1));
+    BENCH_VECTOR("fa47c35000", WE_CBOR_EncodeDouble(&e, 100000.0));
+    BENCH_VECTOR("fa7f7fffff", WE_CBOR_EncodeFloat(&e, 3.4028234663852886e+38f));
+    BENCH_VECTOR("fb7e37e43c8800759c", WE_CBOR_EncodeDouble(&e, 1.0e+300));
+    BENCH_VECTOR("fbc010666666666666", WE_CBOR_EncodeDouble(&e, -4.1));
+    BENCH_VECTOR("f4", WE_CBOR_EncodeBool(&e, false));
+    BENCH_VECTOR("f5", WE_CBOR_EncodeBool(&e, true));
+    BENCH_VECTOR("f6", WE_CBOR_EncodeNull(&e));
+    BENCH_VECTOR("c11a514b67b0", WE_CBOR_EncodeTag(&e, 1), WE_CBOR_EncodeUInt(&e, 1363896240));
+    BENCH_VECTOR("40", WE_CBOR_EncodeBytes(&e, NULL, 0));
+    BENCH_VECTOR("4401020304", WE_CBOR_EncodeBytes(&e, (const uint8_t*)"\x01\x02\x03\x04", 4));
+    BENCH_VECTOR("60", WE_CBOR_EncodeString(&e, ""));
+    BENCH_VECTOR("6161", WE_CBOR_EncodeString(&e, "a"));
+    BENCH_VECTOR("6449455446", WE_CBOR_EncodeString(&e, "IETF"));
+    BENCH_VECTOR("62225c", WE_CBOR_EncodeString(&e, "\"\\"));
+    BENCH_VECTOR("62c3bc", WE_CBOR_EncodeString(&e, "\xc3\xbc"));
+    BENCH_VECTOR("80", WE_CBOR_StartArray(&e, 0));
+    BENCH_VECTOR("83010203", WE_CBOR_StartArray(&e, 3), WE_CBOR_EncodeUInt(&e, 1), WE_CBOR_EncodeUInt(&e, 2), WE_CBOR_EncodeUInt(&e, 3));
+    BENCH_VECTOR("8301820203820405", WE_CBOR_StartArray(&e, 3), WE_CBOR_EncodeUInt(&e, 1), WE_CBOR_StartArray(&e, 2), WE_CBOR_EncodeUInt(&e, 2), WE_CBOR_EncodeUInt(&e, 3), WE_CBOR_StartArray(&e, 2), WE_CBOR_EncodeUInt(&e, 4),
+                 WE_CBOR_EncodeUInt(&e, 5));
+    BENCH_VECTOR("a0", WE_CBOR_StartMap(&e, 0));
+    BENCH_VECTOR("a201020304", WE_CBOR_StartMap(&e, 2), WE_CBOR_EncodeUInt(&e, 1), WE_CBOR_EncodeUInt(&e, 2), WE_CBOR_EncodeUInt(&e, 3), WE_CBOR_EncodeUInt(&e, 4));
+    BENCH_VECTOR("a26161016162820203", WE_CBOR_StartMap(&e, 2), WE_CBOR_EncodeString(&e, "a"), WE_CBOR_EncodeUInt(&e, 1), WE_CBOR_EncodeString(&e, "b"), WE_CBOR_StartArray(&e, 2), WE_CBOR_EncodeUInt(&e, 2),
+                 WE_CBOR_EncodeUInt(&e, 3));
+    uint32_t passed = vectors - Bench_failures;
+
+    /* An item that does not fit is not written and marks the encoder as overflowed */
+    uint8_t buffer[4];
+    WE_CBOR_Encoder_t e;
+    WE_CBOR_Init(&e, buffer, sizeof(buffer));
+    bool ok = WE_CBOR_EncodeUInt(&e, 1) && !WE_CBOR_EncodeString(&e, "abcd") && (WE_CBOR_GetLength(&e) == 1) && !WE_CBOR_IsValid(&e);
+    if (!ok)
+    {
+        printf("%-50s FAILED\n", "overflow");
+        Bench_failures++;
+    }
+
+    printf("RFC 8949 appendix A: %u of %u examples ok, overflow %s\n\n", passed, vectors, ok ? "ok" : "FAILED");
+}
+
+static double Bench_GetTimeNsec(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+static void Bench_Report(const char* name, size_t cborLength, double cborTime, int textLength, double textTime)
+{
+    printf("%-25s %6zu %10.1f %6d %10.1f\n", name, cborLength, cborTime, textLength, textTime);
+    if (cborLength == 0)
+    {
+        Bench_failures++;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int repetitions = (argc > 1) ? atoi(argv[1]) : 1000000;
+    if (repetitions <= 0)
+    {
+        repetitions = 1;
+    }
+
+    Bench_CheckVectors();
+
+    AdrasteaI_ATNetService_Signal_Quality_t signalQuality = {.rssi = 17, .ber = 99};
+    AdrasteaI_ATNetService_Extended_Signal_Quality_t extendedSignalQuality = {.rxlev = 99, .ber = 99, .rscp = 255, .ecno = 255, .rsrq = 21, .rsrp = 45};
+    AdrasteaI_ATGNSS_Fix_t fix;
+    memset(&fix, 0, sizeof(fix));
+    fix.fixType = AdrasteaI_ATGNSS_Fix_Type_MSA;
+    fix.latitude = 49.123456;
+    fix.longitude = 9.654321;
+    fix.altitude = 312.5;
+    fix.utcTimestamp = 1760000000ull;
+    fix.accuracy = 3.2f;
+    fix.speed = 0.0f;
+    fix.ephType = AdrasteaI_ATGNSS_Ephemeris_BEP;
+
+    static uint8_t payload[128];
+    static char text[160];
+    WE_CBOR_Encoder_t encoder;
+    volatile size_t sink = 0;
+    double start, cborTime, textTime;
+    int textLength = 0;
+
+    printf("%-25s %6s %10s %6s %10s\n", "", "CBOR", "time (ns)", "text", "time (ns)");
+
+    /* The measured value is changed in every iteration so that the compiler cannot hoist the encoding */
+    start = Bench_GetTimeNsec();
+    for (int i = 0; i < repetitions; i++)
+    {
+        signalQuality.rssi = (uint8_t)(i & 31);
+        WE_CBOR_Init(&encoder, payload, sizeof(payload));
+        AdrasteaI_Telemetry_EncodeSignalQuality(&encoder, &signalQuality);
+        sink += WE_CBOR_GetLength(&encoder);
+    }
+    cborTime = (Bench_GetTimeNsec() - start) / repetitions;
+    start = Bench_GetTimeNsec();
+    for (int i = 0; i < repetitions; i++)
+    {
+        signalQuality.rssi = (uint8_t)(i & 31);
+        textLength = sprintf(text, "%d,%d", -113 + 2 * signalQuality.rssi, signalQuality.ber);
+        sink += textLength;
+    }
+    textTime = (Bench_GetTimeNsec() - start) / repetitions;
+    Bench_Report("signal quality", WE_CBOR_IsValid(&encoder) ? WE_CBOR_GetLength(&encoder) : 0, cborTime, textLength, textTime);
+
+    start = Bench_GetTimeNsec();
+    for (int i = 0; i < repetitions; i++)
+    {
+        extendedSignalQuality.rsrp = (uint8_t)(i % 98);
+        WE_CBOR_Init(&encoder, payload, sizeof(payload));
+        AdrasteaI_Telemetry_EncodeExtendedSignalQuality(&encoder, &extendedSignalQuality);
+        sink += WE_CBOR_GetLength(&encoder);
+    }
+    cborTime = (Bench_GetTimeNsec() - start) / repetitions;
+    start = Bench_GetTimeNsec();
+    for (int i = 0; i < repetitions; i++)
+    {
+        extendedSignalQuality.rsrp = (uint8_t)(i % 98);
+        textLength = sprintf(text, "%d,%d,%d,%d,%d,%d", extendedSignalQuality.rxlev, extendedSignalQuality.ber, extendedSignalQuality.rscp, extendedSignalQuality.ecno, extendedSignalQuality.rsrq, extendedSignalQuality.rsrp);
+        sink += textLength;
+    }
+    textTime = (Bench_GetTimeNsec() - start) / repetitions;
+    Bench_Report("extended signal quality", WE_CBOR_IsValid(&encoder) ? WE_CBOR_GetLength(&encoder) : 0, cborTime, textLength, textTime);
+
+    start = Bench_GetTimeNsec();
+    for (int i = 0; i < repetitions; i++)
+    {
+        fix.latitude += 1e-6;
+        WE_CBOR_Init(&encoder, payload, sizeof(payload));
+        AdrasteaI_Telemetry_EncodeGNSSFix(&encoder, &fix);
+        sink += WE_CBOR_GetLength(&encoder);
+    }
+    cborTime = (Bench_GetTimeNsec() - start) / repetitions;
+    start = Bench_GetTimeNsec();
+    for (int i = 0; i < repetitions; i++)
+    {
+        fix.latitude += 1e-6;
+        textLength = sprintf(text, "%d,%llu,%.6f,%.6f,%.3f,%.3f,%.3f,%d", fix.fixType, (unsigned long long)fix.utcTimestamp, (double)fix.latitude, (double)fix.longitude, (double)fix.altitude, (double)fix.accuracy, (double)fix.speed, fix.ephType);
+        sink += textLength;
+    }
+    textTime = (Bench_GetTimeNsec() - start) / repetitions;
+    Bench_Report("GNSS fix", WE_CBOR_IsValid(&encoder) ? WE_CBOR_GetLength(&encoder) : 0, cborTime, textLength, textTime);
+
+    printf("\nsize in bytes and time per payload on this host, text: comma separated values formatted with sprintf()\n");
+
+    return (Bench_failures != 0) ? 1 : 0;
+}
@@ -0,0 +1,184 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+
+/**
+ * @file
+ * @brief Publication rate of AdrasteaI_MQTTPublisher_PublishBinary() with a full window compared to stop-and-wait.
+ *
+ * Publishes the same messages twice to the simulated module, which confirms each publication with a PUBCONF
+ * notification after the broker round trip. The first run keeps up to ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE messages
+ * in flight, the second one waits for the acknowledgement of each message before publishing the next one (window of
+ * one). The rates are measured in virtual time until the last acknowledgement, the stop-and-wait estimate of
+ * AdrasteaI_MQTTPublisher_GetStatistics() after the first run is reported for comparison.
+ *
+ * Usage: bench_mqtt_publisher [baudrate] [module latency (us)] [broker round trip (us)]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ATMQTT.h"
+#include "AdrasteaI_MQTTPublisher.h"
+#include "host_module.h"
+
+#define BENCH_CONN_ID 1
+#define BENCH_TOPIC "bench/publisher"
+#define BENCH_MESSAGE_COUNT 200
+#define BENCH_PAYLOAD_SIZE 64
+
+static uint32_t Bench_roundTripUsec = 100000;
+static uint16_t Bench_messageID = 0;
+static uint32_t Bench_received = 0;
+static uint32_t Bench_malformed = 0;
+static uint32_t Bench_completed = 0;
+static uint32_t Bench_acknowledged = 0;
+
+static bool Bench_PayloadHandler(const uint8_t* payload, uint32_t length, char* response, uint16_t responseSize)
+{
+    uint32_t sequence;
+
+    if (length != BENCH_PAYLOAD_SIZE)
+    {
+        Bench_malformed++;
+        return false;
+    }
+
+    memcpy(&sequence, payload, sizeof(sequence));
+    if (sequence != Bench_received % BENCH_MESSAGE_COUNT)
+    {
+        Bench_malformed++;
+    }
+    Bench_received++;
+
+    char line[64];
+    Bench_messageID = (Bench_messageID % 0xFFFF) + 1;
+    snprintf(line, sizeof(line), "%%MQTTEVU:\"PUBCONF\",%u,%u,0", BENCH_CONN_ID, Bench_messageID);
+    HostModule_SendURCDelayed(line, Bench_roundTripUsec);
+
+    snprintf(response, responseSize, "%%MQTTCMD:%u", Bench_messageID);
+    return true;
+}
+
+/**
+ * @brief Reads the payload announced by AT%MQTTCMD="PUBLISH" commands.
+ */
+static bool Bench_CommandHandler(const char* command, char* response, uint16_t responseSize)
+{
+    unsigned int connID, retain, qos, length;
+    int offset;
+
+    if (sscanf(command, "AT%%MQTTCMD=\"PUBLISH\",%u,%u,%u,\"" BENCH_TOPIC "\",%u%n", &connID, &retain, &qos, &length, &offset) != 4)
+    {
+        return HostModule_DefaultCommandHandler(command, response, responseSize);
+    }
+
+    if ((connID != BENCH_CONN_ID) || (qos != AdrasteaI_ATMQTT_QoS_At_Least_Once) || (command[offset] != '\0'))
+    {
+        Bench_malformed++;
+        return false;
+    }
+
+    HostModule_ExpectPayload(length, Bench_PayloadHandler);
+    return true;
+}
+
+static void Bench_Callback(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_Message_ID_t msgID, AdrasteaI_MQTTPublisher_Result_t result, void* contextP)
+{
+    Bench_completed++;
+    if (result == AdrasteaI_MQTTPublisher_Result_Success)
+    {
+        Bench_acknowledged++;
+    }
+}
+
+/**
+ * @brief Publishes BENCH_MESSAGE_COUNT messages and returns the rate in messages per second (0 on failure).
+ *
+ * @param[in] stopAndWait If true, the acknowledgement of each message is awaited before publishing the next one
+ */
+static double Bench_Run(const char* name, bool stopAndWait)
+{
+    AdrasteaI_ATMQTT_Topic_Name_t topicName = BENCH_TOPIC;
+    uint8_t payload[BENCH_PAYLOAD_SIZE];
+    HostModule_Statistics_t startStatistics, statistics;
+    bool ok = true;
+
+    memset(payload, 0x5A, sizeof(payload));
+    Bench_completed = 0;
+    Bench_acknowledged = 0;
+    HostModule_GetStatistics(&startStatistics);
+    uint64_t startTime = HostModule_GetTimeUsec();
+
+    for (uint32_t sequence = 0; ok && (sequence < BENCH_MESSAGE_COUNT); sequence++)
+    {
+        memcpy(payload, &sequence, sizeof(sequence));
+        ok = AdrasteaI_MQTTPublisher_PublishBinary(BENCH_CONN_ID, AdrasteaI_ATMQTT_QoS_At_Least_Once, AdrasteaI_ATMQTT_Retain_Not_Retained, topicName, payload, sizeof(payload), ADRASTEAI_MQTT_PUBLISHER_ACK_TIMEOUT_MS, Bench_Callback, NULL, NULL);
+        if (ok && stopAndWait)
+        {
+            ok = AdrasteaI_MQTTPublisher_Flush(ADRASTEAI_MQTT_PUBLISHER_ACK_TIMEOUT_MS);
+        }
+    }
+    ok = ok && AdrasteaI_MQTTPublisher_Flush(ADRASTEAI_MQTT_PUBLISHER_ACK_TIMEOUT_MS);
+
+    uint64_t duration = HostModule_GetTimeUsec() - startTime;
+    HostModule_GetStatistics(&statistics);
+    ok = ok && (Bench_acknowledged == BENCH_MESSAGE_COUNT) && (Bench_completed == BENCH_MESSAGE_COUNT) && (Bench_malformed == 0);
+    double rate = BENCH_MESSAGE_COUNT * 1e6 / duration;
+
+    printf("%-24s %6s %8u %10.1f %10.1f\n", name, ok ? "ok" : "FAILED", statistics.commands - startStatistics.commands, duration / 1000.0, rate);
+    return ok ? rate : 0;
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t baudrate = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 115200;
+    uint32_t latencyUsec = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 2000;
+    Bench_roundTripUsec = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 0) : 100000;
+
+    HostModule_Reset(baudrate, latencyUsec, Bench_CommandHandler);
+    if (!HostModule_InitDriver(NULL))
+    {
+        printf("driver initialization failed\n");
+        return 1;
+    }
+
+    printf("%u baud, module latency %u us, broker round trip %u us, %u messages of %u bytes\n\n", baudrate, latencyUsec, Bench_roundTripUsec, BENCH_MESSAGE_COUNT, BENCH_PAYLOAD_SIZE);
+    printf("%-24s %6s %8s %10s %10s\n", "", "acks", "commands", "time (ms)", "msg/s");
+
+    char name[64];
+    snprintf(name, sizeof(name), "window %u", ADRASTEAI_MQTT_PUBLISHER_WINDOW_SIZE);
+    double windowRate = Bench_Run(name, false);
+
+    AdrasteaI_MQTTPublisher_Statistics_t statistics;
+    AdrasteaI_MQTTPublisher_GetStatistics(&statistics);
+
+    double stopAndWaitRate = Bench_Run("window 1 (stop-and-wait)", true);
+
+    printf("\nspeedup %.2f, stop-and-wait estimated by the publisher statistics %.1f msg/s\n", (stopAndWaitRate > 0) ? windowRate / stopAndWaitRate : 0.0, statistics.stopAndWaitRatePerSecondX100 / 100.0);
+
+    return ((windowRate > 0) && (stopAndWaitRate > 0)) ? 0 : 1;
+}
@@ -0,0 +1,232 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Throughput of AdrasteaI_ATSocket_SendBinaryToSocket() and AdrasteaI_ATSocket_SendStream() compared to
+ * AdrasteaI_ATSocket_SendToSocket().
+ *
+ * Sends the same amount of data with each function to the simulated module, checks that the module has received
+ * the data unchanged and reports the goodput (payload bytes per second) in virtual time. The simulation does not
+ * account for the time the MCU needs for encoding, which is what preparing the next command with
+ * AdrasteaI_ATSocket_SendStream() hides; it is measured on the host separately.
+ *
+ * Usage: bench_socket_send [baudrate] [module latency (us)]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ATCommands.h"
+#include "ATSocket.h"
+#include "host_module.h"
+
+#define BENCH_DATA_SIZE (16 * 1024)
+#define BENCH_SOCKET_ID 1
+
+static uint8_t Bench_received[BENCH_DATA_SIZE];
+static uint32_t Bench_receivedLength = 0;
+
+static int Bench_HexDigit(char c)
+{
+    if ((c >= '0') && (c <= '9'))
+    {
+        return c - '0';
+    }
+    if ((c >= 'A') && (c <= 'F'))
+    {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+/**
+ * @brief Stores the data of AT%SOCKETDATA="SEND" commands, which is either text or hex encoded.
+ */
+static bool Bench_CommandHandler(const char* command, char* response, uint16_t responseSize)
+{
+    unsigned int socketID, length;
+    int offset;
+
+    if (sscanf(command, "AT%%SOCKETDATA=\"SEND\",%u,%u,\"%n", &socketID, &length, &offset) != 2)
+    {
+        return HostModule_DefaultCommandHandler(command, response, responseSize);
+    }
+
+    const char* data = command + offset;
+    size_t dataLength = strlen(data);
+    if ((dataLength == 0) || (data[dataLength - 1] != '"') || (Bench_receivedLength + length > sizeof(Bench_received)))
+    {
+        return false;
+    }
+    dataLength--;
+
+    if (dataLength == 2 * length)
+    {
+        for (unsigned int i = 0; i < length; i++)
+        {
+            int high = Bench_HexDigit(data[2 * i]);
+            int low = Bench_HexDigit(data[2 * i + 1]);
+            if ((high < 0) || (low < 0))
+            {
+                return false;
+            }
+            Bench_received[Bench_receivedLength++] = (uint8_t)((high << 4) | low);
+        }
+    }
+    else if (dataLength == length)
+    {
+        memcpy(Bench_received + Bench_receivedLength, data, length);
+        Bench_receivedLength += length;
+    }
+    else
+    {
+        return false;
+    }
+
+    snprintf(response, responseSize, "%%SOCKETDATA:%u,%u", socketID, length);
+    return true;
+}
+
+static void Bench_Report(const char* name, bool ok, const uint8_t* data, uint64_t startTime, const HostModule_Statistics_t* startStatisticsP)
+{
+    HostModule_Statistics_t statistics;
+    HostModule_GetStatistics(&statistics);
+    uint64_t duration = HostModule_GetTimeUsec() - startTime;
+    uint32_t txBytes = statistics.txBytes - startStatisticsP->txBytes;
+    bool match = ok && (Bench_receivedLength == BENCH_DATA_SIZE) && (memcmp(Bench_received, data, BENCH_DATA_SIZE) == 0);
+
+    printf("%-30s %6s %8u %10u %10.1f %10.0f %6.2f %6u\n", name, match ? "ok" : "FAILED", statistics.commands - startStatisticsP->commands, txBytes, duration / 1000.0, BENCH_DATA_SIZE * 1e6 / duration, (double)BENCH_DATA_SIZE / txBytes,
+           statistics.txBufferModifications - startStatisticsP->txBufferModifications);
+}
+
+/**
+ * @brief Returns the time (us) the host needs for hex encoding one segment.
+ */
+static double Bench_EncodeTimeUsec(const uint8_t* data)
+{
+    static char encoded[2 * ADRASTEAI_ATSOCKET_HEX_SEGMENT_SIZE];
+    const int repetitions = 10000;
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < repetitions; i++)
+    {
+        ATCommand_EncodeHex(data + i % 64, ADRASTEAI_ATSOCKET_HEX_SEGMENT_SIZE, encoded);
+        __asm__ volatile("" : : "r"(encoded) : "memory");
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / 1000.0 / repetitions;
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t baudrate = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 115200;
+    uint32_t latencyUsec = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 2000;
+
+    static uint8_t binary[BENCH_DATA_SIZE];
+    static uint8_t text[BENCH_DATA_SIZE];
+    for (uint32_t i = 0; i < BENCH_DATA_SIZE; i++)
+    {
+        binary[i] = (uint8_t)(i * 131 + (i >> 8));
+        text[i] = (uint8_t)('A' + i % 26);
+    }
+
+    HostModule_Reset(baudrate, latencyUsec, Bench_CommandHandler);
+    if (!HostModule_InitDriver(NULL))
+    {
+        printf("driver initialization failed\n");
+        return 1;
+    }
+
+    printf("%u baud, module latency %u us, %u bytes, hex segment size %u bytes\n\n", baudrate, latencyUsec, BENCH_DATA_SIZE, ADRASTEAI_ATSOCKET_HEX_SEGMENT_SIZE);
+    printf("%-30s %6s %8s %10s %10s %10s %6s %6s\n", "", "data", "commands", "UART bytes", "time (ms)", "goodput", "eff.", "tx mod");
+
+    bool failed = false;
+    const uint32_t waitTimeSteps[] = {5000, 100};
+    for (size_t step = 0; step < sizeof(waitTimeSteps) / sizeof(waitTimeSteps[0]); step++)
+    {
+        char name[64];
+        HostModule_Statistics_t startStatistics;
+        uint64_t startTime;
+        bool ok;
+
+        AdrasteaI_SetTimingParameters(waitTimeSteps[step], 3000);
+
+        /* Text: one command per ADRASTEAI_MAX_PAYLOAD_SIZE characters, the data may not contain quotes or line breaks */
+        Bench_receivedLength = 0;
+        HostModule_GetStatistics(&startStatistics);
+        startTime = HostModule_GetTimeUsec();
+        ok = true;
+        for (uint32_t offset = 0; ok && (offset < BENCH_DATA_SIZE); offset += ADRASTEAI_MAX_PAYLOAD_SIZE)
+        {
+            char segment[ADRASTEAI_MAX_PAYLOAD_SIZE + 1];
+            uint16_t length = (BENCH_DATA_SIZE - offset > ADRASTEAI_MAX_PAYLOAD_SIZE) ? ADRASTEAI_MAX_PAYLOAD_SIZE : (uint16_t)(BENCH_DATA_SIZE - offset);
+            memcpy(segment, text + offset, length);
+            segment[length] = '\0';
+            ok = AdrasteaI_ATSocket_SendToSocket(BENCH_SOCKET_ID, segment, length);
+        }
+        snprintf(name, sizeof(name), "SendToSocket (text), %u us", waitTimeSteps[step]);
+        Bench_Report(name, ok, text, startTime, &startStatistics);
+        failed |= !ok;
+
+        Bench_receivedLength = 0;
+        HostModule_GetStatistics(&startStatistics);
+        startTime = HostModule_GetTimeUsec();
+        ok = AdrasteaI_ATSocket_SendBinaryToSocket(BENCH_SOCKET_ID, binary, BENCH_DATA_SIZE);
+        snprintf(name, sizeof(name), "SendBinaryToSocket, %u us", waitTimeSteps[step]);
+        Bench_Report(name, ok, binary, startTime, &startStatistics);
+        failed |= !ok || (Bench_receivedLength != BENCH_DATA_SIZE) || (memcmp(Bench_received, binary, BENCH_DATA_SIZE) != 0);
+
+        /* Same segments, the command for the next segment is prepared while the current one is pending */
+        static char segmentBuffer[AT_MAX_COMMAND_BUFFER_SIZE];
+        AdrasteaI_ATSocket_Send_Stream_t stream = {0};
+        stream.socketID = BENCH_SOCKET_ID;
+        stream.data = binary;
+        stream.dataLength = BENCH_DATA_SIZE;
+        stream.segmentBuffer = segmentBuffer;
+        stream.segmentBufferSize = sizeof(segmentBuffer);
+        Bench_receivedLength = 0;
+        HostModule_GetStatistics(&startStatistics);
+        startTime = HostModule_GetTimeUsec();
+        ok = AdrasteaI_ATSocket_SendStream(&stream);
+        snprintf(name, sizeof(name), "SendStream (prepared), %u us", waitTimeSteps[step]);
+        Bench_Report(name, ok, binary, startTime, &startStatistics);
+        failed |= !ok || (Bench_receivedLength != BENCH_DATA_SIZE) || (memcmp(Bench_received, binary, BENCH_DATA_SIZE) != 0);
+    }
+
+    HostModule_Statistics_t statistics;
+    HostModule_GetStatistics(&statistics);
+    failed |= (statistics.txBufferModifications != 0);
+
+    printf("\ngoodput: payload bytes per second, eff.: payload bytes per UART byte, tx mod: transmit buffers modified in flight\n");
+    printf("the time is the wait time step of the driver (AdrasteaI_SetTimingParameters())\n");
+    printf("hex encoding of one segment takes %.1f us on this host, transmitting it takes %.1f ms\n", Bench_EncodeTimeUsec(binary), 2 * ADRASTEAI_ATSOCKET_HEX_SEGMENT_SIZE * 10 * 1000.0 / baudrate);
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,494 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Simulated Adrastea-I module for running the driver on a host.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "global.h"
+#include "host_module.h"
+
+#define HOST_MODULE_RX_QUEUE_SIZE 65536
+#define HOST_MODULE_LINE_SIZE 8192
+#define HOST_MODULE_RESPONSE_SIZE 4096
+#define HOST_MODULE_PAYLOAD_SIZE 65536
+#define HOST_MODULE_DELAYED_URC_COUNT 64
+#define HOST_MODULE_URC_SIZE 128
+
+/* Firmware version expected by the driver (see AdrasteaI.c) */
+extern uint8_t AdrasteaI_firmwareVersionMajor;
+extern uint16_t AdrasteaI_firmwareVersionMinor;
+
+static uint64_t HostModule_now = 0;
+static uint32_t HostModule_baudrate = 115200;
+static uint32_t HostModule_latencyUsec = 0;
+static HostModule_CommandHandler_t HostModule_handler = HostModule_DefaultCommandHandler;
+static WE_UART_HandleRxByte_t* HostModule_rxByteHandlerP = NULL;
+static HostModule_Statistics_t HostModule_statistics = {0};
+
+/* Characters sent to the driver and the time at which their reception is complete */
+static uint8_t HostModule_rxData[HOST_MODULE_RX_QUEUE_SIZE];
+static uint64_t HostModule_rxTime[HOST_MODULE_RX_QUEUE_SIZE];
+static uint32_t HostModule_rxHead = 0;
+static uint32_t HostModule_rxTail = 0;
+static uint64_t HostModule_rxEnd = 0;
+static bool HostModule_delivering = false;
+
+/* URCs to be sent later (see HostModule_SendURCDelayed()), in the order they have been requested */
+static struct
+{
+    uint64_t time;
+    char line[HOST_MODULE_URC_SIZE];
+} HostModule_delayedURCs[HOST_MODULE_DELAYED_URC_COUNT];
+static uint32_t HostModule_delayedURCCount = 0;
+
+/* Transfer started by the driver, kept to detect modifications of the buffer before it is completed */
+static const uint8_t* HostModule_txData = NULL;
+static uint8_t HostModule_txCopy[UINT16_MAX];
+static uint16_t HostModule_txLength = 0;
+static uint64_t HostModule_txEnd = 0;
+
+static char HostModule_line[HOST_MODULE_LINE_SIZE];
+static uint16_t HostModule_lineLength = 0;
+static bool HostModule_lineOverflow = false;
+
+/* Raw payload announced by the command handler (see HostModule_ExpectPayload()) */
+static HostModule_PayloadHandler_t HostModule_payloadHandler = NULL;
+static uint8_t HostModule_payload[HOST_MODULE_PAYLOAD_SIZE];
+static uint32_t HostModule_payloadLength = 0;
+static uint32_t HostModule_payloadReceived = 0;
+static bool HostModule_payloadExpected = false;
+
+/**
+ * @brief Returns the time needed to transfer the given number of characters (10 bits each).
+ */
+static uint64_t HostModule_CharacterTime(uint64_t count) { return (count * 10 * 1000000 + HostModule_baudrate - 1) / HostModule_baudrate; }
+
+/**
+ * @brief Queues characters to be sent to the driver, starting not before the given time.
+ */
+static void HostModule_Send(const char* data, uint16_t length, uint64_t startTime)
+{
+    uint64_t start = (startTime > HostModule_rxEnd) ? startTime : HostModule_rxEnd;
+    for (uint16_t i = 0; i < length; i++)
+    {
+        uint32_t next = (HostModule_rxHead + 1) % HOST_MODULE_RX_QUEUE_SIZE;
+        if (next == HostModule_rxTail)
+        {
+            fprintf(stderr, "host module: RX queue overflow\n");
+            abort();
+        }
+        HostModule_rxData[HostModule_rxHead] = (uint8_t)data[i];
+        HostModule_rxTime[HostModule_rxHead] = start + HostModule_CharacterTime(i + 1);
+        HostModule_rxHead = next;
+    }
+    HostModule_rxEnd = start + HostModule_CharacterTime(length);
+}
+
+/**
+ * @brief Queues the delayed URCs that are due at the given time, earliest first.
+ *
+ * Is called while the module is idle only. The module does not send URCs while it is processing a command, the
+ * driver would take them for a part of the response.
+ */
+static void HostModule_ReleaseURCs(uint64_t time)
+{
+    while (HostModule_delayedURCCount > 0)
+    {
+        uint32_t next = 0;
+        for (uint32_t i = 1; i < HostModule_delayedURCCount; i++)
+        {
+            if (HostModule_delayedURCs[i].time < HostModule_delayedURCs[next].time)
+            {
+                next = i;
+            }
+        }
+        if (HostModule_delayedURCs[next].time > time)
+        {
+            return;
+        }
+
+        char text[HOST_MODULE_URC_SIZE + 4];
+        int length = snprintf(text, sizeof(text), "\r\n%s\r\n", HostModule_delayedURCs[next].line);
+        uint64_t urcTime = HostModule_delayedURCs[next].time;
+
+        HostModule_delayedURCCount--;
+        memmove(&HostModule_delayedURCs[next], &HostModule_delayedURCs[next + 1], (HostModule_delayedURCCount - next) * sizeof(HostModule_delayedURCs[0]));
+        HostModule_Send(text, (uint16_t)length, urcTime);
+    }
+}
+
+/**
+ * @brief Answers the commands sent by AdrasteaI_Init() and confirms all other commands without response text.
+ *
+ * Command handlers of the host programs should call this function for the commands they do not handle themselves.
+ */
+bool HostModule_DefaultCommandHandler(const char* command, char* response, uint16_t responseSize)
+{
+    if (strcmp(command, "AT+CGMR") == 0)
+    {
+        snprintf(response, responseSize, "MAPSDK_%u.%u", AdrasteaI_firmwareVersionMajor, AdrasteaI_firmwareVersionMinor);
+    }
+    return true;
+}
+
+/**
+ * @brief Sends the response text (if any) and the result code, starting after the latency.
+ */
+static void HostModule_Respond(bool ok, const char* response, uint64_t time)
+{
+    static char text[HOST_MODULE_RESPONSE_SIZE + 16];
+
+    int length = (response[0] != '\0') ? snprintf(text, sizeof(text), "\r\n%s\r\n", response) : 0;
+    length += snprintf(text + length, sizeof(text) - length, "\r\n%s\r\n", ok ? "OK" : "ERROR");
+    HostModule_Send(text, (uint16_t)length, time + HostModule_latencyUsec);
+}
+
+/**
+ * @brief Makes the simulated module read a raw payload after the current command line.
+ *
+ * Is called by a command handler. The module echoes the payload and answers the command after the last payload byte
+ * with the response of the payload handler, the response of the command handler is discarded.
+ *
+ * @param[in] length Number of payload bytes (at most HOST_MODULE_PAYLOAD_SIZE)
+ * @param[in] handler Handler called with the complete payload
+ */
+void HostModule_ExpectPayload(uint32_t length, HostModule_PayloadHandler_t handler)
+{
+    if (length > HOST_MODULE_PAYLOAD_SIZE)
+    {
+        fprintf(stderr, "host module: payload of %u bytes exceeds %u bytes\n", length, HOST_MODULE_PAYLOAD_SIZE);
+        abort();
+    }
+
+    HostModule_payloadHandler = handler;
+    HostModule_payloadLength = length;
+    HostModule_payloadReceived = 0;
+    HostModule_payloadExpected = true;
+}
+
+/**
+ * @brief Answers the payload once it has been received completely.
+ */
+static void HostModule_HandlePayload(uint64_t time)
+{
+    static char response[HOST_MODULE_RESPONSE_SIZE];
+
+    HostModule_payloadExpected = false;
+
+    response[0] = '\0';
+    bool ok = HostModule_payloadHandler(HostModule_payload, HostModule_payloadLength, response, sizeof(response));
+    HostModule_Respond(ok, response, time);
+}
+
+/**
+ * @brief Answers a complete command line received at the given time.
+ */
+static void HostModule_HandleLine(uint64_t time)
+{
+    static char response[HOST_MODULE_RESPONSE_SIZE];
+
+    HostModule_statistics.commands++;
+
+    response[0] = '\0';
+    HostModule_payloadExpected = false;
+    bool ok = !HostModule_lineOverflow && HostModule_handler(HostModule_line, response, sizeof(response));
+
+    if (!ok || !HostModule_payloadExpected)
+    {
+        HostModule_payloadExpected = false;
+        HostModule_Respond(ok, response, time);
+    }
+    else if (HostModule_payloadLength == 0)
+    {
+        HostModule_HandlePayload(time);
+    }
+}
+
+/**
+ * @brief Receives a character transmitted by the driver at the given time.
+ */
+static void HostModule_Receive(uint8_t c, uint64_t time)
+{
+    /* Commands and payloads are echoed */
+    HostModule_Send((const char*)&c, 1, time);
+
+    if (HostModule_payloadExpected)
+    {
+        HostModule_payload[HostModule_payloadReceived++] = c;
+        if (HostModule_payloadReceived == HostModule_payloadLength)
+        {
+            HostModule_HandlePayload(time);
+        }
+        return;
+    }
+
+    if ((c == '\n') && (HostModule_lineLength > 0) && (HostModule_line[HostModule_lineLength - 1] == '\r'))
+    {
+        HostModule_line[HostModule_lineLength - 1] = '\0';
+        HostModule_HandleLine(time);
+        HostModule_lineLength = 0;
+        HostModule_lineOverflow = false;
+        return;
+    }
+
+    if (HostModule_lineLength < sizeof(HostModule_line) - 1)
+    {
+        HostModule_line[HostModule_lineLength++] = (char)c;
+    }
+    else
+    {
+        HostModule_lineOverflow = true;
+    }
+}
+
+/**
+ * @brief Completes the pending transfer if it ends before the given time.
+ */
+static void HostModule_CompleteTransfer(uint64_t time)
+{
+    if ((HostModule_txData != NULL) && (HostModule_txEnd <= time))
+    {
+        if (memcmp(HostModule_txData, HostModule_txCopy, HostModule_txLength) != 0)
+        {
+            HostModule_statistics.txBufferModifications++;
+        }
+        HostModule_txData = NULL;
+    }
+}
+
+/**
+ * @brief Lets time pass until the given time, delivering the characters received by the driver in the meantime.
+ */
+static void HostModule_AdvanceTo(uint64_t time)
+{
+    if ((HostModule_lineLength == 0) && !HostModule_payloadExpected)
+    {
+        HostModule_ReleaseURCs(time);
+    }
+
+    if (!HostModule_delivering)
+    {
+        /* The receive handler may transmit, which must not deliver characters recursively */
+        HostModule_delivering = true;
+        while ((HostModule_rxTail != HostModule_rxHead) && (HostModule_rxTime[HostModule_rxTail] <= time))
+        {
+            uint64_t arrival = HostModule_rxTime[HostModule_rxTail];
+            HostModule_CompleteTransfer(arrival);
+            if (arrival > HostModule_now)
+            {
+                HostModule_now = arrival;
+            }
+
+            uint8_t c = HostModule_rxData[HostModule_rxTail];
+            HostModule_rxTail = (HostModule_rxTail + 1) % HOST_MODULE_RX_QUEUE_SIZE;
+            HostModule_statistics.rxBytes++;
+            if ((HostModule_rxByteHandlerP != NULL) && (*HostModule_rxByteHandlerP != NULL))
+            {
+                (*HostModule_rxByteHandlerP)(&c, 1);
+            }
+        }
+        HostModule_delivering = false;
+    }
+
+    HostModule_CompleteTransfer(time);
+    if (time > HostModule_now)
+    {
+        HostModule_now = time;
+    }
+}
+
+/**
+ * @brief Resets the simulated module and the virtual clock.
+ *
+ * @param[in] baudrate Baud rate of the UART
+ * @param[in] latencyUsec Time between the reception of a command line and the start of the response
+ * @param[in] handler Command handler (NULL for HostModule_DefaultCommandHandler())
+ */
+void HostModule_Reset(uint32_t baudrate, uint32_t latencyUsec, HostModule_CommandHandler_t handler)
+{
+    HostModule_now = 0;
+    HostModule_baudrate = baudrate;
+    HostModule_latencyUsec = latencyUsec;
+    HostModule_handler = (handler != NULL) ? handler : HostModule_DefaultCommandHandler;
+    memset(&HostModule_statistics, 0, sizeof(HostModule_statistics));
+    HostModule_rxHead = 0;
+    HostModule_rxTail = 0;
+    HostModule_rxEnd = 0;
+    HostModule_txData = NULL;
+    HostModule_txEnd = 0;
+    HostModule_lineLength = 0;
+    HostModule_lineOverflow = false;
+    HostModule_payloadExpected = false;
+    HostModule_delayedURCCount = 0;
+}
+
+/**
+ * @brief Initializes the driver with the simulated module (see AdrasteaI_Init()).
+ *
+ * @param[in] eventCallback Event callback passed to the driver (optional)
+ *
+ * @return true if successful, false otherwise
+ */
+bool HostModule_InitDriver(AdrasteaI_EventCallback_t eventCallback)
+{
+    static WE_UART_t uart;
+    static AdrasteaI_Pins_t pins;
+
+    uart.uartInit = WE_UART1_Init;
+    uart.uartDeinit = WE_UART1_DeInit;
+    uart.uartTransmit = WE_UART1_Transmit;
+    uart.baudrate = HostModule_baudrate;
+    uart.flowControl = WE_FlowControl_NoFlowControl;
+    uart.parity = WE_Parity_None;
+    pins.AdrasteaI_Pin_Reset = WE_PIN((void*)1);
+    pins.AdrasteaI_Pin_WakeUp = WE_PIN((void*)2);
+
+    return AdrasteaI_Init(&uart, &pins, eventCallback);
+}
+
+/**
+ * @brief Sends an unsolicited result code to the driver.
+ *
+ * @param[in] line Text of the URC without line breaks
+ */
+void HostModule_SendURC(const char* line)
+{
+    char text[HOST_MODULE_RESPONSE_SIZE];
+    int length = snprintf(text, sizeof(text), "\r\n%s\r\n", line);
+    HostModule_Send(text, (uint16_t)length, HostModule_now);
+}
+
+/**
+ * @brief Sends an unsolicited result code to the driver after the given time, e.g. to model the round trip to a
+ * server. A URC that becomes due while a command is processed is sent after its response.
+ *
+ * @param[in] line Text of the URC without line breaks
+ * @param[in] delayUsec Time from now until the URC is sent
+ */
+void HostModule_SendURCDelayed(const char* line, uint32_t delayUsec)
+{
+    if ((HostModule_delayedURCCount >= HOST_MODULE_DELAYED_URC_COUNT) || (strlen(line) >= HOST_MODULE_URC_SIZE))
+    {
+        fprintf(stderr, "host module: delayed URC queue overflow\n");
+        abort();
+    }
+
+    HostModule_delayedURCs[HostModule_delayedURCCount].time = HostModule_now + delayUsec;
+    strcpy(HostModule_delayedURCs[HostModule_delayedURCCount].line, line);
+    HostModule_delayedURCCount++;
+}
+
+/**
+ * @brief Returns the current time of the virtual clock in microseconds.
+ */
+uint64_t HostModule_GetTimeUsec(void) { return HostModule_now; }
+
+/**
+ * @brief Returns the statistics of the simulated module.
+ */
+void HostModule_GetStatistics(HostModule_Statistics_t* statisticsP) { *statisticsP = HostModule_statistics; }
+
+/* Platform functions (see global.h) */
+
+bool WE_InitPins(WE_Pin_t pins[], uint8_t numPins)
+{
+    UNUSED(pins);
+    UNUSED(numPins);
+    return true;
+}
+
+bool WE_DeinitPin(WE_Pin_t pin)
+{
+    UNUSED(pin);
+    return true;
+}
+
+bool WE_SetPin(WE_Pin_t pin, WE_Pin_Level_t out)
+{
+    UNUSED(pin);
+    UNUSED(out);
+    return true;
+}
+
+void WE_Delay(uint16_t sleepForMs) { HostModule_AdvanceTo(HostModule_now + (uint64_t)sleepForMs * 1000); }
+
+void WE_DelayMicroseconds(uint32_t sleepForUsec) { HostModule_AdvanceTo(HostModule_now + sleepForUsec); }
+
+uint32_t WE_GetTick() { return (uint32_t)(HostModule_now / 1000); }
+
+uint32_t WE_GetTickMicroseconds() { return (uint32_t)HostModule_now; }
+
+uint32_t WE_EnterCriticalSection(void) { return 0; }
+
+void WE_ExitCriticalSection(uint32_t state) { UNUSED(state); }
+
+bool WE_UART1_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t* rxByteHandlerP)
+{
+    UNUSED(flowControl);
+    UNUSED(parity);
+
+    HostModule_baudrate = baudrate;
+    HostModule_rxByteHandlerP = rxByteHandlerP;
+
+    /* The module reports that it is ready after start up */
+    HostModule_SendURC("%SCMNOTIFYEV:\"READY\"");
+    return true;
+}
+
+bool WE_UART1_DeInit()
+{
+    HostModule_rxByteHandlerP = NULL;
+    return true;
+}
+
+bool WE_UART1_Transmit(const uint8_t* data, uint16_t length)
+{
+    if ((data == NULL) || (length == 0))
+    {
+        return false;
+    }
+
+    /* Wait for the previous transfer to be completed */
+    HostModule_AdvanceTo(HostModule_txEnd);
+
+    HostModule_txData = data;
+    HostModule_txLength = length;
+    memcpy(HostModule_txCopy, data, length);
+    HostModule_txEnd = HostModule_now + HostModule_CharacterTime(length);
+    HostModule_statistics.txBytes += length;
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        HostModule_Receive(data[i], HostModule_now + HostModule_CharacterTime(i + 1));
+    }
+
+    return true;
+}
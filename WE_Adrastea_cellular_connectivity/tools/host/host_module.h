@@ -0,0 +1,92 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Simulated Adrastea-I module for running the driver on a host.
+ *
+ * Implements the platform functions of global.h on top of a virtual clock. The UART is modelled at the configured
+ * baud rate (10 bits per character, full duplex): Transmitting takes time, and a transfer has to be completed before
+ * the next one is started, as on the target. The simulated module echoes every command line and answers it after a
+ * fixed processing latency with the response text returned by the command handler followed by OK or ERROR. Commands
+ * followed by a raw payload (e.g. AT%MQTTCMD="PUBLISH") are answered after the payload, which is echoed as well.
+ * Unsolicited result codes can be sent right away or after a delay.
+ *
+ * Time only passes in WE_Delay(), WE_DelayMicroseconds() and while waiting for the UART, i.e. the results do not
+ * depend on the speed of the host.
+ */
+
+#ifndef HOST_MODULE_H_INCLUDED
+#define HOST_MODULE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "AdrasteaI.h"
+
+/**
+ * @brief Handles a command line received by the simulated module.
+ *
+ * @param[in] command Command line without the line break (null terminated)
+ * @param[out] response Response text sent before the result code, lines separated by "\r\n" (empty for no response)
+ * @param[in] responseSize Size of the response buffer
+ *
+ * @return true to answer with OK, false to answer with ERROR
+ */
+typedef bool (*HostModule_CommandHandler_t)(const char* command, char* response, uint16_t responseSize);
+
+/**
+ * @brief Handles a raw payload received by the simulated module (see HostModule_ExpectPayload()).
+ *
+ * @param[in] payload Payload
+ * @param[in] length Length of the payload
+ * @param[out] response Response text sent before the result code (empty for no response)
+ * @param[in] responseSize Size of the response buffer
+ *
+ * @return true to answer with OK, false to answer with ERROR
+ */
+typedef bool (*HostModule_PayloadHandler_t)(const uint8_t* payload, uint32_t length, char* response, uint16_t responseSize);
+
+/**
+ * @brief Statistics of the simulated module.
+ */
+typedef struct HostModule_Statistics_t
+{
+    uint32_t commands;              /**< Command lines received */
+    uint32_t txBytes;               /**< Bytes transmitted by the driver */
+    uint32_t rxBytes;               /**< Bytes sent to the driver */
+    uint32_t txBufferModifications; /**< Transmit buffers modified by the driver before the transfer was completed */
+} HostModule_Statistics_t;
+
+extern bool HostModule_DefaultCommandHandler(const char* command, char* response, uint16_t responseSize);
+extern void HostModule_Reset(uint32_t baudrate, uint32_t latencyUsec, HostModule_CommandHandler_t handler);
+extern bool HostModule_InitDriver(AdrasteaI_EventCallback_t eventCallback);
+extern void HostModule_ExpectPayload(uint32_t length, HostModule_PayloadHandler_t handler);
+extern void HostModule_SendURC(const char* line);
+extern void HostModule_SendURCDelayed(const char* line, uint32_t delayUsec);
+extern uint64_t HostModule_GetTimeUsec(void);
+extern void HostModule_GetStatistics(HostModule_Statistics_t* statisticsP);
+
+#endif /* HOST_MODULE_H_INCLUDED */
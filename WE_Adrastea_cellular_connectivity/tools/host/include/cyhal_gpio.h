@@ -0,0 +1 @@
+/* Stand-in for the HAL header included by AdrasteaI.c, the host programs do not use the GPIOs. */
@@ -0,0 +1,131 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+
+/**
+ * @file
+ * @brief Checks AdrasteaI_ATMQTT_PublishBinary() with payloads the RX line framer must not interpret.
+ *
+ * The simulated module echoes the payload. Payloads containing line breaks, result codes or URCs and payloads longer
+ * than ADRASTEAI_LINE_MAX_SIZE must be published unchanged, confirmed with the message ID reported by the module and
+ * must not affect the following command.
+ *
+ * Usage: test_mqtt_publish_binary
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ATMQTT.h"
+#include "host_module.h"
+
+#define TEST_CONN_ID 1
+#define TEST_TOPIC "test/binary"
+
+static uint8_t Test_received[8192];
+static uint32_t Test_receivedLength = 0;
+static uint16_t Test_messageID = 0;
+static AdrasteaI_ATMQTT_Topic_Name_t Test_topic = TEST_TOPIC;
+
+static bool Test_PayloadHandler(const uint8_t* payload, uint32_t length, char* response, uint16_t responseSize)
+{
+    if (length > sizeof(Test_received))
+    {
+        return false;
+    }
+
+    memcpy(Test_received, payload, length);
+    Test_receivedLength = length;
+    snprintf(response, responseSize, "%%MQTTCMD:%u", ++Test_messageID);
+    return true;
+}
+
+/**
+ * @brief Reads the payload announced by AT%MQTTCMD="PUBLISH" commands.
+ */
+static bool Test_CommandHandler(const char* command, char* response, uint16_t responseSize)
+{
+    unsigned int connID, retain, qos, length;
+    int offset;
+
+    if (sscanf(command, "AT%%MQTTCMD=\"PUBLISH\",%u,%u,%u,\"" TEST_TOPIC "\",%u%n", &connID, &retain, &qos, &length, &offset) != 4)
+    {
+        return HostModule_DefaultCommandHandler(command, response, responseSize);
+    }
+
+    if ((connID != TEST_CONN_ID) || (command[offset] != '\0'))
+    {
+        return false;
+    }
+
+    HostModule_ExpectPayload(length, Test_PayloadHandler);
+    return true;
+}
+
+static bool Test_Publish(const char* name, const uint8_t* payload, uint32_t length)
+{
+    AdrasteaI_ATMQTT_Message_ID_t msgID;
+    uint16_t expectedMsgID = Test_messageID + 1;
+
+    Test_receivedLength = 0;
+    bool ok = AdrasteaI_ATMQTT_PublishBinary(TEST_CONN_ID, AdrasteaI_ATMQTT_QoS_At_Least_Once, AdrasteaI_ATMQTT_Retain_Not_Retained, Test_topic, payload, length, &msgID);
+    ok = ok && (Test_receivedLength == length) && (memcmp(Test_received, payload, length) == 0) && (msgID == expectedMsgID);
+
+    /* The next command must not be disturbed by the echo of the payload */
+    ok = ok && AdrasteaI_ATMQTT_PublishBinary(TEST_CONN_ID, AdrasteaI_ATMQTT_QoS_At_Least_Once, AdrasteaI_ATMQTT_Retain_Not_Retained, Test_topic, (const uint8_t*)"next", 4, &msgID);
+    ok = ok && (Test_receivedLength == 4) && (memcmp(Test_received, "next", 4) == 0) && (msgID == expectedMsgID + 1);
+
+    printf("%-40s %6u %s\n", name, length, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main(void)
+{
+    HostModule_Reset(115200, 2000, Test_CommandHandler);
+    if (!HostModule_InitDriver(NULL))
+    {
+        printf("driver initialization failed\n");
+        return 1;
+    }
+
+    bool failed = false;
+    static uint8_t payload[6000];
+
+    failed |= !Test_Publish("empty", payload, 0);
+
+    const char* text = "\r\nERROR\r\n";
+    failed |= !Test_Publish("result code ERROR", (const uint8_t*)text, strlen(text));
+
+    text = "\r\nOK\r\n\r\n%MQTTEVU:\"PUBRCV\",1,1\r\n";
+    failed |= !Test_Publish("result code OK and URC", (const uint8_t*)text, strlen(text));
+
+    for (uint32_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = (uint8_t)(i * 131 + (i >> 8));
+    }
+    failed |= !Test_Publish("binary, longer than ADRASTEAI_LINE_MAX_SIZE", payload, sizeof(payload));
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,423 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+
+/**
+ * @file
+ * @brief Checks the store-and-forward queue (AdrasteaI_MQTTQueue.h) with a file-backed flash (file_flash.h).
+ *
+ * The queue drains through the real publisher and AT command layer to the simulated module, which confirms the
+ * publications with PUBCONF notifications. Covered are persistence across restarts, in-order draining, publishing
+ * again after a failed delivery, messages published while connected whose acknowledgement fails or is lost with the
+ * connection, overflow, recovery from a torn write and wear levelling. No flash memory may be
+ * programmed without being erased first.
+ *
+ * Usage: test_mqtt_queue [flash file]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ATMQTT.h"
+#include "AdrasteaI_MQTTPublisher.h"
+#include "AdrasteaI_MQTTQueue.h"
+#include "file_flash.h"
+#include "host_module.h"
+
+#define TEST_CONN_ID 1
+#define TEST_TOPIC "dev/t"
+#define TEST_SECTOR_SIZE 4096
+#define TEST_SECTOR_COUNT 4
+#define TEST_WRITE_ALIGNMENT 16
+#define TEST_MAX_SEQUENCE 8192
+
+static const char* Test_flashPath = "build/test_mqtt_queue.flash";
+static WE_Flash_t Test_flash;
+
+/* Erase operations per sector, counted in the flash interface */
+static WE_Flash_EraseSector_t Test_eraseSector;
+static uint32_t Test_sectorErases[TEST_SECTOR_COUNT];
+
+/* Publications received by the module, by sequence number (first four payload bytes) */
+static uint8_t Test_receivedCount[TEST_MAX_SEQUENCE];
+static int32_t Test_lastSequence = -1;
+static uint32_t Test_outOfOrder = 0;
+static uint32_t Test_malformed = 0;
+
+/* Message whose first delivery is reported as failed (-1 for none) */
+static int32_t Test_failSequence = -1;
+
+/* PUBCONF notifications to be sent by the module */
+static struct
+{
+    uint16_t msgID;
+    bool failed;
+} Test_confirmations[64];
+static uint32_t Test_confirmationCount = 0;
+static uint16_t Test_messageID = 0;
+
+static bool Test_failed = false;
+
+static bool Test_PayloadHandler(const uint8_t* payload, uint32_t length, char* response, uint16_t responseSize)
+{
+    uint32_t sequence;
+
+    if ((length < 4) || (Test_confirmationCount >= sizeof(Test_confirmations) / sizeof(Test_confirmations[0])))
+    {
+        Test_malformed++;
+        return false;
+    }
+
+    memcpy(&sequence, payload, sizeof(sequence));
+    if ((sequence >= TEST_MAX_SEQUENCE) || (length != 4 + sequence % 50))
+    {
+        Test_malformed++;
+        return false;
+    }
+
+    /* Publishing again restarts at the failed message */
+    bool failed = ((int32_t)sequence == Test_failSequence) && (Test_receivedCount[sequence] == 0);
+    if (((int32_t)sequence <= Test_lastSequence) && ((int32_t)sequence != Test_failSequence))
+    {
+        Test_outOfOrder++;
+    }
+    Test_lastSequence = (int32_t)sequence;
+    Test_receivedCount[sequence]++;
+
+    Test_messageID = (Test_messageID % 0xFFFF) + 1;
+    Test_confirmations[Test_confirmationCount].msgID = Test_messageID;
+    Test_confirmations[Test_confirmationCount].failed = failed;
+    Test_confirmationCount++;
+
+    snprintf(response, responseSize, "%%MQTTCMD:%u", Test_messageID);
+    return true;
+}
+
+static bool Test_CommandHandler(const char* command, char* response, uint16_t responseSize)
+{
+    unsigned int connID, retain, qos, length;
+    int offset;
+
+    if (sscanf(command, "AT%%MQTTCMD=\"PUBLISH\",%u,%u,%u,\"" TEST_TOPIC "\",%u%n", &connID, &retain, &qos, &length, &offset) != 4)
+    {
+        return HostModule_DefaultCommandHandler(command, response, responseSize);
+    }
+
+    if ((connID != TEST_CONN_ID) || (qos != AdrasteaI_ATMQTT_QoS_At_Least_Once) || (command[offset] != '\0'))
+    {
+        Test_malformed++;
+        return false;
+    }
+
+    HostModule_ExpectPayload(length, Test_PayloadHandler);
+    return true;
+}
+
+static void Test_Check(const char* name, bool ok)
+{
+    AdrasteaI_MQTTQueue_Statistics_t statistics;
+    WE_FileFlash_Statistics_t flashStatistics;
+    AdrasteaI_MQTTQueue_GetStatistics(&statistics);
+    WE_FileFlash_GetStatistics(&flashStatistics);
+
+    ok = ok && (flashStatistics.programViolations == 0) && (Test_outOfOrder == 0) && (Test_malformed == 0);
+    printf("%-20s pending %4u queued %4u delivered %4u dropped %4u republished %2u erases %u..%u %s\n", name, statistics.pending, statistics.queued, statistics.delivered, statistics.dropped, statistics.republished, statistics.minSectorEraseCount,
+           statistics.maxSectorEraseCount, ok ? "ok" : "FAILED");
+    Test_failed |= !ok;
+}
+
+static bool Test_EraseSector(uint32_t address)
+{
+    Test_sectorErases[address / TEST_SECTOR_SIZE]++;
+    return Test_eraseSector(address);
+}
+
+/**
+ * @brief Simulates a restart: The flash file is reopened and the queue is initialized from its content.
+ */
+static void Test_Restart(void)
+{
+    WE_FileFlash_Close();
+    if (!WE_FileFlash_Open(Test_flashPath, TEST_SECTOR_COUNT * TEST_SECTOR_SIZE, TEST_SECTOR_SIZE, TEST_WRITE_ALIGNMENT, &Test_flash))
+    {
+        printf("opening the flash file failed\n");
+        exit(1);
+    }
+
+    Test_eraseSector = Test_flash.flashEraseSector;
+    Test_flash.flashEraseSector = Test_EraseSector;
+    if (!AdrasteaI_MQTTQueue_Init(&Test_flash, 0, TEST_SECTOR_COUNT))
+    {
+        printf("queue initialization failed\n");
+        exit(1);
+    }
+    Test_confirmationCount = 0;
+}
+
+static void Test_SetConnected(bool connected)
+{
+    HostModule_SendURC(connected ? "%MQTTEVU:\"CONCONF\",1,0" : "%MQTTEVU:\"DISCONF\",1,0");
+    WE_Delay(10);
+}
+
+static uint32_t Test_nextSequence = 0;
+
+static void Test_Publish(uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++, Test_nextSequence++)
+    {
+        uint8_t payload[64];
+        memset(payload, 0xA5, sizeof(payload));
+        memcpy(payload, &Test_nextSequence, sizeof(Test_nextSequence));
+        AdrasteaI_ATMQTT_Topic_Name_t topicName = TEST_TOPIC;
+        if (!AdrasteaI_MQTTQueue_Publish(TEST_CONN_ID, AdrasteaI_ATMQTT_QoS_At_Least_Once, AdrasteaI_ATMQTT_Retain_Not_Retained, topicName, payload, 4 + Test_nextSequence % 50))
+        {
+            printf("publishing message %u failed\n", Test_nextSequence);
+            Test_failed = true;
+        }
+    }
+}
+
+/**
+ * @brief Processes the queue for the given time while the module confirms the publications.
+ *
+ * A failed delivery is reported after the confirmations of the following messages, so these have been delivered
+ * when the queue restarts draining at the failed message.
+ */
+static void Test_Run(uint32_t durationMs)
+{
+    for (uint32_t t = 0; t < durationMs; t += 10)
+    {
+        char line[64];
+        int32_t failedIndex = -1;
+
+        for (uint32_t i = 0; i < Test_confirmationCount; i++)
+        {
+            if (Test_confirmations[i].failed)
+            {
+                failedIndex = (int32_t)i;
+                continue;
+            }
+            snprintf(line, sizeof(line), "%%MQTTEVU:\"PUBCONF\",1,%u,0", Test_confirmations[i].msgID);
+            HostModule_SendURC(line);
+        }
+
+        if ((failedIndex >= 0) && (failedIndex == (int32_t)Test_confirmationCount - 1))
+        {
+            /* Wait for the following messages */
+            Test_confirmations[0] = Test_confirmations[failedIndex];
+            Test_confirmationCount = 1;
+        }
+        else
+        {
+            if (failedIndex >= 0)
+            {
+                snprintf(line, sizeof(line), "%%MQTTEVU:\"PUBCONF\",1,%u,1", Test_confirmations[failedIndex].msgID);
+                HostModule_SendURC(line);
+            }
+            Test_confirmationCount = 0;
+        }
+
+        WE_Delay(10);
+        AdrasteaI_MQTTQueue_Process();
+    }
+}
+
+/**
+ * @brief Returns true if the messages in the given range have been received exactly once.
+ */
+static bool Test_ReceivedOnce(uint32_t first, uint32_t end)
+{
+    for (uint32_t sequence = first; sequence < end; sequence++)
+    {
+        if (Test_receivedCount[sequence] != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Closes the flash file and reads its content.
+ */
+static bool Test_ReadFlashFile(uint8_t* content, FILE** fileP)
+{
+    WE_FileFlash_Close();
+    *fileP = fopen(Test_flashPath, "r+b");
+    return (*fileP != NULL) && (fread(content, 1, TEST_SECTOR_COUNT * TEST_SECTOR_SIZE, *fileP) == TEST_SECTOR_COUNT * TEST_SECTOR_SIZE);
+}
+
+/**
+ * @brief Erases the end of the record written since the given flash content has been read, as if the power had been
+ * lost while programming it.
+ */
+static bool Test_TearRecord(const uint8_t* before)
+{
+    static uint8_t content[TEST_SECTOR_COUNT * TEST_SECTOR_SIZE];
+    FILE* file;
+
+    bool ok = Test_ReadFlashFile(content, &file);
+
+    uint32_t end = sizeof(content);
+    while ((end > 0) && (content[end - 1] == before[end - 1]))
+    {
+        end--;
+    }
+    ok = ok && (end >= 8);
+
+    if (ok)
+    {
+        memset(content + end - 8, 0xFF, 8);
+        ok = (fseek(file, 0, SEEK_SET) == 0) && (fwrite(content, 1, sizeof(content), file) == sizeof(content));
+    }
+    return (file != NULL) && (fclose(file) == 0) && ok;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1)
+    {
+        Test_flashPath = argv[1];
+    }
+    remove(Test_flashPath);
+
+    HostModule_Reset(115200, 2000, Test_CommandHandler);
+    if (!HostModule_InitDriver(NULL))
+    {
+        printf("driver initialization failed\n");
+        return 1;
+    }
+
+    AdrasteaI_MQTTQueue_Statistics_t statistics;
+
+    /* Messages published while disconnected survive a restart */
+    Test_Restart();
+    Test_Publish(20);
+    Test_Restart();
+    AdrasteaI_MQTTQueue_GetStatistics(&statistics);
+    Test_Check("persistence", statistics.pending == 20);
+
+    Test_SetConnected(true);
+    Test_Run(2000);
+    AdrasteaI_MQTTQueue_GetStatistics(&statistics);
+    Test_Check("in-order drain", (statistics.pending == 0) && (statistics.delivered == 20) && Test_ReceivedOnce(0, 20));
+
+    /* A failed delivery is repeated, the following messages delivered in the meantime are not */
+    Test_SetConnected(false);
+    uint32_t first = Test_nextSequence;
+    Test_Publish(8);
+    Test_failSequence = (int32_t)first + 2;
+    Test_SetConnected(true);
+    Test_Run(8000);
+    AdrasteaI_MQTTQueue_GetStatistics(&statistics);
+    Test_failSequence = -1;
+    Test_Check("republish", (statistics.pending == 0) && (statistics.republished == 1) && (Test_receivedCount[first + 2] == 2) && Test_ReceivedOnce(first, first + 2) && Test_ReceivedOnce(first + 3, first + 8));
+
+    /* Messages published while connected are sent right away, a failed one is published again */
+    first = Test_nextSequence;
+    uint32_t republished = statistics.republished;
+    Test_failSequence = (int32_t)first + 1;
+    Test_Publish(4);
+    bool sent = Test_ReceivedOnce(first, first + 4);
+    Test_Run(8000);
+    AdrasteaI_MQTTQueue_GetStatistics(&statistics);
+    Test_failSequence = -1;
+    Test_Check("connected, failed", sent && (statistics.pending == 0) && (statistics.republished == republished + 1) && (Test_receivedCount[first + 1] == 2) && Test_ReceivedOnce(first, first + 1) && Test_ReceivedOnce(first + 2, first + 4));
+
+    /* The acknowledgements are lost with the connection, the messages are published again after the timeout */
+    first = Test_nextSequence;
+    Test_Publish(3);
+    sent = Test_ReceivedOnce(first, first + 3);
+    Test_confirmationCount = 0;
+    Test_SetConnected(false);
+    Test_SetConnected(true);
+    /* Publishing again restarts at the first message */
+    Test_lastSequence = (int32_t)first - 1;
+    Test_Run(ADRASTEAI_MQTT_PUBLISHER_ACK_TIMEOUT_MS + 10000);
+    AdrasteaI_MQTTQueue_GetStatistics(&statistics);
+    Test_Check("connection lost", sent && (statistics.pending == 0) && (Test_receivedCount[first] == 2) && (Test_receivedCount[first + 1] == 2) && (Test_receivedCount[first + 2] == 2));
+
+    /* The oldest messages are dropped when the log is full */
+    Test_SetConnected(false);
+    first = Test_nextSequence;
+    Test_Publish(300);
+    Test_Restart();
+    AdrasteaI_MQTTQueue_GetStatistics(&statistics);
+    uint32_t pending = statistics.pending;
+    Test_SetConnected(true);
+    Test_Run(20000);
+    AdrasteaI_MQTTQueue_GetStatistics(&statistics);
+    Test_Check("overflow", (pending > 0) && (pending < 300) && (statistics.pending == 0) && (statistics.delivered == pending) && Test_ReceivedOnce(Test_nextSequence - pending, Test_nextSequence) && (Test_receivedCount[first] == 0));
+
+    /* A torn record is discarded, the log is continued behind it */
+    static uint8_t before[TEST_SECTOR_COUNT * TEST_SECTOR_SIZE];
+    FILE* file;
+    Test_SetConnected(false);
+    first = Test_nextSequence;
+    Test_Publish(4);
+    if (!Test_ReadFlashFile(before, &file) || (fclose(file) != 0))
+    {
+        printf("reading the flash file failed\n");
+        return 1;
+    }
+    Test_Restart();
+    Test_Publish(1);
+    if (!Test_TearRecord(before))
+    {
+        printf("modifying the flash file failed\n");
+        return 1;
+    }
+    Test_Restart();
+    Test_Publish(1);
+    Test_SetConnected(true);
+    Test_Run(2000);
+    AdrasteaI_MQTTQueue_GetStatistics(&statistics);
+    Test_Check("torn write", (statistics.pending == 0) && (statistics.dropped == 1) && Test_ReceivedOnce(first, first + 4) && (Test_receivedCount[first + 4] == 0) && (Test_receivedCount[first + 5] == 1));
+
+    /* All sectors are erased equally often */
+    memset(Test_sectorErases, 0, sizeof(Test_sectorErases));
+    for (uint32_t round = 0; round < 30; round++)
+    {
+        Test_SetConnected(false);
+        Test_Publish(100);
+        Test_Restart();
+        Test_SetConnected(true);
+        Test_Run(5000);
+    }
+    uint32_t minErases = UINT32_MAX, maxErases = 0;
+    for (uint32_t sector = 0; sector < TEST_SECTOR_COUNT; sector++)
+    {
+        minErases = (Test_sectorErases[sector] < minErases) ? Test_sectorErases[sector] : minErases;
+        maxErases = (Test_sectorErases[sector] > maxErases) ? Test_sectorErases[sector] : maxErases;
+    }
+    AdrasteaI_MQTTQueue_GetStatistics(&statistics);
+    printf("sector erases %u..%u\n", minErases, maxErases);
+    Test_Check("wear levelling", (statistics.pending == 0) && (maxErases - minErases <= 1) && (minErases > 10));
+
+    WE_FileFlash_Close();
+    return Test_failed ? 1 : 0;
+}
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+#
+# This file is part of WIRELESS CONNECTIVITY SDK for PSOC6.
+#
+# COPYRIGHT (c) 2025 Wurth Elektronik eiSos GmbH & Co. KG
+#
+# THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+# FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+# IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+#
+"""Decodes UART traces recorded with WE_TRACE (see global/trace.h).
+
+Input is the raw byte stream returned by WE_Trace_Read(), e.g. dumped to a file
+or captured from the debug UART. Each record is printed with its time relative
+to the first record and to the previous record, in microseconds.
+
+Log records (WE_LOG, see global/log.h) contain only the address of their format
+string and the raw arguments; they are formatted using the ".we_log_strings"
+section of the firmware ELF file given with --elf.
+
+Usage: trace_decode.py [--raw] [--elf FIRMWARE.elf] [FILE]   (reads stdin if FILE is omitted)
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+HEADER = struct.Struct("<BIH")
+TYPES = {0: "START", 1: "TX", 2: "RX", 3: "MARK", 4: "LOG"}
+LEVELS = {"1": "E", "2": "W", "3": "I", "4": "D"}
+LOG_SECTION = ".we_log_strings"
+SHT_NOBITS = 8
+SHF_ALLOC = 2
+
+
+def elf_sections(data):
+    """Yields (name, type, flags, address, contents) of the sections of a little endian ELF file."""
+    if data[:4] != b"\x7fELF" or data[5] != 1:
+        raise ValueError("not a little endian ELF file")
+    if data[4] == 1:
+        shoff, = struct.unpack_from("<I", data, 0x20)
+        entry = struct.Struct("<IIIIII")
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+    else:
+        shoff, = struct.unpack_from("<Q", data, 0x28)
+        entry = struct.Struct("<IIQQQQ")
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x3A)
+    headers = [entry.unpack_from(data, shoff + i * shentsize) for i in range(shnum)]
+    names = headers[shstrndx]
+    for name, stype, flags, address, offset, size in headers:
+        start = names[4] + name
+        name = data[start:data.index(b"\0", start)].decode()
+        contents = b"" if stype == SHT_NOBITS else data[offset:offset + size]
+        yield name, stype, flags, address, contents
+
+
+class LogStrings:
+    """Format strings and constant data of a firmware ELF file."""
+
+    def __init__(self, path):
+        self.entries = {}
+        self.memory = []
+        for name, stype, flags, address, contents in elf_sections(open(path, "rb").read()):
+            if name == LOG_SECTION:
+                for offset in range(len(contents)):
+                    if offset == 0 or contents[offset - 1] == 0:
+                        end = contents.index(b"\0", offset)
+                        self.entries[address + offset] = contents[offset:end].decode(errors="replace")
+            elif flags & SHF_ALLOC and contents:
+                self.memory.append((address, contents))
+
+    def string(self, address):
+        for start, contents in self.memory:
+            if start <= address < start + len(contents):
+                offset = address - start
+                end = contents.find(b"\0", offset)
+                return contents[offset:end if end >= 0 else len(contents)].decode(errors="replace")
+        return "<0x%08x>" % address
+
+    def format(self, payload):
+        if len(payload) < 4 or len(payload) % 4:
+            return "<malformed log record %s>" % payload.hex(" ")
+        values = struct.unpack("<%dI" % (len(payload) // 4), payload)
+        entry = self.entries.get(values[0])
+        if entry is None:
+            return "<unknown log entry 0x%08x %s>" % (values[0], " ".join("0x%x" % v for v in values[1:]))
+        level, module, location, fmt = entry.split("\x1f", 3)
+        return "%s %s %s: %s" % (LEVELS.get(level, level), module, location, c_format(fmt, values[1:], self.string))
+
+
+CONVERSION = re.compile(r"%([-+ #0]*)(\d*)(?:\.(\d+))?(hh|h|ll|l|z|j|t)?([diouxXcsp%])")
+
+
+def c_format(fmt, values, string):
+    """Formats 32 bit argument values like printf()."""
+    values = list(values)
+
+    def convert(match):
+        flags, width, precision, _, conversion = match.groups()
+        if conversion == "%":
+            return "%"
+        if not values:
+            return "<missing>"
+        value = values.pop(0)
+        spec = "%" + flags + width + ("." + precision if precision else "")
+        if conversion in "di":
+            return (spec + "d") % (value - (1 << 32) if value & 0x80000000 else value)
+        if conversion == "u":
+            return (spec + "d") % value
+        if conversion == "c":
+            return (spec + "c") % chr(value & 0xFF)
+        if conversion == "s":
+            return (spec + "s") % string(value)
+        if conversion == "p":
+            return "0x%08x" % value
+        return (spec + conversion) % value
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def records(data):
+    """Yields (type, timestamp_us, payload), unwrapping the 32 bit timestamp."""
+    offset = 0
+    last = None
+    wraps = 0
+    while offset + HEADER.size <= len(data):
+        rtype, timestamp, length = HEADER.unpack_from(data, offset)
+        offset += HEADER.size
+        if rtype not in TYPES or offset + length > len(data):
+            sys.stderr.write("corrupt or incomplete record at offset %d, stopping\n" % (offset - HEADER.size))
+            return
+        payload = data[offset:offset + length]
+        offset += length
+        if rtype == 0:
+            # Trace restarted, timestamps may jump
+            wraps = 0
+            last = None
+        # Only a large step back is a wrap of the 32 bit counter (every ~71.6 minutes). A small one
+        # means out of order records, which must not add 2^32 us to every later timestamp.
+        if last is not None and last - timestamp > (1 << 31):
+            wraps += 1
+        last = timestamp
+        yield rtype, timestamp + (wraps << 32), payload
+
+
+def escape(payload):
+    text = []
+    for b in payload:
+        if b == 0x0D:
+            text.append("\\r")
+        elif b == 0x0A:
+            text.append("\\n")
+        elif 0x20 <= b < 0x7F:
+            text.append(chr(b))
+        else:
+            text.append("\\x%02x" % b)
+    return "".join(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("file", nargs="?", help="trace file (default: stdin)")
+    parser.add_argument("--raw", action="store_true", help="print payloads as hex instead of escaped text")
+    parser.add_argument("--elf", help="firmware ELF file containing the log format strings")
+    args = parser.parse_args()
+
+    strings = LogStrings(args.elf) if args.elf else None
+
+    data = open(args.file, "rb").read() if args.file else sys.stdin.buffer.read()
+
+    start = None
+    previous = None
+    for rtype, timestamp, payload in records(data):
+        if start is None or rtype == 0:
+            start = timestamp
+            previous = timestamp
+        if rtype == 4 and strings is not None and not args.raw:
+            text = strings.format(payload)
+        else:
+            text = payload.hex(" ") if args.raw or rtype == 4 else escape(payload)
+        print("%14.6f %+10d us  %-5s %s" % ((timestamp - start) / 1e6, timestamp - previous, TYPES[rtype], text))
+        previous = timestamp
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())